@@ -0,0 +1,34 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "include/bench_timer.h"
+#include "include/bench_core_memory.h"
+#include "include/bench_core_hash.h"
+#include "include/bench_core_string.h"
+#include "include/bench_containers.h"
+#include "include/bench_ring_queue.h"
+#include "include/bench_hash_map.h"
+#include "include/bench_message.h"
+
+// 使用方法: bench [csv|json] (デフォルト: csv)
+int main(int argc, char** argv) {
+    BENCH_OUTPUT_FORMAT format = BENCH_OUTPUT_FORMAT_CSV;
+    if(argc > 1) {
+        if(0 == strcmp(argv[1], "json")) {
+            format = BENCH_OUTPUT_FORMAT_JSON;
+        } else if(0 != strcmp(argv[1], "csv")) {
+            fprintf(stderr, "usage: %s [csv|json]\n", argv[0]);
+            return 1;
+        }
+    }
+    bench_output_begin(format);
+    bench_core_memory();
+    bench_core_hash();
+    bench_core_string();
+    bench_containers();
+    bench_ring_queue();
+    bench_hash_map();
+    bench_message();
+    bench_output_end();
+    return 0;
+}
@@ -0,0 +1,241 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdalign.h>
+
+#include "include/bench_containers.h"
+#include "include/bench_timer.h"
+
+#include "containers/dynamic_array.h"
+#include "containers/dynamic_array_unchecked.h"
+#include "containers/stack.h"
+#include "containers/stack_unchecked.h"
+#include "containers/typed_dynamic_array.h"
+#include "containers/typed_stack.h"
+
+// 1ラウンドあたりの操作回数
+#define BENCH_OP_COUNT (1ull << 20)
+
+// 計測ラウンド数(1ケースの総操作回数はBENCH_OP_COUNT * BENCH_ROUNDS)
+#define BENCH_ROUNDS 8
+
+// push_nで一度に追加する要素数
+#define BENCH_PUSH_N_CHUNK 64
+
+typedef struct bench_elem4_t { uint32_t value[1]; } bench_elem4_t;
+typedef struct bench_elem16_t { uint32_t value[4]; } bench_elem16_t;
+typedef struct bench_elem64_t { uint32_t value[16]; } bench_elem64_t;
+
+DEFINE_DYNAMIC_ARRAY(bench_elem4_array, bench_elem4_t)
+DEFINE_DYNAMIC_ARRAY(bench_elem16_array, bench_elem16_t)
+DEFINE_DYNAMIC_ARRAY(bench_elem64_array, bench_elem64_t)
+DEFINE_STACK(bench_elem4_stack, bench_elem4_t)
+DEFINE_STACK(bench_elem16_stack, bench_elem16_t)
+DEFINE_STACK(bench_elem64_stack, bench_elem64_t)
+
+static void bench_dynamic_array(uint64_t element_size_);
+static void bench_stack(uint64_t element_size_);
+
+// 最適化で計測対象の処理が削除されないよう、結果の一部をここに書き出す
+static volatile uint32_t s_sink;
+
+// 計測用の要素データ(最大要素サイズ分)
+static alignas(8) uint32_t s_elements[BENCH_PUSH_N_CHUNK][16];
+
+// 型特化コンテナ(typed_dynamic_array.h / typed_stack.h)のpush / ref / popを計測する関数を生成する
+#define DEFINE_BENCH_TYPED(elem_t_, array_name_, stack_name_) \
+    static void bench_typed_##elem_t_(void) { \
+        uint64_t push_elapsed = 0; \
+        uint64_t ref_elapsed = 0; \
+        uint64_t stack_push_elapsed = 0; \
+        uint64_t stack_pop_elapsed = 0; \
+        elem_t_ value = { { 0 } }; \
+        uint32_t sum = 0; \
+        for(uint64_t round = 0; round != BENCH_ROUNDS; ++round) { \
+            array_name_##_t array = TYPED_DYNAMIC_ARRAY_INITIALIZER; \
+            stack_name_##_t stack = TYPED_STACK_INITIALIZER; \
+            if(DYNAMIC_ARRAY_SUCCESS != array_name_##_create(BENCH_OP_COUNT, &array) || STACK_ERROR_CODE_SUCCESS != stack_name_##_create(BENCH_OP_COUNT, &stack)) { \
+                fprintf(stderr, "bench_typed - Failed to create containers.\n"); \
+                array_name_##_destroy(&array); \
+                stack_name_##_destroy(&stack); \
+                return; \
+            } \
+            uint64_t start = bench_timer_now_ns(); \
+            for(uint64_t i = 0; i != BENCH_OP_COUNT; ++i) { \
+                value.value[0] = (uint32_t)i; \
+                array_name_##_push(&value, &array); \
+            } \
+            push_elapsed += bench_timer_now_ns() - start; \
+            start = bench_timer_now_ns(); \
+            for(uint64_t i = 0; i != BENCH_OP_COUNT; ++i) { \
+                array_name_##_ref(i, &array, &value); \
+                sum += value.value[0]; \
+            } \
+            ref_elapsed += bench_timer_now_ns() - start; \
+            start = bench_timer_now_ns(); \
+            for(uint64_t i = 0; i != BENCH_OP_COUNT; ++i) { \
+                value.value[0] = (uint32_t)i; \
+                stack_name_##_push(&stack, &value); \
+            } \
+            stack_push_elapsed += bench_timer_now_ns() - start; \
+            start = bench_timer_now_ns(); \
+            for(uint64_t i = 0; i != BENCH_OP_COUNT; ++i) { \
+                stack_name_##_pop(&stack, &value); \
+                sum += value.value[0]; \
+            } \
+            stack_pop_elapsed += bench_timer_now_ns() - start; \
+            array_name_##_destroy(&array); \
+            stack_name_##_destroy(&stack); \
+        } \
+        s_sink = sum; \
+        bench_report("typed_array_push", sizeof(elem_t_), BENCH_OP_COUNT * BENCH_ROUNDS, push_elapsed); \
+        bench_report("typed_array_ref", sizeof(elem_t_), BENCH_OP_COUNT * BENCH_ROUNDS, ref_elapsed); \
+        bench_report("typed_stack_push", sizeof(elem_t_), BENCH_OP_COUNT * BENCH_ROUNDS, stack_push_elapsed); \
+        bench_report("typed_stack_pop", sizeof(elem_t_), BENCH_OP_COUNT * BENCH_ROUNDS, stack_pop_elapsed); \
+    } \
+
+DEFINE_BENCH_TYPED(bench_elem4_t, bench_elem4_array, bench_elem4_stack)
+DEFINE_BENCH_TYPED(bench_elem16_t, bench_elem16_array, bench_elem16_stack)
+DEFINE_BENCH_TYPED(bench_elem64_t, bench_elem64_array, bench_elem64_stack)
+
+void bench_containers(void) {
+    for(uint64_t i = 0; i != BENCH_PUSH_N_CHUNK; ++i) {
+        for(uint64_t j = 0; j != 16; ++j) {
+            s_elements[i][j] = (uint32_t)(i * 16 + j);
+        }
+    }
+    const uint64_t element_sizes[3] = { sizeof(bench_elem4_t), sizeof(bench_elem16_t), sizeof(bench_elem64_t) };
+    for(uint64_t i = 0; i != 3; ++i) {
+        bench_dynamic_array(element_sizes[i]);
+        bench_stack(element_sizes[i]);
+    }
+    bench_typed_bench_elem4_t();
+    bench_typed_bench_elem16_t();
+    bench_typed_bench_elem64_t();
+}
+
+// dynamic_array_tのpush(事前確保 / 自動拡張 / push_n / 非チェック版)とref(通常版 / 非チェック版)
+static void bench_dynamic_array(uint64_t element_size_) {
+    uint64_t push_elapsed = 0;
+    uint64_t push_grow_elapsed = 0;
+    uint64_t push_n_elapsed = 0;
+    uint64_t push_unchecked_elapsed = 0;
+    uint64_t ref_elapsed = 0;
+    uint64_t ref_unchecked_elapsed = 0;
+    uint32_t out[16] = { 0 };
+    uint32_t sum = 0;
+    for(uint64_t round = 0; round != BENCH_ROUNDS; ++round) {
+        dynamic_array_t array = DYNAMIC_ARRAY_INITIALIZER;
+        dynamic_array_t grow_array = DYNAMIC_ARRAY_INITIALIZER;
+        if(DYNAMIC_ARRAY_SUCCESS != dynamic_array_create(element_size_, alignof(uint32_t), BENCH_OP_COUNT, &array)
+            || DYNAMIC_ARRAY_SUCCESS != dynamic_array_create(element_size_, alignof(uint32_t), 1, &grow_array)
+            || DYNAMIC_ARRAY_SUCCESS != dynamic_array_growth_policy_set(200, &grow_array)) {
+            fprintf(stderr, "bench_dynamic_array - Failed to create dynamic arrays.\n");
+            dynamic_array_destroy(&array);
+            dynamic_array_destroy(&grow_array);
+            return;
+        }
+
+        uint64_t start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != BENCH_OP_COUNT; ++i) {
+            dynamic_array_element_push(s_elements[i % BENCH_PUSH_N_CHUNK], &array);
+        }
+        push_elapsed += bench_timer_now_ns() - start;
+
+        start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != BENCH_OP_COUNT; ++i) {
+            dynamic_array_element_ref(i, &array, out);
+            sum += out[0];
+        }
+        ref_elapsed += bench_timer_now_ns() - start;
+
+        start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != BENCH_OP_COUNT; ++i) {
+            dynamic_array_element_ref_unchecked(i, &array, out);
+            sum += out[0];
+        }
+        ref_unchecked_elapsed += bench_timer_now_ns() - start;
+
+        start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != BENCH_OP_COUNT; ++i) {
+            dynamic_array_element_push(s_elements[i % BENCH_PUSH_N_CHUNK], &grow_array);
+        }
+        push_grow_elapsed += bench_timer_now_ns() - start;
+
+        // 同じ配列をpush_n / 非チェック版pushで再利用する(容量は確保済み)
+        dynamic_array_element_erase(0, BENCH_OP_COUNT, &array);
+        start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != BENCH_OP_COUNT; i += BENCH_PUSH_N_CHUNK) {
+            dynamic_array_element_push_n(s_elements, BENCH_PUSH_N_CHUNK, &array);
+        }
+        push_n_elapsed += bench_timer_now_ns() - start;
+
+        dynamic_array_element_erase(0, BENCH_OP_COUNT, &array);
+        start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != BENCH_OP_COUNT; ++i) {
+            dynamic_array_element_push_unchecked(s_elements[i % BENCH_PUSH_N_CHUNK], &array);
+        }
+        push_unchecked_elapsed += bench_timer_now_ns() - start;
+
+        dynamic_array_destroy(&array);
+        dynamic_array_destroy(&grow_array);
+    }
+    s_sink = sum;
+    const uint64_t ops = BENCH_OP_COUNT * BENCH_ROUNDS;
+    bench_report("dynamic_array_element_push", element_size_, ops, push_elapsed);
+    bench_report("dynamic_array_element_push_grow", element_size_, ops, push_grow_elapsed);
+    bench_report("dynamic_array_element_push_n", element_size_, ops, push_n_elapsed);
+    bench_report("dynamic_array_element_push_unchecked", element_size_, ops, push_unchecked_elapsed);
+    bench_report("dynamic_array_element_ref", element_size_, ops, ref_elapsed);
+    bench_report("dynamic_array_element_ref_unchecked", element_size_, ops, ref_unchecked_elapsed);
+}
+
+// stack_tのpush / pop(通常版 / 非チェック版)
+static void bench_stack(uint64_t element_size_) {
+    uint64_t push_elapsed = 0;
+    uint64_t pop_elapsed = 0;
+    uint64_t push_unchecked_elapsed = 0;
+    uint64_t pop_unchecked_elapsed = 0;
+    uint32_t out[16] = { 0 };
+    uint32_t sum = 0;
+    for(uint64_t round = 0; round != BENCH_ROUNDS; ++round) {
+        stack_t stack = STACK_INITIALIZER;
+        if(STACK_ERROR_CODE_SUCCESS != stack_create(element_size_, alignof(uint32_t), BENCH_OP_COUNT, &stack)) {
+            fprintf(stderr, "bench_stack - Failed to create stack.\n");
+            return;
+        }
+
+        uint64_t start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != BENCH_OP_COUNT; ++i) {
+            stack_push(&stack, s_elements[i % BENCH_PUSH_N_CHUNK]);
+        }
+        push_elapsed += bench_timer_now_ns() - start;
+
+        start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != BENCH_OP_COUNT; ++i) {
+            stack_pop(&stack, out);
+            sum += out[0];
+        }
+        pop_elapsed += bench_timer_now_ns() - start;
+
+        start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != BENCH_OP_COUNT; ++i) {
+            stack_push_unchecked(&stack, s_elements[i % BENCH_PUSH_N_CHUNK]);
+        }
+        push_unchecked_elapsed += bench_timer_now_ns() - start;
+
+        start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != BENCH_OP_COUNT; ++i) {
+            stack_pop_unchecked(&stack, out);
+            sum += out[0];
+        }
+        pop_unchecked_elapsed += bench_timer_now_ns() - start;
+
+        stack_destroy(&stack);
+    }
+    s_sink = sum;
+    const uint64_t ops = BENCH_OP_COUNT * BENCH_ROUNDS;
+    bench_report("stack_push", element_size_, ops, push_elapsed);
+    bench_report("stack_pop", element_size_, ops, pop_elapsed);
+    bench_report("stack_push_unchecked", element_size_, ops, push_unchecked_elapsed);
+    bench_report("stack_pop_unchecked", element_size_, ops, pop_unchecked_elapsed);
+}
@@ -0,0 +1,110 @@
+#include <stdio.h>
+#include <stdint.h>
+
+#include "include/bench_core_hash.h"
+#include "include/bench_timer.h"
+
+#include "core/core_hash.h"
+#include "core/core_memory.h"
+#include "core/core_string.h"
+
+// 1ケースあたりの総処理量(byte)
+#define BENCH_TOTAL_BYTES (1ull << 30)
+
+// 1ケースあたりの最大呼び出し回数(短い入力は呼び出し回数で制限する)
+#define BENCH_MAX_CALLS (1ull << 24)
+
+// 最大入力長
+#define BENCH_MAX_SIZE (1ull << 20)
+
+// 分割入力の1回あたりの長さ
+#define BENCH_CHUNK_SIZE 4096
+
+static void bench_bytes(uint64_t size_);
+static void bench_state(uint64_t size_);
+static void bench_string(void);
+
+// 最適化で計測対象の処理が削除されないよう、結果の一部をここに書き出す
+static volatile uint64_t s_sink;
+
+static unsigned char* s_input;
+
+void bench_core_hash(void) {
+    s_input = core_malloc(BENCH_MAX_SIZE);
+    if(0 == s_input) {
+        fprintf(stderr, "bench_core_hash - Failed to allocate input.\n");
+        return;
+    }
+    for(uint64_t i = 0; i != BENCH_MAX_SIZE; ++i) {
+        s_input[i] = (unsigned char)(i * 131 + 7);
+    }
+    static const uint64_t sizes[] = { 8, 16, 32, 64, 256, 1024, 4096, 65536, BENCH_MAX_SIZE };
+    for(uint64_t i = 0; i != sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        bench_bytes(sizes[i]);
+    }
+    bench_state(BENCH_MAX_SIZE);
+    bench_string();
+    core_free(s_input);
+    s_input = 0;
+}
+
+// core_hash_bytes(入力長ごとのスループット)
+static void bench_bytes(uint64_t size_) {
+    uint64_t iterations = BENCH_TOTAL_BYTES / size_;
+    if(iterations > BENCH_MAX_CALLS) {
+        iterations = BENCH_MAX_CALLS;
+    }
+    uint64_t sum = 0;
+    const uint64_t start = bench_timer_now_ns();
+    for(uint64_t i = 0; i != iterations; ++i) {
+        // 前回の結果をシードに使い、呼び出し間の依存関係を作る(レイテンシに近い値となる)
+        sum = core_hash_bytes(s_input, size_, sum);
+    }
+    const uint64_t elapsed = bench_timer_now_ns() - start;
+    s_sink = sum;
+    bench_report("core_hash_bytes", size_, iterations, elapsed);
+}
+
+// core_hash_state_update(BENCH_CHUNK_SIZE byteずつ与える)
+static void bench_state(uint64_t size_) {
+    const uint64_t iterations = BENCH_TOTAL_BYTES / size_;
+    core_hash_state_t state;
+    uint64_t sum = 0;
+    const uint64_t start = bench_timer_now_ns();
+    for(uint64_t i = 0; i != iterations; ++i) {
+        core_hash_state_init(sum, &state);
+        for(uint64_t offset = 0; offset < size_; offset += BENCH_CHUNK_SIZE) {
+            core_hash_state_update(s_input + offset, BENCH_CHUNK_SIZE, &state);
+        }
+        sum = core_hash_state_digest(&state);
+    }
+    const uint64_t elapsed = bench_timer_now_ns() - start;
+    s_sink = sum;
+    bench_report("core_hash_state_4k_chunks", size_, iterations, elapsed);
+}
+
+// core_string_hash(ヒープ文字列はキャッシュを使用する) と、毎回計算する場合の比較
+static void bench_string(void) {
+    core_string_t string = CORE_STRING_INITIALIZER;
+    if(CORE_STRING_SUCCESS != core_string_create("/api/v1/resource/0123456789abcdef/details?lang=ja", &string)) {
+        fprintf(stderr, "bench_core_hash - Failed to create string.\n");
+        return;
+    }
+    const uint64_t length = core_string_length(&string);
+    uint64_t sum = 0;
+    uint64_t start = bench_timer_now_ns();
+    for(uint64_t i = 0; i != BENCH_MAX_CALLS; ++i) {
+        sum += core_hash_bytes(core_string_cstr(&string), length, CORE_HASH_DEFAULT_SEED);
+    }
+    uint64_t elapsed = bench_timer_now_ns() - start;
+    bench_report("core_string_hash_uncached", length, BENCH_MAX_CALLS, elapsed);
+
+    start = bench_timer_now_ns();
+    for(uint64_t i = 0; i != BENCH_MAX_CALLS; ++i) {
+        sum += core_string_hash(&string);
+    }
+    elapsed = bench_timer_now_ns() - start;
+    bench_report("core_string_hash_cached", length, BENCH_MAX_CALLS, elapsed);
+    s_sink = sum;
+    core_string_destroy(&string);
+}
@@ -0,0 +1,126 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "include/bench_core_memory.h"
+#include "include/bench_timer.h"
+
+#include "core/core_memory.h"
+
+// 1ケースあたりの総処理量の目安(byte)
+#define BENCH_TOTAL_BYTES (1ull << 30)
+
+// 計測対象の最大サイズ(byte)
+#define BENCH_MAX_SIZE (16ull << 20)
+
+static void bench_zero(unsigned char* buffer_);
+static void bench_copy(const unsigned char* src_, unsigned char* dst_);
+static uint64_t bench_iterations(uint64_t size_);
+
+// 最適化で計測対象の処理が削除されないよう、結果の一部をここに書き出す
+static volatile unsigned char s_sink;
+
+// 変更前のcore_zero_memory相当(1byteずつのループ)
+__attribute__((noinline)) static void zero_memory_byte_loop(void* buff_, uint64_t buff_size_) {
+    char* const tmp = buff_;
+    for(uint64_t i = 0; i != buff_size_; ++i) {
+        tmp[i] = 0;
+    }
+}
+
+// 変更前の各コンテナのコピー処理相当(1byteずつのループ)
+__attribute__((noinline)) static void copy_memory_byte_loop(const void* src_, void* dst_, uint64_t size_) {
+    const char* const src = src_;
+    char* const dst = dst_;
+    for(uint64_t i = 0; i != size_; ++i) {
+        dst[i] = src[i];
+    }
+}
+
+void bench_core_memory(void) {
+    fprintf(stderr, "bench_core_memory - kernel: %s\n", core_memory_kernel_name());
+    unsigned char* src = core_malloc_tagged(BENCH_MAX_SIZE, MEMORY_TAG_USER);
+    unsigned char* dst = core_malloc_tagged(BENCH_MAX_SIZE, MEMORY_TAG_USER);
+    if(0 == src || 0 == dst) {
+        fprintf(stderr, "bench_core_memory - Failed to allocate benchmark buffers.\n");
+        core_free_tagged(src, BENCH_MAX_SIZE, MEMORY_TAG_USER);
+        core_free_tagged(dst, BENCH_MAX_SIZE, MEMORY_TAG_USER);
+        return;
+    }
+    for(uint64_t i = 0; i != BENCH_MAX_SIZE; ++i) {
+        src[i] = (unsigned char)i;
+    }
+    bench_zero(dst);
+    bench_copy(src, dst);
+    core_free_tagged(src, BENCH_MAX_SIZE, MEMORY_TAG_USER);
+    core_free_tagged(dst, BENCH_MAX_SIZE, MEMORY_TAG_USER);
+}
+
+// core_zero_memoryを変更前の実装、memsetと比較する
+static void bench_zero(unsigned char* buffer_) {
+    for(uint64_t size = 64; size <= BENCH_MAX_SIZE; size <<= 2) {
+        const uint64_t iterations = bench_iterations(size);
+
+        uint64_t start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != iterations; ++i) {
+            zero_memory_byte_loop(buffer_, size);
+        }
+        bench_report("zero_byte_loop", size, iterations, bench_timer_now_ns() - start);
+        s_sink = buffer_[size - 1];
+
+        start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != iterations; ++i) {
+            core_zero_memory(buffer_, size);
+        }
+        bench_report("core_zero_memory", size, iterations, bench_timer_now_ns() - start);
+        s_sink = buffer_[size - 1];
+
+        start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != iterations; ++i) {
+            memset(buffer_, 0, size);
+        }
+        bench_report("memset", size, iterations, bench_timer_now_ns() - start);
+        s_sink = buffer_[size - 1];
+    }
+}
+
+// core_copy_memory / core_move_memoryを変更前の実装、memcpyと比較する
+static void bench_copy(const unsigned char* src_, unsigned char* dst_) {
+    for(uint64_t size = 64; size <= BENCH_MAX_SIZE; size <<= 2) {
+        const uint64_t iterations = bench_iterations(size);
+
+        uint64_t start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != iterations; ++i) {
+            copy_memory_byte_loop(src_, dst_, size);
+        }
+        bench_report("copy_byte_loop", size, iterations, bench_timer_now_ns() - start);
+        s_sink = dst_[size - 1];
+
+        start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != iterations; ++i) {
+            core_copy_memory(src_, dst_, size);
+        }
+        bench_report("core_copy_memory", size, iterations, bench_timer_now_ns() - start);
+        s_sink = dst_[size - 1];
+
+        start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != iterations; ++i) {
+            core_move_memory(src_, dst_, size);
+        }
+        bench_report("core_move_memory", size, iterations, bench_timer_now_ns() - start);
+        s_sink = dst_[size - 1];
+
+        start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != iterations; ++i) {
+            memcpy(dst_, src_, size);
+        }
+        bench_report("memcpy", size, iterations, bench_timer_now_ns() - start);
+        s_sink = dst_[size - 1];
+    }
+}
+
+// 総処理量がBENCH_TOTAL_BYTES程度になる繰り返し回数
+static uint64_t bench_iterations(uint64_t size_) {
+    const uint64_t iterations = BENCH_TOTAL_BYTES / size_;
+    return (0 == iterations) ? 1 : iterations;
+}
@@ -0,0 +1,626 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "include/bench_core_string.h"
+#include "include/bench_timer.h"
+
+#include "core/core_memory.h"
+#include "core/core_string.h"
+#include "core/core_string_builder.h"
+#include "core/core_string_view.h"
+#include "core/core_string_number.h"
+#include "core/core_string_tokenizer.h"
+
+#include "containers/dynamic_array.h"
+
+#include "define.h"
+
+// 1ケースあたりの総処理量の目安(byte)
+#define BENCH_TOTAL_BYTES (1ull << 28)
+
+// 1ケースあたりの最大繰り返し回数(小さいサイズで関数呼び出しコストのみを長時間計測しないため)
+#define BENCH_MAX_ITERATIONS (1ull << 22)
+
+// 計測対象の最大文字列長
+#define BENCH_MAX_LENGTH (64ull << 10)
+
+// 追記による文字列構築ケースで構築する文字列長
+#define BENCH_BUILD_LENGTH (64ull << 10)
+
+// 追記による文字列構築ケースの繰り返し回数
+#define BENCH_BUILD_ROUNDS 16
+
+// 長さ計算、比較、検索ケースの最大文字列長
+#define BENCH_SEARCH_MAX_LENGTH (1ull << 20)
+
+// 数値変換ケースのフィールド数
+#define BENCH_PARSE_FIELDS 4096
+
+// 数値変換ケースの繰り返し回数
+#define BENCH_PARSE_ROUNDS 256
+
+static CORE_STRING_ERROR_CODE bench_string_create(const char* text_, uint64_t size_, core_string_t* const string_);
+static void bench_create_destroy(const char* text_);
+static void bench_copy(const char* text_);
+static void bench_concat(const char* text_);
+static void bench_concat_build(const char* text_);
+static void bench_append_build(const char* text_);
+static void bench_append_char_build(void);
+static void bench_builder_build(const char* text_);
+static void bench_trim(const char* text_);
+static void bench_search(void);
+static void bench_parse(void);
+static void bench_parse_fields(const char* name_, const char* fields_, uint64_t length_, bool float_);
+static void bench_format(void);
+static void bench_tokenize(void);
+static void bench_format_values(const char* name_, const int64_t* integers_, const double* floats_, core_string_t* const out_);
+static uint64_t bench_iterations(uint64_t size_);
+
+// 最適化で計測対象の処理が削除されないよう、結果の一部をここに書き出す
+static volatile uint64_t s_sink;
+
+// 変更前のpfn_string_length_from_char相当(1byteずつのループ)
+__attribute__((noinline)) static uint64_t length_byte_loop(const char* str_) {
+    uint64_t length = 0;
+    while('\0' != str_[length]) {
+        length++;
+    }
+    return length;
+}
+
+void bench_core_string(void) {
+    fprintf(stderr, "bench_core_string - kernel: %s\n", core_string_kernel_name());
+    char* text = core_malloc_tagged(BENCH_MAX_LENGTH + 1, MEMORY_TAG_USER);
+    if(0 == text) {
+        fprintf(stderr, "bench_core_string - Failed to allocate benchmark buffer.\n");
+        return;
+    }
+    for(uint64_t i = 0; i != BENCH_MAX_LENGTH; ++i) {
+        text[i] = (char)('a' + (i % 26));
+    }
+    text[BENCH_MAX_LENGTH] = '\0';
+    bench_create_destroy(text);
+    bench_copy(text);
+    bench_concat(text);
+    bench_concat_build(text);
+    bench_append_build(text);
+    bench_append_char_build();
+    bench_builder_build(text);
+    bench_trim(text);
+    bench_search();
+    bench_parse();
+    bench_format();
+    bench_tokenize();
+    core_free_tagged(text, BENCH_MAX_LENGTH + 1, MEMORY_TAG_USER);
+}
+
+// 長さsize_の文字列を生成する(text_の末尾size_文字を使用する)
+static CORE_STRING_ERROR_CODE bench_string_create(const char* text_, uint64_t size_, core_string_t* const string_) {
+    return core_string_create(text_ + (BENCH_MAX_LENGTH - size_), string_);
+}
+
+// core_string_create + core_string_destroy(短い文字列はインラインバッファに格納され、ヒープ確保が発生しない)
+static void bench_create_destroy(const char* text_) {
+    for(uint64_t size = 4; size <= 64; size <<= 1) {
+        const uint64_t iterations = BENCH_MAX_ITERATIONS;
+        const char* text = text_ + (BENCH_MAX_LENGTH - size);
+        uint64_t sum = 0;
+        const uint64_t start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != iterations; ++i) {
+            core_string_t string = CORE_STRING_INITIALIZER;
+            core_string_create(text, &string);
+            sum += core_string_length(&string);
+            core_string_destroy(&string);
+        }
+        bench_report("core_string_create_destroy", size, iterations, bench_timer_now_ns() - start);
+        s_sink = sum;
+    }
+}
+
+// core_string_copy(バッファ確保済みのコピー先への上書き)
+static void bench_copy(const char* text_) {
+    for(uint64_t size = 16; size <= BENCH_MAX_LENGTH; size <<= 2) {
+        const uint64_t iterations = bench_iterations(size);
+        core_string_t src = CORE_STRING_INITIALIZER;
+        core_string_t dst = CORE_STRING_INITIALIZER;
+        if(CORE_STRING_SUCCESS != bench_string_create(text_, size, &src) || CORE_STRING_SUCCESS != core_string_copy(&src, &dst)) {
+            fprintf(stderr, "bench_copy - Failed to create benchmark strings.\n");
+            core_string_destroy(&src);
+            core_string_destroy(&dst);
+            return;
+        }
+
+        const uint64_t start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != iterations; ++i) {
+            core_string_copy(&src, &dst);
+        }
+        bench_report("core_string_copy", size, iterations, bench_timer_now_ns() - start);
+        s_sink = core_string_length(&dst);
+
+        core_string_destroy(&src);
+        core_string_destroy(&dst);
+    }
+}
+
+// core_string_concat(1文字の文字列に連結する。連結先のリセットを含む)
+static void bench_concat(const char* text_) {
+    for(uint64_t size = 16; size <= BENCH_MAX_LENGTH; size <<= 2) {
+        const uint64_t iterations = bench_iterations(size);
+        core_string_t src = CORE_STRING_INITIALIZER;
+        core_string_t dst = CORE_STRING_INITIALIZER;
+        if(CORE_STRING_SUCCESS != bench_string_create(text_, size, &src) || CORE_STRING_SUCCESS != core_string_create("x", &dst)) {
+            fprintf(stderr, "bench_concat - Failed to create benchmark strings.\n");
+            core_string_destroy(&src);
+            core_string_destroy(&dst);
+            return;
+        }
+
+        const uint64_t start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != iterations; ++i) {
+            core_string_copy_from_char("x", &dst);
+            core_string_concat(&src, &dst);
+        }
+        bench_report("core_string_concat", size, iterations, bench_timer_now_ns() - start);
+        s_sink = core_string_length(&dst);
+
+        core_string_destroy(&src);
+        core_string_destroy(&dst);
+    }
+}
+
+// core_string_concatの繰り返しによる文字列構築(空の文字列からBENCH_BUILD_LENGTHまで追記する。バッファ拡張のコストを含む)
+static void bench_concat_build(const char* text_) {
+    for(uint64_t size = 16; size <= 4096; size <<= 2) {
+        const uint64_t appends = BENCH_BUILD_LENGTH / size;
+        core_string_t src = CORE_STRING_INITIALIZER;
+        if(CORE_STRING_SUCCESS != bench_string_create(text_, size, &src)) {
+            fprintf(stderr, "bench_concat_build - Failed to create benchmark strings.\n");
+            return;
+        }
+
+        uint64_t elapsed = 0;
+        for(uint64_t round = 0; round != BENCH_BUILD_ROUNDS; ++round) {
+            core_string_t dst = CORE_STRING_INITIALIZER;
+            const uint64_t start = bench_timer_now_ns();
+            for(uint64_t i = 0; i != appends; ++i) {
+                core_string_concat(&src, &dst);
+            }
+            elapsed += bench_timer_now_ns() - start;
+            s_sink = core_string_length(&dst);
+            core_string_destroy(&dst);
+        }
+        bench_report("core_string_concat_build", size, appends * BENCH_BUILD_ROUNDS, elapsed);
+
+        core_string_destroy(&src);
+    }
+}
+
+// core_string_append_from_charの繰り返しによる文字列構築(core_string_concat_buildのC文字列版)
+static void bench_append_build(const char* text_) {
+    for(uint64_t size = 16; size <= 4096; size <<= 2) {
+        const uint64_t appends = BENCH_BUILD_LENGTH / size;
+        const char* text = text_ + (BENCH_MAX_LENGTH - size);
+
+        uint64_t elapsed = 0;
+        for(uint64_t round = 0; round != BENCH_BUILD_ROUNDS; ++round) {
+            core_string_t dst = CORE_STRING_INITIALIZER;
+            const uint64_t start = bench_timer_now_ns();
+            for(uint64_t i = 0; i != appends; ++i) {
+                core_string_append_from_char(text, &dst);
+            }
+            elapsed += bench_timer_now_ns() - start;
+            s_sink = core_string_length(&dst);
+            core_string_destroy(&dst);
+        }
+        bench_report("core_string_append_build", size, appends * BENCH_BUILD_ROUNDS, elapsed);
+    }
+}
+
+// core_string_append_charの繰り返しによる文字列構築(空の文字列からBENCH_BUILD_LENGTH文字まで1文字ずつ追記する)
+static void bench_append_char_build(void) {
+    uint64_t elapsed = 0;
+    for(uint64_t round = 0; round != BENCH_BUILD_ROUNDS; ++round) {
+        core_string_t dst = CORE_STRING_INITIALIZER;
+        const uint64_t start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != BENCH_BUILD_LENGTH; ++i) {
+            core_string_append_char((char)('a' + (i & 15)), &dst);
+        }
+        elapsed += bench_timer_now_ns() - start;
+        s_sink = core_string_length(&dst);
+        core_string_destroy(&dst);
+    }
+    bench_report("core_string_append_char_build", 1, BENCH_BUILD_LENGTH * BENCH_BUILD_ROUNDS, elapsed);
+}
+
+// core_string_builder_tによる文字列構築(core_string_concat_buildと同じ追記 + 最後に1つのcore_string_tへまとめる。ビルダーはresetして再利用する)
+static void bench_builder_build(const char* text_) {
+    for(uint64_t size = 16; size <= 4096; size <<= 2) {
+        const uint64_t appends = BENCH_BUILD_LENGTH / size;
+        core_string_t src = CORE_STRING_INITIALIZER;
+        core_string_builder_t builder = CORE_STRING_BUILDER_INITIALIZER;
+        if(CORE_STRING_SUCCESS != bench_string_create(text_, size, &src) || CORE_STRING_SUCCESS != core_string_builder_create(0, &builder)) {
+            fprintf(stderr, "bench_builder_build - Failed to create benchmark strings.\n");
+            core_string_destroy(&src);
+            return;
+        }
+
+        uint64_t elapsed = 0;
+        for(uint64_t round = 0; round != BENCH_BUILD_ROUNDS; ++round) {
+            core_string_t dst = CORE_STRING_INITIALIZER;
+            const uint64_t start = bench_timer_now_ns();
+            for(uint64_t i = 0; i != appends; ++i) {
+                core_string_builder_append(&src, &builder);
+            }
+            core_string_builder_finalize(&builder, &dst);
+            elapsed += bench_timer_now_ns() - start;
+            s_sink = core_string_length(&dst);
+            core_string_destroy(&dst);
+        }
+        bench_report("core_string_builder_build", size, appends * BENCH_BUILD_ROUNDS, elapsed);
+
+        core_string_builder_destroy(&builder);
+        core_string_destroy(&src);
+    }
+}
+
+// core_string_trim(結果をcore_string_tにコピー)とcore_string_view_trim(ビューのみ計算)の比較。両端にトリム対象の空白を4文字ずつ付加する
+static void bench_trim(const char* text_) {
+    for(uint64_t size = 16; size <= BENCH_MAX_LENGTH; size <<= 2) {
+        const uint64_t iterations = bench_iterations(size);
+        core_string_t src = CORE_STRING_INITIALIZER;
+        core_string_t dst = CORE_STRING_INITIALIZER;
+        if(CORE_STRING_SUCCESS != core_string_copy_from_char("    ", &src) ||
+           CORE_STRING_SUCCESS != core_string_append_from_buffer(text_, size, &src) ||
+           CORE_STRING_SUCCESS != core_string_append_from_char("    ", &src)) {
+            fprintf(stderr, "bench_trim - Failed to create benchmark strings.\n");
+            core_string_destroy(&src);
+            return;
+        }
+
+        uint64_t start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != iterations; ++i) {
+            core_string_trim(&src, &dst, ' ', ' ');
+        }
+        bench_report("core_string_trim", size, iterations, bench_timer_now_ns() - start);
+        s_sink = core_string_length(&dst);
+
+        core_string_view_t view = CORE_STRING_VIEW_INITIALIZER;
+        core_string_view_t trimmed = CORE_STRING_VIEW_INITIALIZER;
+        core_string_view_from_string(&src, &view);
+        uint64_t sum = 0;
+        start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != iterations; ++i) {
+            core_string_view_trim(&view, ' ', ' ', &trimmed);
+            sum += trimmed.length;
+        }
+        bench_report("core_string_view_trim", size, iterations, bench_timer_now_ns() - start);
+        s_sink = sum;
+
+        core_string_destroy(&src);
+        core_string_destroy(&dst);
+    }
+}
+
+// 長さ計算、比較、1文字検索、部分文字列検索をbyteループ / libcと比較する(いずれも末尾まで走査する条件で計測する)
+static void bench_search(void) {
+    char* text = core_malloc_tagged(BENCH_SEARCH_MAX_LENGTH + 1, MEMORY_TAG_USER);
+    if(0 == text) {
+        fprintf(stderr, "bench_search - Failed to allocate benchmark buffer.\n");
+        return;
+    }
+    for(uint64_t i = 0; i != BENCH_SEARCH_MAX_LENGTH; ++i) {
+        text[i] = (char)('a' + (i % 7));
+    }
+    text[BENCH_SEARCH_MAX_LENGTH] = '\0';
+    // 先頭文字と末尾文字は頻繁に一致するが、全体としては末尾にのみ現れるneedle
+    static const char needle[] = "abcdefgabz";
+    const uint64_t needle_length = sizeof(needle) - 1;
+
+    for(uint64_t size = 16; size <= BENCH_SEARCH_MAX_LENGTH; size <<= 2) {
+        const uint64_t iterations = bench_iterations(size);
+        core_string_t str1 = CORE_STRING_INITIALIZER;
+        core_string_t str2 = CORE_STRING_INITIALIZER;
+        const char saved_end = text[size];
+        text[size] = '\0';
+        const char saved_last = text[size - 1];
+        text[size - 1] = 'z';
+        if(CORE_STRING_SUCCESS != core_string_append_from_buffer(text, size, &str1) ||
+           CORE_STRING_SUCCESS != core_string_append_from_buffer(text, size, &str2)) {
+            fprintf(stderr, "bench_search - Failed to create benchmark strings.\n");
+            core_string_destroy(&str1);
+            core_string_destroy(&str2);
+            break;
+        }
+        const char* const str2_buffer = core_string_cstr(&str2);
+        uint64_t sum = 0;
+
+        uint64_t start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != iterations; ++i) {
+            sum += length_byte_loop(text);
+            __asm__ volatile("" ::: "memory");
+        }
+        bench_report("length_byte_loop", size, iterations, bench_timer_now_ns() - start);
+        start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != iterations; ++i) {
+            core_string_view_t view = CORE_STRING_VIEW_INITIALIZER;
+            core_string_view_from_char(text, &view);
+            sum += view.length;
+        }
+        bench_report("core_string_length_from_char", size, iterations, bench_timer_now_ns() - start);
+        start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != iterations; ++i) {
+            sum += strlen(text);
+            __asm__ volatile("" ::: "memory");  // ループ外への移動を防ぐ
+        }
+        bench_report("strlen", size, iterations, bench_timer_now_ns() - start);
+
+        start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != iterations; ++i) {
+            sum += core_string_equal(&str1, &str2) ? 1 : 0;
+        }
+        bench_report("core_string_equal", size, iterations, bench_timer_now_ns() - start);
+        start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != iterations; ++i) {
+            sum += (0 == memcmp(text, str2_buffer, size)) ? 1 : 0;
+            __asm__ volatile("" ::: "memory");
+        }
+        bench_report("memcmp", size, iterations, bench_timer_now_ns() - start);
+
+        start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != iterations; ++i) {
+            sum += core_string_find_char(&str1, 0, 'z');
+        }
+        bench_report("core_string_find_char", size, iterations, bench_timer_now_ns() - start);
+        start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != iterations; ++i) {
+            sum += (uint64_t)(const char*)memchr(text, 'z', size);
+            __asm__ volatile("" ::: "memory");
+        }
+        bench_report("memchr", size, iterations, bench_timer_now_ns() - start);
+
+        if(size >= needle_length) {
+            start = bench_timer_now_ns();
+            for(uint64_t i = 0; i != iterations; ++i) {
+                sum += core_string_find_from_char(&str1, 0, needle);
+            }
+            bench_report("core_string_find", size, iterations, bench_timer_now_ns() - start);
+            start = bench_timer_now_ns();
+            for(uint64_t i = 0; i != iterations; ++i) {
+                sum += (uint64_t)strstr(text, needle);
+                __asm__ volatile("" ::: "memory");
+            }
+            bench_report("strstr", size, iterations, bench_timer_now_ns() - start);
+        }
+        s_sink = sum;
+
+        text[size - 1] = saved_last;
+        text[size] = saved_end;
+        core_string_destroy(&str1);
+        core_string_destroy(&str2);
+    }
+    core_free_tagged(text, BENCH_SEARCH_MAX_LENGTH + 1, MEMORY_TAG_USER);
+}
+
+// ','区切りの整数/浮動小数点数フィールドの変換をstrtoll / strtodと比較する
+static void bench_parse(void) {
+    // フィールドあたり最大24文字 + 区切り文字
+    const uint64_t capacity = BENCH_PARSE_FIELDS * 32;
+    char* fields = core_malloc_tagged(capacity, MEMORY_TAG_USER);
+    if(0 == fields) {
+        fprintf(stderr, "bench_parse - Failed to allocate benchmark buffer.\n");
+        return;
+    }
+    uint64_t state = 88172645463325252ull;
+    uint64_t length = 0;
+    for(uint64_t i = 0; i != BENCH_PARSE_FIELDS; ++i) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        // 1〜19桁の整数(値の大きさが偏らないようにシフト量を変える)
+        length += (uint64_t)snprintf(fields + length, capacity - length, "%lld,", (long long)((int64_t)state >> (state % 61)));
+    }
+    bench_parse_fields("core_string_parse_i64", fields, length, false);
+
+    length = 0;
+    for(uint64_t i = 0; i != BENCH_PARSE_FIELDS; ++i) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        // 価格や計測値のような固定小数点表記と、指数表記を混在させる
+        if(0 != (i & 3)) {
+            length += (uint64_t)snprintf(fields + length, capacity - length, "%.*f,", (int)(state % 9), (double)(state >> 40) / 1000.0);
+        } else {
+            length += (uint64_t)snprintf(fields + length, capacity - length, "%.17g,", (double)(int64_t)state * 1e-12);
+        }
+    }
+    bench_parse_fields("core_string_parse_f64", fields, length, true);
+    core_free_tagged(fields, capacity, MEMORY_TAG_USER);
+}
+
+// fields_の全フィールドをcore_string_parse_XXXとlibcの関数で変換する時間を計測する
+static void bench_parse_fields(const char* name_, const char* fields_, uint64_t length_, bool float_) {
+    double sum = 0.0;
+    uint64_t start = bench_timer_now_ns();
+    for(uint64_t round = 0; round != BENCH_PARSE_ROUNDS; ++round) {
+        for(uint64_t offset = 0; offset < length_;) {
+            uint64_t consumed = 0;
+            if(float_) {
+                double value = 0.0;
+                core_string_parse_f64(fields_ + offset, length_ - offset, &value, &consumed);
+                sum += value;
+            } else {
+                int64_t value = 0;
+                core_string_parse_i64(fields_ + offset, length_ - offset, &value, &consumed);
+                sum += (double)value;
+            }
+            offset += consumed + 1;
+        }
+    }
+    bench_report(name_, length_, BENCH_PARSE_ROUNDS, bench_timer_now_ns() - start);
+
+    start = bench_timer_now_ns();
+    for(uint64_t round = 0; round != BENCH_PARSE_ROUNDS; ++round) {
+        for(const char* field = fields_; field < fields_ + length_;) {
+            char* end = 0;
+            if(float_) {
+                sum += strtod(field, &end);
+            } else {
+                sum += (double)strtoll(field, &end, 10);
+            }
+            field = end + 1;
+        }
+    }
+    bench_report(float_ ? "strtod" : "strtoll", length_, BENCH_PARSE_ROUNDS, bench_timer_now_ns() - start);
+    s_sink = (sum > 0.0) ? 1 : 0;
+}
+
+// 整数/浮動小数点数の','区切りテキストへの変換をcore_string_append_format、snprintfと比較する
+static void bench_format(void) {
+    int64_t* integers = core_malloc_tagged(sizeof(int64_t) * BENCH_PARSE_FIELDS, MEMORY_TAG_USER);
+    double* floats = core_malloc_tagged(sizeof(double) * BENCH_PARSE_FIELDS, MEMORY_TAG_USER);
+    if(0 == integers || 0 == floats) {
+        fprintf(stderr, "bench_format - Failed to allocate benchmark buffer.\n");
+        core_free_tagged(integers, sizeof(int64_t) * BENCH_PARSE_FIELDS, MEMORY_TAG_USER);
+        core_free_tagged(floats, sizeof(double) * BENCH_PARSE_FIELDS, MEMORY_TAG_USER);
+        return;
+    }
+    uint64_t state = 88172645463325252ull;
+    for(uint64_t i = 0; i != BENCH_PARSE_FIELDS; ++i) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        integers[i] = (int64_t)state >> (state % 61);
+        // 価格のような短い値と、全桁を使う値を混在させる
+        floats[i] = (0 != (i & 3)) ? (double)(state >> 40) / 1000.0 : (double)(int64_t)state * 1e-12;
+    }
+    core_string_t out = CORE_STRING_INITIALIZER;
+    bench_format_values("core_string_append_i64", integers, 0, &out);
+    bench_format_values("core_string_append_f64", 0, floats, &out);
+    core_string_destroy(&out);
+    core_free_tagged(integers, sizeof(int64_t) * BENCH_PARSE_FIELDS, MEMORY_TAG_USER);
+    core_free_tagged(floats, sizeof(double) * BENCH_PARSE_FIELDS, MEMORY_TAG_USER);
+}
+
+// integers_またはfloats_の全要素を','区切りでout_に書き出す時間を、core_string_append_XXX、core_string_append_format、snprintfで計測する
+static void bench_format_values(const char* name_, const int64_t* integers_, const double* floats_, core_string_t* const out_) {
+    uint64_t start = bench_timer_now_ns();
+    for(uint64_t round = 0; round != BENCH_PARSE_ROUNDS; ++round) {
+        core_string_copy_from_char("", out_);
+        for(uint64_t i = 0; i != BENCH_PARSE_FIELDS; ++i) {
+            if(0 != integers_) {
+                core_string_append_i64(integers_[i], out_);
+            } else {
+                core_string_append_f64(floats_[i], out_);
+            }
+            core_string_append_char(',', out_);
+        }
+    }
+    const uint64_t length = core_string_length(out_);
+    bench_report(name_, length, BENCH_PARSE_ROUNDS, bench_timer_now_ns() - start);
+
+    // %.17gは読み戻すと元の値に戻る最小の精度指定(桁数は最短にならない)
+    start = bench_timer_now_ns();
+    for(uint64_t round = 0; round != BENCH_PARSE_ROUNDS; ++round) {
+        core_string_copy_from_char("", out_);
+        for(uint64_t i = 0; i != BENCH_PARSE_FIELDS; ++i) {
+            if(0 != integers_) {
+                core_string_append_format(out_, "%lld,", (long long)integers_[i]);
+            } else {
+                core_string_append_format(out_, "%.17g,", floats_[i]);
+            }
+        }
+    }
+    bench_report("core_string_append_format", core_string_length(out_), BENCH_PARSE_ROUNDS, bench_timer_now_ns() - start);
+
+    start = bench_timer_now_ns();
+    char buffer[32];
+    for(uint64_t round = 0; round != BENCH_PARSE_ROUNDS; ++round) {
+        core_string_copy_from_char("", out_);
+        for(uint64_t i = 0; i != BENCH_PARSE_FIELDS; ++i) {
+            const int written = (0 != integers_) ? snprintf(buffer, sizeof(buffer), "%lld,", (long long)integers_[i]) : snprintf(buffer, sizeof(buffer), "%.17g,", floats_[i]);
+            core_string_append_from_buffer(buffer, (uint64_t)written, out_);
+        }
+    }
+    bench_report("snprintf + append_from_buffer", core_string_length(out_), BENCH_PARSE_ROUNDS, bench_timer_now_ns() - start);
+    s_sink = length;
+}
+
+// 総処理量がBENCH_TOTAL_BYTES程度になる繰り返し回数(上限BENCH_MAX_ITERATIONS)
+static uint64_t bench_iterations(uint64_t size_) {
+    const uint64_t iterations = BENCH_TOTAL_BYTES / size_;
+    if(iterations > BENCH_MAX_ITERATIONS) {
+        return BENCH_MAX_ITERATIONS;
+    }
+    return (0 == iterations) ? 1 : iterations;
+}
+
+// ','区切りの1行をフィールドに分割する時間を、core_string_find_char + core_string_substring_copy(フィールドごとにコピー)と比較する
+static void bench_tokenize(void) {
+    core_string_t line = CORE_STRING_INITIALIZER;
+    core_string_t field = CORE_STRING_INITIALIZER;
+    dynamic_array_t tokens = DYNAMIC_ARRAY_INITIALIZER;
+    uint64_t state = 88172645463325252ull;
+    for(uint64_t i = 0; i != BENCH_PARSE_FIELDS; ++i) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        // 1〜24文字のフィールド
+        char buffer[32];
+        const int length = snprintf(buffer, sizeof(buffer), "%.*s,", (int)(state % 24) + 1, "abcdefghijklmnopqrstuvwxyz");
+        if(CORE_STRING_SUCCESS != core_string_append_from_buffer(buffer, (uint64_t)length, &line)) {
+            fprintf(stderr, "bench_tokenize - Failed to create benchmark string.\n");
+            core_string_destroy(&line);
+            return;
+        }
+    }
+    const uint64_t length = core_string_length(&line) - 1;  // 末尾の','を除く
+    uint64_t sum = 0;
+
+    uint64_t start = bench_timer_now_ns();
+    for(uint64_t round = 0; round != BENCH_PARSE_ROUNDS; ++round) {
+        uint64_t from = 0;
+        for(;;) {
+            const uint64_t index = core_string_find_char(&line, from, ',');
+            const uint64_t to = (INVALID_VALUE_U64 != index && index < length) ? index : length;
+            core_string_substring_copy(&line, &field, from, to - 1);
+            sum += core_string_length(&field);
+            if(to == length) {
+                break;
+            }
+            from = to + 1;
+        }
+    }
+    bench_report("core_string_substring_copy_split", length, BENCH_PARSE_ROUNDS, bench_timer_now_ns() - start);
+
+    core_string_view_t source = CORE_STRING_VIEW_INITIALIZER;
+    core_string_view_from_buffer(core_string_cstr(&line), length, &source);
+    start = bench_timer_now_ns();
+    for(uint64_t round = 0; round != BENCH_PARSE_ROUNDS; ++round) {
+        core_string_tokenizer_t tokenizer = CORE_STRING_TOKENIZER_INITIALIZER;
+        core_string_view_t token = CORE_STRING_VIEW_INITIALIZER;
+        core_string_tokenizer_create(&source, ",", &tokenizer);
+        while(core_string_tokenizer_next(&tokenizer, &token)) {
+            sum += token.length;
+        }
+    }
+    bench_report("core_string_tokenizer_next", length, BENCH_PARSE_ROUNDS, bench_timer_now_ns() - start);
+
+    start = bench_timer_now_ns();
+    for(uint64_t round = 0; round != BENCH_PARSE_ROUNDS; ++round) {
+        core_string_tokenizer_t tokenizer = CORE_STRING_TOKENIZER_INITIALIZER;
+        core_string_tokenizer_create(&source, ",", &tokenizer);
+        core_string_tokenizer_collect(&tokenizer, &tokens);
+        uint64_t count = 0;
+        dynamic_array_size(&tokens, &count);
+        sum += count;
+    }
+    bench_report("core_string_tokenizer_collect", length, BENCH_PARSE_ROUNDS, bench_timer_now_ns() - start);
+    s_sink = sum;
+
+    dynamic_array_destroy(&tokens);
+    core_string_destroy(&field);
+    core_string_destroy(&line);
+}
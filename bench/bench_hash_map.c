@@ -0,0 +1,204 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdalign.h>
+
+#include "include/bench_hash_map.h"
+#include "include/bench_timer.h"
+
+#include "containers/hash_map.h"
+#include "containers/dynamic_array.h"
+
+#include "core/core_string.h"
+
+// 整数キーの最大格納数(1Kから10倍ずつ増やす)
+#define BENCH_MAX_COUNT 100000000ull
+
+// 文字列キーの最大格納数
+#define BENCH_STRING_MAX_COUNT 1000000ull
+
+// 線形探索(ベースライン)の最大要素数
+#define BENCH_LINEAR_MAX_COUNT 10000ull
+
+// 1ケースあたりの最小操作回数(小さいサイズでは繰り返して計測時間を確保する)
+#define BENCH_MIN_OPS (1ull << 22)
+
+static void bench_u64_case(uint64_t count_);
+static void bench_string_case(uint64_t count_);
+static void bench_linear_case(uint64_t count_);
+static uint64_t bench_key(uint64_t index_);
+
+// 最適化で計測対象の処理が削除されないよう、結果の一部をここに書き出す
+static volatile uint64_t s_sink;
+
+void bench_hash_map(void) {
+    for(uint64_t count = 1000; count <= BENCH_MAX_COUNT; count *= 10) {
+        bench_u64_case(count);
+    }
+    for(uint64_t count = 1000; count <= BENCH_STRING_MAX_COUNT; count *= 10) {
+        bench_string_case(count);
+    }
+    for(uint64_t count = 1000; count <= BENCH_LINEAR_MAX_COUNT; count *= 10) {
+        bench_linear_case(count);
+    }
+}
+
+// uint64_t -> uint64_tのinsert(自動拡張 / reserve済み)、find(ヒット / ミス)、erase
+static void bench_u64_case(uint64_t count_) {
+    const uint64_t rounds = (count_ >= BENCH_MIN_OPS) ? 1 : BENCH_MIN_OPS / count_;
+    uint64_t grow_elapsed = 0;
+    uint64_t reserved_elapsed = 0;
+    uint64_t hit_elapsed = 0;
+    uint64_t miss_elapsed = 0;
+    uint64_t erase_elapsed = 0;
+    uint64_t sum = 0;
+    void* value = NULL;
+    for(uint64_t round = 0; round != rounds; ++round) {
+        hash_map_t map = HASH_MAP_INITIALIZER;
+        if(HASH_MAP_SUCCESS != hash_map_create(sizeof(uint64_t), alignof(uint64_t), sizeof(uint64_t), alignof(uint64_t), 0, &map)) {
+            fprintf(stderr, "bench_hash_map - Failed to create map.\n");
+            return;
+        }
+        uint64_t start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != count_; ++i) {
+            const uint64_t key = bench_key(i);
+            if(HASH_MAP_SUCCESS != hash_map_insert(&key, &i, &map)) {
+                fprintf(stderr, "bench_hash_map - Failed to insert %llu elements. Skipped.\n", (unsigned long long)count_);
+                hash_map_destroy(&map);
+                return;
+            }
+        }
+        grow_elapsed += bench_timer_now_ns() - start;
+        hash_map_destroy(&map);
+
+        // 100M要素では自動拡張時に新旧のスロット配列が同時に存在するため、reserve済みのマップは作り直す
+        if(HASH_MAP_SUCCESS != hash_map_create(sizeof(uint64_t), alignof(uint64_t), sizeof(uint64_t), alignof(uint64_t), count_, &map)) {
+            fprintf(stderr, "bench_hash_map - Failed to reserve %llu elements. Skipped.\n", (unsigned long long)count_);
+            return;
+        }
+        start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != count_; ++i) {
+            const uint64_t key = bench_key(i);
+            hash_map_insert(&key, &i, &map);
+        }
+        reserved_elapsed += bench_timer_now_ns() - start;
+
+        start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != count_; ++i) {
+            const uint64_t key = bench_key(i);
+            if(HASH_MAP_SUCCESS == hash_map_find(&key, &map, &value)) {
+                sum += *(const uint64_t*)value;
+            }
+        }
+        hit_elapsed += bench_timer_now_ns() - start;
+
+        start = bench_timer_now_ns();
+        for(uint64_t i = count_; i != count_ * 2; ++i) {
+            const uint64_t key = bench_key(i);
+            sum += (HASH_MAP_SUCCESS == hash_map_find(&key, &map, &value)) ? 1 : 0;
+        }
+        miss_elapsed += bench_timer_now_ns() - start;
+
+        start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != count_; ++i) {
+            const uint64_t key = bench_key(i);
+            hash_map_erase(&key, &map);
+        }
+        erase_elapsed += bench_timer_now_ns() - start;
+        hash_map_destroy(&map);
+    }
+    s_sink = sum;
+    bench_report("hash_map_u64_insert", count_, count_ * rounds, grow_elapsed);
+    bench_report("hash_map_u64_insert_reserved", count_, count_ * rounds, reserved_elapsed);
+    bench_report("hash_map_u64_find_hit", count_, count_ * rounds, hit_elapsed);
+    bench_report("hash_map_u64_find_miss", count_, count_ * rounds, miss_elapsed);
+    bench_report("hash_map_u64_erase", count_, count_ * rounds, erase_elapsed);
+}
+
+// core_string_tキー(ヒープ確保される長さ)のinsert / find
+static void bench_string_case(uint64_t count_) {
+    const uint64_t rounds = (count_ >= BENCH_MIN_OPS / 4) ? 1 : (BENCH_MIN_OPS / 4) / count_;
+    uint64_t insert_elapsed = 0;
+    uint64_t hit_elapsed = 0;
+    uint64_t sum = 0;
+    void* value = NULL;
+    char buffer[64];
+    core_string_t key = CORE_STRING_INITIALIZER;
+    for(uint64_t round = 0; round != rounds; ++round) {
+        hash_map_t map = HASH_MAP_INITIALIZER;
+        if(HASH_MAP_SUCCESS != hash_map_create_string_key(sizeof(uint64_t), alignof(uint64_t), 0, &map)) {
+            fprintf(stderr, "bench_hash_map - Failed to create map.\n");
+            break;
+        }
+        uint64_t start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != count_; ++i) {
+            snprintf(buffer, sizeof(buffer), "/api/v1/resource/%016llx", (unsigned long long)bench_key(i));
+            core_string_copy_from_char(buffer, &key);
+            hash_map_insert(&key, &i, &map);
+        }
+        insert_elapsed += bench_timer_now_ns() - start;
+
+        start = bench_timer_now_ns();
+        for(uint64_t i = 0; i != count_; ++i) {
+            snprintf(buffer, sizeof(buffer), "/api/v1/resource/%016llx", (unsigned long long)bench_key(i));
+            core_string_copy_from_char(buffer, &key);
+            if(HASH_MAP_SUCCESS == hash_map_find(&key, &map, &value)) {
+                sum += *(const uint64_t*)value;
+            }
+        }
+        hit_elapsed += bench_timer_now_ns() - start;
+        hash_map_destroy(&map);
+    }
+    core_string_destroy(&key);
+    s_sink = sum;
+    // キー文字列の生成時間も含む
+    bench_report("hash_map_string_insert", count_, count_ * rounds, insert_elapsed);
+    bench_report("hash_map_string_find_hit", count_, count_ * rounds, hit_elapsed);
+}
+
+// ベースライン: dynamic_array_tに格納したキーと値の組を線形探索する
+static void bench_linear_case(uint64_t count_) {
+    typedef struct bench_pair_t {
+        uint64_t key;
+        uint64_t value;
+    } bench_pair_t;
+    dynamic_array_t array;
+    dynamic_array_default_create(&array);
+    if(DYNAMIC_ARRAY_SUCCESS != dynamic_array_create(sizeof(bench_pair_t), alignof(bench_pair_t), count_, &array)) {
+        fprintf(stderr, "bench_hash_map - Failed to create array.\n");
+        return;
+    }
+    for(uint64_t i = 0; i != count_; ++i) {
+        const bench_pair_t pair = { bench_key(i), i };
+        dynamic_array_element_push(&pair, &array);
+    }
+    void* data = NULL;
+    uint64_t stride = 0;
+    dynamic_array_data(&array, &data, &stride);
+    const bench_pair_t* pairs = (const bench_pair_t*)data;
+
+    // 探索回数は要素数によらず一定にする(1回あたり平均count_ / 2要素を比較する)
+    const uint64_t lookups = (1ull << 26) / count_;
+    uint64_t sum = 0;
+    const uint64_t start = bench_timer_now_ns();
+    for(uint64_t n = 0; n != lookups; ++n) {
+        const uint64_t key = bench_key(n % count_);
+        for(uint64_t i = 0; i != count_; ++i) {
+            if(pairs[i].key == key) {
+                sum += pairs[i].value;
+                break;
+            }
+        }
+    }
+    const uint64_t elapsed = bench_timer_now_ns() - start;
+    s_sink = sum;
+    bench_report("linear_scan_u64_find_hit", count_, lookups, elapsed);
+    dynamic_array_destroy(&array);
+}
+
+// 連番を64bitの擬似乱数に変換する(splitmix64の最終段)
+static uint64_t bench_key(uint64_t index_) {
+    uint64_t x = index_ + 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
@@ -0,0 +1,91 @@
+#include <stdio.h>
+#include <stdint.h>
+
+#include "include/bench_message.h"
+#include "include/bench_timer.h"
+
+#include "core/message.h"
+
+// 計測の繰り返し回数
+#define BENCH_MESSAGE_ITERATIONS (1ull << 20)
+
+// 最適化で計測対象の処理が削除されないよう、結果の一部をここに書き出す
+static volatile uint64_t s_sink;
+
+static void bench_message_format(void);
+static void bench_message_async(const char* case_name_, MESSAGE_ASYNC_POLICY policy_);
+static void bench_message_filtered(void);
+static void bench_message_binary(void);
+
+void bench_message(void) {
+    bench_message_format();
+    bench_message_async("message_async_output_drop", MESSAGE_ASYNC_POLICY_DROP);
+    bench_message_async("message_async_output_block", MESSAGE_ASYNC_POLICY_BLOCK);
+    bench_message_filtered();
+    bench_message_binary();
+}
+
+// message_format(message_outputの整形処理。出力は含まない)
+static void bench_message_format(void) {
+    char buffer[MESSAGE_BUFFER_SIZE];
+    uint64_t sum = 0;
+    const uint64_t start = bench_timer_now_ns();
+    for(uint64_t i = 0; i != BENCH_MESSAGE_ITERATIONS; ++i) {
+        sum += message_format(MESSAGE_SEVERITY_ERROR, buffer, sizeof(buffer), "%s - Argument %s requires a valid pointer.", "stack_push", "stack_");
+    }
+    const uint64_t elapsed = bench_timer_now_ns() - start;
+    bench_report("message_format", sum / BENCH_MESSAGE_ITERATIONS, BENCH_MESSAGE_ITERATIONS, elapsed);
+    s_sink = sum;
+}
+
+// 非同期出力時のmessage_output(呼び出し元スレッドのコスト。出力先は/dev/null)
+static void bench_message_async(const char* case_name_, MESSAGE_ASYNC_POLICY policy_) {
+    message_async_config_t config = { 4096, policy_, "/dev/null" };
+    if(MESSAGE_SUCCESS != message_async_start(&config)) {
+        fprintf(stderr, "bench_message_async - Failed to start asynchronous output.\n");
+        return;
+    }
+    const uint64_t start = bench_timer_now_ns();
+    for(uint64_t i = 0; i != BENCH_MESSAGE_ITERATIONS; ++i) {
+        message_output(MESSAGE_SEVERITY_ERROR, "%s - Argument %s requires a valid pointer.", "stack_push", "stack_");
+    }
+    const uint64_t elapsed = bench_timer_now_ns() - start;
+    message_async_stop();
+    bench_report(case_name_, MESSAGE_ASYNC_RECORD_SIZE, BENCH_MESSAGE_ITERATIONS, elapsed);
+    if(0 != message_async_dropped_count()) {
+        fprintf(stderr, "%s - dropped %llu messages.\n", case_name_, (unsigned long long)message_async_dropped_count());
+    }
+}
+
+// 実行時の出力レベルで除外されるWARN_MESSAGE(レベル判定のみ。引数は評価されない)
+static void bench_message_filtered(void) {
+    const uint8_t level = message_level_get();
+    message_level_set(MESSAGE_LEVEL_ERROR);
+    const uint64_t start = bench_timer_now_ns();
+    for(uint64_t i = 0; i != BENCH_MESSAGE_ITERATIONS; ++i) {
+        WARN_MESSAGE("%s - Argument %s requires a valid pointer. (%llu)", "stack_push", "stack_", (unsigned long long)i);
+    }
+    const uint64_t elapsed = bench_timer_now_ns() - start;
+    message_level_set(level);
+    bench_report("message_filtered", 0, BENCH_MESSAGE_ITERATIONS, elapsed);
+}
+
+// バイナリ出力時のmessage_output(引数の記録とファイルへのコピー。整形は行わない)
+static void bench_message_binary(void) {
+    const char* path = "bench_message.clog";
+    if(MESSAGE_SUCCESS != message_binary_start(path, BENCH_MESSAGE_ITERATIONS * 128)) {
+        fprintf(stderr, "bench_message_binary - Failed to start binary output.\n");
+        return;
+    }
+    const uint64_t start = bench_timer_now_ns();
+    for(uint64_t i = 0; i != BENCH_MESSAGE_ITERATIONS; ++i) {
+        message_output(MESSAGE_SEVERITY_ERROR, "%s - Argument %s requires a valid pointer.", "stack_push", "stack_");
+    }
+    const uint64_t elapsed = bench_timer_now_ns() - start;
+    if(0 != message_binary_dropped_count()) {
+        fprintf(stderr, "bench_message_binary - dropped %llu messages.\n", (unsigned long long)message_binary_dropped_count());
+    }
+    message_binary_stop();
+    remove(path);
+    bench_report("message_binary_output", 0, BENCH_MESSAGE_ITERATIONS, elapsed);
+}
@@ -0,0 +1,185 @@
+#if defined(__linux__)
+#define _POSIX_C_SOURCE 200809L // for sched_yield
+#endif
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "include/bench_ring_queue.h"
+#include "include/bench_timer.h"
+
+#include "containers/ring_queue.h"
+#include "containers/stack.h"
+
+// 1ケースあたりの総メッセージ数(全プロデューサの合計)
+#define BENCH_MESSAGE_COUNT (1ull << 20)
+
+// キューの最大格納数
+#define BENCH_QUEUE_CAPACITY 1024
+
+#define BENCH_MAX_THREADS 4
+
+typedef struct bench_message_t {
+    uint64_t value[2];
+} bench_message_t;
+
+// 計測対象コンテナのpush / pop(満杯 / 空の場合はfalseを返す)
+typedef bool (*bench_push_func_t)(void* container_, const bench_message_t* message_);
+typedef bool (*bench_pop_func_t)(void* container_, bench_message_t* out_message_);
+
+// ベースライン: mutexで排他したstack_t
+typedef struct bench_locked_stack_t {
+    pthread_mutex_t mutex;
+    stack_t stack;
+} bench_locked_stack_t;
+
+typedef struct bench_worker_t {
+    void* container;
+    bench_push_func_t push;
+    bench_pop_func_t pop;
+    uint64_t message_count;             // プロデューサ: 送信数
+    _Atomic uint64_t* popped_count;     // コンシューマ: 全コンシューマの受信数合計
+    uint64_t sum;                       // コンシューマ: 受信値の合計
+} bench_worker_t;
+
+static void bench_ring_queue_case(const char* case_name_, RING_QUEUE_MODE mode_, uint32_t producer_count_, uint32_t consumer_count_);
+static void bench_locked_stack_case(const char* case_name_, uint32_t producer_count_, uint32_t consumer_count_);
+static uint64_t bench_run(void* container_, bench_push_func_t push_, bench_pop_func_t pop_, uint32_t producer_count_, uint32_t consumer_count_);
+static void* bench_producer(void* arg_);
+static void* bench_consumer(void* arg_);
+static bool ring_queue_push_adapter(void* container_, const bench_message_t* message_);
+static bool ring_queue_pop_adapter(void* container_, bench_message_t* out_message_);
+static bool locked_stack_push_adapter(void* container_, const bench_message_t* message_);
+static bool locked_stack_pop_adapter(void* container_, bench_message_t* out_message_);
+
+// 最適化で計測対象の処理が削除されないよう、結果の一部をここに書き出す
+static volatile uint64_t s_sink;
+
+void bench_ring_queue(void) {
+    bench_ring_queue_case("ring_queue_spsc_1p1c", RING_QUEUE_MODE_SPSC, 1, 1);
+    bench_ring_queue_case("ring_queue_mpmc_1p1c", RING_QUEUE_MODE_MPMC, 1, 1);
+    bench_ring_queue_case("ring_queue_mpmc_2p2c", RING_QUEUE_MODE_MPMC, 2, 2);
+    bench_ring_queue_case("ring_queue_mpmc_4p4c", RING_QUEUE_MODE_MPMC, 4, 4);
+    bench_locked_stack_case("locked_stack_1p1c", 1, 1);
+    bench_locked_stack_case("locked_stack_2p2c", 2, 2);
+    bench_locked_stack_case("locked_stack_4p4c", 4, 4);
+}
+
+static void bench_ring_queue_case(const char* case_name_, RING_QUEUE_MODE mode_, uint32_t producer_count_, uint32_t consumer_count_) {
+    ring_queue_t queue = RING_QUEUE_INITIALIZER;
+    if(RING_QUEUE_SUCCESS != ring_queue_create(sizeof(bench_message_t), alignof(bench_message_t), BENCH_QUEUE_CAPACITY, mode_, &queue)) {
+        fprintf(stderr, "bench_ring_queue - Failed to create queue.\n");
+        return;
+    }
+    const uint64_t elapsed = bench_run(&queue, ring_queue_push_adapter, ring_queue_pop_adapter, producer_count_, consumer_count_);
+    bench_report(case_name_, sizeof(bench_message_t), BENCH_MESSAGE_COUNT, elapsed);
+    ring_queue_destroy(&queue);
+}
+
+static void bench_locked_stack_case(const char* case_name_, uint32_t producer_count_, uint32_t consumer_count_) {
+    bench_locked_stack_t locked_stack;
+    stack_default_create(&locked_stack.stack);
+    if(STACK_ERROR_CODE_SUCCESS != stack_create(sizeof(bench_message_t), alignof(bench_message_t), BENCH_QUEUE_CAPACITY, &locked_stack.stack)) {
+        fprintf(stderr, "bench_ring_queue - Failed to create stack.\n");
+        return;
+    }
+    pthread_mutex_init(&locked_stack.mutex, NULL);
+    const uint64_t elapsed = bench_run(&locked_stack, locked_stack_push_adapter, locked_stack_pop_adapter, producer_count_, consumer_count_);
+    bench_report(case_name_, sizeof(bench_message_t), BENCH_MESSAGE_COUNT, elapsed);
+    pthread_mutex_destroy(&locked_stack.mutex);
+    stack_destroy(&locked_stack.stack);
+}
+
+// プロデューサ / コンシューマスレッドを起動し、全メッセージの受け渡しが完了するまでの時間(ns)を返す
+static uint64_t bench_run(void* container_, bench_push_func_t push_, bench_pop_func_t pop_, uint32_t producer_count_, uint32_t consumer_count_) {
+    _Atomic uint64_t popped_count = 0;
+    bench_worker_t producers[BENCH_MAX_THREADS];
+    bench_worker_t consumers[BENCH_MAX_THREADS];
+    pthread_t producer_threads[BENCH_MAX_THREADS];
+    pthread_t consumer_threads[BENCH_MAX_THREADS];
+
+    const uint64_t start = bench_timer_now_ns();
+    for(uint32_t i = 0; i != consumer_count_; ++i) {
+        consumers[i] = (bench_worker_t){ container_, push_, pop_, BENCH_MESSAGE_COUNT, &popped_count, 0 };
+        pthread_create(&consumer_threads[i], NULL, bench_consumer, &consumers[i]);
+    }
+    for(uint32_t i = 0; i != producer_count_; ++i) {
+        producers[i] = (bench_worker_t){ container_, push_, pop_, BENCH_MESSAGE_COUNT / producer_count_, &popped_count, 0 };
+        pthread_create(&producer_threads[i], NULL, bench_producer, &producers[i]);
+    }
+    for(uint32_t i = 0; i != producer_count_; ++i) {
+        pthread_join(producer_threads[i], NULL);
+    }
+    uint64_t sum = 0;
+    for(uint32_t i = 0; i != consumer_count_; ++i) {
+        pthread_join(consumer_threads[i], NULL);
+        sum += consumers[i].sum;
+    }
+    const uint64_t elapsed = bench_timer_now_ns() - start;
+    s_sink = sum;
+    return elapsed;
+}
+
+// 満杯の場合はCPUを譲って再試行する(コア数がスレッド数より少ない環境でも進行させるため)
+static void* bench_producer(void* arg_) {
+    bench_worker_t* worker = (bench_worker_t*)arg_;
+    bench_message_t message = { { 0, 0 } };
+    for(uint64_t i = 0; i != worker->message_count; ++i) {
+        message.value[0] = i;
+        while(!worker->push(worker->container, &message)) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+// 全コンシューマの受信数合計がメッセージ数に達するまでpopする
+static void* bench_consumer(void* arg_) {
+    bench_worker_t* worker = (bench_worker_t*)arg_;
+    bench_message_t message;
+    while(atomic_load_explicit(worker->popped_count, memory_order_relaxed) < worker->message_count) {
+        if(!worker->pop(worker->container, &message)) {
+            sched_yield();
+            continue;
+        }
+        worker->sum += message.value[0];
+        atomic_fetch_add_explicit(worker->popped_count, 1, memory_order_relaxed);
+    }
+    return NULL;
+}
+
+static bool ring_queue_push_adapter(void* container_, const bench_message_t* message_) {
+    return RING_QUEUE_SUCCESS == ring_queue_push((ring_queue_t*)container_, message_);
+}
+
+static bool ring_queue_pop_adapter(void* container_, bench_message_t* out_message_) {
+    return RING_QUEUE_SUCCESS == ring_queue_pop((ring_queue_t*)container_, out_message_);
+}
+
+// stack_push / stack_popは満杯 / 空でエラーメッセージを出力するため、事前にサイズを確認する
+static bool locked_stack_push_adapter(void* container_, const bench_message_t* message_) {
+    bench_locked_stack_t* locked_stack = (bench_locked_stack_t*)container_;
+    bool result = false;
+    pthread_mutex_lock(&locked_stack->mutex);
+    if(!stack_full(&locked_stack->stack)) {
+        result = (STACK_ERROR_CODE_SUCCESS == stack_push(&locked_stack->stack, message_));
+    }
+    pthread_mutex_unlock(&locked_stack->mutex);
+    return result;
+}
+
+static bool locked_stack_pop_adapter(void* container_, bench_message_t* out_message_) {
+    bench_locked_stack_t* locked_stack = (bench_locked_stack_t*)container_;
+    bool result = false;
+    pthread_mutex_lock(&locked_stack->mutex);
+    if(!stack_empty(&locked_stack->stack)) {
+        result = (STACK_ERROR_CODE_SUCCESS == stack_pop(&locked_stack->stack, out_message_));
+    }
+    pthread_mutex_unlock(&locked_stack->mutex);
+    return result;
+}
@@ -0,0 +1,49 @@
+#if defined(__linux__)
+    #define _POSIX_C_SOURCE 199309L    // -std=c17ではclock_gettimeが宣言されないため
+#endif
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <time.h>
+
+#include "include/bench_timer.h"
+
+static BENCH_OUTPUT_FORMAT s_format = BENCH_OUTPUT_FORMAT_CSV;
+static bool s_is_first_record = true;   // JSON出力時の区切り文字制御用
+
+uint64_t bench_timer_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+void bench_output_begin(BENCH_OUTPUT_FORMAT format_) {
+    s_format = format_;
+    s_is_first_record = true;
+    if(BENCH_OUTPUT_FORMAT_JSON == s_format) {
+        printf("[\n");
+    } else {
+        printf("case,size,iterations,elapsed_ns,ns_per_op,gb_per_sec\n");
+    }
+}
+
+void bench_output_end(void) {
+    if(BENCH_OUTPUT_FORMAT_JSON == s_format) {
+        printf("\n]\n");
+    }
+    fflush(stdout);
+}
+
+void bench_report(const char* case_name_, uint64_t size_, uint64_t iterations_, uint64_t elapsed_ns_) {
+    const double bytes = (double)size_ * (double)iterations_;
+    const double gb_per_sec = (0 == elapsed_ns_) ? 0.0 : bytes / (double)elapsed_ns_;  // byte/ns = GB/s
+    const double ns_per_op = (0 == iterations_) ? 0.0 : (double)elapsed_ns_ / (double)iterations_;
+    if(BENCH_OUTPUT_FORMAT_JSON == s_format) {
+        printf("%s  {\"case\": \"%s\", \"size\": %" PRIu64 ", \"iterations\": %" PRIu64 ", \"elapsed_ns\": %" PRIu64 ", \"ns_per_op\": %.3f, \"gb_per_sec\": %.3f}",
+            s_is_first_record ? "" : ",\n", case_name_, size_, iterations_, elapsed_ns_, ns_per_op, gb_per_sec);
+    } else {
+        printf("%s,%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%.3f,%.3f\n", case_name_, size_, iterations_, elapsed_ns_, ns_per_op, gb_per_sec);
+    }
+    s_is_first_record = false;
+}
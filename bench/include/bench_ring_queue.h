@@ -0,0 +1,3 @@
+#pragma once
+
+void bench_ring_queue(void);
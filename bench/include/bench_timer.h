@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief 計測結果の出力形式
+ *
+ */
+typedef enum BENCH_OUTPUT_FORMAT {
+    BENCH_OUTPUT_FORMAT_CSV,    /**< CSV(1行目にヘッダを出力) */
+    BENCH_OUTPUT_FORMAT_JSON,   /**< JSON(計測結果オブジェクトの配列) */
+} BENCH_OUTPUT_FORMAT;
+
+/**
+ * @brief 単調増加時計の現在値を取得する
+ *
+ * @return uint64_t 現在時刻(ns)
+ */
+uint64_t bench_timer_now_ns(void);
+
+/**
+ * @brief 計測結果の出力を開始する(CSVの場合はヘッダ、JSONの場合は配列の開始を出力する)
+ *
+ * @param format_ 出力形式
+ */
+void bench_output_begin(BENCH_OUTPUT_FORMAT format_);
+
+/**
+ * @brief 計測結果の出力を終了する(JSONの場合は配列を閉じる)
+ *
+ */
+void bench_output_end(void);
+
+/**
+ * @brief 計測結果1件を標準出力に出力する
+ * @note 出力項目: case,size,iterations,elapsed_ns,ns_per_op,gb_per_sec
+ * @note コンテナ操作の計測では、size_に要素サイズ、iterations_に総操作回数を指定する
+ *
+ * @param case_name_ 計測ケース名
+ * @param size_ 1回あたりの処理サイズ(byte)
+ * @param iterations_ 繰り返し回数
+ * @param elapsed_ns_ 経過時間(ns)
+ */
+void bench_report(const char* case_name_, uint64_t size_, uint64_t iterations_, uint64_t elapsed_ns_);
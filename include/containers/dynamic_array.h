@@ -9,15 +9,18 @@
  * 安全かつ簡単に行えることを目的としたAPIである。
  *
  * ただし、以下の点はstd::vectorとは仕様が異なる:
- * - オブジェクトをpushした際、領域の拡張が必要となった際には、必要となる分だけ確保する。
+ * - 標準ではpushした際に領域が満杯であればエラーとなる。
+ *   @ref dynamic_array_growth_policy_set() で拡張率を設定した場合は、満杯時に拡張率に従って自動で領域を拡張する(償却O(1))。
  * - 配列サイズの拡張処理において、サイズが小さくなる方への拡張は許可しない。
  *
  * 代表的な操作として以下が提供される:
  * - 配列へ格納可能な要素数の予約(reserve)
  * - 配列サイズの拡張(サイズが大きくなる方のみ許容)(resize)
  * - 配列への要素の追加(push)
+ * - 複数要素の一括追加/挿入/削除、配列同士の連結(push_n, insert, erase, append)
  * - 配列要素の参照(ref)
  * - 配列要素の更新(set)
+ * - 配列要素へのポインタ/スパンの取得(コピーを伴わない参照)(element_ptr, data, span)
  *
  * @section prerequisites 初期化に関する注意点
  * 一部の関数は @ref dynamic_array_create() によって初期化された dynamic_array_t を必要とします。
@@ -36,6 +39,8 @@
 #include <stdbool.h>
 #include <stdalign.h>
 
+#include "core/core_memory.h"
+
 /**
  * @brief dynamic_array_t関連処理が出力するエラーコード
  *
@@ -72,6 +77,33 @@ typedef struct dynamic_array_t {
  */
 #define DYNAMIC_ARRAY_INITIALIZER { 0 }
 
+/**
+ * @brief dynamic_array_tに格納されている要素全体を指す書き換え可能なスパン
+ *
+ * 要素i(0 <= i < count)のアドレスは(char*)begin + i * strideで求められる。
+ * endは最後の要素の次の位置を指す(begin + count * stride)。
+ *
+ * @note 配列の拡張(resize, reserve, 自動拡張を伴うpush等)によってバッファが移動すると無効になる。
+ */
+typedef struct dynamic_array_span_t {
+    void* begin;        /**< 先頭要素へのポインタ */
+    void* end;          /**< 最後の要素の次の位置へのポインタ */
+    uint64_t stride;    /**< 要素間の間隔(パディングを含む要素サイズ)(byte) */
+    uint64_t count;     /**< 格納されている要素数 */
+} dynamic_array_span_t;
+
+/**
+ * @brief dynamic_array_tに格納されている要素全体を指す読み取り専用のスパン
+ *
+ * @note 各メンバの意味は @ref dynamic_array_span_t と同様。
+ */
+typedef struct dynamic_array_const_span_t {
+    const void* begin;  /**< 先頭要素へのポインタ */
+    const void* end;    /**< 最後の要素の次の位置へのポインタ */
+    uint64_t stride;    /**< 要素間の間隔(パディングを含む要素サイズ)(byte) */
+    uint64_t count;     /**< 格納されている要素数 */
+} dynamic_array_const_span_t;
+
 /**
  * @brief 引数で与えたdynamic_array_オブジェクトを「デフォルト状態」に初期化する。
  *
@@ -151,6 +183,48 @@ void dynamic_array_default_create(dynamic_array_t* const dynamic_array_);
  */
 DYNAMIC_ARRAY_ERROR_CODE dynamic_array_create(uint64_t element_size_, uint8_t alignment_requirement_, uint64_t max_element_count_, dynamic_array_t* const dynamic_array_);
 
+/**
+ * @brief @ref dynamic_array_create() と同様にdynamic_array_を初期化する。ただし、内部データと配列要素格納領域はarena_から確保する。
+ *
+ * @note 内部データと配列要素格納領域の確保はアリーナのポインタを進めるのみで完了するため、
+ *       フレーム単位、リクエスト単位で生成/破棄する配列に適している。
+ *
+ * @note アリーナ上に生成したオブジェクトに対して @ref dynamic_array_destroy() を呼んだ場合、メモリは解放されずデフォルト状態に戻るのみである。
+ *       メモリは @ref core_arena_reset() または @ref core_arena_destroy() によって一括で破棄される。
+ *       また、 @ref dynamic_array_resize() 等による領域の再確保時も新たな領域はアリーナから確保され、旧領域はアリーナのリセットまで解放されない。
+ *
+ * @note arena_はdynamic_array_を使用し終えるまで有効でなければならない。
+ *
+ * 使用例:
+ * @code
+ * core_arena_t arena = CORE_ARENA_INITIALIZER;
+ * core_arena_create(64 * 1024, &arena);
+ *
+ * dynamic_array_t array = DYNAMIC_ARRAY_INITIALIZER;
+ * DYNAMIC_ARRAY_ERROR_CODE result = dynamic_array_create_with_arena(sizeof(uint32_t), alignof(uint32_t), 128, &arena, &array);
+ * // エラー処理
+ *
+ * core_arena_reset(&arena);   // arrayが使用していたメモリを一括破棄
+ * dynamic_array_default_create(&array);
+ * core_arena_destroy(&arena);
+ * @endcode
+ *
+ * @param[in] element_size_ 格納する要素のサイズ(sizeof(object))
+ * @param[in] alignment_requirement_ 格納する要素のアライメント要件(alignof(object))(2の冪乗)
+ * @param[in] max_element_count_ 格納する要素の数
+ * @param[in,out] arena_ メモリ確保元アリーナ
+ * @param[out] dynamic_array_ 初期化対象オブジェクト
+ * @retval DYNAMIC_ARRAY_INVALID_ARGUMENT 引数dynamic_array_またはarena_がNULL、
+ *                                        引数element_size_が0または
+ *                                        引数alignment_requirement_が0または2の冪乗でない
+ * @retval DYNAMIC_ARRAY_MEMORY_ALLOCATE_ERROR アリーナの空き容量が不足している
+ * @retval DYNAMIC_ARRAY_SUCCESS 初期化に成功し、正常終了
+ *
+ * @see dynamic_array_create()
+ * @see core_arena_allocate()
+ */
+DYNAMIC_ARRAY_ERROR_CODE dynamic_array_create_with_arena(uint64_t element_size_, uint8_t alignment_requirement_, uint64_t max_element_count_, core_arena_t* const arena_, dynamic_array_t* const dynamic_array_);
+
 /**
  * @brief 引数で与えた動的配列オブジェクトdynamic_array_が保持するメモリを破棄する。
  *
@@ -211,7 +285,8 @@ void dynamic_array_destroy(dynamic_array_t* const dynamic_array_);
  * @param[in] max_element_count_ 格納する配列要素の数
  * @param[out] dynamic_array_ メモリ確保対象オブジェクト
  *
- * @retval DYNAMIC_ARRAY_INVALID_ARGUMENT 引数dynamic_array_がNULL
+ * @retval DYNAMIC_ARRAY_INVALID_ARGUMENT 引数dynamic_array_がNULLまたはmax_element_count_が大きすぎる
+ * @retval DYNAMIC_ARRAY_INVALID_DARRAY 未初期化のdynamic_array_が渡された
  * @retval DYNAMIC_ARRAY_MEMORY_ALLOCATE_ERROR 必要なメモリ領域の確保に失敗
  * @retval DYNAMIC_ARRAY_SUCCESS メモリ確保が正常に終了または必要なメモリ確保量が0で何もしなかった
  *
@@ -232,9 +307,10 @@ DYNAMIC_ARRAY_ERROR_CODE dynamic_array_reserve(uint64_t max_element_count_, dyna
  * ```
  * DYNAMIC_ARRAY_INVALID_ARGUMENT を返すとともに、上記のような [WARNING] ログが出力される。
  *
- * @note 本関数内でのバッファメモリの取得には、 @ref dynamic_array_reserve() を使用している。
- * このため、dynamic_array_resize()を行う前には @ref dynamic_array_create() によって、格納するオブジェクトのサイズ、アライメント要件が初期化されている必要がある。
- * 詳細は @ref dynamic_array_reserve() を参照のこと。
+ * @note dynamic_array_resize()を行う前には @ref dynamic_array_create() によって、格納するオブジェクトのサイズ、アライメント要件が初期化されている必要がある。
+ *
+ * @note ヒープから確保した配列の場合、バッファはrealloc相当の再確保により1回のみ移動し、格納済みの要素は保持される。
+ * アリーナ上の配列の場合は、アリーナから新たな領域を確保して格納済みの要素をコピーする。
  *
  * 使用例:
  * @code
@@ -255,15 +331,50 @@ DYNAMIC_ARRAY_ERROR_CODE dynamic_array_reserve(uint64_t max_element_count_, dyna
  * @param[out] dynamic_array_ 拡張対象オブジェクト
  *
  * @retval DYNAMIC_ARRAY_INVALID_ARGUMENT 引数dynamic_array_がNULLまたは現在保持する容量よりも小さいサイズが指定された
- * @retval DYNAMIC_ARRAY_MEMORY_ALLOCATE_ERROR データ一時退避用バッファまたは拡張後のバッファのメモリ取得に失敗
+ * @retval DYNAMIC_ARRAY_MEMORY_ALLOCATE_ERROR 拡張後のバッファのメモリ取得に失敗(この場合、元のバッファと格納済みの要素はそのまま保持される)
  * @retval DYNAMIC_ARRAY_SUCCESS バッファの拡張に成功し正常終了
  *
  * @see dynamic_array_reserve()
- * @see core_malloc()
- * @see core_free()
+ * @see core_realloc_tagged()
  */
 DYNAMIC_ARRAY_ERROR_CODE dynamic_array_resize(uint64_t max_element_count_, dynamic_array_t* const dynamic_array_);
 
+/**
+ * @brief dynamic_array_のバッファが満杯の状態で @ref dynamic_array_element_push() が呼ばれた際の自動拡張率を設定する
+ *
+ * @note growth_factor_percent_は拡張後の要素数を現在の要素数に対する百分率で指定する(150: 1.5倍、200: 2倍)。
+ *       0を指定した場合は自動拡張を行わず、満杯時の @ref dynamic_array_element_push() はDYNAMIC_ARRAY_BUFFER_FULLを返す(デフォルト)。
+ *
+ * @note 現在の要素数が0の場合は4要素分を確保する。また、要素数が少なく拡張率を掛けても要素数が増えない場合は1要素分拡張する。
+ *
+ * @note 拡張は @ref dynamic_array_resize() と同様に行われる。
+ *
+ * 使用例:
+ * @code
+ * dynamic_array_t test_array = DYNAMIC_ARRAY_INITIALIZER;
+ * DYNAMIC_ARRAY_ERROR_CODE result_create = dynamic_array_create(sizeof(uint32_t), alignof(uint32_t), 16, &test_array);
+ * // エラー処理
+ * DYNAMIC_ARRAY_ERROR_CODE result_policy = dynamic_array_growth_policy_set(200, &test_array);  // 満杯時に2倍に拡張
+ * // エラー処理
+ * for(uint32_t i = 0; i != 1000; ++i) {
+ *     DYNAMIC_ARRAY_ERROR_CODE result_push = dynamic_array_element_push(&i, &test_array);   // 満杯でもエラーとならない
+ *     // エラー処理
+ * }
+ * dynamic_array_destroy(&test_array);
+ * @endcode
+ *
+ * @param[in] growth_factor_percent_ 自動拡張率(%)(0または101以上)
+ * @param[in,out] dynamic_array_ 設定対象オブジェクト
+ *
+ * @retval DYNAMIC_ARRAY_INVALID_ARGUMENT 引数dynamic_array_がNULLまたはgrowth_factor_percent_が1〜100
+ * @retval DYNAMIC_ARRAY_INVALID_DARRAY 未初期化のdynamic_array_が渡された
+ * @retval DYNAMIC_ARRAY_SUCCESS 設定に成功し正常終了
+ *
+ * @see dynamic_array_element_push()
+ * @see dynamic_array_resize()
+ */
+DYNAMIC_ARRAY_ERROR_CODE dynamic_array_growth_policy_set(uint16_t growth_factor_percent_, dynamic_array_t* const dynamic_array_);
+
 /**
  * @brief 与えられたdynamic_array_に格納可能な配列要素数を取得する
  *
@@ -369,15 +480,124 @@ DYNAMIC_ARRAY_ERROR_CODE dynamic_array_size(const dynamic_array_t* const dynamic
  * dynamic_array_destroy(&test_array);
  * @endcode
  *
- * @param[in] object_ 追加オブジェクト
+ * @param[in] object_ 追加オブジェクト(自身の要素を指していてもよい)
  * @param[in,out] dynamic_array_ 要素を追加する対象の配列オブジェクト（内部状態が更新される）
  * @retval DYNAMIC_ARRAY_INVALID_ARGUMENT 引数object_またはdynamic_array_がNULL
  * @retval DYNAMIC_ARRAY_INVALID_DARRAY 未初期化のdynamic_array_が渡された
- * @retval DYNAMIC_ARRAY_BUFFER_FULL 格納先のバッファが既に満杯
+ * @retval DYNAMIC_ARRAY_BUFFER_FULL 格納先のバッファが既に満杯で自動拡張が無効、またはこれ以上拡張できない
+ * @retval DYNAMIC_ARRAY_MEMORY_ALLOCATE_ERROR 自動拡張時のメモリ確保に失敗
  * @retval DYNAMIC_ARRAY_SUCCESS バッファへの追加に成功し、正常終了
+ *
+ * @see dynamic_array_growth_policy_set()
  */
 DYNAMIC_ARRAY_ERROR_CODE dynamic_array_element_push(const void* const object_, dynamic_array_t* const dynamic_array_);
 
+/**
+ * @brief 連続した領域に格納されたcount_個のオブジェクトを、dynamic_array_の末尾に一括で追加する
+ *
+ * @note objects_は要素サイズ(element_size)間隔で詰めて格納されている必要がある(sizeof(object)の配列)。
+ * @note 容量の確認は1回のみ行い、要素サイズとアライメント後のサイズが等しい場合は1回のメモリコピーで格納する。
+ * @note 容量が不足する場合、自動拡張が有効( @ref dynamic_array_growth_policy_set() )であれば拡張し、無効であれば何も追加せずにDYNAMIC_ARRAY_BUFFER_FULLを返す。
+ * @note objects_にdynamic_array_自身のバッファ内を指すポインタを与えてはならない(拡張によって無効になる可能性がある)。
+ * @note count_が0の場合は何もせずに正常終了する。
+ *
+ * 使用例:
+ * @code
+ * uint32_t values[1000];
+ * // valuesを初期化
+ * dynamic_array_t test_array = DYNAMIC_ARRAY_INITIALIZER;
+ * DYNAMIC_ARRAY_ERROR_CODE result_create = dynamic_array_create(sizeof(uint32_t), alignof(uint32_t), 1000, &test_array);
+ * // エラー処理
+ * DYNAMIC_ARRAY_ERROR_CODE result_push = dynamic_array_element_push_n(values, 1000, &test_array);
+ * // エラー処理
+ * dynamic_array_destroy(&test_array);
+ * @endcode
+ *
+ * @param[in] objects_ 追加オブジェクトの先頭(自身の要素を指していてもよい)
+ * @param[in] count_ 追加オブジェクト数
+ * @param[in,out] dynamic_array_ 要素を追加する対象の配列オブジェクト
+ * @retval DYNAMIC_ARRAY_INVALID_ARGUMENT 引数objects_またはdynamic_array_がNULL、または追加後の要素数が大きすぎる
+ * @retval DYNAMIC_ARRAY_INVALID_DARRAY 未初期化のdynamic_array_が渡された
+ * @retval DYNAMIC_ARRAY_BUFFER_FULL 容量が不足しており自動拡張が無効
+ * @retval DYNAMIC_ARRAY_MEMORY_ALLOCATE_ERROR 自動拡張時のメモリ確保に失敗
+ * @retval DYNAMIC_ARRAY_SUCCESS 追加に成功し、正常終了
+ *
+ * @see dynamic_array_element_push()
+ */
+DYNAMIC_ARRAY_ERROR_CODE dynamic_array_element_push_n(const void* const objects_, uint64_t count_, dynamic_array_t* const dynamic_array_);
+
+/**
+ * @brief 連続した領域に格納されたcount_個のオブジェクトを、dynamic_array_の配列インデックスelement_index_の位置に一括で挿入する
+ *
+ * @note element_index_以降に格納されていた要素は、count_個分後ろへ移動する(1回のメモリ移動で行う)。
+ * @note element_index_に現在の要素数を指定した場合は、 @ref dynamic_array_element_push_n() と同じ動作となる。
+ * @note objects_の形式、容量不足時の動作は @ref dynamic_array_element_push_n() と同様。
+ *
+ * 使用例:
+ * @code
+ * uint32_t values[3] = { 1, 2, 3 };
+ * DYNAMIC_ARRAY_ERROR_CODE result_insert = dynamic_array_element_insert(0, values, 3, &test_array);  // 先頭に3要素を挿入
+ * // エラー処理
+ * @endcode
+ *
+ * @param[in] element_index_ 挿入位置(0〜現在の要素数)
+ * @param[in] objects_ 挿入オブジェクトの先頭(自身の要素を指していてもよい)
+ * @param[in] count_ 挿入オブジェクト数
+ * @param[in,out] dynamic_array_ 要素を挿入する対象の配列オブジェクト
+ * @retval DYNAMIC_ARRAY_INVALID_ARGUMENT 引数objects_またはdynamic_array_がNULL、または挿入後の要素数が大きすぎる
+ * @retval DYNAMIC_ARRAY_INVALID_DARRAY 未初期化のdynamic_array_が渡された
+ * @retval DYNAMIC_ARRAY_OUT_OF_RANGE element_index_が現在の要素数より大きい
+ * @retval DYNAMIC_ARRAY_BUFFER_FULL 容量が不足しており自動拡張が無効
+ * @retval DYNAMIC_ARRAY_MEMORY_ALLOCATE_ERROR 自動拡張時のメモリ確保に失敗
+ * @retval DYNAMIC_ARRAY_SUCCESS 挿入に成功し、正常終了
+ */
+DYNAMIC_ARRAY_ERROR_CODE dynamic_array_element_insert(uint64_t element_index_, const void* const objects_, uint64_t count_, dynamic_array_t* const dynamic_array_);
+
+/**
+ * @brief dynamic_array_の配列インデックスelement_index_からcount_個の要素を削除する
+ *
+ * @note 削除範囲より後ろの要素は前に詰められる(1回のメモリ移動で行う)。バッファの容量は変化しない。
+ * @note count_が0の場合は何もせずに正常終了する。
+ *
+ * 使用例:
+ * @code
+ * DYNAMIC_ARRAY_ERROR_CODE result_erase = dynamic_array_element_erase(2, 3, &test_array);  // インデックス2〜4の要素を削除
+ * // エラー処理
+ * @endcode
+ *
+ * @param[in] element_index_ 削除範囲の先頭インデックス
+ * @param[in] count_ 削除する要素数
+ * @param[in,out] dynamic_array_ 要素を削除する対象の配列オブジェクト
+ * @retval DYNAMIC_ARRAY_INVALID_ARGUMENT 引数dynamic_array_がNULL
+ * @retval DYNAMIC_ARRAY_INVALID_DARRAY 未初期化のdynamic_array_が渡された
+ * @retval DYNAMIC_ARRAY_OUT_OF_RANGE 削除範囲が格納済みの要素の範囲外
+ * @retval DYNAMIC_ARRAY_SUCCESS 削除に成功し、正常終了
+ */
+DYNAMIC_ARRAY_ERROR_CODE dynamic_array_element_erase(uint64_t element_index_, uint64_t count_, dynamic_array_t* const dynamic_array_);
+
+/**
+ * @brief src_に格納されている全要素をdst_の末尾に一括で追加する
+ *
+ * @note src_とdst_は要素サイズとアライメント後の要素サイズが一致している必要がある。
+ * @note 容量の確認は1回のみ行い、1回のメモリコピーで格納する。容量不足時の動作は @ref dynamic_array_element_push_n() と同様。
+ * @note src_とdst_に同じオブジェクトを指定してもよい(格納済みの要素が複製される)。
+ *
+ * 使用例:
+ * @code
+ * DYNAMIC_ARRAY_ERROR_CODE result_append = dynamic_array_append(&src_array, &dst_array);
+ * // エラー処理
+ * @endcode
+ *
+ * @param[in] src_ 追加元オブジェクト
+ * @param[in,out] dst_ 追加先オブジェクト
+ * @retval DYNAMIC_ARRAY_INVALID_ARGUMENT 引数src_またはdst_がNULL、要素のサイズが一致しない、または追加後の要素数が大きすぎる
+ * @retval DYNAMIC_ARRAY_INVALID_DARRAY 未初期化のsrc_またはdst_が渡された
+ * @retval DYNAMIC_ARRAY_BUFFER_FULL 容量が不足しており自動拡張が無効
+ * @retval DYNAMIC_ARRAY_MEMORY_ALLOCATE_ERROR 自動拡張時のメモリ確保に失敗
+ * @retval DYNAMIC_ARRAY_SUCCESS 追加に成功し、正常終了
+ */
+DYNAMIC_ARRAY_ERROR_CODE dynamic_array_append(const dynamic_array_t* const src_, dynamic_array_t* const dst_);
+
 /**
  * @brief dynamic_array_の内部バッファの配列インデックスelement_index_に格納されているデータをout_object_に格納する。
  *
@@ -409,6 +629,9 @@ DYNAMIC_ARRAY_ERROR_CODE dynamic_array_element_push(const void* const object_, d
  * dynamic_array_destroy(&test_array);
  * @endcode
  *
+ * @note out_object_には要素のサイズ(element_size)分のみコピーされる。
+ *       ループ内で多数の要素を読み出す場合は、コピーを伴わない @ref dynamic_array_element_const_ptr() または @ref dynamic_array_const_span() を使用すること。
+ *
  * @param[in] element_index_ 取得したいオブジェクトが格納されている配列インデックス
  * @param[in] dynamic_array_ 取得元オブジェクト
  * @param[out] out_object_ 取得したオブジェクト格納先
@@ -458,3 +681,151 @@ DYNAMIC_ARRAY_ERROR_CODE dynamic_array_element_ref(uint64_t element_index_, cons
  * @retval DYNAMIC_ARRAY_SUCCESS 上書きに成功し正常終了
  */
 DYNAMIC_ARRAY_ERROR_CODE dynamic_array_element_set(uint64_t element_index_, void* object_, dynamic_array_t* const dynamic_array_);
+
+/**
+ * @brief dynamic_array_の配列インデックスelement_index_に格納されているオブジェクトへのポインタを取得する(コピーは行わない)
+ *
+ * @note 取得したポインタを介してオブジェクトを直接書き換えることができる。
+ * @note 取得したポインタは、配列の拡張(resize, reserve, 自動拡張を伴うpush等)によってバッファが移動すると無効になる。
+ *
+ * 使用例:
+ * @code
+ * typedef struct element_data_t {
+ *     uint16_t data1;
+ *     uint16_t data2;
+ *     uint16_t data3;
+ * } element_data_t;
+ * dynamic_array_t test_array = DYNAMIC_ARRAY_INITIALIZER;
+ * DYNAMIC_ARRAY_ERROR_CODE result_create = dynamic_array_create(sizeof(element_data_t), alignof(element_data_t), 64, &test_array);
+ *
+ * element_data_t data = {10, 20, 30};
+ * DYNAMIC_ARRAY_ERROR_CODE result_push = dynamic_array_element_push(&data, &test_array);
+ * // エラー処理
+ *
+ * void* ptr = 0;
+ * DYNAMIC_ARRAY_ERROR_CODE result_ptr = dynamic_array_element_ptr(0, &test_array, &ptr);
+ * // エラー処理
+ * ((element_data_t*)ptr)->data1 = 11;     // 配列内の要素が直接書き換えられる
+ * dynamic_array_destroy(&test_array);
+ * @endcode
+ *
+ * @param[in] element_index_ 取得したいオブジェクトが格納されている配列インデックス
+ * @param[in] dynamic_array_ 取得元オブジェクト
+ * @param[out] out_ptr_ オブジェクトへのポインタ格納先
+ * @retval DYNAMIC_ARRAY_INVALID_ARGUMENT 引数dynamic_array_またはout_ptr_がNULL
+ * @retval DYNAMIC_ARRAY_INVALID_DARRAY 未初期化のdynamic_array_が渡された
+ * @retval DYNAMIC_ARRAY_OUT_OF_RANGE 保有している配列の範囲外のインデックスが渡された
+ * @retval DYNAMIC_ARRAY_SUCCESS ポインタの取得に成功し、正常終了
+ *
+ * @see dynamic_array_element_const_ptr()
+ */
+DYNAMIC_ARRAY_ERROR_CODE dynamic_array_element_ptr(uint64_t element_index_, dynamic_array_t* const dynamic_array_, void** const out_ptr_);
+
+/**
+ * @brief dynamic_array_の配列インデックスelement_index_に格納されているオブジェクトへの読み取り専用ポインタを取得する(コピーは行わない)
+ *
+ * @note @ref stack_pop_peek_ptr() と同様に、データのコピーを必要としないため高速に参照できる。
+ * @note 取得したポインタは、配列の拡張(resize, reserve, 自動拡張を伴うpush等)によってバッファが移動すると無効になる。
+ *
+ * 使用例:
+ * @code
+ * const void* ptr = 0;
+ * DYNAMIC_ARRAY_ERROR_CODE result_ptr = dynamic_array_element_const_ptr(0, &test_array, &ptr);
+ * // エラー処理
+ * uint16_t value = ((const element_data_t*)ptr)->data1;
+ * @endcode
+ *
+ * @param[in] element_index_ 取得したいオブジェクトが格納されている配列インデックス
+ * @param[in] dynamic_array_ 取得元オブジェクト
+ * @param[out] out_ptr_ オブジェクトへのポインタ格納先
+ * @retval DYNAMIC_ARRAY_INVALID_ARGUMENT 引数dynamic_array_またはout_ptr_がNULL
+ * @retval DYNAMIC_ARRAY_INVALID_DARRAY 未初期化のdynamic_array_が渡された
+ * @retval DYNAMIC_ARRAY_OUT_OF_RANGE 保有している配列の範囲外のインデックスが渡された
+ * @retval DYNAMIC_ARRAY_SUCCESS ポインタの取得に成功し、正常終了
+ *
+ * @see dynamic_array_element_ptr()
+ */
+DYNAMIC_ARRAY_ERROR_CODE dynamic_array_element_const_ptr(uint64_t element_index_, const dynamic_array_t* const dynamic_array_, const void** const out_ptr_);
+
+/**
+ * @brief dynamic_array_の内部バッファの先頭ポインタと要素間の間隔(stride)を取得する
+ *
+ * @note 要素i(0 <= i < 要素数)のアドレスは(char*)(*out_data_) + i * (*out_stride_)で求められる。
+ *       strideはアライメント要件を満たすためのパディングを含むため、sizeof(object)と一致するとは限らない。
+ * @note バッファが未確保(格納可能要素数が0)の場合、out_data_にはNULLが格納される。
+ * @note 取得したポインタは、配列の拡張(resize, reserve, 自動拡張を伴うpush等)によってバッファが移動すると無効になる。
+ *
+ * 使用例:
+ * @code
+ * void* data = 0;
+ * uint64_t stride = 0;
+ * uint64_t size = 0;
+ * dynamic_array_data(&test_array, &data, &stride);
+ * dynamic_array_size(&test_array, &size);
+ * for(uint64_t i = 0; i != size; ++i) {
+ *     element_data_t* element = (element_data_t*)((char*)data + i * stride);
+ *     element->data1 += 1;
+ * }
+ * @endcode
+ *
+ * @param[in] dynamic_array_ 取得元オブジェクト
+ * @param[out] out_data_ 内部バッファの先頭ポインタ格納先
+ * @param[out] out_stride_ 要素間の間隔(byte)格納先
+ * @retval DYNAMIC_ARRAY_INVALID_ARGUMENT 引数dynamic_array_、out_data_、out_stride_のいずれかがNULL
+ * @retval DYNAMIC_ARRAY_INVALID_DARRAY 未初期化のdynamic_array_が渡された
+ * @retval DYNAMIC_ARRAY_SUCCESS 取得に成功し、正常終了
+ */
+DYNAMIC_ARRAY_ERROR_CODE dynamic_array_data(dynamic_array_t* const dynamic_array_, void** const out_data_, uint64_t* const out_stride_);
+
+/**
+ * @brief dynamic_array_に格納されている要素全体を指す書き換え可能なスパンを取得する
+ *
+ * @note 要素が格納されていない場合は、begin == end、count == 0となる。
+ * @note 取得したスパンは、配列の拡張(resize, reserve, 自動拡張を伴うpush等)によってバッファが移動すると無効になる。
+ *
+ * 使用例:
+ * @code
+ * dynamic_array_span_t span;
+ * if(DYNAMIC_ARRAY_SUCCESS == dynamic_array_span(&test_array, &span)) {
+ *     for(char* it = span.begin; it != (char*)span.end; it += span.stride) {
+ *         ((element_data_t*)it)->data1 = 0;
+ *     }
+ * }
+ * @endcode
+ *
+ * @param[in] dynamic_array_ 取得元オブジェクト
+ * @param[out] out_span_ スパン格納先
+ * @retval DYNAMIC_ARRAY_INVALID_ARGUMENT 引数dynamic_array_またはout_span_がNULL
+ * @retval DYNAMIC_ARRAY_INVALID_DARRAY 未初期化のdynamic_array_が渡された
+ * @retval DYNAMIC_ARRAY_SUCCESS 取得に成功し、正常終了
+ *
+ * @see dynamic_array_const_span()
+ */
+DYNAMIC_ARRAY_ERROR_CODE dynamic_array_span(dynamic_array_t* const dynamic_array_, dynamic_array_span_t* const out_span_);
+
+/**
+ * @brief dynamic_array_に格納されている要素全体を指す読み取り専用のスパンを取得する
+ *
+ * @note 要素が格納されていない場合は、begin == end、count == 0となる。
+ * @note 取得したスパンは、配列の拡張(resize, reserve, 自動拡張を伴うpush等)によってバッファが移動すると無効になる。
+ *
+ * 使用例:
+ * @code
+ * dynamic_array_const_span_t span;
+ * uint64_t sum = 0;
+ * if(DYNAMIC_ARRAY_SUCCESS == dynamic_array_const_span(&test_array, &span)) {
+ *     for(const char* it = span.begin; it != (const char*)span.end; it += span.stride) {
+ *         sum += ((const element_data_t*)it)->data1;
+ *     }
+ * }
+ * @endcode
+ *
+ * @param[in] dynamic_array_ 取得元オブジェクト
+ * @param[out] out_span_ スパン格納先
+ * @retval DYNAMIC_ARRAY_INVALID_ARGUMENT 引数dynamic_array_またはout_span_がNULL
+ * @retval DYNAMIC_ARRAY_INVALID_DARRAY 未初期化のdynamic_array_が渡された
+ * @retval DYNAMIC_ARRAY_SUCCESS 取得に成功し、正常終了
+ *
+ * @see dynamic_array_span()
+ */
+DYNAMIC_ARRAY_ERROR_CODE dynamic_array_const_span(const dynamic_array_t* const dynamic_array_, dynamic_array_const_span_t* const out_span_);
@@ -0,0 +1,105 @@
+/**
+ * @file dynamic_array_unchecked.h
+ * @author chocolate-pie24
+ * @brief dynamic_array_tの引数チェックを省略したインライン版APIの定義
+ *
+ * @details
+ * ホットパス向けに、 @ref dynamic_array_element_push() 、 @ref dynamic_array_element_ref() 等から
+ * 引数チェック、オブジェクト状態チェック、エラーメッセージ出力を取り除いたstatic inline関数を提供する。
+ * 呼び出し側で以下を保証すること(違反時の動作は未定義。DEBUG_BUILD時はDEBUG_ASSERTで検出する):
+ *
+ * - dynamic_array_が @ref dynamic_array_create() により初期化済みであること
+ * - ポインタ引数がNULLでないこと
+ * - push時はバッファに空きがあること(自動拡張は行わない。事前に @ref dynamic_array_reserve() 等で確保しておくこと)
+ * - 要素アクセス時はelement_index_が格納数未満であること
+ *
+ * 上記が保証できない箇所では、エラーコードを返す通常版APIを使用すること。
+ *
+ * @version 0.1
+ * @date 2025-07-27
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "define.h"
+
+#include "containers/dynamic_array.h"
+#include "containers/internal/dynamic_array_internal_data.h"
+
+#include "core/core_memory.h"
+
+/**
+ * @brief 引数チェックを行わずに、object_をdynamic_array_の末尾に追加する
+ *
+ * @note 事前条件: dynamic_array_は初期化済みで、格納数がmax_element_count未満であること。object_はNULLでないこと。
+ *
+ * @param[in] object_ 追加オブジェクト
+ * @param[in,out] dynamic_array_ 追加対象配列
+ *
+ * @see dynamic_array_element_push()
+ */
+static inline void dynamic_array_element_push_unchecked(const void* const object_, dynamic_array_t* const dynamic_array_) {
+    DEBUG_ASSERT(0 != dynamic_array_ && 0 != dynamic_array_->internal_data && 0 != object_);
+    dynamic_array_internal_data_t* internal_data = (dynamic_array_internal_data_t*)(dynamic_array_->internal_data);
+    DEBUG_ASSERT(internal_data->element_count < internal_data->max_element_count);
+    char* dst_ptr = (char*)(internal_data->memory_pool) + (internal_data->aligned_element_size * internal_data->element_count);
+    core_copy_memory_small(object_, dst_ptr, internal_data->element_size);
+    internal_data->element_count++;
+}
+
+/**
+ * @brief 引数チェックを行わずに、element_index_番目の要素をout_object_にコピーする
+ *
+ * @note 事前条件: dynamic_array_は初期化済みで、element_index_は格納数未満であること。out_object_はNULLでないこと。
+ *
+ * @param[in] element_index_ 取得する要素のインデックス
+ * @param[in] dynamic_array_ 取得元配列
+ * @param[out] out_object_ コピー先バッファ
+ *
+ * @see dynamic_array_element_ref()
+ */
+static inline void dynamic_array_element_ref_unchecked(uint64_t element_index_, const dynamic_array_t* const dynamic_array_, void* const out_object_) {
+    DEBUG_ASSERT(0 != dynamic_array_ && 0 != dynamic_array_->internal_data && 0 != out_object_);
+    const dynamic_array_internal_data_t* internal_data = (const dynamic_array_internal_data_t*)(dynamic_array_->internal_data);
+    DEBUG_ASSERT(element_index_ < internal_data->element_count);
+    const char* src_ptr = (const char*)(internal_data->memory_pool) + (internal_data->aligned_element_size * element_index_);
+    core_copy_memory_small(src_ptr, out_object_, internal_data->element_size);
+}
+
+/**
+ * @brief 引数チェックを行わずに、element_index_番目の要素へのポインタを取得する
+ *
+ * @note 事前条件: dynamic_array_は初期化済みで、element_index_は格納数未満であること。
+ * @note 取得したポインタは、次の拡張(push / resize / reserve等)またはdestroyまで有効。
+ *
+ * @param[in] element_index_ 取得する要素のインデックス
+ * @param[in] dynamic_array_ 取得元配列
+ * @return void* 要素へのポインタ
+ *
+ * @see dynamic_array_element_ptr()
+ */
+static inline void* dynamic_array_element_ptr_unchecked(uint64_t element_index_, dynamic_array_t* const dynamic_array_) {
+    DEBUG_ASSERT(0 != dynamic_array_ && 0 != dynamic_array_->internal_data);
+    dynamic_array_internal_data_t* internal_data = (dynamic_array_internal_data_t*)(dynamic_array_->internal_data);
+    DEBUG_ASSERT(element_index_ < internal_data->element_count);
+    return (char*)(internal_data->memory_pool) + (internal_data->aligned_element_size * element_index_);
+}
+
+/**
+ * @brief 引数チェックを行わずに、dynamic_array_に格納されている要素数を取得する
+ *
+ * @note 事前条件: dynamic_array_は初期化済みであること。
+ *
+ * @param[in] dynamic_array_ 取得対象配列
+ * @return uint64_t 格納されている要素数
+ *
+ * @see dynamic_array_size()
+ */
+static inline uint64_t dynamic_array_size_unchecked(const dynamic_array_t* const dynamic_array_) {
+    DEBUG_ASSERT(0 != dynamic_array_ && 0 != dynamic_array_->internal_data);
+    return ((const dynamic_array_internal_data_t*)(dynamic_array_->internal_data))->element_count;
+}
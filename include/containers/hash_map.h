@@ -0,0 +1,314 @@
+/**
+ * @file hash_map.h
+ * @author chocolate-pie24
+ * @brief hash_map_tオブジェクトの定義と関連APIの宣言
+ *
+ * @details
+ * hash_map_tは、キーから値を平均O(1)で検索するためのオープンアドレス法のハッシュマップを提供する。特徴は、
+ * - 型を意識する必要なく、キーと値を格納する機能を提供(要素サイズ、アライメント要件の指定方法は @ref dynamic_array_create() と同じ)
+ * - キーの種類を生成時に選択可能
+ *   - @ref hash_map_create() : 固定サイズのキー。キーのバイト列でハッシュ値の計算、比較を行う(整数、ID、パディングのない構造体等)
+ *   - @ref hash_map_create_string_key() : core_string_tのキー。文字列の内容でハッシュ値の計算、比較を行い、キーは格納時にマップ内にコピーする
+ * - ハッシュ値は @ref core_hash_bytes() 、文字列キーは @ref core_string_hash() で計算する(文字列キーはキャッシュされたハッシュ値を再利用する)
+ * - Swiss Table方式のメタデータ配列
+ *   - スロットごとに1byteの制御バイト(空き / 削除済み / ハッシュ値の下位7bit)を持ち、16スロット分をベクトル命令(SSE2 / NEON、その他はSWAR)で一度に比較する
+ *   - キーの比較は制御バイトが一致したスロットのみ行うため、検索時にスロット本体にアクセスする回数はほぼ1回となる
+ * - 格納数がスロット数の7/8を超える場合は、スロット数を2倍にして自動で再配置する
+ * - @ref hash_map_reserve() による事前確保、 @ref hash_map_rehash() による再配置(削除済みスロットの回収、縮小)を利用者が制御可能
+ *
+ * @anchor hash_map_initialization_rule
+ * オブジェクトの状態(NULLポインタ / 未初期化状態 / デフォルト状態 / 初期化済み状態)の扱いは、
+ * @ref stack_initialization_rule と同じ。 @ref HASH_MAP_INITIALIZER または @ref hash_map_default_create() で
+ * デフォルト状態とした後、 @ref hash_map_create() / @ref hash_map_create_string_key() で初期化済み状態に遷移させること。
+ *
+ * 利用上の注意:
+ * - 値へのポインタ( @ref hash_map_find() 、 @ref hash_map_iterate() で取得)は、要素の追加、削除、再配置によって無効になる
+ * - 固定サイズのキーはバイト列として比較するため、パディングを含む構造体をキーとする場合はパディングを0で埋めること
+ * - スレッドセーフではない
+ *
+ * 使用例:
+ * @code
+ * hash_map_t map = HASH_MAP_INITIALIZER;
+ * hash_map_create_string_key(sizeof(uint32_t), alignof(uint32_t), 0, &map);
+ *
+ * core_string_t key = CORE_STRING_INITIALIZER;
+ * core_string_create("apple", &key);
+ * uint32_t count = 3;
+ * hash_map_insert(&key, &count, &map);
+ *
+ * void* value = 0;
+ * if(HASH_MAP_SUCCESS == hash_map_find(&key, &map, &value)) {
+ *     (*(uint32_t*)value)++;  // マップ内の値を直接更新する
+ * }
+ * core_string_destroy(&key);
+ * hash_map_destroy(&map);
+ * @endcode
+ *
+ * @version 0.1
+ * @date 2025-08-15
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdalign.h>
+
+/**
+ * @brief hash_map_t関連処理が出力するエラーコード
+ *
+ */
+typedef enum HASH_MAP_ERROR_CODE {
+    HASH_MAP_SUCCESS = 0x00,                /**< 正常終了 */
+    HASH_MAP_INVALID_ARGUMENT = 0x01,       /**< 引数異常 */
+    HASH_MAP_MEMORY_ALLOCATE_ERROR = 0x02,  /**< メモリアロケートエラー */
+    HASH_MAP_INVALID_MAP = 0x03,            /**< 無効なハッシュマップオブジェクト(未初期化) */
+    HASH_MAP_NOT_FOUND = 0x04,              /**< キーが格納されていない */
+} HASH_MAP_ERROR_CODE;
+
+/**
+ * @brief ハッシュマップオブジェクト構造体
+ *
+ * 格納するキー、値とそれに付随する管理情報を格納する。
+ * オブジェクトの初期化については、 @ref hash_map_initialization_rule を参照のこと。
+ */
+typedef struct hash_map_t {
+    void* internal_data;    /**< オブジェクト内部データ */
+} hash_map_t;
+
+/** @brief オブジェクト初期化用マクロ
+ *
+ * 使用例:
+ * @code
+ *  hash_map_t map = HASH_MAP_INITIALIZER;
+ * @endcode
+ */
+#define HASH_MAP_INITIALIZER { 0 }
+
+/**
+ * @brief 引数で与えたmap_オブジェクトを「デフォルト状態」に初期化する。
+ *
+ * @note 初期化済みオブジェクトに対して本関数を直接呼ぶと、内部データのメモリが解放されずメモリリークとなる。
+ *       再利用する場合は、必ず事前に @ref hash_map_destroy() を呼ぶこと。
+ *
+ * @note 引数map_にNULLを与えた場合には、ワーニングメッセージを出力し、処理を終了する。
+ *
+ * @param[in,out] map_ デフォルト状態とするオブジェクト
+ */
+void hash_map_default_create(hash_map_t* const map_);
+
+/**
+ * @brief 固定サイズのキーと値のメモリ要件、アライメント要件、格納数を指定し、map_を初期化する
+ *
+ * @note map_が既に初期化済みの場合、保持しているデータは破棄される。
+ * @note max_element_count_個の要素を再配置なしに格納できるスロットを確保する( @ref hash_map_reserve() と同じ)。0の場合は最初の挿入時に確保する。
+ * @note value_size_に0を指定した場合、値を持たないキーの集合として使用できる。
+ *
+ * 使用例:
+ * @code
+ * typedef struct position_t {
+ *     float x;
+ *     float y;
+ * } position_t;
+ *
+ * hash_map_t map = HASH_MAP_INITIALIZER;
+ * HASH_MAP_ERROR_CODE result = hash_map_create(sizeof(uint64_t), alignof(uint64_t), sizeof(position_t), alignof(position_t), 1024, &map);
+ * if(HASH_MAP_SUCCESS != result) {
+ *     // ここにエラー処理を書く
+ * }
+ * const uint64_t entity_id = 42;
+ * const position_t position = { 1.0f, 2.0f };
+ * hash_map_insert(&entity_id, &position, &map);
+ * hash_map_destroy(&map);
+ * @endcode
+ *
+ * @param[in] key_size_ キーのサイズ(byte)
+ * @param[in] key_alignment_ キーのアライメント要件(2の冪乗)
+ * @param[in] value_size_ 値のサイズ(byte)
+ * @param[in] value_alignment_ 値のアライメント要件(2の冪乗)
+ * @param[in] max_element_count_ 予約する格納数
+ * @param[out] map_ 初期化対象オブジェクト
+ *
+ * @retval HASH_MAP_INVALID_ARGUMENT map_がNULL、key_size_ / key_alignment_ / value_alignment_が0、アライメント要件が2の冪乗でない、またはサイズが大きすぎる
+ * @retval HASH_MAP_MEMORY_ALLOCATE_ERROR メモリ確保に失敗
+ * @retval HASH_MAP_SUCCESS 初期化に成功し、正常終了
+ */
+HASH_MAP_ERROR_CODE hash_map_create(uint64_t key_size_, uint8_t key_alignment_, uint64_t value_size_, uint8_t value_alignment_, uint64_t max_element_count_, hash_map_t* const map_);
+
+/**
+ * @brief core_string_tをキーとし、値のメモリ要件、アライメント要件、格納数を指定してmap_を初期化する
+ *
+ * @note キーは挿入時にマップ内のcore_string_tにコピーされ、削除時、 @ref hash_map_destroy() 時に破棄される。
+ *       挿入に使用したcore_string_tは挿入後に変更、破棄してよい。
+ * @note キーを指定する各APIのkey_には、const core_string_t*を渡すこと。デフォルト状態の文字列は空文字列として扱う。
+ * @note その他は @ref hash_map_create() と同じ。
+ *
+ * @param[in] value_size_ 値のサイズ(byte)
+ * @param[in] value_alignment_ 値のアライメント要件(2の冪乗)
+ * @param[in] max_element_count_ 予約する格納数
+ * @param[out] map_ 初期化対象オブジェクト
+ *
+ * @retval HASH_MAP_INVALID_ARGUMENT map_がNULL、value_alignment_が0または2の冪乗でない、またはサイズが大きすぎる
+ * @retval HASH_MAP_MEMORY_ALLOCATE_ERROR メモリ確保に失敗
+ * @retval HASH_MAP_SUCCESS 初期化に成功し、正常終了
+ */
+HASH_MAP_ERROR_CODE hash_map_create_string_key(uint64_t value_size_, uint8_t value_alignment_, uint64_t max_element_count_, hash_map_t* const map_);
+
+/**
+ * @brief map_が保持するメモリ(文字列キーを含む)を解放し、デフォルト状態に戻す
+ *
+ * @note 引数map_にNULLを与えた場合には、ワーニングメッセージを出力し、処理を終了する。
+ * @note デフォルト状態のオブジェクトに対して呼んでも問題ない(2重destroy可能)。
+ *
+ * @param[in,out] map_ 破棄対象オブジェクト
+ */
+void hash_map_destroy(hash_map_t* const map_);
+
+/**
+ * @brief max_element_count_個の要素を再配置なしに格納できるようスロットを確保する
+ *
+ * @note 既に十分なスロットがある場合は何もしない。不足する場合は格納済みの要素を新しいスロットに再配置する。
+ * @note 格納数が事前にわかっている場合に使用すると、挿入中の再配置(全要素の再ハッシュ)を避けられる。
+ *
+ * @param[in] max_element_count_ 格納する要素数
+ * @param[in,out] map_ 対象オブジェクト
+ *
+ * @retval HASH_MAP_INVALID_ARGUMENT map_がNULL、またはmax_element_count_が大きすぎる
+ * @retval HASH_MAP_INVALID_MAP map_が初期化されていない
+ * @retval HASH_MAP_MEMORY_ALLOCATE_ERROR メモリ確保に失敗(この場合、map_は変更されない)
+ * @retval HASH_MAP_SUCCESS 正常終了
+ */
+HASH_MAP_ERROR_CODE hash_map_reserve(uint64_t max_element_count_, hash_map_t* const map_);
+
+/**
+ * @brief 格納済みの要素をslot_count_個以上のスロットに再配置する
+ *
+ * @note 削除済みスロットはすべて回収される。削除を繰り返した後の検索性能の回復に使用する。
+ * @note slot_count_は2の冪乗に切り上げ、格納済みの要素数に対して不足する場合は必要な数まで増やす。
+ *       0を指定した場合は格納済みの要素数に必要な最小のスロット数とする(縮小)。
+ *
+ * @param[in] slot_count_ 再配置後のスロット数の下限
+ * @param[in,out] map_ 対象オブジェクト
+ *
+ * @retval HASH_MAP_INVALID_ARGUMENT map_がNULL、またはslot_count_が大きすぎる
+ * @retval HASH_MAP_INVALID_MAP map_が初期化されていない
+ * @retval HASH_MAP_MEMORY_ALLOCATE_ERROR メモリ確保に失敗(この場合、map_は変更されない)
+ * @retval HASH_MAP_SUCCESS 正常終了
+ */
+HASH_MAP_ERROR_CODE hash_map_rehash(uint64_t slot_count_, hash_map_t* const map_);
+
+/**
+ * @brief key_とvalue_の組をmap_に格納する。key_が格納済みの場合は値を上書きする
+ *
+ * @param[in] key_ キー(固定サイズのキーの場合はkey_sizeバイトがコピーされる。文字列キーの場合はconst core_string_t*)
+ * @param[in] value_ 値(value_sizeバイトがコピーされる。value_sizeが0の場合はNULLでもよい)
+ * @param[in,out] map_ 格納先オブジェクト
+ *
+ * @retval HASH_MAP_INVALID_ARGUMENT map_、key_、value_のいずれかがNULL
+ * @retval HASH_MAP_INVALID_MAP map_が初期化されていない
+ * @retval HASH_MAP_MEMORY_ALLOCATE_ERROR スロットの拡張、または文字列キーのコピーに失敗
+ * @retval HASH_MAP_SUCCESS 格納に成功し、正常終了
+ */
+HASH_MAP_ERROR_CODE hash_map_insert(const void* const key_, const void* const value_, hash_map_t* const map_);
+
+/**
+ * @brief key_に対応する値へのポインタを取得する
+ *
+ * @note 取得したポインタを通して値を直接更新してよい。
+ *
+ * @param[in] key_ キー(文字列キーの場合はconst core_string_t*)
+ * @param[in] map_ 検索対象オブジェクト
+ * @param[out] out_value_ 値へのポインタの格納先(見つからない場合は変更しない)
+ *
+ * @retval HASH_MAP_INVALID_ARGUMENT key_、map_、out_value_のいずれかがNULL
+ * @retval HASH_MAP_INVALID_MAP map_が初期化されていない
+ * @retval HASH_MAP_NOT_FOUND key_が格納されていない
+ * @retval HASH_MAP_SUCCESS 取得に成功し、正常終了
+ */
+HASH_MAP_ERROR_CODE hash_map_find(const void* const key_, const hash_map_t* const map_, void** const out_value_);
+
+/**
+ * @brief key_とその値をmap_から削除する
+ *
+ * @param[in] key_ キー(文字列キーの場合はconst core_string_t*)
+ * @param[in,out] map_ 削除対象オブジェクト
+ *
+ * @retval HASH_MAP_INVALID_ARGUMENT key_またはmap_がNULL
+ * @retval HASH_MAP_INVALID_MAP map_が初期化されていない
+ * @retval HASH_MAP_NOT_FOUND key_が格納されていない
+ * @retval HASH_MAP_SUCCESS 削除に成功し、正常終了
+ */
+HASH_MAP_ERROR_CODE hash_map_erase(const void* const key_, hash_map_t* const map_);
+
+/**
+ * @brief map_に格納されている全ての要素を削除する(スロットは保持する)
+ *
+ * @param[in,out] map_ 対象オブジェクト
+ *
+ * @retval HASH_MAP_INVALID_ARGUMENT map_がNULL
+ * @retval HASH_MAP_INVALID_MAP map_が初期化されていない
+ * @retval HASH_MAP_SUCCESS 正常終了
+ */
+HASH_MAP_ERROR_CODE hash_map_clear(hash_map_t* const map_);
+
+/**
+ * @brief map_に格納されている要素数を取得する
+ *
+ * @param[in] map_ 取得対象オブジェクト
+ * @param[out] out_size_ 要素数格納先
+ *
+ * @retval HASH_MAP_INVALID_ARGUMENT map_またはout_size_がNULL
+ * @retval HASH_MAP_INVALID_MAP map_が初期化されていない
+ * @retval HASH_MAP_SUCCESS 取得に成功し、正常終了
+ */
+HASH_MAP_ERROR_CODE hash_map_size(const hash_map_t* const map_, uint64_t* const out_size_);
+
+/**
+ * @brief map_のスロット数を取得する
+ *
+ * @note 再配置なしに格納できる要素数は、スロット数の7/8である。
+ *
+ * @param[in] map_ 取得対象オブジェクト
+ * @param[out] out_slot_count_ スロット数格納先
+ *
+ * @retval HASH_MAP_INVALID_ARGUMENT map_またはout_slot_count_がNULL
+ * @retval HASH_MAP_INVALID_MAP map_が初期化されていない
+ * @retval HASH_MAP_SUCCESS 取得に成功し、正常終了
+ */
+HASH_MAP_ERROR_CODE hash_map_slot_count(const hash_map_t* const map_, uint64_t* const out_slot_count_);
+
+/**
+ * @brief map_に格納されている要素を順に取得する
+ *
+ * @note 順序は不定。反復中に要素の追加、削除を行った場合の結果は不定。
+ *
+ * 使用例:
+ * @code
+ * uint64_t cursor = 0;
+ * const void* key = 0;
+ * void* value = 0;
+ * while(hash_map_iterate(&map, &cursor, &key, &value)) {
+ *     // 文字列キーの場合、keyはconst core_string_t*
+ * }
+ * @endcode
+ *
+ * @param[in] map_ 対象オブジェクト
+ * @param[in,out] cursor_ 反復位置(最初の呼び出し前に0で初期化する)
+ * @param[out] out_key_ キーへのポインタの格納先
+ * @param[out] out_value_ 値へのポインタの格納先
+ *
+ * @retval true  要素を取得した
+ * @retval false 全ての要素を取得済み、引数がNULL、またはmap_が初期化されていない
+ */
+bool hash_map_iterate(const hash_map_t* const map_, uint64_t* const cursor_, const void** const out_key_, void** const out_value_);
+
+/**
+ * @brief エラーコードを文字列に変換する
+ *
+ * @param[in] err_code_ hash_map_t関連処理が出力するエラーコード
+ *
+ * @return const char* エラーメッセージ
+ */
+const char* hash_map_error_code_to_string(HASH_MAP_ERROR_CODE err_code_);
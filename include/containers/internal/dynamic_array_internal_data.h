@@ -7,18 +7,21 @@
  * API利用者がこのヘッダを直接インクルードする必要はない。
  *
  * @note 内部用ヘッダであり、公開インターフェースでは使用しないこと。
+ * @note インライン展開される非チェック版API(dynamic_array_unchecked.h)から参照するため、includeディレクトリに配置している。
  */
 #pragma once
 
 #include <stdint.h>
 
+#include "core/core_memory.h"
+
 /**
  * @struct dynamic_array_internal_data_t
  * @brief dynamic_array_tの内部構造体。バッファ管理データと格納するオブジェクトデータを格納する
  *
  * この構造体は dynamic_array_t の実装における内部状態を表す。
  * 利用者が直接この構造体にアクセスすることは想定されておらず、
- * dynamic_array.c内でのみ使用される。
+ * dynamic_array.cおよびdynamic_array_unchecked.h内でのみ使用される。
  *
  */
 typedef struct dynamic_array_internal_data_t {
@@ -28,5 +31,7 @@ typedef struct dynamic_array_internal_data_t {
     uint64_t max_element_count;     /**< memory_poolに格納可能なオブジェクトの数 */
     uint64_t aligned_element_size;  /**< アライメントされた各オブジェクトに必要なメモリ領域 */
     uint8_t alignment_requirement;  /**< 格納するオブジェクトのメモリアラインメント要件 */
+    uint16_t growth_factor_percent; /**< バッファ満杯時の自動拡張率(%)。0の場合は自動拡張しない */
     alignas(8) void* memory_pool;   /**< @brief オブジェクト格納先バッファ */
+    core_arena_t* arena;            /**< メモリ確保元アリーナ(NULLの場合はヒープから確保する) */
 } dynamic_array_internal_data_t;
@@ -0,0 +1,28 @@
+/**
+ * @file stack_internal_data.h
+ * @brief stack_tの内部実装に関する構造体定義（非公開ヘッダ）
+ *
+ * このヘッダファイルは、stackモジュール内部で使用される
+ * stack_internal_data_t構造体を定義する。
+ * API利用者がこのヘッダを直接インクルードする必要はない。
+ *
+ * @note 内部用ヘッダであり、公開インターフェースでは使用しないこと。
+ * @note インライン展開される非チェック版API(stack_unchecked.h)から参照するため、includeディレクトリに配置している。
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "core/core_memory.h"
+
+typedef struct stack_internal_data_t {
+    uint64_t element_size;          /**< 格納するオブジェクトのサイズ(byte) */
+    uint64_t buffer_size;           /**< memory_poolのサイズ(byte) */
+    uint64_t max_element_count;     /**< memory_poolに格納可能なオブジェクトの数 */
+    uint64_t aligned_element_size;  /**< アライメントされた各オブジェクトに必要なメモリ領域 */
+    uint64_t top_index;
+    uint8_t alignment_requirement;  /**< 格納するオブジェクトのメモリアラインメント要件 */
+    uint8_t valid_flags;
+    void* memory_pool;              /**< オブジェクト格納先バッファ */
+    core_arena_t* arena;            /**< メモリ確保元アリーナ(NULLの場合はヒープから確保する) */
+} stack_internal_data_t;
@@ -0,0 +1,190 @@
+/**
+ * @file ring_queue.h
+ * @author chocolate-pie24
+ * @brief ring_queue_tオブジェクトの定義と関連APIの宣言
+ *
+ * @details
+ * ring_queue_tは、スレッド間でオブジェクトを受け渡すための固定長のロックフリーFIFOキューを提供する。特徴は、
+ * - 型を意識する必要なく、オブジェクトをpush / popする機能を提供(要素サイズ、アライメント要件の指定方法は @ref stack_create() と同じ)
+ * - 生成時に動作モードを選択可能
+ *   - @ref RING_QUEUE_MODE_SPSC : 単一プロデューサ / 単一コンシューマ。push / popともにアトミックなロード/ストアのみで動作する
+ *   - @ref RING_QUEUE_MODE_MPMC : 複数プロデューサ / 複数コンシューマ。スロットごとのシーケンス番号とCASで排他する(Vyukov方式)
+ * - 格納可能数は2の冪乗(インデックス計算をマスク演算で行うため)
+ * - プロデューサ側(tail)とコンシューマ側(head)の管理データをキャッシュライン境界で分離し、false sharingを防止
+ * - ロックを使用しないため、満杯/空の場合は待たずに @ref RING_QUEUE_FULL / @ref RING_QUEUE_EMPTY を返す
+ *
+ * @anchor ring_queue_initialization_rule
+ * オブジェクトの状態(NULLポインタ / 未初期化状態 / デフォルト状態 / 初期化済み状態)の扱いは、
+ * @ref stack_initialization_rule と同じ。 @ref RING_QUEUE_INITIALIZER または @ref ring_queue_default_create() で
+ * デフォルト状態とした後、 @ref ring_queue_create() で初期化済み状態に遷移させること。
+ *
+ * スレッド安全性:
+ * - ring_queue_push() / ring_queue_pop() は、動作モードの制約(SPSCの場合はプロデューサ、コンシューマそれぞれ1スレッド)の範囲でスレッドセーフ
+ * - ring_queue_create() / ring_queue_destroy() はスレッドセーフではない。他スレッドがキューにアクセスしていない状態で呼ぶこと
+ *
+ * @version 0.1
+ * @date 2025-08-10
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief ring_queue_t関連処理が出力するエラーコード
+ *
+ */
+typedef enum RING_QUEUE_ERROR_CODE {
+    RING_QUEUE_SUCCESS = 0x00,                  /**< 正常終了 */
+    RING_QUEUE_MEMORY_ALLOCATE_ERROR = 0x01,    /**< メモリアロケートエラー */
+    RING_QUEUE_INVALID_ARGUMENT = 0x02,         /**< 引数異常 */
+    RING_QUEUE_INVALID_QUEUE = 0x03,            /**< 無効なキューオブジェクト(未初期化) */
+    RING_QUEUE_EMPTY = 0x04,                    /**< キューが空 */
+    RING_QUEUE_FULL = 0x05,                     /**< キューが満杯 */
+} RING_QUEUE_ERROR_CODE;
+
+/**
+ * @brief ring_queue_tの動作モード
+ *
+ */
+typedef enum RING_QUEUE_MODE {
+    RING_QUEUE_MODE_SPSC = 0x00,    /**< 単一プロデューサ / 単一コンシューマ */
+    RING_QUEUE_MODE_MPMC = 0x01,    /**< 複数プロデューサ / 複数コンシューマ */
+} RING_QUEUE_MODE;
+
+/**
+ * @brief リングキューオブジェクト構造体
+ *
+ * キューに格納するオブジェクトとそれに付随する管理情報を格納する。
+ * オブジェクトの初期化については、 @ref ring_queue_initialization_rule を参照のこと。
+ */
+typedef struct ring_queue_t {
+    void* internal_data;    /**< オブジェクト内部データ */
+} ring_queue_t;
+
+/** @brief オブジェクト初期化用マクロ
+ *
+ * 使用例:
+ * @code
+ *  ring_queue_t queue = RING_QUEUE_INITIALIZER;
+ * @endcode
+ */
+#define RING_QUEUE_INITIALIZER { 0 }
+
+/**
+ * @brief 引数で与えたqueue_オブジェクトを「デフォルト状態」に初期化する。
+ *
+ * @note 初期化済みオブジェクトに対して本関数を直接呼ぶと、内部データのメモリが解放されずメモリリークとなる。
+ *       再利用する場合は、必ず事前に @ref ring_queue_destroy() を呼ぶこと。
+ *
+ * @note 引数queue_にNULLを与えた場合には、ワーニングメッセージを出力し、処理を終了する。
+ *
+ * @param[in,out] queue_ デフォルト状態とするオブジェクト
+ */
+void ring_queue_default_create(ring_queue_t* const queue_);
+
+/**
+ * @brief 格納するオブジェクトのメモリ要件、アライメント要件、最大格納数、動作モードを指定し、queue_を初期化する
+ *
+ * @note queue_が既に初期化済みの場合、保持しているバッファは破棄される。
+ *
+ * 使用例:
+ * @code
+ * typedef struct work_item_t {
+ *     uint32_t id;
+ *     float value;
+ * } work_item_t;
+ *
+ * ring_queue_t queue = RING_QUEUE_INITIALIZER;
+ * RING_QUEUE_ERROR_CODE result = ring_queue_create(sizeof(work_item_t), alignof(work_item_t), 1024, RING_QUEUE_MODE_MPMC, &queue);
+ * if(RING_QUEUE_SUCCESS != result) {
+ *     // ここにエラー処理を書く
+ * }
+ * // 各スレッドでring_queue_push / ring_queue_popを呼ぶ
+ * ring_queue_destroy(&queue);
+ * @endcode
+ *
+ * @param[in] element_size_ 格納するオブジェクトのサイズ(byte)
+ * @param[in] alignment_requirement_ 格納するオブジェクトのアライメント要件(2の冪乗)
+ * @param[in] max_element_count_ 最大格納数(2の冪乗)
+ * @param[in] mode_ 動作モード
+ * @param[out] queue_ 初期化対象オブジェクト
+ *
+ * @retval RING_QUEUE_INVALID_ARGUMENT queue_がNULL、element_size_ / alignment_requirement_ / max_element_count_が0、2の冪乗でない、または大きすぎる
+ * @retval RING_QUEUE_MEMORY_ALLOCATE_ERROR メモリ確保に失敗
+ * @retval RING_QUEUE_SUCCESS 初期化に成功し、正常終了
+ */
+RING_QUEUE_ERROR_CODE ring_queue_create(uint64_t element_size_, uint8_t alignment_requirement_, uint64_t max_element_count_, RING_QUEUE_MODE mode_, ring_queue_t* const queue_);
+
+/**
+ * @brief queue_が保持するバッファを解放し、デフォルト状態に戻す
+ *
+ * @note 引数queue_にNULLを与えた場合には、ワーニングメッセージを出力し、処理を終了する。
+ * @note デフォルト状態のオブジェクトに対して呼んでも問題ない(2重destroy可能)。
+ *
+ * @param[in,out] queue_ 破棄対象オブジェクト
+ */
+void ring_queue_destroy(ring_queue_t* const queue_);
+
+/**
+ * @brief data_をqueue_の末尾に追加する
+ *
+ * @param[in,out] queue_ オブジェクト追加対象キュー
+ * @param[in] data_ 追加オブジェクト(element_sizeバイトがコピーされる)
+ *
+ * @retval RING_QUEUE_INVALID_ARGUMENT queue_またはdata_がNULL
+ * @retval RING_QUEUE_INVALID_QUEUE queue_が初期化されていない
+ * @retval RING_QUEUE_FULL キューが満杯で追加できない
+ * @retval RING_QUEUE_SUCCESS 追加に成功し、正常終了
+ */
+RING_QUEUE_ERROR_CODE ring_queue_push(ring_queue_t* const queue_, const void* const data_);
+
+/**
+ * @brief queue_の先頭のオブジェクトを取り出し、out_data_にコピーする
+ *
+ * @param[in,out] queue_ データ取得元キュー
+ * @param[out] out_data_ データ格納先バッファ(element_sizeバイト以上)
+ *
+ * @retval RING_QUEUE_INVALID_ARGUMENT queue_またはout_data_がNULL
+ * @retval RING_QUEUE_INVALID_QUEUE queue_が初期化されていない
+ * @retval RING_QUEUE_EMPTY キューが空で取り出せない
+ * @retval RING_QUEUE_SUCCESS 取り出しに成功し、正常終了
+ */
+RING_QUEUE_ERROR_CODE ring_queue_pop(ring_queue_t* const queue_, void* const out_data_);
+
+/**
+ * @brief queue_の最大格納数を取得する
+ *
+ * @param[in] queue_ 取得対象キュー
+ * @param[out] out_capacity_ 最大格納数格納先
+ *
+ * @retval RING_QUEUE_INVALID_ARGUMENT queue_またはout_capacity_がNULL
+ * @retval RING_QUEUE_INVALID_QUEUE queue_が初期化されていない
+ * @retval RING_QUEUE_SUCCESS 取得に成功し、正常終了
+ */
+RING_QUEUE_ERROR_CODE ring_queue_capacity(const ring_queue_t* const queue_, uint64_t* const out_capacity_);
+
+/**
+ * @brief queue_に格納されているオブジェクト数を取得する
+ *
+ * @note 他スレッドがpush / popを行っている間は、取得した時点の概算値となる。
+ *
+ * @param[in] queue_ 取得対象キュー
+ * @param[out] out_size_ 格納数格納先
+ *
+ * @retval RING_QUEUE_INVALID_ARGUMENT queue_またはout_size_がNULL
+ * @retval RING_QUEUE_INVALID_QUEUE queue_が初期化されていない
+ * @retval RING_QUEUE_SUCCESS 取得に成功し、正常終了
+ */
+RING_QUEUE_ERROR_CODE ring_queue_size(const ring_queue_t* const queue_, uint64_t* const out_size_);
+
+/**
+ * @brief エラーコードを文字列に変換する
+ *
+ * @param[in] err_code_ ring_queue_t関連処理が出力するエラーコード
+ *
+ * @return const char* エラーメッセージ
+ */
+const char* ring_queue_error_code_to_string(RING_QUEUE_ERROR_CODE err_code_);
@@ -41,6 +41,8 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "core/core_memory.h"
+
 /**
  * @brief stack_t関連処理が出力するエラーコード
  *
@@ -168,6 +170,51 @@ void stack_default_create(stack_t* const stack_);
  */
 STACK_ERROR_CODE stack_create(uint64_t element_size_, uint8_t alignment_requirement_, uint64_t max_element_count_, stack_t* const stack_);
 
+/**
+ * @brief @ref stack_create() と同様にstack_を初期化する。ただし、内部データとオブジェクト格納用メモリ領域はarena_から確保する。
+ *
+ * @note 内部データとオブジェクト格納用メモリ領域の確保はアリーナのポインタを進めるのみで完了するため、
+ *       フレーム単位、リクエスト単位で生成/破棄するスタックに適している。
+ *
+ * @note アリーナ上に生成したオブジェクトに対して @ref stack_destroy() を呼んだ場合、メモリは解放されずデフォルト状態に戻るのみである。
+ *       メモリは @ref core_arena_reset() または @ref core_arena_destroy() によって一括で破棄される。
+ *       また、 @ref stack_resize() 、 @ref stack_reserve() による領域の再確保時も新たな領域はアリーナから確保され、旧領域はアリーナのリセットまで解放されない。
+ *
+ * @note arena_はstack_を使用し終えるまで有効でなければならない。
+ *
+ * 使用例:
+ * @code
+ * core_arena_t arena = CORE_ARENA_INITIALIZER;
+ * core_arena_create(64 * 1024, &arena);
+ *
+ * stack_t stack = STACK_INITIALIZER;
+ * STACK_ERROR_CODE result = stack_create_with_arena(sizeof(uint32_t), alignof(uint32_t), 128, &arena, &stack);
+ * if(STACK_ERROR_CODE_SUCCESS != result) {
+ *     // ここにエラー処理を書く
+ * }
+ *
+ * core_arena_reset(&arena);   // stackが使用していたメモリを一括破棄
+ * stack_default_create(&stack);
+ * core_arena_destroy(&arena);
+ * @endcode
+ *
+ * @param[in] element_size_ スタックに格納するオブジェクトのサイズ(sizeof(object)で取得する)
+ * @param[in] alignment_requirement_ スタックに格納するオブジェクトのアライメント要件(alignof(object)で取得する)
+ * @param[in] max_element_count_ スタックに格納するオブジェクトの数(1以上を指定する)
+ * @param[in,out] arena_ メモリ確保元アリーナ
+ * @param[out] stack_ 初期化対象オブジェクト
+ *
+ * @retval STACK_ERROR_INVALID_ARGUMENT
+ *                                      - 引数stack_またはarena_がNULL
+ *                                      - その他 @ref stack_create() と同様
+ * @retval STACK_ERROR_MEMORY_ALLOCATE_ERROR アリーナの空き容量が不足している
+ * @retval STACK_ERROR_CODE_SUCCESS オブジェクトの初期化に成功し、正常終了
+ *
+ * @see stack_create()
+ * @see core_arena_allocate()
+ */
+STACK_ERROR_CODE stack_create_with_arena(uint64_t element_size_, uint8_t alignment_requirement_, uint64_t max_element_count_, core_arena_t* const arena_, stack_t* const stack_);
+
 /**
  * @brief stack_が保持するメモリを破棄する。
  *
@@ -0,0 +1,105 @@
+/**
+ * @file stack_unchecked.h
+ * @author chocolate-pie24
+ * @brief stack_tの引数チェックを省略したインライン版APIの定義
+ *
+ * @details
+ * ホットパス向けに、 @ref stack_push() 、 @ref stack_pop() 等から引数チェック、オブジェクト状態チェック、
+ * エラーメッセージ出力を取り除いたstatic inline関数を提供する。
+ * 呼び出し側で以下を保証すること(違反時の動作は未定義。DEBUG_BUILD時はDEBUG_ASSERTで検出する):
+ *
+ * - stack_が @ref stack_create() により初期化済みであること
+ * - ポインタ引数がNULLでないこと
+ * - push時はスタックが満杯でないこと、pop / peek時はスタックが空でないこと
+ *
+ * 上記が保証できない箇所では、エラーコードを返す通常版APIを使用すること。
+ *
+ * @version 0.1
+ * @date 2025-08-10
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include <string.h> // for memset
+
+#include "define.h"
+
+#include "containers/stack.h"
+#include "containers/internal/stack_internal_data.h"
+
+#include "core/core_memory.h"
+
+/**
+ * @brief 引数チェックを行わずに、data_をstack_にpushする
+ *
+ * @note 事前条件: stack_は初期化済みで満杯でないこと。data_はNULLでないこと。
+ *
+ * @param[in,out] stack_ オブジェクト追加対象スタック
+ * @param[in] data_ 追加オブジェクト
+ *
+ * @see stack_push()
+ */
+static inline void stack_push_unchecked(stack_t* const stack_, const void* const data_) {
+    DEBUG_ASSERT(0 != stack_ && 0 != stack_->internal_data && 0 != data_);
+    stack_internal_data_t* internal_data = (stack_internal_data_t*)(stack_->internal_data);
+    DEBUG_ASSERT(internal_data->top_index < internal_data->max_element_count);
+    char* dst = (char*)(internal_data->memory_pool) + (internal_data->top_index * internal_data->aligned_element_size);
+    core_copy_memory_small(data_, dst, internal_data->element_size);
+    if(internal_data->aligned_element_size != internal_data->element_size) {
+        memset(dst + internal_data->element_size, 0, internal_data->aligned_element_size - internal_data->element_size);
+    }
+    internal_data->top_index++;
+}
+
+/**
+ * @brief 引数チェックを行わずに、stack_の一番上のデータをout_data_にコピーし、stack_から削除する
+ *
+ * @note 事前条件: stack_は初期化済みで空でないこと。out_data_はNULLでないこと。
+ *
+ * @param[in,out] stack_ データ取得元スタックオブジェクト
+ * @param[out] out_data_ データ格納先バッファ
+ *
+ * @see stack_pop()
+ */
+static inline void stack_pop_unchecked(const stack_t* const stack_, void* const out_data_) {
+    DEBUG_ASSERT(0 != stack_ && 0 != stack_->internal_data && 0 != out_data_);
+    stack_internal_data_t* internal_data = (stack_internal_data_t*)(stack_->internal_data);
+    DEBUG_ASSERT(0 != internal_data->top_index);
+    internal_data->top_index--;
+    const char* src = (const char*)(internal_data->memory_pool) + (internal_data->top_index * internal_data->aligned_element_size);
+    core_copy_memory_small(src, out_data_, internal_data->element_size);
+}
+
+/**
+ * @brief 引数チェックを行わずに、stack_の一番上のデータへの参照を取得する(データは削除されない)
+ *
+ * @note 事前条件: stack_は初期化済みで空でないこと。
+ * @note 取得した参照は、次のpush / resize / reserve / destroyまで有効。
+ *
+ * @param[in] stack_ データ取得元スタックオブジェクト
+ * @return const void* 一番上のデータへのポインタ
+ *
+ * @see stack_pop_peek_ptr()
+ */
+static inline const void* stack_peek_unchecked(const stack_t* const stack_) {
+    DEBUG_ASSERT(0 != stack_ && 0 != stack_->internal_data);
+    const stack_internal_data_t* internal_data = (const stack_internal_data_t*)(stack_->internal_data);
+    DEBUG_ASSERT(0 != internal_data->top_index);
+    return (const char*)(internal_data->memory_pool) + ((internal_data->top_index - 1) * internal_data->aligned_element_size);
+}
+
+/**
+ * @brief 引数チェックを行わずに、stack_に格納されているオブジェクト数を取得する
+ *
+ * @note 事前条件: stack_は初期化済みであること。
+ *
+ * @param[in] stack_ 取得対象スタックオブジェクト
+ * @return uint64_t 格納されているオブジェクト数
+ */
+static inline uint64_t stack_size_unchecked(const stack_t* const stack_) {
+    DEBUG_ASSERT(0 != stack_ && 0 != stack_->internal_data);
+    return ((const stack_internal_data_t*)(stack_->internal_data))->top_index;
+}
@@ -0,0 +1,280 @@
+/**
+ * @file typed_dynamic_array.h
+ * @author chocolate-pie24
+ * @brief 型特化した動的配列を生成するマクロテンプレートの定義
+ *
+ * @details
+ * dynamic_array_tは要素サイズを実行時に保持するため、要素のコピーは可変長のメモリコピーとなる。
+ * 本ヘッダの @ref DEFINE_DYNAMIC_ARRAY() は、要素型をコンパイル時に確定させた構造体とstatic inline関数群を生成する。
+ * 要素アクセスは通常の代入となるため、push / pop / refはコンパイラによりロード/ストア命令に展開される。
+ *
+ * 特徴は、
+ * - エラーコードはdynamic_array_tと共通の @ref DYNAMIC_ARRAY_ERROR_CODE を使用
+ * - 自動拡張の振る舞いは @ref dynamic_array_growth_policy_set() と同様(拡張率0の場合は自動拡張しない)
+ * - 引数チェックは @ref ENABLE_ARGUMENT_CHECK に従う
+ * - バッファはヒープ(MEMORY_TAG_DARRAY)から確保する。malloc標準のアライメントを超える型には使用しないこと
+ *
+ * 使用例:
+ * @code
+ * DEFINE_DYNAMIC_ARRAY(u32_array, uint32_t)    // u32_array_t型とu32_array_xxx関数群を生成
+ *
+ * u32_array_t array = TYPED_DYNAMIC_ARRAY_INITIALIZER;
+ * if(DYNAMIC_ARRAY_SUCCESS != u32_array_create(16, &array)) {
+ *     // ここにエラー処理を書く
+ * }
+ * const uint32_t value = 10;
+ * u32_array_push(&value, &array);
+ * uint32_t out = 0;
+ * u32_array_ref(0, &array, &out);
+ * u32_array_destroy(&array);
+ * @endcode
+ *
+ * スレッド安全性:
+ * - 本実装はスレッドセーフではない。必要に応じて呼び出し側で排他制御を行うこと。
+ *
+ * @version 0.1
+ * @date 2025-07-27
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "define.h"
+
+#include "containers/dynamic_array.h"
+
+#include "core/core_memory.h"
+#include "core/message.h"
+
+/**
+ * @brief 型特化動的配列をデフォルト状態(バッファ未確保)に初期化する
+ *
+ */
+#define TYPED_DYNAMIC_ARRAY_INITIALIZER { 0 }
+
+/**
+ * @brief 自動拡張時、max_element_countが0の場合に確保する要素数
+ *
+ */
+#define TYPED_DARRAY_GROWTH_INITIAL_COUNT 4
+
+#if ENABLE_ARGUMENT_CHECK
+/**
+ * @brief 引数のNULLチェックを行い、NULLであればDYNAMIC_ARRAY_INVALID_ARGUMENTで処理を終了するマクロ
+ *
+ */
+#define TYPED_DARRAY_CHECK_ARG_NULL_RETURN_ERROR(func_name_, arg_name_, ptr_) \
+    if(0 == (ptr_)) { \
+        ERROR_MESSAGE("%s - Argument %s requires a valid pointer.", func_name_, arg_name_); \
+        return DYNAMIC_ARRAY_INVALID_ARGUMENT; \
+    } \
+
+#else
+#define TYPED_DARRAY_CHECK_ARG_NULL_RETURN_ERROR(func_name_, arg_name_, ptr_) DEBUG_ASSERT(0 != (ptr_));
+#endif
+
+/**
+ * @brief 拡張率growth_factor_percent_に従い、required_count_個以上を格納可能な要素数を算出する
+ *
+ * @param[in] max_element_count_ 現在の格納可能要素数
+ * @param[in] required_count_ 必要な要素数
+ * @param[in] growth_factor_percent_ 拡張率(%)。100より大きい値であること
+ * @return uint64_t 拡張後の格納可能要素数
+ */
+static inline uint64_t typed_darray_next_count(uint64_t max_element_count_, uint64_t required_count_, uint16_t growth_factor_percent_) {
+    uint64_t next_count = (0 == max_element_count_) ? TYPED_DARRAY_GROWTH_INITIAL_COUNT : max_element_count_;
+    while(next_count < required_count_) {
+        if(next_count > (UINT64_MAX / growth_factor_percent_)) {
+            return required_count_; // これ以上拡張率を掛けられない場合は必要な分のみ確保する
+        }
+        const uint64_t grown_count = next_count * growth_factor_percent_ / 100;
+        next_count = (grown_count <= next_count) ? (next_count + 1) : grown_count;  // 要素数が少なく拡張率を掛けても増えない場合
+    }
+    return next_count;
+}
+
+/**
+ * @brief 要素型type_に特化した動的配列name_##_tと、関連するstatic inline関数群を生成する
+ *
+ * 生成される関数(引数順はdynamic_array_tのAPIに合わせ、操作対象の配列を最後に置く):
+ * - name_##_create(max_element_count_, array_)        : max_element_count_個分のバッファを確保する(既存のバッファは破棄)
+ * - name_##_destroy(array_)                           : バッファを解放し、デフォルト状態に戻す
+ * - name_##_resize(max_element_count_, array_)        : 格納済みの要素を保持したままバッファを拡張する
+ * - name_##_growth_policy_set(growth_factor_percent_, array_) : push時の自動拡張率を設定する(0 or 100より大きい値)
+ * - name_##_push(object_, array_)                     : 末尾に追加する
+ * - name_##_pop(array_, out_object_)                  : 末尾の要素を取り出す
+ * - name_##_ref(element_index_, array_, out_object_)  : 要素をコピーして取得する
+ * - name_##_set(element_index_, object_, array_)      : 要素を上書きする
+ * - name_##_ptr(element_index_, array_, out_ptr_)     : 要素へのポインタを取得する
+ * - name_##_clear(array_)                             : 格納数を0にする(バッファは保持)
+ * - name_##_size(array_) / name_##_capacity(array_)   : 格納数 / 格納可能数を返す
+ *
+ * @note type_にポインタ型を指定する場合は、const修飾が正しく付与されるようtypedefした型名を渡すこと。
+ *
+ * @param name_ 生成する型名、関数名のプレフィックス
+ * @param type_ 要素型
+ */
+#define DEFINE_DYNAMIC_ARRAY(name_, type_) \
+    typedef struct name_##_t { \
+        type_* data;                    /**< 要素格納先バッファ */ \
+        uint64_t element_count;         /**< 格納されている要素数 */ \
+        uint64_t max_element_count;     /**< バッファに格納可能な要素数 */ \
+        uint16_t growth_factor_percent; /**< バッファ満杯時の自動拡張率(%)。0の場合は自動拡張しない */ \
+    } name_##_t; \
+    \
+    /* 格納済みの要素を保持したまま、バッファをmax_element_count_個分に再確保し、未使用領域を0クリアする */ \
+    static inline DYNAMIC_ARRAY_ERROR_CODE name_##_grow(uint64_t max_element_count_, name_##_t* const array_) { \
+        if(max_element_count_ > (SIZE_MAX / sizeof(type_))) { \
+            ERROR_MESSAGE("%s - Provided max_element_count_ is too big.", #name_ "_grow"); \
+            return DYNAMIC_ARRAY_INVALID_ARGUMENT; \
+        } \
+        const size_t old_size = (size_t)(array_->max_element_count * sizeof(type_)); \
+        const size_t new_size = (size_t)(max_element_count_ * sizeof(type_)); \
+        type_* new_data = (0 == array_->data) ? (type_*)core_malloc_tagged(new_size, MEMORY_TAG_DARRAY) : (type_*)core_realloc_tagged(array_->data, old_size, new_size, MEMORY_TAG_DARRAY); \
+        if(0 == new_data) { \
+            ERROR_MESSAGE("%s - Failed to allocate buffer memory.", #name_ "_grow"); \
+            return DYNAMIC_ARRAY_MEMORY_ALLOCATE_ERROR; \
+        } \
+        const size_t used_size = (size_t)(array_->element_count * sizeof(type_)); \
+        core_zero_memory((char*)new_data + used_size, new_size - used_size); \
+        array_->data = new_data; \
+        array_->max_element_count = max_element_count_; \
+        return DYNAMIC_ARRAY_SUCCESS; \
+    } \
+    \
+    static inline void name_##_destroy(name_##_t* const array_) { \
+        if(0 == array_) { \
+            WARN_MESSAGE("%s - Argument array_ requires a valid pointer.", #name_ "_destroy"); \
+            return; \
+        } \
+        if(0 != array_->data) { \
+            core_free_tagged(array_->data, (size_t)(array_->max_element_count * sizeof(type_)), MEMORY_TAG_DARRAY); \
+        } \
+        array_->data = 0; \
+        array_->element_count = 0; \
+        array_->max_element_count = 0; \
+        array_->growth_factor_percent = 0; \
+    } \
+    \
+    static inline DYNAMIC_ARRAY_ERROR_CODE name_##_create(uint64_t max_element_count_, name_##_t* const array_) { \
+        TYPED_DARRAY_CHECK_ARG_NULL_RETURN_ERROR(#name_ "_create", "array_", array_) \
+        name_##_destroy(array_); \
+        if(0 == max_element_count_) { \
+            return DYNAMIC_ARRAY_SUCCESS; \
+        } \
+        return name_##_grow(max_element_count_, array_); \
+    } \
+    \
+    static inline DYNAMIC_ARRAY_ERROR_CODE name_##_resize(uint64_t max_element_count_, name_##_t* const array_) { \
+        TYPED_DARRAY_CHECK_ARG_NULL_RETURN_ERROR(#name_ "_resize", "array_", array_) \
+        if(max_element_count_ < array_->element_count) { \
+            ERROR_MESSAGE("%s - Cannot resize to smaller max_element_count than current element_count.", #name_ "_resize"); \
+            return DYNAMIC_ARRAY_INVALID_ARGUMENT; \
+        } \
+        if(max_element_count_ == array_->max_element_count) { \
+            return DYNAMIC_ARRAY_SUCCESS; \
+        } \
+        if(0 == max_element_count_) { \
+            const uint16_t growth_factor_percent = array_->growth_factor_percent; /* 拡張率の設定は保持する */ \
+            name_##_destroy(array_); \
+            array_->growth_factor_percent = growth_factor_percent; \
+            return DYNAMIC_ARRAY_SUCCESS; \
+        } \
+        return name_##_grow(max_element_count_, array_); \
+    } \
+    \
+    static inline DYNAMIC_ARRAY_ERROR_CODE name_##_growth_policy_set(uint16_t growth_factor_percent_, name_##_t* const array_) { \
+        TYPED_DARRAY_CHECK_ARG_NULL_RETURN_ERROR(#name_ "_growth_policy_set", "array_", array_) \
+        if(0 != growth_factor_percent_ && growth_factor_percent_ <= 100) { \
+            ERROR_MESSAGE("%s - Argument growth_factor_percent_ must be 0 or greater than 100.", #name_ "_growth_policy_set"); \
+            return DYNAMIC_ARRAY_INVALID_ARGUMENT; \
+        } \
+        array_->growth_factor_percent = growth_factor_percent_; \
+        return DYNAMIC_ARRAY_SUCCESS; \
+    } \
+    \
+    static inline DYNAMIC_ARRAY_ERROR_CODE name_##_push(const type_* const object_, name_##_t* const array_) { \
+        TYPED_DARRAY_CHECK_ARG_NULL_RETURN_ERROR(#name_ "_push", "array_", array_) \
+        TYPED_DARRAY_CHECK_ARG_NULL_RETURN_ERROR(#name_ "_push", "object_", object_) \
+        const type_ object = *object_;  /* object_が自身の要素を指していても拡張前に読み出しておく */ \
+        if(array_->element_count == array_->max_element_count) { \
+            if(0 == array_->growth_factor_percent) { \
+                ERROR_MESSAGE("%s - Dynamic array buffer full.", #name_ "_push"); \
+                return DYNAMIC_ARRAY_BUFFER_FULL; \
+            } \
+            const uint64_t next_count = typed_darray_next_count(array_->max_element_count, array_->element_count + 1, array_->growth_factor_percent); \
+            const DYNAMIC_ARRAY_ERROR_CODE result_grow = name_##_grow(next_count, array_); \
+            if(DYNAMIC_ARRAY_SUCCESS != result_grow) { \
+                return result_grow; \
+            } \
+        } \
+        array_->data[array_->element_count] = object; \
+        array_->element_count++; \
+        return DYNAMIC_ARRAY_SUCCESS; \
+    } \
+    \
+    static inline DYNAMIC_ARRAY_ERROR_CODE name_##_pop(name_##_t* const array_, type_* const out_object_) { \
+        TYPED_DARRAY_CHECK_ARG_NULL_RETURN_ERROR(#name_ "_pop", "array_", array_) \
+        TYPED_DARRAY_CHECK_ARG_NULL_RETURN_ERROR(#name_ "_pop", "out_object_", out_object_) \
+        if(0 == array_->element_count) { \
+            ERROR_MESSAGE("%s - Provided array is empty.", #name_ "_pop"); \
+            return DYNAMIC_ARRAY_OUT_OF_RANGE; \
+        } \
+        array_->element_count--; \
+        *out_object_ = array_->data[array_->element_count]; \
+        return DYNAMIC_ARRAY_SUCCESS; \
+    } \
+    \
+    static inline DYNAMIC_ARRAY_ERROR_CODE name_##_ref(uint64_t element_index_, const name_##_t* const array_, type_* const out_object_) { \
+        TYPED_DARRAY_CHECK_ARG_NULL_RETURN_ERROR(#name_ "_ref", "array_", array_) \
+        TYPED_DARRAY_CHECK_ARG_NULL_RETURN_ERROR(#name_ "_ref", "out_object_", out_object_) \
+        if(element_index_ >= array_->element_count) { \
+            ERROR_MESSAGE("%s - Requested element_index_ is out of range.", #name_ "_ref"); \
+            return DYNAMIC_ARRAY_OUT_OF_RANGE; \
+        } \
+        *out_object_ = array_->data[element_index_]; \
+        return DYNAMIC_ARRAY_SUCCESS; \
+    } \
+    \
+    static inline DYNAMIC_ARRAY_ERROR_CODE name_##_set(uint64_t element_index_, const type_* const object_, name_##_t* const array_) { \
+        TYPED_DARRAY_CHECK_ARG_NULL_RETURN_ERROR(#name_ "_set", "array_", array_) \
+        TYPED_DARRAY_CHECK_ARG_NULL_RETURN_ERROR(#name_ "_set", "object_", object_) \
+        if(element_index_ >= array_->element_count) { \
+            ERROR_MESSAGE("%s - Requested element_index_ is out of range.", #name_ "_set"); \
+            return DYNAMIC_ARRAY_OUT_OF_RANGE; \
+        } \
+        array_->data[element_index_] = *object_; \
+        return DYNAMIC_ARRAY_SUCCESS; \
+    } \
+    \
+    static inline DYNAMIC_ARRAY_ERROR_CODE name_##_ptr(uint64_t element_index_, name_##_t* const array_, type_** const out_ptr_) { \
+        TYPED_DARRAY_CHECK_ARG_NULL_RETURN_ERROR(#name_ "_ptr", "array_", array_) \
+        TYPED_DARRAY_CHECK_ARG_NULL_RETURN_ERROR(#name_ "_ptr", "out_ptr_", out_ptr_) \
+        if(element_index_ >= array_->element_count) { \
+            ERROR_MESSAGE("%s - Requested element_index_ is out of range.", #name_ "_ptr"); \
+            return DYNAMIC_ARRAY_OUT_OF_RANGE; \
+        } \
+        *out_ptr_ = array_->data + element_index_; \
+        return DYNAMIC_ARRAY_SUCCESS; \
+    } \
+    \
+    static inline DYNAMIC_ARRAY_ERROR_CODE name_##_clear(name_##_t* const array_) { \
+        TYPED_DARRAY_CHECK_ARG_NULL_RETURN_ERROR(#name_ "_clear", "array_", array_) \
+        array_->element_count = 0; \
+        return DYNAMIC_ARRAY_SUCCESS; \
+    } \
+    \
+    static inline uint64_t name_##_size(const name_##_t* const array_) { \
+        DEBUG_ASSERT(0 != array_); \
+        return array_->element_count; \
+    } \
+    \
+    static inline uint64_t name_##_capacity(const name_##_t* const array_) { \
+        DEBUG_ASSERT(0 != array_); \
+        return array_->max_element_count; \
+    } \
+
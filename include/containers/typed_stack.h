@@ -0,0 +1,227 @@
+/**
+ * @file typed_stack.h
+ * @author chocolate-pie24
+ * @brief 型特化したスタックを生成するマクロテンプレートの定義
+ *
+ * @details
+ * stack_tは要素サイズを実行時に保持するため、push / popは可変長のメモリコピーとなる。
+ * 本ヘッダの @ref DEFINE_STACK() は、要素型をコンパイル時に確定させた構造体とstatic inline関数群を生成する。
+ * 要素アクセスは通常の代入となるため、push / popはコンパイラによりロード/ストア命令に展開される。
+ *
+ * 特徴は、
+ * - エラーコードはstack_tと共通の @ref STACK_ERROR_CODE を使用
+ * - stack_tと同様にpush時の動的拡張は行わない(必要に応じてname_##_resizeで明示的に拡張する)
+ * - 引数チェックは @ref ENABLE_ARGUMENT_CHECK に従う
+ * - バッファはヒープ(MEMORY_TAG_STACK)から確保する。malloc標準のアライメントを超える型には使用しないこと
+ *
+ * 使用例:
+ * @code
+ * DEFINE_STACK(u32_stack, uint32_t)    // u32_stack_t型とu32_stack_xxx関数群を生成
+ *
+ * u32_stack_t stack = TYPED_STACK_INITIALIZER;
+ * if(STACK_ERROR_CODE_SUCCESS != u32_stack_create(16, &stack)) {
+ *     // ここにエラー処理を書く
+ * }
+ * const uint32_t value = 10;
+ * u32_stack_push(&stack, &value);
+ * uint32_t out = 0;
+ * u32_stack_pop(&stack, &out);
+ * u32_stack_destroy(&stack);
+ * @endcode
+ *
+ * スレッド安全性:
+ * - 本実装はスレッドセーフではない。必要に応じて呼び出し側で排他制御を行うこと。
+ *
+ * @version 0.1
+ * @date 2025-08-10
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "define.h"
+
+#include "containers/stack.h"
+
+#include "core/core_memory.h"
+#include "core/message.h"
+
+/**
+ * @brief 型特化スタックをデフォルト状態(バッファ未確保)に初期化する
+ *
+ */
+#define TYPED_STACK_INITIALIZER { 0 }
+
+#if ENABLE_ARGUMENT_CHECK
+/**
+ * @brief 引数のNULLチェックを行い、NULLであればSTACK_ERROR_INVALID_ARGUMENTで処理を終了するマクロ
+ *
+ */
+#define TYPED_STACK_CHECK_ARG_NULL_RETURN_ERROR(func_name_, arg_name_, ptr_) \
+    if(0 == (ptr_)) { \
+        ERROR_MESSAGE("%s - Argument %s requires a valid pointer.", func_name_, arg_name_); \
+        return STACK_ERROR_INVALID_ARGUMENT; \
+    } \
+
+/**
+ * @brief スタックのバッファが確保済みかをチェックし、未確保であればSTACK_ERROR_INVALID_STACKで処理を終了するマクロ
+ *
+ */
+#define TYPED_STACK_CHECK_VALID_RETURN_ERROR(func_name_, stack_) \
+    if(0 == (stack_)->data) { \
+        ERROR_MESSAGE("%s - Provided stack is not valid.", func_name_); \
+        return STACK_ERROR_INVALID_STACK; \
+    } \
+
+#else
+#define TYPED_STACK_CHECK_ARG_NULL_RETURN_ERROR(func_name_, arg_name_, ptr_) DEBUG_ASSERT(0 != (ptr_));
+#define TYPED_STACK_CHECK_VALID_RETURN_ERROR(func_name_, stack_) DEBUG_ASSERT(0 != (stack_)->data);
+#endif
+
+/**
+ * @brief 要素型type_に特化したスタックname_##_tと、関連するstatic inline関数群を生成する
+ *
+ * 生成される関数(引数順はstack_tのAPIに合わせる):
+ * - name_##_create(max_element_count_, stack_)   : max_element_count_個分のバッファを確保する(既存のバッファは破棄)
+ * - name_##_destroy(stack_)                      : バッファを解放し、デフォルト状態に戻す
+ * - name_##_resize(max_element_count_, stack_)   : 格納済みの要素を保持したままバッファを拡張する(縮小は不可)
+ * - name_##_push(stack_, data_)                  : 一番上に追加する
+ * - name_##_pop(stack_, out_data_)               : 一番上の要素を取り出す
+ * - name_##_peek_ptr(stack_, out_data_)          : 一番上の要素への参照を取得する(要素は削除しない)
+ * - name_##_clear(stack_)                        : 格納数を0にする(バッファは保持)
+ * - name_##_size(stack_) / name_##_full(stack_) / name_##_empty(stack_) : 格納数 / 満杯判定 / 空判定
+ *
+ * @note type_にポインタ型を指定する場合は、const修飾が正しく付与されるようtypedefした型名を渡すこと。
+ *
+ * @param name_ 生成する型名、関数名のプレフィックス
+ * @param type_ 要素型
+ */
+#define DEFINE_STACK(name_, type_) \
+    typedef struct name_##_t { \
+        type_* data;                /**< 要素格納先バッファ */ \
+        uint64_t top_index;         /**< 格納されている要素数(次にpushする位置) */ \
+        uint64_t max_element_count; /**< バッファに格納可能な要素数 */ \
+    } name_##_t; \
+    \
+    static inline void name_##_destroy(name_##_t* const stack_) { \
+        if(0 == stack_) { \
+            WARN_MESSAGE("%s - Argument stack_ requires a valid pointer.", #name_ "_destroy"); \
+            return; \
+        } \
+        if(0 != stack_->data) { \
+            core_free_tagged(stack_->data, (size_t)(stack_->max_element_count * sizeof(type_)), MEMORY_TAG_STACK); \
+        } \
+        stack_->data = 0; \
+        stack_->top_index = 0; \
+        stack_->max_element_count = 0; \
+    } \
+    \
+    static inline STACK_ERROR_CODE name_##_create(uint64_t max_element_count_, name_##_t* const stack_) { \
+        TYPED_STACK_CHECK_ARG_NULL_RETURN_ERROR(#name_ "_create", "stack_", stack_) \
+        if(0 == max_element_count_) { \
+            ERROR_MESSAGE("%s - Argument max_element_count_ requires a non-zero value.", #name_ "_create"); \
+            return STACK_ERROR_INVALID_ARGUMENT; \
+        } \
+        if(max_element_count_ > (SIZE_MAX / sizeof(type_))) { \
+            ERROR_MESSAGE("%s - Provided max_element_count_ is too big.", #name_ "_create"); \
+            return STACK_ERROR_INVALID_ARGUMENT; \
+        } \
+        name_##_destroy(stack_); \
+        const size_t buffer_size = (size_t)(max_element_count_ * sizeof(type_)); \
+        stack_->data = (type_*)core_malloc_tagged(buffer_size, MEMORY_TAG_STACK); \
+        if(0 == stack_->data) { \
+            ERROR_MESSAGE("%s - Failed to allocate buffer memory.", #name_ "_create"); \
+            return STACK_ERROR_MEMORY_ALLOCATE_ERROR; \
+        } \
+        core_zero_memory(stack_->data, buffer_size); \
+        stack_->max_element_count = max_element_count_; \
+        return STACK_ERROR_CODE_SUCCESS; \
+    } \
+    \
+    static inline STACK_ERROR_CODE name_##_resize(uint64_t max_element_count_, name_##_t* const stack_) { \
+        TYPED_STACK_CHECK_ARG_NULL_RETURN_ERROR(#name_ "_resize", "stack_", stack_) \
+        TYPED_STACK_CHECK_VALID_RETURN_ERROR(#name_ "_resize", stack_) \
+        if(max_element_count_ <= stack_->max_element_count) { \
+            ERROR_MESSAGE("%s - Shrinking the buffer is not allowed.", #name_ "_resize"); \
+            return STACK_ERROR_INVALID_ARGUMENT; \
+        } \
+        if(max_element_count_ > (SIZE_MAX / sizeof(type_))) { \
+            ERROR_MESSAGE("%s - Provided max_element_count_ is too big.", #name_ "_resize"); \
+            return STACK_ERROR_INVALID_ARGUMENT; \
+        } \
+        const size_t old_size = (size_t)(stack_->max_element_count * sizeof(type_)); \
+        const size_t new_size = (size_t)(max_element_count_ * sizeof(type_)); \
+        type_* new_data = (type_*)core_realloc_tagged(stack_->data, old_size, new_size, MEMORY_TAG_STACK); \
+        if(0 == new_data) { \
+            ERROR_MESSAGE("%s - Failed to allocate new buffer memory.", #name_ "_resize"); \
+            return STACK_ERROR_MEMORY_ALLOCATE_ERROR; \
+        } \
+        core_zero_memory((char*)new_data + old_size, new_size - old_size); \
+        stack_->data = new_data; \
+        stack_->max_element_count = max_element_count_; \
+        return STACK_ERROR_CODE_SUCCESS; \
+    } \
+    \
+    static inline STACK_ERROR_CODE name_##_push(name_##_t* const stack_, const type_* const data_) { \
+        TYPED_STACK_CHECK_ARG_NULL_RETURN_ERROR(#name_ "_push", "stack_", stack_) \
+        TYPED_STACK_CHECK_ARG_NULL_RETURN_ERROR(#name_ "_push", "data_", data_) \
+        TYPED_STACK_CHECK_VALID_RETURN_ERROR(#name_ "_push", stack_) \
+        if(stack_->top_index >= stack_->max_element_count) { \
+            ERROR_MESSAGE("%s - Provided stack is full.", #name_ "_push"); \
+            return STACK_ERROR_STACK_FULL; \
+        } \
+        stack_->data[stack_->top_index] = *data_; \
+        stack_->top_index++; \
+        return STACK_ERROR_CODE_SUCCESS; \
+    } \
+    \
+    static inline STACK_ERROR_CODE name_##_pop(name_##_t* const stack_, type_* const out_data_) { \
+        TYPED_STACK_CHECK_ARG_NULL_RETURN_ERROR(#name_ "_pop", "stack_", stack_) \
+        TYPED_STACK_CHECK_ARG_NULL_RETURN_ERROR(#name_ "_pop", "out_data_", out_data_) \
+        TYPED_STACK_CHECK_VALID_RETURN_ERROR(#name_ "_pop", stack_) \
+        if(0 == stack_->top_index) { \
+            ERROR_MESSAGE("%s - Provided stack is empty.", #name_ "_pop"); \
+            return STACK_ERROR_STACK_EMPTY; \
+        } \
+        stack_->top_index--; \
+        *out_data_ = stack_->data[stack_->top_index]; \
+        return STACK_ERROR_CODE_SUCCESS; \
+    } \
+    \
+    static inline STACK_ERROR_CODE name_##_peek_ptr(const name_##_t* const stack_, const type_** const out_data_) { \
+        TYPED_STACK_CHECK_ARG_NULL_RETURN_ERROR(#name_ "_peek_ptr", "stack_", stack_) \
+        TYPED_STACK_CHECK_ARG_NULL_RETURN_ERROR(#name_ "_peek_ptr", "out_data_", out_data_) \
+        TYPED_STACK_CHECK_VALID_RETURN_ERROR(#name_ "_peek_ptr", stack_) \
+        if(0 == stack_->top_index) { \
+            ERROR_MESSAGE("%s - Provided stack is empty.", #name_ "_peek_ptr"); \
+            return STACK_ERROR_STACK_EMPTY; \
+        } \
+        *out_data_ = stack_->data + (stack_->top_index - 1); \
+        return STACK_ERROR_CODE_SUCCESS; \
+    } \
+    \
+    static inline STACK_ERROR_CODE name_##_clear(name_##_t* const stack_) { \
+        TYPED_STACK_CHECK_ARG_NULL_RETURN_ERROR(#name_ "_clear", "stack_", stack_) \
+        stack_->top_index = 0; \
+        return STACK_ERROR_CODE_SUCCESS; \
+    } \
+    \
+    static inline uint64_t name_##_size(const name_##_t* const stack_) { \
+        DEBUG_ASSERT(0 != stack_); \
+        return stack_->top_index; \
+    } \
+    \
+    static inline bool name_##_full(const name_##_t* const stack_) { \
+        DEBUG_ASSERT(0 != stack_); \
+        return stack_->top_index >= stack_->max_element_count; \
+    } \
+    \
+    static inline bool name_##_empty(const name_##_t* const stack_) { \
+        DEBUG_ASSERT(0 != stack_); \
+        return 0 == stack_->top_index; \
+    } \
+
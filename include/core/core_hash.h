@@ -0,0 +1,145 @@
+/**
+ * @file core_hash.h
+ * @author chocolate-pie24
+ * @brief 非暗号学的64bitハッシュ関数の宣言
+ *
+ * @details
+ * ハッシュテーブルや重複排除で使用する、高速な64bitハッシュ値を計算する。暗号学的な強度は持たないため、
+ * 改ざん検出や外部から与えられたキーに対するHashDoS対策が必要な用途には使用しないこと(シードを秘匿することで緩和はできる)。
+ *
+ * - CORE_HASH_LONG_THRESHOLD byte以下の入力: wyhash方式(64bit x 64bit -> 128bitの乗算で混合)
+ * - それより長い入力: xxh3方式の8レーン累積(64byteのストライプ単位)を、実行環境のベクトル命令( core_hash_kernel_name() 参照)で計算する
+ *
+ * 同じ入力とシードに対するハッシュ値は、命令セットやプラットフォームによらず同じ値となる。
+ * ただし、ライブラリのバージョン間での一致は保証しないため、ハッシュ値を永続化しないこと。
+ *
+ * 入力を分割して与える場合は core_hash_state_t を使用する。分割の仕方によらず、 core_hash_bytes() と同じ値となる。
+ *
+ * 使用例:
+ * @code
+ * const uint64_t hash = core_hash_bytes("key", 3, CORE_HASH_DEFAULT_SEED);
+ *
+ * core_hash_state_t state;
+ * core_hash_state_init(CORE_HASH_DEFAULT_SEED, &state);
+ * core_hash_state_update("k", 1, &state);
+ * core_hash_state_update("ey", 2, &state);
+ * // core_hash_state_digest(&state) == hash
+ * @endcode
+ *
+ * @version 0.1
+ * @date 2025-07-20
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief 標準のシード(core_string_hash()、hash_map_tが使用する)
+ *
+ */
+#define CORE_HASH_DEFAULT_SEED 0xa0761d6478bd642full
+
+/**
+ * @brief この長さ(byte)を超える入力を、ベクトル命令による累積で処理する
+ *
+ */
+#define CORE_HASH_LONG_THRESHOLD 256
+
+/**
+ * @brief 累積処理の単位(byte)
+ *
+ */
+#define CORE_HASH_STRIPE_SIZE 64
+
+/**
+ * @brief エラーコードリスト
+ *
+ */
+typedef enum CORE_HASH_ERROR_CODE {
+    CORE_HASH_SUCCESS = 0x00,           /**< 正常終了 */
+    CORE_HASH_INVALID_ARGUMENT = 0x01,  /**< 引数異常 */
+} CORE_HASH_ERROR_CODE;
+
+/**
+ * @brief 分割した入力のハッシュ値を計算するための状態
+ *
+ * core_string_view_tと同様に値として扱うことができ、メモリを保持しない(破棄処理は不要)。
+ * メンバは core_hash.c 内部で使用するため、直接参照、変更しないこと。
+ */
+typedef struct core_hash_state_t {
+    uint64_t acc[8];            /**< 累積値(入力長が CORE_HASH_LONG_THRESHOLD を超えた場合に使用) */
+    uint64_t seed;              /**< シード */
+    uint64_t total_length;      /**< これまでに与えられた入力の合計長(byte) */
+    uint64_t stripe_count;      /**< 現在のブロック内で累積済みのストライプ数 */
+    uint64_t buffer_size;       /**< bufferに保持している入力の長さ(byte) */
+    unsigned char buffer[CORE_HASH_LONG_THRESHOLD];     /**< 未処理の入力 */
+    unsigned char last_stripe[CORE_HASH_STRIPE_SIZE];   /**< 累積済みの入力の末尾(最終ストライプの組み立てに使用) */
+} core_hash_state_t;
+
+/**
+ * @brief data_の先頭length_ byteのハッシュ値を計算する
+ *
+ * @note data_がNULLでlength_が0でない場合はエラーメッセージを出力し、長さ0の入力として扱う
+ *
+ * @param[in] data_ 入力(length_が0の場合はNULLでもよい)
+ * @param[in] length_ 入力の長さ(byte)
+ * @param[in] seed_ シード(異なるシードでは異なるハッシュ値の系列となる)
+ *
+ * @return ハッシュ値
+ */
+uint64_t core_hash_bytes(const void* const data_, uint64_t length_, uint64_t seed_);
+
+/**
+ * @brief 分割入力用の状態をstate_に初期化する
+ *
+ * @param[in] seed_ シード
+ * @param[out] state_ 初期化対象
+ *
+ * @retval CORE_HASH_SUCCESS 初期化成功
+ * @retval CORE_HASH_INVALID_ARGUMENT state_がNULL
+ */
+CORE_HASH_ERROR_CODE core_hash_state_init(uint64_t seed_, core_hash_state_t* const state_);
+
+/**
+ * @brief state_に入力を追加する
+ *
+ * @note CORE_HASH_LONG_THRESHOLD byteまでは内部のバッファに保持し、それを超えた分はストライプ単位で累積する
+ *
+ * @param[in] data_ 入力(length_が0の場合はNULLでもよい)
+ * @param[in] length_ 入力の長さ(byte)
+ * @param[in,out] state_ core_hash_state_init()で初期化した状態
+ *
+ * @retval CORE_HASH_SUCCESS 追加成功
+ * @retval CORE_HASH_INVALID_ARGUMENT state_がNULL、またはdata_がNULLでlength_が0でない
+ */
+CORE_HASH_ERROR_CODE core_hash_state_update(const void* const data_, uint64_t length_, core_hash_state_t* const state_);
+
+/**
+ * @brief state_にこれまで与えた入力全体のハッシュ値を取得する
+ *
+ * @note state_は変更しないため、続けて入力を追加できる
+ *
+ * @param[in] state_ core_hash_state_init()で初期化した状態
+ *
+ * @return 入力全体を core_hash_bytes() に与えた場合と同じハッシュ値。state_がNULLの場合は0
+ */
+uint64_t core_hash_state_digest(const core_hash_state_t* const state_);
+
+/**
+ * @brief 長い入力の累積処理が使用している命令セット名を取得する
+ *
+ * @return const char* 命令セット名("avx2", "sse2", "neon", "word"のいずれか)
+ */
+const char* core_hash_kernel_name(void);
+
+/**
+ * @brief エラーコードを文字列に変換する
+ *
+ * @param[in] err_code_ core_hash関連処理が出力するエラーコード
+ *
+ * @return const char* エラーメッセージ
+ */
+const char* core_hash_error_code_to_string(CORE_HASH_ERROR_CODE err_code_);
@@ -2,6 +2,17 @@
  * @file core_memory.h
  * @author chocolate-pie24
  * @brief メモリ関連処理定義
+ *
+ * @details
+ * 汎用的なメモリ確保/解放/クリア処理に加え、線形アロケータ(アリーナ)を提供する。
+ *
+ * アリーナ(core_arena_t)は、事前に確保した一つのメモリ領域から先頭側に向かって順に領域を切り出すアロケータである。
+ * 個別の解放は行わず、 @ref core_arena_reset() によってすべての割り当てをO(1)で一括破棄する。
+ * フレーム単位、リクエスト単位で生成/破棄されるオブジェクトの格納先として使用することを想定している。
+ *
+ * また、メモリ種別(MEMORY_TAG)付きの確保/解放処理を提供し、種別ごとの使用量(現在値、最大値、確保/解放回数)を記録する。
+ * 記録はrelaxedなアトミック加算のみで行われるため、リリースビルドでも有効のまま運用できる。
+ *
  * @version 0.1
  * @date 2025-07-20
  *
@@ -12,19 +23,147 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h> // for memcpy
+
+/**
+ * @brief core_memory関連処理が出力するエラーコード
+ *
+ */
+typedef enum CORE_MEMORY_ERROR_CODE {
+    CORE_MEMORY_SUCCESS = 0x00,                 /**< 正常終了 */
+    CORE_MEMORY_INVALID_ARGUMENT = 0x01,        /**< 引数異常 */
+    CORE_MEMORY_MEMORY_ALLOCATE_ERROR = 0x02,   /**< メモリアロケートエラー */
+    CORE_MEMORY_INVALID_ARENA = 0x03,           /**< 無効なアリーナオブジェクト */
+    CORE_MEMORY_ARENA_FULL = 0x04,              /**< アリーナの空き容量不足 */
+} CORE_MEMORY_ERROR_CODE;
+
+#ifndef ENABLE_MEMORY_TRACKING
+    /**
+     * @brief メモリトラッキング有効化スイッチ用マクロ定義
+     * @note 記録処理は軽量であるため、デバッグビルド/リリースビルド共に有効とする。コンパイルオプションで0を与えると無効化できる。
+     */
+    #define ENABLE_MEMORY_TRACKING 1
+#endif
+
+/**
+ * @brief メモリトラッキング用のメモリ種別リスト
+ *
+ */
+typedef enum MEMORY_TAG {
+    MEMORY_TAG_STRING,      /**< core_string_t */
+    MEMORY_TAG_DARRAY,      /**< dynamic_array_t */
+    MEMORY_TAG_STACK,       /**< stack_t */
+    MEMORY_TAG_QUEUE,       /**< ring_queue_t */
+    MEMORY_TAG_HASH_MAP,    /**< hash_map_t */
+    MEMORY_TAG_ARENA,       /**< core_arena_t(アリーナ上に生成したオブジェクトはアリーナの使用量として計上される) */
+    MEMORY_TAG_MESSAGE,     /**< メッセージ出力 */
+    MEMORY_TAG_USER,        /**< ライブラリ利用者 */
+    MEMORY_TAG_MAX,         /**< メモリ種別数(種別としては使用しない) */
+} MEMORY_TAG;
+
+/**
+ * @brief メモリ種別ごとのメモリ使用状況
+ *
+ */
+typedef struct core_memory_stats_t {
+    uint64_t current_bytes;     /**< 現在確保されているメモリ量(byte) */
+    uint64_t peak_bytes;        /**< current_bytesの最大値(byte) */
+    uint64_t allocation_count;  /**< 確保回数の累計 */
+    uint64_t free_count;        /**< 解放回数の累計 */
+} core_memory_stats_t;
+
+/**
+ * @brief 線形アロケータ(アリーナ)オブジェクト構造体
+ *
+ * オブジェクトの初期化には以下のいずれかを使用する:
+ * - CORE_ARENA_INITIALIZER
+ * - core_arena_create
+ */
+typedef struct core_arena_t {
+    void* internal_data;    /**< オブジェクト内部データ */
+} core_arena_t;
+
+/** @brief アリーナオブジェクト初期化用マクロ
+ *
+ * 使用例:
+ * @code
+ * core_arena_t arena = CORE_ARENA_INITIALIZER;
+ * @endcode
+ */
+#define CORE_ARENA_INITIALIZER { 0 }
 
 /**
  * @brief 対象バッファを全て0でクリアする
  * @note できるだけ標準ライブラリを使用しないで自作で行きたいので自作した
  *
+ * @note 16byte以上の領域は、先頭/末尾を非アライメントのベクトルストアで処理し、
+ *       その間をアライメントされたベクトルストアで処理する。使用する命令セットは以下の通り。
+ *       - x86_64: SSE2(実行環境がAVX2をサポートしている場合は実行時にAVX2へ切り替える)
+ *       - ARM: NEON
+ *       - その他: 8byte単位のストア
+ *
  * @param buff_ クリア対象バッファ
  * @param buff_size_ クリアバッファサイズ(byte)
  */
-void core_zero_memory(void* buff_, uint32_t buff_size_);
+void core_zero_memory(void* buff_, uint64_t buff_size_);
+
+/**
+ * @brief src_からdst_へsize_バイトをコピーする
+ *
+ * @note src_とdst_の領域が重なっていてはいけない。重なる可能性がある場合は @ref core_move_memory() を使用すること。
+ * @note 使用する命令セットは @ref core_zero_memory() と同様。
+ *
+ * @param src_ コピー元バッファ
+ * @param dst_ コピー先バッファ
+ * @param size_ コピーサイズ(byte)
+ */
+void core_copy_memory(const void* src_, void* dst_, uint64_t size_);
+
+/**
+ * @brief 要素1つ分程度の小さい領域をコピーする(呼び出し側にインライン展開される)
+ *
+ * @note コンテナの非チェック版API等、要素サイズが実行時に決まるホットパス向け。
+ *       よく使われるサイズ(1, 2, 4, 8, 16byte)は定数サイズのmemcpyとしてロード / ストア命令に展開され、
+ *       それ以外はmemcpyを呼び出す。 @ref core_copy_memory() と異なり、関数呼び出しと命令セットの判定を行わない。
+ * @note src_とdst_の領域が重なっていてはいけない。
+ *
+ * @param src_ コピー元バッファ
+ * @param dst_ コピー先バッファ
+ * @param size_ コピーサイズ(byte)
+ */
+static inline void core_copy_memory_small(const void* src_, void* dst_, uint64_t size_) {
+    switch(size_) {
+        case 1: memcpy(dst_, src_, 1); break;
+        case 2: memcpy(dst_, src_, 2); break;
+        case 4: memcpy(dst_, src_, 4); break;
+        case 8: memcpy(dst_, src_, 8); break;
+        case 16: memcpy(dst_, src_, 16); break;
+        default: memcpy(dst_, src_, (size_t)size_); break;
+    }
+}
+
+/**
+ * @brief src_からdst_へsize_バイトをコピーする。src_とdst_の領域が重なっていてもよい。
+ *
+ * @note 領域の位置関係に応じて前方または後方からコピーを行う。
+ * @note 使用する命令セットは @ref core_zero_memory() と同様。
+ *
+ * @param src_ コピー元バッファ
+ * @param dst_ コピー先バッファ
+ * @param size_ コピーサイズ(byte)
+ */
+void core_move_memory(const void* src_, void* dst_, uint64_t size_);
+
+/**
+ * @brief @ref core_zero_memory() 、 @ref core_copy_memory() 、 @ref core_move_memory() が使用している命令セット名を取得する
+ *
+ * @return const char* 命令セット名("avx2", "sse2", "neon", "word"のいずれか)
+ */
+const char* core_memory_kernel_name(void);
 
 /**
  * @brief 要求されたメモリを確保し、出力する
- * @note TODO: メモリトラッキング用メモリ種別追加
+ * @note 本関数による確保はメモリトラッキングの対象外である。トラッキングが必要な場合は @ref core_malloc_tagged() を使用すること。
  *
  * @param memory_size_ 確保メモリ領域
  * @return void* 確保されたメモリ領域へのポインタ
@@ -33,8 +172,207 @@ void* core_malloc(size_t memory_size_);
 
 /**
  * @brief 指定されたメモリ領域を破棄する
- * @note TODO: メモリトラッキング用メモリ種別追加
+ * @note @ref core_malloc() で確保した領域に対して使用する。
  *
  * @param memory_pool_ 破棄対象メモリ領域
  */
 void core_free(void* memory_pool_);
+
+/**
+ * @brief 要求されたメモリを確保し、メモリ種別tag_の使用量として記録する
+ *
+ * @note 確保した領域は、同じサイズ、同じメモリ種別を指定して @ref core_free_tagged() で解放すること。
+ *       確保に失敗した場合は使用量は記録されない。
+ *
+ * 使用例:
+ * @code
+ * void* buffer = core_malloc_tagged(128, MEMORY_TAG_USER);
+ * if(0 == buffer) {
+ *     // エラー処理
+ * }
+ * core_free_tagged(buffer, 128, MEMORY_TAG_USER);
+ * @endcode
+ *
+ * @param memory_size_ 確保メモリ領域(byte)
+ * @param tag_ メモリ種別
+ * @return void* 確保されたメモリ領域へのポインタ(確保失敗、またはtag_が不正な場合はNULL)
+ */
+void* core_malloc_tagged(size_t memory_size_, MEMORY_TAG tag_);
+
+/**
+ * @brief @ref core_malloc_tagged() で確保したメモリ領域を破棄し、メモリ種別tag_の使用量から差し引く
+ *
+ * @note memory_pool_にNULLを与えた場合は何もしない。
+ *
+ * @param memory_pool_ 破棄対象メモリ領域
+ * @param memory_size_ 確保時に指定したサイズ(byte)
+ * @param tag_ 確保時に指定したメモリ種別
+ */
+void core_free_tagged(void* memory_pool_, size_t memory_size_, MEMORY_TAG tag_);
+
+/**
+ * @brief @ref core_malloc_tagged() で確保したメモリ領域をnew_size_に再確保し、メモリ種別tag_の使用量を更新する
+ *
+ * @note 先頭からmin(old_size_, new_size_)バイトの内容は保持される。拡張された領域の内容は不定。
+ * @note 再確保に失敗した場合はNULLを返す。この場合、memory_pool_は解放されず、そのまま使用できる。
+ * @note memory_pool_にNULLを与えた場合は、 @ref core_malloc_tagged() と同じ動作となる。
+ * @note 再確保は確保回数/解放回数には計上されない。
+ *
+ * 使用例:
+ * @code
+ * char* buffer = core_malloc_tagged(128, MEMORY_TAG_USER);
+ * char* tmp = core_realloc_tagged(buffer, 128, 256, MEMORY_TAG_USER);
+ * if(0 != tmp) {
+ *     buffer = tmp;
+ * }
+ * core_free_tagged(buffer, (0 != tmp) ? 256 : 128, MEMORY_TAG_USER);
+ * @endcode
+ *
+ * @param memory_pool_ 再確保対象メモリ領域
+ * @param old_size_ 現在のサイズ(byte)
+ * @param new_size_ 再確保後のサイズ(byte)(0は不可)
+ * @param tag_ 確保時に指定したメモリ種別
+ * @return void* 再確保されたメモリ領域へのポインタ(失敗、または引数が不正な場合はNULL)
+ */
+void* core_realloc_tagged(void* memory_pool_, size_t old_size_, size_t new_size_, MEMORY_TAG tag_);
+
+/**
+ * @brief メモリ種別tag_のメモリ使用状況を取得する
+ *
+ * @note 各値は個別にrelaxedで読み出されるため、他スレッドで確保/解放が進行中の場合、値同士の整合は保証されない。
+ *
+ * 使用例:
+ * @code
+ * core_memory_stats_t stats = { 0 };
+ * if(CORE_MEMORY_SUCCESS == core_memory_report(MEMORY_TAG_STRING, &stats)) {
+ *     // stats.current_bytes, stats.peak_bytesを参照する
+ * }
+ * @endcode
+ *
+ * @param[in] tag_ 取得対象メモリ種別
+ * @param[out] out_stats_ メモリ使用状況格納先
+ *
+ * @retval CORE_MEMORY_INVALID_ARGUMENT 引数out_stats_がNULLまたはtag_が不正
+ * @retval CORE_MEMORY_SUCCESS 正常終了(ENABLE_MEMORY_TRACKINGが0の場合は全て0が格納される)
+ */
+CORE_MEMORY_ERROR_CODE core_memory_report(MEMORY_TAG tag_, core_memory_stats_t* const out_stats_);
+
+/**
+ * @brief 全メモリ種別のメモリ使用状況をインフォメーションメッセージとして出力する
+ *
+ * @note 出力には INFO_MESSAGE を使用するため、インフォメーションメッセージが無効なビルドでは何も出力されない。
+ *
+ * @see core_memory_report()
+ */
+void core_memory_report_print(void);
+
+/**
+ * @brief メモリ種別を文字列に変換する
+ *
+ * @param tag_ メモリ種別
+ * @return const char* メモリ種別名(不正な値の場合は"UNDEFINED")
+ */
+const char* core_memory_tag_to_string(MEMORY_TAG tag_);
+
+/**
+ * @brief capacity_バイトの領域を持つアリーナを生成する
+ *
+ * @note 管理データと割り当て用領域は一度の @ref core_malloc() でまとめて確保される。
+ *
+ * @note arena_がすでに初期化済みの場合は、 @ref core_arena_destroy() で保持している領域を解放した後に再初期化する。
+ *
+ * 使用例:
+ * @code
+ * core_arena_t arena = CORE_ARENA_INITIALIZER;
+ * CORE_MEMORY_ERROR_CODE result = core_arena_create(64 * 1024, &arena);   // 64KBのアリーナを生成
+ * if(CORE_MEMORY_SUCCESS != result) {
+ *     // エラー処理
+ * }
+ * core_arena_destroy(&arena);
+ * @endcode
+ *
+ * @param[in] capacity_ 割り当て可能な領域のサイズ(byte)
+ * @param[out] arena_ 初期化対象オブジェクト
+ *
+ * @retval CORE_MEMORY_INVALID_ARGUMENT 引数arena_がNULLまたはcapacity_が0
+ * @retval CORE_MEMORY_MEMORY_ALLOCATE_ERROR 領域の確保に失敗
+ * @retval CORE_MEMORY_SUCCESS アリーナの生成に成功し、正常終了
+ *
+ * @see core_arena_destroy()
+ */
+CORE_MEMORY_ERROR_CODE core_arena_create(uint64_t capacity_, core_arena_t* const arena_);
+
+/**
+ * @brief arena_が保持する領域を解放する
+ *
+ * @note 本関数の実行後は、アリーナから割り当てられた領域はすべて無効となる。
+ *       アリーナ上に生成したコンテナ類は、本関数の実行前に使用を終えておくこと。
+ *
+ * @note 引数arena_にNULLを与えた場合には、以下のワーニングメッセージを出力し、処理を終了する。
+ *       ```
+ *       [WARNING] core_arena_destroy - Argument arena_ requires a valid pointer.
+ *       ```
+ *
+ * @param[in,out] arena_ 破棄対象オブジェクト
+ *
+ * @see core_free()
+ */
+void core_arena_destroy(core_arena_t* const arena_);
+
+/**
+ * @brief arena_からsize_バイトの領域をalignment_requirement_に従って割り当てる
+ *
+ * @note 割り当ては使用済み位置をアライメント要件に合わせて切り上げ、size_分進めるのみで行われる。
+ *       割り当てた領域は0クリアされない。
+ *
+ * 使用例:
+ * @code
+ * core_arena_t arena = CORE_ARENA_INITIALIZER;
+ * core_arena_create(1024, &arena);
+ * void* ptr = 0;
+ * CORE_MEMORY_ERROR_CODE result = core_arena_allocate(sizeof(uint64_t), alignof(uint64_t), &arena, &ptr);
+ * if(CORE_MEMORY_SUCCESS != result) {
+ *     // エラー処理
+ * }
+ * core_arena_destroy(&arena);
+ * @endcode
+ *
+ * @param[in] size_ 割り当てサイズ(byte)
+ * @param[in] alignment_requirement_ 割り当て領域のアライメント要件(2の冪乗)
+ * @param[in,out] arena_ 割り当て元オブジェクト
+ * @param[out] out_ptr_ 割り当てた領域の先頭アドレス格納先
+ *
+ * @retval CORE_MEMORY_INVALID_ARGUMENT 引数arena_、out_ptr_がNULL、size_が0またはalignment_requirement_が2の冪乗でない
+ * @retval CORE_MEMORY_INVALID_ARENA 未初期化のarena_が渡された
+ * @retval CORE_MEMORY_ARENA_FULL アリーナの空き容量が不足している
+ * @retval CORE_MEMORY_SUCCESS 割り当てに成功し、正常終了
+ */
+CORE_MEMORY_ERROR_CODE core_arena_allocate(uint64_t size_, uint8_t alignment_requirement_, core_arena_t* const arena_, void** const out_ptr_);
+
+/**
+ * @brief arena_から割り当てたすべての領域をO(1)で破棄し、アリーナを空の状態に戻す
+ *
+ * @note 領域自体は解放せず、使用済み位置を先頭に戻すのみである。
+ *       アリーナ上に生成したコンテナ類は本関数の実行により無効となるため、
+ *       以降はdestroyを呼ばずにデフォルト状態に戻して(default_create)から再利用すること。
+ *
+ * @param[in,out] arena_ 対象オブジェクト
+ *
+ * @retval CORE_MEMORY_INVALID_ARGUMENT 引数arena_がNULL
+ * @retval CORE_MEMORY_INVALID_ARENA 未初期化のarena_が渡された
+ * @retval CORE_MEMORY_SUCCESS 正常終了
+ */
+CORE_MEMORY_ERROR_CODE core_arena_reset(core_arena_t* const arena_);
+
+/**
+ * @brief arena_の使用済みサイズと容量を取得する
+ *
+ * @param[in] arena_ 取得対象オブジェクト
+ * @param[out] out_used_ 使用済みサイズ(byte)(アライメント調整分を含む)
+ * @param[out] out_capacity_ 容量(byte)
+ *
+ * @retval CORE_MEMORY_INVALID_ARGUMENT 引数arena_、out_used_、out_capacity_のいずれかがNULL
+ * @retval CORE_MEMORY_INVALID_ARENA 未初期化のarena_が渡された
+ * @retval CORE_MEMORY_SUCCESS 正常終了
+ */
+CORE_MEMORY_ERROR_CODE core_arena_usage(const core_arena_t* const arena_, uint64_t* const out_used_, uint64_t* const out_capacity_);
@@ -13,13 +13,17 @@
  * - 文字列の連結
  * - 文字列のトリミング
  *
+ * 短い文字列( @ref CORE_STRING_INLINE_CAPACITY 文字以下)はcore_string_t内のバッファに直接格納し、ヒープ確保を行わない(Small String Optimization)。
+ * これを超える長さの文字列、およびアリーナから確保する文字列( @ref core_string_create_with_arena() )は、内部データとバッファを別途確保する。
+ * どちらの表現でも、 @ref core_string_cstr() / @ref core_string_length() はO(1)で動作する。
+ *
  * @anchor core_string_initialization_rule
  * 本APIでは、core_string_t型の扱いにおいて以下の状態を区別する:
  *
  * - NULLポインタ: オブジェクト自体がNULLの場合(例: core_string_t* object = 0)
  * - 未初期化状態: オブジェクト自体は存在するが、メンバの初期化がされていない状態(例: core_string_t object;)
- * - デフォルト状態: オブジェクト内部管理データinternal_data == NULLの状態。使用前に明示的な初期化が必要。
- * - 初期化済み状態: internal_dataが有効な領域を指しており、APIでの使用が可能な状態。
+ * - デフォルト状態: オブジェクト内部管理データinternal_data == NULLで、かつインライン文字列も保持していない状態。使用前に明示的な初期化が必要。
+ * - 初期化済み状態: internal_dataが有効な領域を指している、またはインライン文字列を保持しており、APIでの使用が可能な状態。
  *
  * 未初期化状態のオブジェクトをAPIに渡すと未定義の動作を引き起こす可能性があるため、
  * 必ず次のいずれかの方法で「デフォルト状態」に初期化してから使用すること:
@@ -44,6 +48,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "core/core_memory.h"
+
 // TODO: core_string_replace() 部分文字列の入れ替え
 
 /**
@@ -56,16 +62,28 @@ typedef enum CORE_STRING_ERROR_CODE {
     CORE_STRING_RUNTIME_ERROR,          /**< 実行時エラー */
     CORE_STRING_BUFFER_EMPTY,           /**< 文字列バッファが空 */
     CORE_STRING_MEMORY_ALLOCATE_ERROR,  /**< メモリアロケートエラー */
+    CORE_STRING_OUT_OF_RANGE,           /**< 数値変換結果が型の範囲外 */
 } CORE_STRING_ERROR_CODE;
 
+/**
+ * @brief core_string_t内に直接格納できる文字列の最大長(終端文字を除く)
+ *
+ * core_string_t全体が32byteに収まるよう設定している。
+ */
+#define CORE_STRING_INLINE_CAPACITY 22
+
 /**
  * @brief 文字列オブジェクト構造体
  *
  * 文字列データとそれに付随する管理情報を格納する。
  * オブジェクトの初期化については、 @ref core_string_initialization_rule を参照のこと。
+ *
+ * @note inline_buffer / inline_sizeはcore_string内部で使用するメンバであり、利用者が直接アクセスしないこと。
  */
 typedef struct core_string_t {
-    void* internal_data;    /**< オブジェクト内部データ */
+    void* internal_data;    /**< オブジェクト内部データ(インライン文字列を保持している場合はNULL) */
+    char inline_buffer[CORE_STRING_INLINE_CAPACITY + 1];    /**< インライン文字列格納バッファ(ヌル終端) */
+    uint8_t inline_size;    /**< インライン文字列の使用サイズ(終端文字含む)。0の場合はインライン文字列を保持していない */
 } core_string_t;
 
 /** @brief オブジェクト初期化用マクロ
@@ -145,6 +163,46 @@ void core_string_default_create(core_string_t* const string_);
  */
 CORE_STRING_ERROR_CODE core_string_create(const char* const src_, core_string_t* const dst_);
 
+/**
+ * @brief @ref core_string_create() と同様にdst_を初期化する。ただし、内部データと文字列バッファはarena_から確保する。
+ *
+ * @note 以降のバッファ拡張( @ref core_string_buffer_reserve() 、 @ref core_string_concat() 等)もarena_から行われる。
+ *       拡張前のバッファはアリーナのリセットまで解放されない。
+ *
+ * @note アリーナ上に生成したオブジェクトに対して @ref core_string_destroy() を呼んだ場合、メモリは解放されずデフォルト状態に戻るのみである。
+ *       メモリは @ref core_arena_reset() または @ref core_arena_destroy() によって一括で破棄される。
+ *
+ * @note arena_はdst_を使用し終えるまで有効でなければならない。
+ *
+ * 使用例:
+ * @code
+ * core_arena_t arena = CORE_ARENA_INITIALIZER;
+ * core_arena_create(4096, &arena);
+ *
+ * core_string_t dst = CORE_STRING_INITIALIZER;
+ * CORE_STRING_ERROR_CODE result = core_string_create_with_arena("Hello", &arena, &dst);
+ * if(CORE_STRING_SUCCESS != result) {
+ *     // ここにエラー処理を書く
+ * }
+ * core_arena_reset(&arena);   // dstが使用していたメモリを一括破棄
+ * core_string_default_create(&dst);
+ * core_arena_destroy(&arena);
+ * @endcode
+ *
+ * @param[in]  src_ 初期化文字列(終端文字まで含めてコピーされる)
+ * @param[in,out] arena_ メモリ確保元アリーナ
+ * @param[out] dst_ 初期化対象オブジェクト
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT 引数src_、arena_またはdst_がNULL
+ * @retval CORE_STRING_RUNTIME_ERROR 文字列のコピーに失敗(これが発生したら本関数のバグ)
+ * @retval CORE_STRING_MEMORY_ALLOCATE_ERROR アリーナの空き容量が不足している
+ * @retval CORE_STRING_SUCCESS 正常に初期化とコピーが完了
+ *
+ * @see core_string_create()
+ * @see core_arena_allocate()
+ */
+CORE_STRING_ERROR_CODE core_string_create_with_arena(const char* const src_, core_arena_t* const arena_, core_string_t* const dst_);
+
 /**
  * @brief コピー元src_の文字列内容を、コピー先dst_に複製する。
  *
@@ -222,6 +280,7 @@ CORE_STRING_ERROR_CODE core_string_copy_from_char(const char* const src_, core_s
  * @note この関数を呼ぶことで、core_string_t型オブジェクトが保持しているinternal_dataのメモリおよび、
  *       internal_data内に保持しているメモリ領域が解放され、NULLが設定される。
  *       これにより、internal_dataにはNULLが設定される。なお、メモリの解放にはcore_free()を使用している。
+ *       インライン文字列を保持している場合は、インライン文字列をクリアしてデフォルト状態に戻す。
  *
  * @note 本関数により破棄したオブジェクトを再度使用する場合には、下記の関数を使用する。
  * - @ref core_string_create()
@@ -248,7 +307,8 @@ void core_string_destroy(core_string_t* const string_);
  * @brief string_オブジェクトに指定サイズの文字列バッファを確保する。
  *
  * @note
- * - string_がデフォルト状態( @ref core_string_initialization_rule 参照)の場合、internal_data構造体を確保して初期化する
+ * - string_がデフォルト状態( @ref core_string_initialization_rule 参照)の場合、buffer_size_が CORE_STRING_INLINE_CAPACITY + 1 以下であれば
+ *   オブジェクト内のインラインバッファを使用し、それを超える場合はinternal_data構造体を確保して初期化する
  * - すでに指定したサイズ以上のバッファが確保されている場合には何もせず成功を返す
  * - バッファの再確保が行われた場合、既存のデータはすべて破棄され、バッファ全体がクリアされる
  *
@@ -284,6 +344,7 @@ CORE_STRING_ERROR_CODE core_string_buffer_reserve(uint64_t buffer_size_, core_st
  * - この関数は既存の文字列データを保持したままバッファサイズを拡張する
  * - すでに指定サイズ以上のバッファが確保されている場合は何もせず成功を返す
  * - オブジェクトがデフォルト状態の場合は @ref core_string_buffer_reserve() を呼び出して新規に確保する( @ref core_string_initialization_rule 参照)
+ * - インライン文字列を保持していて容量が不足する場合は、ヒープにバッファを確保して文字列を移す
  *
  * 使用例:
  * @code
@@ -314,6 +375,7 @@ CORE_STRING_ERROR_CODE core_string_buffer_resize(uint64_t buffer_size_, core_str
  *
  * @note
  * - オブジェクトがデフォルト状態の場合は0を返す( @ref core_string_initialization_rule 参照)
+ * - インライン文字列を保持している場合は CORE_STRING_INLINE_CAPACITY + 1 を返す
  * - 引数がNULLの場合は @ref INVALID_VALUE_U64 を返す
  *
  * 使用例:
@@ -396,6 +458,7 @@ bool core_string_equal(const core_string_t* const string1_, const core_string_t*
  * @note
  * - 引数のどちらかが NULL またはデフォルト状態( @ref core_string_initialization_rule 参照)の場合は false を返す
  * - 比較は文字列長と各文字が完全一致するかどうかで判定される
+ * - 文字列長の計算と比較はベクトル命令でまとめて行う(長さが異なる場合は内容を比較しない)
  *
  * 使用例:
  * @code
@@ -420,6 +483,60 @@ bool core_string_equal(const core_string_t* const string1_, const core_string_t*
  */
 bool core_string_equal_from_char(const char* const str1_, const core_string_t* const string2_);
 
+/**
+ * @brief string_のoffset_文字目以降で、最初にc_が現れる位置を取得する
+ *
+ * @note 実行環境のベクトル命令( core_string_kernel_name() 参照)で複数文字をまとめて検索する
+ *
+ * 使用例:
+ * @code
+ * uint64_t index = core_string_find_char(&str, 0, '=');
+ * if(INVALID_VALUE_U64 != index) {
+ *     // 見つかった
+ * }
+ * @endcode
+ *
+ * @param[in] string_ 検索対象の文字列
+ * @param[in] offset_ 検索を開始する位置
+ * @param[in] c_      検索する文字
+ *
+ * @return 見つかった位置(0-based)。見つからない場合、offset_が文字列長以上の場合、string_がNULLまたはデフォルト状態の場合は INVALID_VALUE_U64
+ */
+uint64_t core_string_find_char(const core_string_t* const string_, uint64_t offset_, char c_);
+
+/**
+ * @brief string_のoffset_文字目以降で、最初にneedle_が保持する文字列が現れる位置を取得する
+ *
+ * @note 検索文字列の先頭文字と末尾文字が一致する位置をベクトル命令でまとめて探し、候補位置でのみ全体を比較する
+ *
+ * @param[in] string_ 検索対象の文字列
+ * @param[in] offset_ 検索を開始する位置
+ * @param[in] needle_ 検索する文字列(空文字列の場合はoffset_を返す)
+ *
+ * @return 見つかった位置(0-based)。見つからない場合、offset_が文字列長を超える場合、引数がNULLまたはデフォルト状態の場合は INVALID_VALUE_U64
+ */
+uint64_t core_string_find(const core_string_t* const string_, uint64_t offset_, const core_string_t* const needle_);
+
+/**
+ * @brief string_のoffset_文字目以降で、最初にC文字列needle_が現れる位置を取得する
+ *
+ * @note core_string_find() のC文字列版
+ *
+ * @param[in] string_ 検索対象の文字列
+ * @param[in] offset_ 検索を開始する位置
+ * @param[in] needle_ 検索する文字列(空文字列の場合はoffset_を返す)
+ *
+ * @return 見つかった位置(0-based)。見つからない場合、offset_が文字列長を超える場合、引数がNULLまたはstring_がデフォルト状態の場合は INVALID_VALUE_U64
+ */
+uint64_t core_string_find_from_char(const core_string_t* const string_, uint64_t offset_, const char* const needle_);
+
+/**
+ * @brief 文字列長の計算、比較、検索が使用している命令セット名を取得する
+ *
+ * @return const char* 命令セット名("avx2", "sse2", "neon", "word"のいずれか)
+ */
+const char* core_string_kernel_name(void);
+
 /**
  * @brief core_string_tオブジェクトが保持している文字列の長さを取得する
  *
@@ -447,6 +564,35 @@ bool core_string_equal_from_char(const char* const str1_, const core_string_t* c
  */
 uint64_t core_string_length(const core_string_t* const string_);
 
+/**
+ * @brief core_string_tオブジェクトが保持している文字列のハッシュ値を取得する
+ *
+ * @note
+ * - core_hash_bytes(core_string_cstr(string_), core_string_length(string_), CORE_HASH_DEFAULT_SEED) と同じ値を返す
+ * - ヒープ、アリーナに確保した文字列は計算結果をオブジェクト内にキャッシュし、2回目以降は再計算しない。
+ *   キャッシュは文字列を変更するAPIの呼び出しで無効化される(インライン文字列は短いため、キャッシュせずに毎回計算する)
+ * - キャッシュの更新はアトミックに行うため、同じオブジェクトに対して複数スレッドから同時に呼び出してよい
+ * - デフォルト状態( @ref core_string_initialization_rule 参照)のオブジェクトは空文字列として扱う
+ *
+ * 使用例:
+ * @code
+ * core_string_t key = CORE_STRING_INITIALIZER;
+ * core_string_create("a long key that does not fit inline", &key);
+ * uint64_t hash = core_string_hash(&key);  // 計算してキャッシュする
+ * hash = core_string_hash(&key);           // キャッシュした値を返す
+ * core_string_append_char('!', &key);      // キャッシュは無効化される
+ * core_string_destroy(&key);
+ * @endcode
+ *
+ * @param[in] string_ ハッシュ値を取得する対象のcore_string_tオブジェクト
+ *
+ * @retval 0     引数がNULLの場合
+ * @retval その他 文字列のハッシュ値
+ *
+ * @see core_hash_bytes()
+ */
+uint64_t core_string_hash(const core_string_t* const string_);
+
 /**
  * @brief core_string_tオブジェクトが保持している文字列の先頭ポインタを取得する
  *
@@ -480,6 +626,7 @@ const char* core_string_cstr(const core_string_t* const string_);
  *
  * @note
  * - 連結の結果、dst_のバッファサイズが不足する場合は自動でリサイズが行われる
+ *   (容量は現在の2倍と必要サイズの大きい方に拡張されるため、繰り返し連結しても全体のコピー量は連結後の長さに比例する)
  * - string_およびdst_がデフォルト状態( @ref core_string_initialization_rule 参照)の場合はエラーを返す
  * - 連結後、dst_の内部のバッファ末尾には必ず終端文字 '\0' が付加される
  *
@@ -514,6 +661,103 @@ const char* core_string_cstr(const core_string_t* const string_);
  */
 CORE_STRING_ERROR_CODE core_string_concat(const core_string_t* const string_, core_string_t* const dst_);
 
+/**
+ * @brief dst_の末尾に1文字追記する
+ *
+ * @note
+ * - バッファが不足する場合は core_string_concat() と同様に容量を2倍(以上)に拡張するため、繰り返し追記しても償却O(1)となる
+ * - dst_がデフォルト状態( @ref core_string_initialization_rule 参照)の場合は、1文字の文字列を生成する
+ *
+ * 使用例:
+ * @code
+ * core_string_t str = CORE_STRING_INITIALIZER;
+ * for(char c = 'a'; c <= 'z'; ++c) {
+ *     if(CORE_STRING_SUCCESS != core_string_append_char(c, &str)) {
+ *         // エラー処理
+ *     }
+ * }
+ * printf("%s\n", core_string_cstr(&str)); // abcdefghijklmnopqrstuvwxyz
+ * core_string_destroy(&str);
+ * @endcode
+ *
+ * @param[in]  c_   追記する文字('\0'は不可)
+ * @param[out] dst_ 追記先オブジェクト
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT dst_がNULL、またはc_が'\0'
+ * @retval CORE_STRING_MEMORY_ALLOCATE_ERROR バッファの拡張に失敗
+ * @retval CORE_STRING_SUCCESS 正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_append_char(char c_, core_string_t* const dst_);
+
+/**
+ * @brief dst_の末尾にC文字列src_を追記する
+ *
+ * @note
+ * - バッファが不足する場合は容量を2倍(以上)に拡張するため、繰り返し追記しても償却O(1)となる
+ * - src_はdst_自身の文字列(core_string_cstr()の戻り値等)を指していてもよい
+ * - dst_がデフォルト状態( @ref core_string_initialization_rule 参照)の場合は、src_の内容で文字列を生成する
+ *
+ * 使用例:
+ * @code
+ * core_string_t request = CORE_STRING_INITIALIZER;
+ * core_string_append_from_char("GET ", &request);
+ * core_string_append_from_char(path, &request);
+ * core_string_append_from_char(" HTTP/1.1\r\n", &request);
+ * core_string_destroy(&request);
+ * @endcode
+ *
+ * @param[in]  src_ 追記する文字列
+ * @param[out] dst_ 追記先オブジェクト
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT src_またはdst_がNULL
+ * @retval CORE_STRING_MEMORY_ALLOCATE_ERROR バッファの拡張に失敗
+ * @retval CORE_STRING_SUCCESS 正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_append_from_char(const char* const src_, core_string_t* const dst_);
+
+/**
+ * @brief dst_の末尾に、src_の先頭からlength_文字を追記する
+ *
+ * @note
+ * - src_は終端文字を含まなくてよい(部分文字列や、文字列ビルダーのブロック等の追記に使用する)
+ * - その他の挙動は core_string_append_from_char() と同様
+ *
+ * @param[in]  src_    追記する文字列の先頭(length_が0の場合はNULLでもよい)
+ * @param[in]  length_ 追記する文字数
+ * @param[out] dst_    追記先オブジェクト
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT dst_がNULL、またはlength_が0以外でsrc_がNULL
+ * @retval CORE_STRING_MEMORY_ALLOCATE_ERROR バッファの拡張に失敗
+ * @retval CORE_STRING_SUCCESS 正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_append_from_buffer(const char* const src_, uint64_t length_, core_string_t* const dst_);
+
+/**
+ * @brief dst_の末尾にprintf形式で整形した文字列を追記する
+ *
+ * @note
+ * - まず現在の空き領域に直接整形し、収まらなかった場合のみバッファを拡張して整形し直す(一時バッファは使用しない)
+ * - バッファが不足する場合は容量を2倍(以上)に拡張するため、繰り返し追記しても償却O(1)となる
+ * - 可変引数にdst_自身の文字列を渡してはならない
+ *
+ * 使用例:
+ * @code
+ * core_string_t header = CORE_STRING_INITIALIZER;
+ * core_string_append_format(&header, "Content-Length: %llu\r\n", (unsigned long long)body_length);
+ * core_string_destroy(&header);
+ * @endcode
+ *
+ * @param[out] dst_ 追記先オブジェクト
+ * @param[in] format_ printfと同様のフォーマット文字列
+ * @param[in] ... フォーマットに対応する値
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT dst_またはformat_がNULL
+ * @retval CORE_STRING_MEMORY_ALLOCATE_ERROR バッファの拡張に失敗(dst_の内容は変更されない)
+ * @retval CORE_STRING_RUNTIME_ERROR 整形に失敗
+ * @retval CORE_STRING_SUCCESS 正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_append_format(core_string_t* const dst_, const char* const format_, ...);
+
 /**
  * @brief src_ の [from_, to_] 範囲の部分文字列を dst_ にコピーする
  *
@@ -521,6 +765,7 @@ CORE_STRING_ERROR_CODE core_string_concat(const core_string_t* const string_, co
  * - from_からto_ の範囲は両端を含むインデックスとして扱われる
  * - dst_のバッファサイズが不足している場合は自動でリサイズが行われる
  * - 部分文字列のコピー後、dst_の末尾には必ず終端文字'\0'が付加される
+ * - src_とdst_に同じオブジェクトを指定した場合は、メモリ確保を行わずにその場で部分文字列を先頭に詰める
  *
  * 使用例:
  * @code
@@ -545,7 +790,7 @@ CORE_STRING_ERROR_CODE core_string_concat(const core_string_t* const string_, co
  *
  * @retval CORE_STRING_INVALID_ARGUMENT
  * - from_ または to_ が不正 (from_ > to_)
- * - to_ が src_ の範囲を超えている
+ * - to_ が src_ の範囲を超えている (to_ >= src_の長さ)
  * @retval CORE_STRING_RUNTIME_ERROR
  * - src_または dst_がデフォルト状態( @ref core_string_initialization_rule 参照)
  * - バッファのリサイズに失敗
@@ -555,7 +800,7 @@ CORE_STRING_ERROR_CODE core_string_concat(const core_string_t* const string_, co
  * @see core_string_buffer_resize()
  * @see core_string_cstr()
  */
-CORE_STRING_ERROR_CODE core_string_substring_copy(const core_string_t* const src_, core_string_t* const dst_, uint16_t from_, uint16_t to_);
+CORE_STRING_ERROR_CODE core_string_substring_copy(const core_string_t* const src_, core_string_t* const dst_, uint64_t from_, uint64_t to_);
 
 /**
  * @brief 指定したトリム文字を取り除いた文字列をdst_にコピーする。
@@ -564,6 +809,8 @@ CORE_STRING_ERROR_CODE core_string_substring_copy(const core_string_t* const src
  * - 左端の連続するltrim_文字と右端の連続するrtrim_文字を削除する
  * - トリム後の文字列長が0になる場合、空文字列としてdst_に格納する
  * - 必要に応じてdst_のバッファサイズを再確保する
+ * - src_とdst_に同じオブジェクトを指定した場合は、メモリ確保を行わずにその場でトリムする
+ * - 複数種類の文字を取り除く場合は core_string_trim_set() を使用する
  *
  * 使用例:
  * @code
@@ -594,12 +841,54 @@ CORE_STRING_ERROR_CODE core_string_substring_copy(const core_string_t* const src
  */
 CORE_STRING_ERROR_CODE core_string_trim(const core_string_t* const src_, core_string_t* const dst_, char ltrim_, char rtrim_);
 
+/**
+ * @brief core_string_trim_set() で空白類文字(' ', '\t', '\n', '\v', '\f', '\r')を取り除く場合に指定する文字集合
+ *
+ */
+#define CORE_STRING_WHITESPACE " \t\n\v\f\r"
+
+/**
+ * @brief 指定した文字集合に含まれる文字を両端から取り除いた文字列をdst_にコピーする。
+ *
+ * @note
+ * - 左端から連続するltrim_set_に含まれる文字と、右端から連続するrtrim_set_に含まれる文字を削除する
+ * - ltrim_set_ / rtrim_set_にNULLまたは空文字列を指定した場合、その側はトリムしない
+ * - src_とdst_に同じオブジェクトを指定した場合は、メモリ確保を行わずにその場でトリムする
+ * - 走査は両端から1回ずつのみで、残す部分のコピーは1回で行う
+ *
+ * 使用例:
+ * @code
+ * core_string_t line = CORE_STRING_INITIALIZER;
+ * core_string_create(" \t key = value\r\n", &line);
+ * CORE_STRING_ERROR_CODE result = core_string_trim_set(&line, &line, CORE_STRING_WHITESPACE, CORE_STRING_WHITESPACE);
+ * if (CORE_STRING_SUCCESS == result) {
+ *     // lineには "key = value" が格納される
+ * }
+ * core_string_destroy(&line);
+ * @endcode
+ *
+ * @param[in]  src_       トリム対象の文字列オブジェクト。未初期化状態は不可。( @ref core_string_initialization_rule 参照)
+ * @param[out] dst_       トリム結果の出力先オブジェクト(src_と同じオブジェクトでもよい)
+ * @param[in]  ltrim_set_ 左端のトリム対象文字の集合
+ * @param[in]  rtrim_set_ 右端のトリム対象文字の集合
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT src_またはdst_がNULL
+ * @retval CORE_STRING_RUNTIME_ERROR    src_がデフォルト状態( @ref core_string_initialization_rule 参照)
+ * @retval CORE_STRING_MEMORY_ALLOCATE_ERROR メモリ再確保に失敗
+ * @retval CORE_STRING_SUCCESS          正常終了
+ *
+ * @see core_string_trim()
+ */
+CORE_STRING_ERROR_CODE core_string_trim_set(const core_string_t* const src_, core_string_t* const dst_, const char* const ltrim_set_, const char* const rtrim_set_);
+
 /**
  * @brief core_string_tオブジェクトの内容をint32_t型整数に変換する。
  *
  * @note
  * - 文字列が整数として解釈できない場合はエラーを返す
- * - 変換結果がint32_tの範囲外の場合もエラーを返す
+ * - 変換結果がint32_tの範囲外の場合もエラーを返す(互換性のため CORE_STRING_OUT_OF_RANGE ではなく CORE_STRING_RUNTIME_ERROR を返す)
+ * - 受け付けるのは[+|-]10進数字列のみ。 core_string_parse_i32() と異なり、0x形式の16進数は変換失敗とする(ロケールに依存せず、先頭の空白は読み飛ばさない)
+ * - 他の型への変換は core_string_number.h を参照
  *
  * 使用例:
  * @code
@@ -620,6 +909,6 @@ CORE_STRING_ERROR_CODE core_string_trim(const core_string_t* const src_, core_st
  * @retval CORE_STRING_RUNTIME_ERROR    string_がデフォルト状態( @ref core_string_initialization_rule 参照)、空文字列、変換失敗、または範囲外の値
  * @retval CORE_STRING_SUCCESS          正常に変換が完了
  *
- * @see strtol()
+ * @see core_string_parse_i32()
  */
 CORE_STRING_ERROR_CODE core_string_to_i32(const core_string_t* const string_, int32_t* out_value_);
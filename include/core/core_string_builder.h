@@ -0,0 +1,189 @@
+/**
+ * @file core_string_builder.h
+ * @author chocolate-pie24
+ * @brief 文字列ビルダーオブジェクト(core_string_builder_t)の定義と関連APIの宣言
+ *
+ * @details
+ * core_string_builder_tは、大きな文字列(数KB以上のレスポンス等)を多数の断片から組み立てるためのオブジェクトである。
+ * 追記された文字列は固定サイズのブロックを連結したリストに格納され、ブロックが不足した場合は新しいブロックを追加する。
+ * core_string_concat() による組み立てと異なり、既存の内容が再確保・コピーされることはない。
+ *
+ * 組み立てた文字列は以下のいずれかの方法で取り出す:
+ * - @ref core_string_builder_finalize() : 1つのcore_string_tにまとめる(全体で1回のバッファ確保と1回のコピー)
+ * - @ref core_string_builder_write() : 各ブロックをwritevでファイルディスクリプタに直接書き出す(連結のコピーが発生しない)
+ *
+ * @anchor core_string_builder_initialization_rule
+ * オブジェクトの状態の扱いはcore_string_tと同様である( @ref core_string_initialization_rule 参照)。
+ * - デフォルト状態: internal_data == NULLの状態。 @ref CORE_STRING_BUILDER_INITIALIZER または @ref core_string_builder_default_create() で遷移する。
+ *   デフォルト状態のオブジェクトに追記した場合は、 @ref CORE_STRING_BUILDER_DEFAULT_BLOCK_SIZE で自動的に生成される。
+ * - 初期化済み状態: internal_dataが有効な領域を指している状態。
+ *
+ * 使用例:
+ * @code
+ * core_string_builder_t builder = CORE_STRING_BUILDER_INITIALIZER;
+ * core_string_builder_append_from_char("HTTP/1.1 200 OK\r\n", &builder);
+ * core_string_builder_append_format(&builder, "Content-Length: %llu\r\n\r\n", (unsigned long long)core_string_length(&body));
+ * core_string_builder_append(&body, &builder);
+ * core_string_builder_write(&builder, socket_fd);
+ * core_string_builder_destroy(&builder);
+ * @endcode
+ *
+ * @version 0.1
+ * @date 2025-07-20
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "core/core_string.h"
+
+/**
+ * @brief core_string_builder_create() でブロックサイズに0を指定した場合、およびデフォルト状態から自動生成した場合のブロックサイズ(byte)
+ *
+ */
+#define CORE_STRING_BUILDER_DEFAULT_BLOCK_SIZE 4096
+
+/**
+ * @brief 文字列ビルダーオブジェクト構造体
+ *
+ * オブジェクトの初期化については、 @ref core_string_builder_initialization_rule を参照のこと。
+ */
+typedef struct core_string_builder_t {
+    void* internal_data;    /**< 内部データ */
+} core_string_builder_t;
+
+/**
+ * @brief core_string_builder_tをデフォルト状態に初期化する
+ *
+ * @code
+ * core_string_builder_t builder = CORE_STRING_BUILDER_INITIALIZER;
+ * @endcode
+ */
+#define CORE_STRING_BUILDER_INITIALIZER { 0 }
+
+/**
+ * @brief builder_をデフォルト状態に初期化する
+ *
+ * @note 初期化済みのオブジェクトに対して呼び出すとメモリリークとなるため、再初期化は core_string_builder_destroy() で行うこと
+ *
+ * @param[out] builder_ 初期化対象オブジェクト(NULLの場合は警告を出力して何もしない)
+ */
+void core_string_builder_default_create(core_string_builder_t* const builder_);
+
+/**
+ * @brief ブロックサイズを指定してbuilder_を生成する
+ *
+ * @note
+ * - ブロックは最初の追記時に確保する
+ * - ブロックサイズを超える文字列を一度に追記した場合は、その文字列が収まるサイズのブロックを確保する
+ * - builder_が初期化済みの場合は、既存の内容を破棄してから生成する
+ *
+ * @param[in]  block_size_ 1ブロックあたりの容量(byte)。0の場合は @ref CORE_STRING_BUILDER_DEFAULT_BLOCK_SIZE を使用する
+ * @param[out] builder_    生成対象オブジェクト
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT builder_がNULL
+ * @retval CORE_STRING_MEMORY_ALLOCATE_ERROR 内部データのメモリ確保に失敗
+ * @retval CORE_STRING_SUCCESS 正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_builder_create(uint64_t block_size_, core_string_builder_t* const builder_);
+
+/**
+ * @brief builder_が保持する全てのブロックを解放し、デフォルト状態に戻す
+ *
+ * @param[in,out] builder_ 破棄対象オブジェクト(NULLの場合は警告を出力して何もしない。デフォルト状態の場合は何もしない)
+ */
+void core_string_builder_destroy(core_string_builder_t* const builder_);
+
+/**
+ * @brief builder_の内容を空にする
+ *
+ * @note 確保済みのブロックは解放せず、以降の追記で再利用する
+ *
+ * @param[in,out] builder_ 対象オブジェクト(NULLの場合は警告を出力して何もしない)
+ */
+void core_string_builder_reset(core_string_builder_t* const builder_);
+
+/**
+ * @brief builder_に追記された文字列の合計長を取得する
+ *
+ * @param[in] builder_ 対象オブジェクト
+ *
+ * @return 合計長(終端文字を含まない)。builder_がNULLの場合は INVALID_VALUE_U64 、デフォルト状態の場合は0
+ */
+uint64_t core_string_builder_length(const core_string_builder_t* const builder_);
+
+/**
+ * @brief builder_の末尾にstring_の内容を追記する
+ *
+ * @param[in]     string_  追記する文字列(デフォルト状態の場合は空文字列として扱う)
+ * @param[in,out] builder_ 追記先オブジェクト
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT string_またはbuilder_がNULL
+ * @retval CORE_STRING_MEMORY_ALLOCATE_ERROR ブロックの確保に失敗
+ * @retval CORE_STRING_SUCCESS 正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_builder_append(const core_string_t* const string_, core_string_builder_t* const builder_);
+
+/**
+ * @brief builder_の末尾にC文字列src_を追記する
+ *
+ * @param[in]     src_     追記する文字列
+ * @param[in,out] builder_ 追記先オブジェクト
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT src_またはbuilder_がNULL
+ * @retval CORE_STRING_MEMORY_ALLOCATE_ERROR ブロックの確保に失敗
+ * @retval CORE_STRING_SUCCESS 正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_builder_append_from_char(const char* const src_, core_string_builder_t* const builder_);
+
+/**
+ * @brief builder_の末尾にprintf形式で整形した文字列を追記する
+ *
+ * @note 現在のブロックの空き領域に直接整形し、収まらなかった場合は新しいブロックに整形し直す(整形結果はブロックを跨がない)
+ *
+ * @param[in,out] builder_ 追記先オブジェクト
+ * @param[in] format_ printfと同様のフォーマット文字列
+ * @param[in] ... フォーマットに対応する値
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT builder_またはformat_がNULL
+ * @retval CORE_STRING_MEMORY_ALLOCATE_ERROR ブロックの確保に失敗
+ * @retval CORE_STRING_RUNTIME_ERROR 整形に失敗
+ * @retval CORE_STRING_SUCCESS 正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_builder_append_format(core_string_builder_t* const builder_, const char* const format_, ...);
+
+/**
+ * @brief builder_の内容を1つの文字列にまとめてdst_に格納し、builder_を空にする
+ *
+ * @note
+ * - dst_の既存の内容は破棄される(dst_のバッファ確保は最大1回)
+ * - builder_のブロックは解放せず、 core_string_builder_reset() と同様に再利用可能な状態となる
+ *
+ * @param[in,out] builder_ 対象オブジェクト(デフォルト状態の場合、dst_は空文字列となる)
+ * @param[out]    dst_     格納先オブジェクト
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT builder_またはdst_がNULL
+ * @retval CORE_STRING_MEMORY_ALLOCATE_ERROR dst_のバッファ確保に失敗(builder_の内容は変更されない)
+ * @retval CORE_STRING_SUCCESS 正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_builder_finalize(core_string_builder_t* const builder_, core_string_t* const dst_);
+
+/**
+ * @brief builder_の内容をファイルディスクリプタfd_に書き出す
+ *
+ * @note
+ * - 各ブロックをwritevでまとめて書き出すため、連結のためのコピーは発生しない
+ * - 書き込みが途中までしか行われなかった場合、およびシグナルで中断された場合は残りを再度書き込む
+ * - builder_の内容は変更されない
+ *
+ * @param[in] builder_ 対象オブジェクト
+ * @param[in] fd_      書き出し先ファイルディスクリプタ
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT builder_がNULL、またはfd_が負の値
+ * @retval CORE_STRING_RUNTIME_ERROR 書き込みに失敗
+ * @retval CORE_STRING_SUCCESS 正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_builder_write(const core_string_builder_t* const builder_, int fd_);
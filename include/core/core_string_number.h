@@ -0,0 +1,232 @@
+/**
+ * @file core_string_number.h
+ * @author chocolate-pie24
+ * @brief 文字列と整数、浮動小数点数の相互変換APIの宣言
+ *
+ * @details
+ * strtol / strtod系の関数と異なり、ロケールやerrnoに依存せず、終端文字のない文字列(先頭ポインタと長さ)を直接変換できる。
+ * テキストフィードのフィールドのように、大量の数値を高速に変換する用途を想定している。
+ *
+ * 変換関数は2種類用意する。
+ * - core_string_parse_XXX() : 先頭ポインタと長さで指定した範囲の先頭から数値を読み取り、読み取った文字数を返す
+ * - core_string_to_XXX()    : core_string_tの文字列全体を数値として変換する
+ *
+ * 受け付ける書式:
+ * - 整数: [+|-]数字列、または[+|-]0x16進数字列(0X、大文字の16進数字も可)。符号なし整数では'-'は受け付けない
+ * - 浮動小数点数: [+|-]数字列[.数字列][(e|E)[+|-]数字列]、または[+|-](inf|infinity|nan)(大文字小文字を区別しない)
+ * - 先頭の空白は読み飛ばさない
+ *
+ * 浮動小数点数は正しく丸めた値(変換結果に最も近い値)を返す。
+ *
+ * 数値から文字列への変換は core_string_append_XXX() で行い、変換結果を文字列の末尾に追加する。
+ * 書式指定文字列の解釈やロケールの参照を行わないため、 core_string_append_format() より高速に変換できる。
+ *
+ * 使用例:
+ * @code
+ * const char* line = "123,-4.5e2";
+ * uint64_t consumed = 0;
+ * int64_t i = 0;
+ * double d = 0.0;
+ * core_string_parse_i64(line, 10, &i, &consumed);                   // i = 123, consumed = 3
+ * core_string_parse_f64(line + consumed + 1, 6, &d, &consumed);     // d = -450.0, consumed = 6
+ *
+ * core_string_t out = CORE_STRING_INITIALIZER;
+ * core_string_append_i64(-42, &out);      // "-42"
+ * core_string_append_from_char(",", &out);
+ * core_string_append_f64(0.1, &out);      // "-42,0.1"
+ * core_string_destroy(&out);
+ * @endcode
+ *
+ * @version 0.1
+ * @date 2025-07-20
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "core/core_string.h"
+
+/**
+ * @brief str_の先頭length_文字の先頭から整数を読み取る
+ *
+ * @note
+ * - out_consumed_にNULLを指定した場合は、length_文字全体が数値である必要がある(数値の後ろに文字が続く場合はエラー)
+ * - 変換結果が型の範囲外の場合は、out_value_に型の最小値または最大値を格納し、 CORE_STRING_OUT_OF_RANGE を返す
+ * - 変換失敗時のメッセージ出力は行わない(大量のフィールドを変換する際に、数値かどうかの判定に使用できるようにするため)
+ * - 8桁単位の数字列は1回のロードでまとめて変換する
+ *
+ * @param[in]  str_          変換対象の文字列(終端文字は不要。length_が0の場合はNULLでもよい)
+ * @param[in]  length_       変換対象の文字数
+ * @param[out] out_value_    変換結果の格納先
+ * @param[out] out_consumed_ 読み取った文字数の格納先(NULL可)。数値が見つからない場合は0
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT out_value_がNULL、またはlength_が0以外でstr_がNULL
+ * @retval CORE_STRING_RUNTIME_ERROR    先頭が数値ではない、またはout_consumed_がNULLで数値の後ろに文字が続く
+ * @retval CORE_STRING_OUT_OF_RANGE     変換結果が型の範囲外
+ * @retval CORE_STRING_SUCCESS          正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_parse_i64(const char* const str_, uint64_t length_, int64_t* const out_value_, uint64_t* const out_consumed_);
+
+/**
+ * @brief str_の先頭length_文字の先頭からint32_t型整数を読み取る(詳細は core_string_parse_i64() 参照)
+ */
+CORE_STRING_ERROR_CODE core_string_parse_i32(const char* const str_, uint64_t length_, int32_t* const out_value_, uint64_t* const out_consumed_);
+
+/**
+ * @brief str_の先頭length_文字の先頭からint16_t型整数を読み取る(詳細は core_string_parse_i64() 参照)
+ */
+CORE_STRING_ERROR_CODE core_string_parse_i16(const char* const str_, uint64_t length_, int16_t* const out_value_, uint64_t* const out_consumed_);
+
+/**
+ * @brief str_の先頭length_文字の先頭からint8_t型整数を読み取る(詳細は core_string_parse_i64() 参照)
+ */
+CORE_STRING_ERROR_CODE core_string_parse_i8(const char* const str_, uint64_t length_, int8_t* const out_value_, uint64_t* const out_consumed_);
+
+/**
+ * @brief str_の先頭length_文字の先頭からuint64_t型整数を読み取る(詳細は core_string_parse_i64() 参照)
+ */
+CORE_STRING_ERROR_CODE core_string_parse_u64(const char* const str_, uint64_t length_, uint64_t* const out_value_, uint64_t* const out_consumed_);
+
+/**
+ * @brief str_の先頭length_文字の先頭からuint32_t型整数を読み取る(詳細は core_string_parse_i64() 参照)
+ */
+CORE_STRING_ERROR_CODE core_string_parse_u32(const char* const str_, uint64_t length_, uint32_t* const out_value_, uint64_t* const out_consumed_);
+
+/**
+ * @brief str_の先頭length_文字の先頭からuint16_t型整数を読み取る(詳細は core_string_parse_i64() 参照)
+ */
+CORE_STRING_ERROR_CODE core_string_parse_u16(const char* const str_, uint64_t length_, uint16_t* const out_value_, uint64_t* const out_consumed_);
+
+/**
+ * @brief str_の先頭length_文字の先頭からuint8_t型整数を読み取る(詳細は core_string_parse_i64() 参照)
+ */
+CORE_STRING_ERROR_CODE core_string_parse_u8(const char* const str_, uint64_t length_, uint8_t* const out_value_, uint64_t* const out_consumed_);
+
+/**
+ * @brief str_の先頭length_文字の先頭からdouble型浮動小数点数を読み取る
+ *
+ * @note
+ * - 有効数字19桁以下、10のべき乗の指数が小さい一般的な入力は、整数演算と1回の浮動小数点演算のみで正確に変換する
+ * - それ以外の入力は、小数点を含まない形に書き直した上でstrtodで変換する(小数点を含まないため、ロケールの影響を受けない)
+ * - 変換結果がdoubleの範囲を超える場合は、out_value_に±無限大を格納し、 CORE_STRING_OUT_OF_RANGE を返す
+ * - その他は core_string_parse_i64() と同様
+ *
+ * @param[in]  str_          変換対象の文字列(終端文字は不要。length_が0の場合はNULLでもよい)
+ * @param[in]  length_       変換対象の文字数
+ * @param[out] out_value_    変換結果の格納先
+ * @param[out] out_consumed_ 読み取った文字数の格納先(NULL可)。数値が見つからない場合は0
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT out_value_がNULL、またはlength_が0以外でstr_がNULL
+ * @retval CORE_STRING_RUNTIME_ERROR    先頭が数値ではない、またはout_consumed_がNULLで数値の後ろに文字が続く
+ * @retval CORE_STRING_OUT_OF_RANGE     変換結果が型の範囲外
+ * @retval CORE_STRING_MEMORY_ALLOCATE_ERROR 非常に長い数字列の変換用バッファの確保に失敗
+ * @retval CORE_STRING_SUCCESS          正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_parse_f64(const char* const str_, uint64_t length_, double* const out_value_, uint64_t* const out_consumed_);
+
+/**
+ * @brief str_の先頭length_文字の先頭からfloat型浮動小数点数を読み取る
+ *
+ * @note doubleを経由せずにfloatへ直接丸める(二重丸めは発生しない)。その他は core_string_parse_f64() と同様
+ */
+CORE_STRING_ERROR_CODE core_string_parse_f32(const char* const str_, uint64_t length_, float* const out_value_, uint64_t* const out_consumed_);
+
+/**
+ * @brief string_の文字列全体をint64_t型整数に変換する
+ *
+ * @note 書式は core_string_parse_i64() と同じ。文字列全体が数値である必要がある
+ *
+ * @param[in]  string_    変換対象の文字列
+ * @param[out] out_value_ 変換結果の格納先
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT string_またはout_value_がNULL
+ * @retval CORE_STRING_RUNTIME_ERROR    string_がデフォルト状態、空文字列、または数値として解釈できない
+ * @retval CORE_STRING_OUT_OF_RANGE     変換結果が型の範囲外
+ * @retval CORE_STRING_SUCCESS          正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_to_i64(const core_string_t* const string_, int64_t* const out_value_);
+
+/**
+ * @brief string_の文字列全体をint16_t型整数に変換する(詳細は core_string_to_i64() 参照)
+ */
+CORE_STRING_ERROR_CODE core_string_to_i16(const core_string_t* const string_, int16_t* const out_value_);
+
+/**
+ * @brief string_の文字列全体をint8_t型整数に変換する(詳細は core_string_to_i64() 参照)
+ */
+CORE_STRING_ERROR_CODE core_string_to_i8(const core_string_t* const string_, int8_t* const out_value_);
+
+/**
+ * @brief string_の文字列全体をuint64_t型整数に変換する(詳細は core_string_to_i64() 参照)
+ */
+CORE_STRING_ERROR_CODE core_string_to_u64(const core_string_t* const string_, uint64_t* const out_value_);
+
+/**
+ * @brief string_の文字列全体をuint32_t型整数に変換する(詳細は core_string_to_i64() 参照)
+ */
+CORE_STRING_ERROR_CODE core_string_to_u32(const core_string_t* const string_, uint32_t* const out_value_);
+
+/**
+ * @brief string_の文字列全体をuint16_t型整数に変換する(詳細は core_string_to_i64() 参照)
+ */
+CORE_STRING_ERROR_CODE core_string_to_u16(const core_string_t* const string_, uint16_t* const out_value_);
+
+/**
+ * @brief string_の文字列全体をuint8_t型整数に変換する(詳細は core_string_to_i64() 参照)
+ */
+CORE_STRING_ERROR_CODE core_string_to_u8(const core_string_t* const string_, uint8_t* const out_value_);
+
+/**
+ * @brief string_の文字列全体をdouble型浮動小数点数に変換する(書式は core_string_parse_f64() 、詳細は core_string_to_i64() 参照)
+ */
+CORE_STRING_ERROR_CODE core_string_to_f64(const core_string_t* const string_, double* const out_value_);
+
+/**
+ * @brief string_の文字列全体をfloat型浮動小数点数に変換する(書式は core_string_parse_f64() 、詳細は core_string_to_i64() 参照)
+ */
+CORE_STRING_ERROR_CODE core_string_to_f32(const core_string_t* const string_, float* const out_value_);
+
+/**
+ * @brief value_の10進表記をdst_の末尾に追加する
+ *
+ * @note 2桁ずつの対応表で変換し、スタック上の作業領域からdst_へ1回でコピーする(ヒープの一時領域は使用しない)
+ *
+ * @param[in]     value_ 変換する値
+ * @param[in,out] dst_   追加先の文字列(デフォルト状態でもよい)
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT      dst_がNULL
+ * @retval CORE_STRING_MEMORY_ALLOCATE_ERROR dst_のバッファ拡張に失敗
+ * @retval CORE_STRING_SUCCESS               正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_append_i64(int64_t value_, core_string_t* const dst_);
+
+/**
+ * @brief value_の10進表記をdst_の末尾に追加する(詳細は core_string_append_i64() 参照)
+ */
+CORE_STRING_ERROR_CODE core_string_append_u64(uint64_t value_, core_string_t* const dst_);
+
+/**
+ * @brief value_を、読み戻すと同じ値になる短い10進表記でdst_の末尾に追加する
+ *
+ * @note
+ * - 数字列はGrisu2で求める。ほぼ全ての値で最短の桁数となり、ごく一部の値(最短の表現が隣接する値との中点ちょうどにある場合など)では最短より長くなる(いずれも core_string_parse_f64() やstrtodで読み戻すと元の値に戻る)
+ * - 10^-7以上10^21未満の値は固定小数点表記("100", "0.001", "1.5")、それ以外は指数表記("1e21", "1.5e-7")で出力する
+ * - 0は"0"、負の0は"-0"、無限大は"inf" / "-inf"、NaNは"nan"を出力する
+ * - 小数点は常に'.'を使用する(ロケールの影響を受けない)
+ *
+ * @param[in]     value_ 変換する値
+ * @param[in,out] dst_   追加先の文字列(デフォルト状態でもよい)
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT      dst_がNULL
+ * @retval CORE_STRING_MEMORY_ALLOCATE_ERROR dst_のバッファ拡張に失敗
+ * @retval CORE_STRING_SUCCESS               正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_append_f64(double value_, core_string_t* const dst_);
+
+/**
+ * @brief value_を、floatとして読み戻すと同じ値になる短い10進表記でdst_の末尾に追加する(詳細は core_string_append_f64() 参照)
+ */
+CORE_STRING_ERROR_CODE core_string_append_f32(float value_, core_string_t* const dst_);
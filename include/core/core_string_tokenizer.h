@@ -0,0 +1,257 @@
+/**
+ * @file core_string_tokenizer.h
+ * @author chocolate-pie24
+ * @brief 文字列の分割イテレータ(core_string_tokenizer_t)の定義と関連APIの宣言
+ *
+ * @details
+ * core_string_tokenizer_tは、CSVや空白区切りのレコードのように、1行の文字列を区切り文字で多数のフィールドに分割するためのイテレータである。
+ * 分割結果は元の文字列を参照するビュー(core_string_view_t)として返すため、トークンごとのメモリ確保やコピーは発生しない。
+ * core_string_view_split() と異なり、以下の分割に対応する。
+ * - 区切り文字の集合(",;"のように複数の文字のいずれかで区切る)
+ * - 複数文字の区切り文字列("::"や"\r\n"等)
+ * - 引用符で囲まれたフィールド(引用符内の区切り文字は区切りとして扱わない)
+ * - 連続する区切り文字を1つの区切りとして扱い、空のトークンを返さない分割(空白区切り向け)
+ *
+ * 区切り文字の検索は実行環境のベクトル命令(core_string_kernel_name() 参照)で複数文字をまとめて行う。
+ * 区切り文字集合は CORE_STRING_TOKENIZER_VECTOR_DELIMITER_MAX 文字以下の場合にベクトル命令で検索し、それより多い場合は1文字ずつ検索する。
+ *
+ * 利用上の注意:
+ * - トークンは分割対象の文字列を参照する。分割対象の文字列が変更、破棄された時点でトークンは無効となる
+ * - トークンの元の文字列内での位置は、トークンのdataとtokenizerのdataの差で求められる
+ * - イテレータはメモリを確保しないため、破棄処理は不要である
+ *
+ * 使用例:
+ * @code
+ * core_string_view_t line = CORE_STRING_VIEW_INITIALIZER;
+ * core_string_view_from_char("id,\"name, with comma\",price", &line);
+ * core_string_tokenizer_t tokenizer = CORE_STRING_TOKENIZER_INITIALIZER;
+ * core_string_tokenizer_create(&line, ",", &tokenizer);
+ * core_string_tokenizer_quote_set('"', &tokenizer);
+ * core_string_view_t token = CORE_STRING_VIEW_INITIALIZER;
+ * while(core_string_tokenizer_next(&tokenizer, &token)) {
+ *     // token = "id", "name, with comma", "price"
+ * }
+ * @endcode
+ *
+ * @version 0.1
+ * @date 2025-07-20
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "core/core_string.h"
+#include "core/core_string_view.h"
+
+#include "containers/dynamic_array.h"
+
+/**
+ * @brief ベクトル命令で検索する区切り文字集合の最大文字数
+ *
+ */
+#define CORE_STRING_TOKENIZER_VECTOR_DELIMITER_MAX 4
+
+/**
+ * @brief 文字列分割イテレータ構造体
+ *
+ * core_string_view_tと同様に値として扱うことができ、メモリを保持しない。
+ * メンバは参照してよいが、変更は各API関数を通して行うこと。
+ */
+typedef struct core_string_tokenizer_t {
+    const char* data;               /**< 分割対象の文字列の先頭 */
+    uint64_t length;                /**< 分割対象の文字数 */
+    uint64_t position;              /**< 次のトークンの開始位置 */
+    const char* separator;          /**< 区切り文字列(区切り文字集合で分割する場合はNULL) */
+    uint64_t separator_length;      /**< 区切り文字列の文字数 */
+    uint64_t delimiter_bits[4];     /**< 区切り文字集合(文字コードごとのビット集合) */
+    char delimiters[CORE_STRING_TOKENIZER_VECTOR_DELIMITER_MAX]; /**< ベクトル命令で検索する区切り文字(不足分は先頭の文字で埋める) */
+    uint8_t delimiter_count;        /**< 区切り文字集合の文字数 */
+    char quote;                     /**< 引用符('\0'の場合は引用符を扱わない) */
+    bool skip_empty;                /**< 空のトークンを返さない */
+    bool finished;                  /**< 全てのトークンを返し終えた */
+} core_string_tokenizer_t;
+
+/**
+ * @brief core_string_tokenizer_tを、トークンを返さない空のイテレータに初期化する
+ *
+ * @code
+ * core_string_tokenizer_t tokenizer = CORE_STRING_TOKENIZER_INITIALIZER;
+ * @endcode
+ */
+#define CORE_STRING_TOKENIZER_INITIALIZER { 0, 0, 0, 0, 0, { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, 0, 0, false, true }
+
+/**
+ * @brief 引用符で囲まれていたかの情報を含むトークン
+ *
+ * core_string_tokenizer_next_token() 、 core_string_tokenizer_collect() が返し、 core_string_tokenizer_unquote() に渡す。
+ */
+typedef struct core_string_token_t {
+    core_string_view_t view;        /**< トークン(引用符で囲まれていた場合は引用符の内側を参照する) */
+    bool quoted;                    /**< 引用符で囲まれていた */
+} core_string_token_t;
+
+/**
+ * @brief core_string_token_tを空のトークンに初期化する
+ *
+ * @code
+ * core_string_token_t token = CORE_STRING_TOKEN_INITIALIZER;
+ * @endcode
+ */
+#define CORE_STRING_TOKEN_INITIALIZER { CORE_STRING_VIEW_INITIALIZER, false }
+
+/**
+ * @brief source_をdelimiters_のいずれかの文字で分割するイテレータを生成する
+ *
+ * @note
+ * - 連続する区切り文字や末尾の区切り文字からは空のトークンが得られる("a,,b," -> "a", "", "b", "")。
+ *   空のトークンを返さない場合は core_string_tokenizer_skip_empty_set() を使用する
+ * - source_が空の文字列の場合は空のトークンを1つ返す。source_のdataがNULLの場合はトークンを返さない( core_string_view_split() と同様)
+ * - delimiters_の内容はイテレータにコピーするため、生成後にdelimiters_を破棄してもよい
+ *
+ * @param[in]  source_         分割対象の文字列
+ * @param[in]  delimiters_     区切り文字の集合(1文字以上)
+ * @param[out] out_tokenizer_  生成したイテレータの格納先
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT 引数がNULL、またはdelimiters_が空文字列
+ * @retval CORE_STRING_SUCCESS          正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_tokenizer_create(const core_string_view_t* const source_, const char* const delimiters_, core_string_tokenizer_t* const out_tokenizer_);
+
+/**
+ * @brief source_を区切り文字列separator_で分割するイテレータを生成する
+ *
+ * @note
+ * - separator_はイテレータから参照するため、イテレータの使用中は破棄しないこと
+ * - その他は core_string_tokenizer_create() と同様
+ *
+ * @param[in]  source_         分割対象の文字列
+ * @param[in]  separator_      区切り文字列(1文字以上)
+ * @param[out] out_tokenizer_  生成したイテレータの格納先
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT 引数がNULL、またはseparator_が空文字列
+ * @retval CORE_STRING_SUCCESS          正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_tokenizer_create_separator(const core_string_view_t* const source_, const char* const separator_, core_string_tokenizer_t* const out_tokenizer_);
+
+/**
+ * @brief 引用符で囲まれたフィールドの扱いを設定する
+ *
+ * @note
+ * - トークンの先頭がquote_の場合、対応する閉じ引用符までをトークンとし、その間の区切り文字は区切りとして扱わない
+ * - 引用符内で引用符を2つ重ねたもの("")は、引用符1文字を表すものとして閉じ引用符とはみなさない
+ * - 返すトークンは引用符の内側を参照する。重ねた引用符はそのまま含まれるため、必要であれば core_string_tokenizer_unquote() で変換すること
+ * - 閉じ引用符から次の区切り文字までの文字は無視する。閉じ引用符がない場合は文字列の末尾までをトークンとする
+ *
+ * @param[in]     quote_     引用符('\0'を指定した場合は引用符を扱わない)
+ * @param[in,out] tokenizer_ 設定対象のイテレータ
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT tokenizer_がNULL
+ * @retval CORE_STRING_SUCCESS          正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_tokenizer_quote_set(char quote_, core_string_tokenizer_t* const tokenizer_);
+
+/**
+ * @brief 空のトークンを返すかを設定する
+ *
+ * @note trueを設定した場合、先頭、末尾、連続する区切り文字を読み飛ばし、空のトークンを返さない("  a   b " -> "a", "b")
+ *
+ * @param[in]     skip_empty_ trueの場合は空のトークンを返さない(生成直後はfalse)
+ * @param[in,out] tokenizer_  設定対象のイテレータ
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT tokenizer_がNULL
+ * @retval CORE_STRING_SUCCESS          正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_tokenizer_skip_empty_set(bool skip_empty_, core_string_tokenizer_t* const tokenizer_);
+
+/**
+ * @brief 次のトークンを取得する
+ *
+ * 使用例:
+ * @code
+ * core_string_view_t token = CORE_STRING_VIEW_INITIALIZER;
+ * while(core_string_tokenizer_next(&tokenizer, &token)) {
+ *     // トークンの処理
+ * }
+ * @endcode
+ *
+ * @param[in,out] tokenizer_ イテレータ
+ * @param[out]    out_token_ 取得したトークンの格納先
+ *
+ * @retval true  トークンを取得した
+ * @retval false 全てのトークンを取得済み、または引数がNULL
+ */
+bool core_string_tokenizer_next(core_string_tokenizer_t* const tokenizer_, core_string_view_t* const out_token_);
+
+/**
+ * @brief 次のトークンを、引用符で囲まれていたかの情報と合わせて取得する
+ *
+ * @note 分割結果は core_string_tokenizer_next() と同じ。引用符で囲まれたトークンを core_string_tokenizer_unquote() で変換する場合に使用する
+ *
+ * 使用例:
+ * @code
+ * core_string_token_t token = CORE_STRING_TOKEN_INITIALIZER;
+ * while(core_string_tokenizer_next_token(&tokenizer, &token)) {
+ *     core_string_tokenizer_unquote(&tokenizer, &token, &field);
+ * }
+ * @endcode
+ *
+ * @param[in,out] tokenizer_ イテレータ
+ * @param[out]    out_token_ 取得したトークンの格納先
+ *
+ * @retval true  トークンを取得した
+ * @retval false 全てのトークンを取得済み、または引数がNULL
+ */
+bool core_string_tokenizer_next_token(core_string_tokenizer_t* const tokenizer_, core_string_token_t* const out_token_);
+
+/**
+ * @brief 残りの全てのトークンをout_tokens_に格納する
+ *
+ * @note
+ * - out_tokens_の既存の要素は削除してから格納する。バッファは再利用するため、行ごとに同じ配列を使用すれば2行目以降はメモリ確保が発生しない
+ * - out_tokens_がデフォルト状態の場合は、core_string_token_t用の配列として生成する
+ * - out_tokens_を生成済みの場合は、core_string_token_t用( dynamic_array_create(sizeof(core_string_token_t), alignof(core_string_token_t), ...) )である必要がある
+ * - 各要素は引用符で囲まれていたかを保持するため、そのまま core_string_tokenizer_unquote() に渡すことができる
+ * - 容量が不足した場合は、拡張率の設定( dynamic_array_growth_policy_set() )に関わらず2倍に拡張する
+ *
+ * 使用例:
+ * @code
+ * dynamic_array_t tokens = DYNAMIC_ARRAY_INITIALIZER;
+ * core_string_tokenizer_create(&line, " \t", &tokenizer);
+ * core_string_tokenizer_skip_empty_set(true, &tokenizer);
+ * core_string_tokenizer_collect(&tokenizer, &tokens);
+ * dynamic_array_const_span_t span;
+ * dynamic_array_const_span(&tokens, &span);    // span.count個のcore_string_token_t
+ * dynamic_array_destroy(&tokens);
+ * @endcode
+ *
+ * @param[in,out] tokenizer_  イテレータ(全てのトークンを取得済みの状態になる)
+ * @param[in,out] out_tokens_ トークンの格納先
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT      引数がNULL、またはout_tokens_の要素がcore_string_token_tでない
+ * @retval CORE_STRING_MEMORY_ALLOCATE_ERROR out_tokens_の生成、拡張に失敗
+ * @retval CORE_STRING_RUNTIME_ERROR         out_tokens_の操作に失敗
+ * @retval CORE_STRING_SUCCESS               正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_tokenizer_collect(core_string_tokenizer_t* const tokenizer_, dynamic_array_t* const out_tokens_);
+
+/**
+ * @brief 引用符で囲まれていたトークンの重ねた引用符("")を1文字に戻してdst_にコピーする
+ *
+ * @note
+ * - token_は core_string_tokenizer_next_token() または core_string_tokenizer_collect() でtokenizer_から取得したものを指定する
+ * - 引用符で囲まれていなかったトークン(token_->quotedがfalse)はそのままコピーする
+ * - dst_の既存の内容は破棄する
+ *
+ * @param[in]  tokenizer_ トークンを返したイテレータ(引用符の文字を参照する)
+ * @param[in]  token_     変換するトークン
+ * @param[out] dst_       変換結果の格納先
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT      引数がNULL
+ * @retval CORE_STRING_MEMORY_ALLOCATE_ERROR dst_のバッファ確保に失敗
+ * @retval CORE_STRING_SUCCESS               正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_tokenizer_unquote(const core_string_tokenizer_t* const tokenizer_, const core_string_token_t* const token_, core_string_t* const dst_);
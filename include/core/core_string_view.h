@@ -0,0 +1,255 @@
+/**
+ * @file core_string_view.h
+ * @author chocolate-pie24
+ * @brief 文字列ビュー(core_string_view_t)の定義と関連APIの宣言
+ *
+ * @details
+ * core_string_view_tは、他のオブジェクトが所有する文字列の一部を先頭ポインタと長さで参照する構造体である。
+ * 部分文字列の切り出し、トリミング、分割、検索、比較をメモリ確保やコピーなしで行えるため、
+ * 入力を細かく切り分けるパーサ等での使用を想定している。
+ *
+ * 利用上の注意:
+ * - ビューは参照先の文字列を所有しない。参照先の文字列が変更、破棄された時点でビューは無効となる
+ * - core_string_tから生成したビューは、短い文字列の場合core_string_tオブジェクト自体の内部を指すため、
+ *   core_string_tオブジェクトを移動(構造体コピー)した場合も無効となる
+ * - ビューが参照する範囲は終端文字'\0'で終わるとは限らない。C文字列が必要な場合は core_string_view_to_string() でコピーすること
+ *
+ * 使用例:
+ * @code
+ * core_string_view_t line = CORE_STRING_VIEW_INITIALIZER;
+ * core_string_view_from_char("  key=value  ", &line);
+ * core_string_view_trim(&line, ' ', ' ', &line);
+ * core_string_view_t key = CORE_STRING_VIEW_INITIALIZER;
+ * if(core_string_view_split(&line, '=', &key)) {
+ *     // key = "key", line = "value"
+ * }
+ * @endcode
+ *
+ * @version 0.1
+ * @date 2025-07-20
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "core/core_string.h"
+
+/**
+ * @brief 文字列ビュー構造体
+ *
+ * core_string_tと異なり、メンバは直接参照してよい。
+ */
+typedef struct core_string_view_t {
+    const char* data;   /**< 参照する文字列の先頭(長さ0の場合はNULLの場合がある) */
+    uint64_t length;    /**< 参照する文字数 */
+} core_string_view_t;
+
+/**
+ * @brief core_string_view_tを空のビューに初期化する
+ *
+ * @code
+ * core_string_view_t view = CORE_STRING_VIEW_INITIALIZER;
+ * @endcode
+ */
+#define CORE_STRING_VIEW_INITIALIZER { 0, 0 }
+
+/**
+ * @brief string_全体を参照するビューを生成する
+ *
+ * @param[in]  string_   参照する文字列(デフォルト状態の場合はdataがNULLの空のビューとなる)
+ * @param[out] out_view_ 生成したビューの格納先
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT string_またはout_view_がNULL
+ * @retval CORE_STRING_SUCCESS 正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_view_from_string(const core_string_t* const string_, core_string_view_t* const out_view_);
+
+/**
+ * @brief C文字列str_全体を参照するビューを生成する
+ *
+ * @param[in]  str_      参照する文字列
+ * @param[out] out_view_ 生成したビューの格納先
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT str_またはout_view_がNULL
+ * @retval CORE_STRING_SUCCESS 正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_view_from_char(const char* const str_, core_string_view_t* const out_view_);
+
+/**
+ * @brief data_の先頭からlength_文字を参照するビューを生成する
+ *
+ * @note data_は終端文字で終わっている必要はない(受信バッファ等の一部を参照できる)
+ *
+ * @param[in]  data_     参照する文字列の先頭(length_が0の場合はNULLでもよい)
+ * @param[in]  length_   参照する文字数
+ * @param[out] out_view_ 生成したビューの格納先
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT out_view_がNULL、またはlength_が0以外でdata_がNULL
+ * @retval CORE_STRING_SUCCESS 正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_view_from_buffer(const char* const data_, uint64_t length_, core_string_view_t* const out_view_);
+
+/**
+ * @brief view_のoffset_文字目からlength_文字を参照するビューを生成する
+ *
+ * @note
+ * - length_がview_の残りの長さを超える場合は、view_の末尾までを参照する(末尾まで切り出す場合は INVALID_VALUE_U64 を指定できる)
+ * - out_view_にview_と同じオブジェクトを指定してもよい
+ *
+ * @param[in]  view_     切り出し元のビュー
+ * @param[in]  offset_   切り出しを開始する位置(0-based, view_の長さ以下)
+ * @param[in]  length_   切り出す文字数
+ * @param[out] out_view_ 切り出したビューの格納先
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT view_またはout_view_がNULL、またはoffset_がview_の長さを超えている
+ * @retval CORE_STRING_SUCCESS 正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_view_substring(const core_string_view_t* const view_, uint64_t offset_, uint64_t length_, core_string_view_t* const out_view_);
+
+/**
+ * @brief view_の左端の連続するltrim_文字と右端の連続するrtrim_文字を除いたビューを生成する
+ *
+ * @note
+ * - core_string_trim() のビュー版であり、コピーは発生しない
+ * - out_view_にview_と同じオブジェクトを指定してもよい
+ *
+ * @param[in]  view_     トリム対象のビュー
+ * @param[in]  ltrim_    左端のトリム対象文字
+ * @param[in]  rtrim_    右端のトリム対象文字
+ * @param[out] out_view_ トリム結果の格納先
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT view_またはout_view_がNULL
+ * @retval CORE_STRING_SUCCESS 正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_view_trim(const core_string_view_t* const view_, char ltrim_, char rtrim_, core_string_view_t* const out_view_);
+
+/**
+ * @brief rest_の先頭からdelimiter_の直前までをout_token_に切り出し、rest_をdelimiter_の直後に進める
+ *
+ * @note
+ * - delimiter_が見つからない場合はrest_全体を最後のトークンとし、rest_を空(dataがNULL)にする
+ * - 連続する区切り文字や末尾の区切り文字からは空のトークンが得られる("a,,b," -> "a", "", "b", "")
+ * - dataがNULLのビュー( @ref CORE_STRING_VIEW_INITIALIZER 等)に対してはfalseを返すため、whileループで全トークンを列挙できる
+ *
+ * 使用例:
+ * @code
+ * core_string_view_t rest = CORE_STRING_VIEW_INITIALIZER;
+ * core_string_view_t token = CORE_STRING_VIEW_INITIALIZER;
+ * core_string_view_from_char("a,b,c", &rest);
+ * while(core_string_view_split(&rest, ',', &token)) {
+ *     // token = "a", "b", "c"
+ * }
+ * @endcode
+ *
+ * @param[in,out] rest_      分割対象のビュー。切り出した部分と区切り文字が取り除かれる
+ * @param[in]     delimiter_ 区切り文字
+ * @param[out]    out_token_ 切り出したトークンの格納先
+ *
+ * @retval true  トークンを切り出した
+ * @retval false rest_を全て切り出し済み、または引数がNULL
+ */
+bool core_string_view_split(core_string_view_t* const rest_, char delimiter_, core_string_view_t* const out_token_);
+
+/**
+ * @brief view_のoffset_文字目以降で、最初にc_が現れる位置を取得する
+ *
+ * @param[in] view_   検索対象のビュー
+ * @param[in] offset_ 検索を開始する位置
+ * @param[in] c_      検索する文字
+ *
+ * @return 見つかった位置(view_の先頭からのインデックス)。見つからない場合、offset_がview_の長さ以上の場合、view_がNULLの場合は INVALID_VALUE_U64
+ */
+uint64_t core_string_view_find_char(const core_string_view_t* const view_, uint64_t offset_, char c_);
+
+/**
+ * @brief view_のoffset_文字目以降で、最初にneedle_が現れる位置を取得する
+ *
+ * @param[in] view_   検索対象のビュー
+ * @param[in] offset_ 検索を開始する位置
+ * @param[in] needle_ 検索する文字列(空の場合はoffset_を返す)
+ *
+ * @return 見つかった位置(view_の先頭からのインデックス)。見つからない場合、offset_がview_の長さを超える場合、引数がNULLの場合は INVALID_VALUE_U64
+ */
+uint64_t core_string_view_find(const core_string_view_t* const view_, uint64_t offset_, const core_string_view_t* const needle_);
+
+/**
+ * @brief 2つのビューが参照する文字列が一致するかを判定する
+ *
+ * @note 長さが異なる場合は内容を比較せずにfalseを返す
+ *
+ * @param[in] view1_ 比較対象1
+ * @param[in] view2_ 比較対象2
+ *
+ * @retval true  一致
+ * @retval false 不一致、または引数がNULL
+ */
+bool core_string_view_equal(const core_string_view_t* const view1_, const core_string_view_t* const view2_);
+
+/**
+ * @brief C文字列str1_とview2_が参照する文字列が一致するかを判定する
+ *
+ * @note str1_はview2_の長さ+1文字までしか走査しない
+ *
+ * @param[in] str1_  比較対象1
+ * @param[in] view2_ 比較対象2
+ *
+ * @retval true  一致
+ * @retval false 不一致、または引数がNULL
+ */
+bool core_string_view_equal_from_char(const char* const str1_, const core_string_view_t* const view2_);
+
+/**
+ * @brief 2つのビューが参照する文字列を辞書順で比較する
+ *
+ * @note 文字はunsigned charとして比較する。一方が他方の先頭部分に一致する場合は、短い方を小さいとする
+ *
+ * @param[in] view1_ 比較対象1
+ * @param[in] view2_ 比較対象2
+ *
+ * @retval 負の値 view1_ < view2_
+ * @retval 0      view1_ == view2_、または引数がNULL
+ * @retval 正の値 view1_ > view2_
+ */
+int core_string_view_compare(const core_string_view_t* const view1_, const core_string_view_t* const view2_);
+
+/**
+ * @brief view_がprefix_で始まるかを判定する
+ *
+ * @param[in] view_   判定対象のビュー
+ * @param[in] prefix_ 先頭に期待する文字列
+ *
+ * @retval true  prefix_で始まる(prefix_が空の場合を含む)
+ * @retval false prefix_で始まらない、または引数がNULL
+ */
+bool core_string_view_starts_with(const core_string_view_t* const view_, const core_string_view_t* const prefix_);
+
+/**
+ * @brief view_がsuffix_で終わるかを判定する
+ *
+ * @param[in] view_   判定対象のビュー
+ * @param[in] suffix_ 末尾に期待する文字列
+ *
+ * @retval true  suffix_で終わる(suffix_が空の場合を含む)
+ * @retval false suffix_で終わらない、または引数がNULL
+ */
+bool core_string_view_ends_with(const core_string_view_t* const view_, const core_string_view_t* const suffix_);
+
+/**
+ * @brief view_が参照する文字列をdst_にコピーする
+ *
+ * @note
+ * - dst_の既存の内容は破棄される
+ * - view_がdst_自身の文字列を参照していてもよい
+ *
+ * @param[in]  view_ コピー元のビュー
+ * @param[out] dst_  コピー先オブジェクト
+ *
+ * @retval CORE_STRING_INVALID_ARGUMENT view_またはdst_がNULL
+ * @retval CORE_STRING_MEMORY_ALLOCATE_ERROR バッファの確保に失敗
+ * @retval CORE_STRING_SUCCESS 正常終了
+ */
+CORE_STRING_ERROR_CODE core_string_view_to_string(const core_string_view_t* const view_, core_string_t* const dst_);
@@ -10,6 +10,10 @@
  */
 #pragma once
 
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
 /**
  * @brief 出力メッセージ重要度リスト
  * @author chocolate-pie24
@@ -29,107 +33,426 @@ typedef enum MESSAGE_SEVERITY {
     MESSAGE_SEVERITY_DEBUG
 } MESSAGE_SEVERITY;
 
+/**
+ * @brief メッセージ出力元モジュールリスト(モジュール単位の出力レベル設定に使用する)
+ *
+ * 各ソースファイルは、message.hをインクルードする前に MESSAGE_MODULE_NAME にモジュール名(MESSAGE_MODULE_を除いた部分)を定義する。
+ * 定義しない場合は MESSAGE_MODULE_DEFAULT として扱う。
+ *
+ * @code
+ * #define MESSAGE_MODULE_NAME STACK    // MESSAGE_MODULE_STACK
+ * #include "core/message.h"
+ * @endcode
+ */
+typedef enum MESSAGE_MODULE {
+    MESSAGE_MODULE_DEFAULT,         /**< モジュール未指定(アプリケーション、テスト等) */
+    MESSAGE_MODULE_CORE_MEMORY,     /**< core_memory */
+    MESSAGE_MODULE_CORE_STRING,     /**< core_string */
+    MESSAGE_MODULE_DYNAMIC_ARRAY,   /**< dynamic_array */
+    MESSAGE_MODULE_STACK,           /**< stack */
+    MESSAGE_MODULE_RING_QUEUE,      /**< ring_queue */
+    MESSAGE_MODULE_HASH_MAP,        /**< hash_map */
+    MESSAGE_MODULE_CORE_HASH,       /**< core_hash */
+    MESSAGE_MODULE_MAX,             /**< モジュール数(モジュールとしては使用しない) */
+} MESSAGE_MODULE;
+
+/**
+ * @name メッセージ出力レベル
+ *
+ * 指定したレベル以下の重要度のメッセージを出力する(MESSAGE_LEVEL_WARNINGであればエラー、ワーニングを出力する)。
+ * プリプロセッサで比較するため、列挙型ではなくマクロで定義する。
+ * @{
+ */
+#define MESSAGE_LEVEL_NONE 0            /**< 全メッセージを出力しない */
+#define MESSAGE_LEVEL_ERROR 1           /**< エラーのみ出力する */
+#define MESSAGE_LEVEL_WARNING 2         /**< ワーニング以上を出力する */
+#define MESSAGE_LEVEL_INFORMATION 3     /**< インフォメーション以上を出力する */
+#define MESSAGE_LEVEL_DEBUG 4           /**< 全メッセージを出力する */
+#define MESSAGE_LEVEL_INHERIT 0xFF      /**< message_module_level_set()用: モジュール個別設定を解除し、全体の設定に従う */
+/** @} */
+
+/**
+ * @brief コンパイル時の出力レベル(これより重要度の低いメッセージ出力マクロはコードを生成しない)
+ *
+ * コンパイルオプション(-DMESSAGE_COMPILE_LEVEL=MESSAGE_LEVEL_ERROR等)で変更できる。
+ * 既定値はリリースビルドではMESSAGE_LEVEL_WARNING、それ以外ではMESSAGE_LEVEL_DEBUG。
+ */
+#ifndef MESSAGE_COMPILE_LEVEL
+    #ifdef RELEASE_BUILD
+        #define MESSAGE_COMPILE_LEVEL MESSAGE_LEVEL_WARNING
+    #else
+        #define MESSAGE_COMPILE_LEVEL MESSAGE_LEVEL_DEBUG
+    #endif
+#endif
+
+/**
+ * @name モジュール単位のコンパイル時出力レベル
+ *
+ * 既定値は MESSAGE_COMPILE_LEVEL 。ホットパスを含むモジュールのみ出力コードを削除したい場合、
+ * -DMESSAGE_COMPILE_LEVEL_STACK=MESSAGE_LEVEL_NONE のように個別に指定する。
+ * @{
+ */
+#ifndef MESSAGE_COMPILE_LEVEL_DEFAULT
+#define MESSAGE_COMPILE_LEVEL_DEFAULT MESSAGE_COMPILE_LEVEL
+#endif
+#ifndef MESSAGE_COMPILE_LEVEL_CORE_MEMORY
+#define MESSAGE_COMPILE_LEVEL_CORE_MEMORY MESSAGE_COMPILE_LEVEL
+#endif
+#ifndef MESSAGE_COMPILE_LEVEL_CORE_STRING
+#define MESSAGE_COMPILE_LEVEL_CORE_STRING MESSAGE_COMPILE_LEVEL
+#endif
+#ifndef MESSAGE_COMPILE_LEVEL_DYNAMIC_ARRAY
+#define MESSAGE_COMPILE_LEVEL_DYNAMIC_ARRAY MESSAGE_COMPILE_LEVEL
+#endif
+#ifndef MESSAGE_COMPILE_LEVEL_STACK
+#define MESSAGE_COMPILE_LEVEL_STACK MESSAGE_COMPILE_LEVEL
+#endif
+#ifndef MESSAGE_COMPILE_LEVEL_RING_QUEUE
+#define MESSAGE_COMPILE_LEVEL_RING_QUEUE MESSAGE_COMPILE_LEVEL
+#endif
+#ifndef MESSAGE_COMPILE_LEVEL_HASH_MAP
+#define MESSAGE_COMPILE_LEVEL_HASH_MAP MESSAGE_COMPILE_LEVEL
+#endif
+#ifndef MESSAGE_COMPILE_LEVEL_CORE_HASH
+#define MESSAGE_COMPILE_LEVEL_CORE_HASH MESSAGE_COMPILE_LEVEL
+#endif
+/** @} */
+
+/**
+ * @brief メッセージ出力元モジュール名(インクルード前に未定義であればDEFAULT)
+ *
+ */
+#ifndef MESSAGE_MODULE_NAME
+#define MESSAGE_MODULE_NAME DEFAULT
+#endif
+
 /**
  * @brief ビルドモードによるエラーメッセージ出力切り替えスイッチ用マクロ定義
- * @note エラーメッセージなのでデバッグビルド/リリースビルド共に出力を有効化するが、無効化できるようにもしておく
+ * @note 既定値は MESSAGE_COMPILE_LEVEL から決まる。0を定義すると全モジュールで無効化する
  *
  */
-#define ENABLE_MESSAGE_SEVERITY_ERROR 1
+#ifndef ENABLE_MESSAGE_SEVERITY_ERROR
+#define ENABLE_MESSAGE_SEVERITY_ERROR (MESSAGE_COMPILE_LEVEL >= MESSAGE_LEVEL_ERROR)
+#endif
 
 /**
  * @brief ビルドモードによるワーニングメッセージ出力切り替えスイッチ用マクロ定義
- * @note ワーニングメッセージなのでデバッグビルド/リリースビルド共に出力を有効化するが、無効化できるようにもしておく
- *
- */
-#define ENABLE_MESSAGE_SEVERITY_WARNING 1
-
-#ifdef RELEASE_BUILD
-    /**
-     * @brief デバッグ用メッセージよりは重要だが、ワーニングほど重要でないメッセージに関する出力切り替えスイッチ用マクロ定義
-     * @note 現状はリリースビルド時には出力を無効にする
-     */
-    #define ENABLE_MESSAGE_SEVERITY_INFORMATION 0
-
-    /**
-     * @brief デバッグ用メッセージに関する出力切り替えスイッチ用マクロ定義
-     * @note 現状はリリースビルド時には出力を無効にする
-     */
-    #define ENABLE_MESSAGE_SEVERITY_DEBUG 0
-#else
-    /**
-     * @brief デバッグメッセージよりは重要だが、ワーニングほど重要でないメッセージに関する出力切り替えスイッチ用マクロ定義
-     * @note 現状はデバッグビルド時には出力を有効にする
-     */
-    #define ENABLE_MESSAGE_SEVERITY_INFORMATION 1
-
-    /**
-     * @brief デバッグ用メッセージに関する出力切り替えスイッチ用マクロ定義
-     * @note 現状はリリースビルド時には出力を有効にする
-     */
-    #define ENABLE_MESSAGE_SEVERITY_DEBUG 1
+ * @note 既定値は MESSAGE_COMPILE_LEVEL から決まる(デバッグビルド/リリースビルド共に有効)
+ *
+ */
+#ifndef ENABLE_MESSAGE_SEVERITY_WARNING
+#define ENABLE_MESSAGE_SEVERITY_WARNING (MESSAGE_COMPILE_LEVEL >= MESSAGE_LEVEL_WARNING)
+#endif
+
+/**
+ * @brief デバッグ用メッセージよりは重要だが、ワーニングほど重要でないメッセージに関する出力切り替えスイッチ用マクロ定義
+ * @note 既定値は MESSAGE_COMPILE_LEVEL から決まる(リリースビルド時には無効)
+ */
+#ifndef ENABLE_MESSAGE_SEVERITY_INFORMATION
+#define ENABLE_MESSAGE_SEVERITY_INFORMATION (MESSAGE_COMPILE_LEVEL >= MESSAGE_LEVEL_INFORMATION)
+#endif
+
+/**
+ * @brief デバッグ用メッセージに関する出力切り替えスイッチ用マクロ定義
+ * @note 既定値は MESSAGE_COMPILE_LEVEL から決まる(リリースビルド時には無効)
+ */
+#ifndef ENABLE_MESSAGE_SEVERITY_DEBUG
+#define ENABLE_MESSAGE_SEVERITY_DEBUG (MESSAGE_COMPILE_LEVEL >= MESSAGE_LEVEL_DEBUG)
 #endif
 
+/**
+ * @brief message_output()が1メッセージの整形に使用するバッファサイズ(byte)
+ *
+ * ヘッダ、末尾の制御文字を含めてこのサイズを超えるメッセージは、本文が切り詰められる。
+ */
+#define MESSAGE_BUFFER_SIZE 1024
+
 /**
  * @brief メッセージ出力関数(メッセージの重要度に応じて出力フォーマットを変える)
  *
+ * @note メッセージはスレッドローカルのバッファ(MESSAGE_BUFFER_SIZE byte)に1回で整形し、1回の書き込みで出力する。
+ *       ヒープ確保は行わない。重要度がエラーの場合は標準エラー出力、それ以外は標準出力に出力する。
+ * @note @ref message_async_start() で非同期出力を開始している場合は、整形したメッセージをキューに格納して戻る。
+ * @note @ref message_binary_start() でバイナリ出力を開始している場合は、整形せずに引数の値をファイルに記録して戻る。
+ *
  * @param severity_ メッセージの重要度
  * @param fmt_ メッセージ内容(printfの"message %s %f"と同様のフォーマット)
  * @param ... メッセージ内容に付加する各種値(printfの%sや%fに対する値に相当)
  */
 void message_output(MESSAGE_SEVERITY severity_, const char* const fmt_,  ...);
 
-#if ENABLE_MESSAGE_SEVERITY_ERROR
-    /**
-     * @brief エラーメッセージ出力処理マクロ定義
-     *
-     */
-    #define ERROR_MESSAGE(...) message_output(MESSAGE_SEVERITY_ERROR, __VA_ARGS__)
-#else
-    /**
-     * @brief エラーメッセージ出力処理マクロ定義(エラーメッセージ出力スイッチが無効であれば空行で置き換えられる)
-     *
-     */
-    #define ERROR_MESSAGE(...)
-#endif
+/**
+ * @brief message_output()と同じ形式のメッセージを、呼び出し側が用意したバッファに整形する(出力は行わない)
+ *
+ * @note 本文がバッファに収まらない場合は切り詰め、本文末尾を"..."に置き換える。ヘッダと末尾の制御文字は常に付加される。
+ *
+ * 使用例:
+ * @code
+ * char buffer[256];
+ * uint64_t length = message_format(MESSAGE_SEVERITY_WARNING, buffer, sizeof(buffer), "value = %d", 10);
+ * // buffer = "\033[1;33m[WARNING] value = 10\033[0m\n"
+ * @endcode
+ *
+ * @param severity_ メッセージの重要度
+ * @param buffer_ 整形結果格納先バッファ(ヌル終端される)
+ * @param buffer_size_ buffer_のサイズ(byte)
+ * @param fmt_ メッセージ内容(printfと同様のフォーマット)
+ * @param ... メッセージ内容に付加する各種値
+ *
+ * @return uint64_t 書き込んだ文字数(終端文字を除く)。buffer_ / fmt_がNULL、severity_が未定義、
+ *                  またはbuffer_size_がヘッダと末尾を格納できない大きさの場合は0
+ */
+uint64_t message_format(MESSAGE_SEVERITY severity_, char* const buffer_, uint64_t buffer_size_, const char* const fmt_, ...);
 
-#if ENABLE_MESSAGE_SEVERITY_WARNING
-    /**
-     * @brief ワーニングメッセージ出力処理マクロ定義
-     *
-     */
-    #define WARN_MESSAGE(...) message_output(MESSAGE_SEVERITY_WARNING, __VA_ARGS__)
-#else
-    /**
-     * @brief ワーニングメッセージ出力処理マクロ定義(ワーニングメッセージ出力スイッチが無効であれば空行で置き換えられる)
-     *
-     */
-    #define WARN_MESSAGE(...)
-#endif
+/**
+ * @brief 非同期出力関連処理が出力するエラーコード
+ *
+ */
+typedef enum MESSAGE_ERROR_CODE {
+    MESSAGE_SUCCESS = 0x00,                 /**< 正常終了 */
+    MESSAGE_INVALID_ARGUMENT = 0x01,        /**< 引数異常 */
+    MESSAGE_MEMORY_ALLOCATE_ERROR = 0x02,   /**< メモリアロケートエラー */
+    MESSAGE_RUNTIME_ERROR = 0x03,           /**< 実行時エラー(出力先ファイルのオープン、書き込みスレッドの生成に失敗) */
+    MESSAGE_ALREADY_STARTED = 0x04,         /**< 非同期出力 / バイナリ出力が既に開始されている */
+    MESSAGE_INVALID_FILE = 0x05,            /**< バイナリログファイルの形式が不正 */
+} MESSAGE_ERROR_CODE;
 
-#if ENABLE_MESSAGE_SEVERITY_INFORMATION
-    /**
-     * @brief インフォメーションメッセージ出力処理マクロ定義
-     *
-     */
-    #define INFO_MESSAGE(...) message_output(MESSAGE_SEVERITY_INFORMATION, __VA_ARGS__)
-#else
-    /**
-     * @brief インフォメーションメッセージ出力処理マクロ定義(インフォメーションメッセージ出力スイッチが無効であれば空行で置き換えられる)
-     *
-     */
-    #define INFO_MESSAGE(...)
-#endif
+/**
+ * @brief 非同期出力時、キューが満杯の場合の動作
+ *
+ */
+typedef enum MESSAGE_ASYNC_POLICY {
+    MESSAGE_ASYNC_POLICY_DROP = 0x00,   /**< メッセージを破棄する(破棄数は message_async_dropped_count() で取得できる) */
+    MESSAGE_ASYNC_POLICY_BLOCK = 0x01,  /**< キューに空きができるまで待つ */
+} MESSAGE_ASYNC_POLICY;
 
-#if ENABLE_MESSAGE_SEVERITY_DEBUG
-    /**
-     * @brief デバッグメッセージ出力処理マクロ定義
-     *
-     */
-    #define DEBUG_MESSAGE(...) message_output(MESSAGE_SEVERITY_DEBUG, __VA_ARGS__)
-#else
-    /**
-     * @brief デバッグメッセージ出力処理マクロ定義(デバッグメッセージ出力スイッチが無効であれば空行で置き換えられる)
-     *
-     */
-    #define DEBUG_MESSAGE(...)
+/**
+ * @brief 非同期出力時に1メッセージとしてキューに格納するレコードのサイズ(byte)
+ *
+ * 非同期出力時は、ヘッダ、末尾の制御文字を含めてこのサイズ(から管理情報分を除いたもの)を超えるメッセージの本文が切り詰められる。
+ */
+#ifndef MESSAGE_ASYNC_RECORD_SIZE
+#define MESSAGE_ASYNC_RECORD_SIZE 256
 #endif
+
+/**
+ * @brief 非同期出力設定
+ *
+ */
+typedef struct message_async_config_t {
+    uint64_t queue_capacity;        /**< キューに格納可能なメッセージ数(2の冪乗)。使用メモリは queue_capacity * MESSAGE_ASYNC_RECORD_SIZE 程度となる */
+    MESSAGE_ASYNC_POLICY policy;    /**< キューが満杯の場合の動作 */
+    const char* file_path;          /**< 出力先ファイルパス(追記)。NULLの場合、エラーは標準エラー出力、それ以外は標準出力に出力する */
+} message_async_config_t;
+
+/**
+ * @brief メッセージの非同期出力を開始する
+ *
+ * 以降の message_output() は、整形したメッセージをロックフリーキュー( @ref ring_queue_t , MPMC)に格納して即座に戻り、
+ * 出力は専用の書き込みスレッドがまとめて(writevで)行う。
+ * 初回の開始時に、終了時に未出力のメッセージを書き出すための関数をatexitに登録する。
+ *
+ * @note message_async_start() / message_async_stop() 同士を複数スレッドから同時に呼んではならない。
+ *       他スレッドのメッセージ出力と並行して message_async_stop() を呼ぶこと(atexitに登録した終了処理を含む)はできる。
+ *       その場合、stop以前にキューへの格納を始めたメッセージは書き出され、以降のメッセージは同期出力となる。
+ *
+ * 使用例:
+ * @code
+ * message_async_config_t config = { 1024, MESSAGE_ASYNC_POLICY_DROP, NULL };
+ * if(MESSAGE_SUCCESS != message_async_start(&config)) {
+ *     // ここにエラー処理を書く(同期出力のまま動作する)
+ * }
+ * ERROR_MESSAGE("func - Something failed.");    // キューに格納して戻る
+ * message_async_stop();                         // 未出力のメッセージを書き出して同期出力に戻る
+ * @endcode
+ *
+ * @param[in] config_ 非同期出力設定
+ *
+ * @retval MESSAGE_INVALID_ARGUMENT config_がNULL、queue_capacityが0または2の冪乗でない、policyが未定義
+ * @retval MESSAGE_ALREADY_STARTED 既に非同期出力中
+ * @retval MESSAGE_MEMORY_ALLOCATE_ERROR キューのメモリ確保に失敗
+ * @retval MESSAGE_RUNTIME_ERROR 出力先ファイルのオープン、または書き込みスレッドの生成に失敗
+ * @retval MESSAGE_SUCCESS 非同期出力を開始し、正常終了
+ */
+MESSAGE_ERROR_CODE message_async_start(const message_async_config_t* const config_);
+
+/**
+ * @brief 非同期出力を終了する。キューに残っているメッセージをすべて書き出し、書き込みスレッドを終了して同期出力に戻る
+ *
+ * @note 非同期出力中でない場合は何もしない。
+ */
+void message_async_stop(void);
+
+/**
+ * @brief 本関数の呼び出し前に非同期出力したメッセージが、すべて書き出されるまで待つ
+ *
+ * @note 非同期出力中でない場合は何もしない。
+ */
+void message_async_flush(void);
+
+/**
+ * @brief MESSAGE_ASYNC_POLICY_DROP でキューが満杯だったために破棄したメッセージ数を取得する
+ *
+ * @return uint64_t 直近の message_async_start() 以降に破棄したメッセージ数
+ */
+uint64_t message_async_dropped_count(void);
+
+/**
+ * @brief バイナリ出力時のファイルサイズ既定値(byte)
+ *
+ */
+#define MESSAGE_BINARY_DEFAULT_FILE_SIZE (64ull * 1024ull * 1024ull)
+
+/**
+ * @brief メッセージのバイナリ出力を開始する
+ *
+ * 以降の message_output() はメッセージを文字列に整形せず、フォーマット文字列のID(ポインタ値)、タイムスタンプ、重要度、
+ * 引数の値をそのままメモリマップしたファイルに書き込む(文字列引数は内容をコピーする)。
+ * フォーマット文字列自体は、初めて出力されたときに1度だけ書き込む。
+ * ファイルは @ref message_binary_decode() (またはtools/message_decode)でテキストに復元する。
+ *
+ * @note フォーマット文字列は静的な文字列(リテラル)であること。ポインタ値でフォーマットを識別するため、
+ *       実行中に内容が変わる文字列をフォーマットに渡した場合は正しく復元できない。
+ * @note ファイルが満杯になった後のメッセージは破棄する(破棄数は @ref message_binary_dropped_count() で取得できる)。
+ * @note %nと%lc / %lsは記録しない(%lc / %lsは空文字として復元される)。long doubleはdoubleに変換して記録する。
+ * @note message_binary_start() / message_binary_stop() はスレッドセーフではない。他スレッドがメッセージを出力していない状態で呼ぶこと。
+ *       バイナリ出力中は @ref message_async_start() による非同期出力より優先される。
+ *
+ * 使用例:
+ * @code
+ * if(MESSAGE_SUCCESS != message_binary_start("app.clog", MESSAGE_BINARY_DEFAULT_FILE_SIZE)) {
+ *     // ここにエラー処理を書く(テキスト出力のまま動作する)
+ * }
+ * WARN_MESSAGE("func - value = %d.", value);   // 引数の値のみを記録する
+ * message_binary_stop();                         // ファイルを使用済みサイズに切り詰めて閉じる
+ * // $ ./bin/message_decode app.clog
+ * @endcode
+ *
+ * @param[in] file_path_ 出力先ファイルパス(既存の場合は上書き)
+ * @param[in] file_size_ ファイルサイズ(byte)。ヘッダ + 1レコード分(MESSAGE_BUFFER_SIZE)以上であること
+ *
+ * @retval MESSAGE_INVALID_ARGUMENT file_path_がNULL、またはfile_size_が小さすぎる
+ * @retval MESSAGE_ALREADY_STARTED 既にバイナリ出力中
+ * @retval MESSAGE_RUNTIME_ERROR ファイルの作成またはメモリマップに失敗
+ * @retval MESSAGE_SUCCESS バイナリ出力を開始し、正常終了
+ */
+MESSAGE_ERROR_CODE message_binary_start(const char* const file_path_, uint64_t file_size_);
+
+/**
+ * @brief バイナリ出力を終了する。ファイルを使用済みサイズに切り詰めて閉じ、テキスト出力に戻る
+ *
+ * @note バイナリ出力中でない場合は何もしない。
+ */
+void message_binary_stop(void);
+
+/**
+ * @brief バイナリ出力でファイルが満杯だったために破棄したメッセージ数を取得する
+ *
+ * @return uint64_t 直近の message_binary_start() 以降に破棄したメッセージ数
+ */
+uint64_t message_binary_dropped_count(void);
+
+/**
+ * @brief バイナリ出力したファイルを読み込み、テキストに復元してout_に出力する
+ *
+ * 1メッセージを1行とし、先頭にタイムスタンプ(UNIX時刻の秒.ナノ秒)を付加した上で message_format() と同じ形式で出力する。
+ * 破棄したメッセージがある場合は、末尾にその数を出力する。
+ *
+ * @param[in] file_path_ message_binary_start() で指定したファイルパス
+ * @param[out] out_ 出力先
+ *
+ * @retval MESSAGE_INVALID_ARGUMENT file_path_ / out_がNULL
+ * @retval MESSAGE_RUNTIME_ERROR ファイルの読み込みに失敗
+ * @retval MESSAGE_INVALID_FILE バイナリログファイルではない、またはファイルが破損している
+ * @retval MESSAGE_MEMORY_ALLOCATE_ERROR 作業用メモリの確保に失敗
+ * @retval MESSAGE_SUCCESS 正常終了
+ */
+MESSAGE_ERROR_CODE message_binary_decode(const char* const file_path_, FILE* const out_);
+
+/**
+ * @brief 実行時の出力レベルを設定する(モジュール個別設定をしていない全モジュールに適用)
+ *
+ * 既定値はMESSAGE_LEVEL_DEBUG(コンパイル時の設定で有効なメッセージをすべて出力する)。
+ *
+ * @param level_ 出力レベル(MESSAGE_LEVEL_NONE ～ MESSAGE_LEVEL_DEBUG)。範囲外の場合は何もしない
+ */
+void message_level_set(uint8_t level_);
+
+/**
+ * @brief 実行時の出力レベルを取得する
+ *
+ * @return uint8_t message_level_set() で設定した出力レベル
+ */
+uint8_t message_level_get(void);
+
+/**
+ * @brief モジュール個別の実行時出力レベルを設定する
+ *
+ * 使用例:
+ * @code
+ * message_level_set(MESSAGE_LEVEL_WARNING);                           // 全体はワーニング以上
+ * message_module_level_set(MESSAGE_MODULE_STACK, MESSAGE_LEVEL_NONE); // stackは出力しない
+ * message_module_level_set(MESSAGE_MODULE_STACK, MESSAGE_LEVEL_INHERIT); // 全体の設定に戻す
+ * @endcode
+ *
+ * @param module_ 対象モジュール
+ * @param level_ 出力レベル(MESSAGE_LEVEL_NONE ～ MESSAGE_LEVEL_DEBUG、またはMESSAGE_LEVEL_INHERIT)。
+ *               module_、level_が範囲外の場合は何もしない
+ */
+void message_module_level_set(MESSAGE_MODULE module_, uint8_t level_);
+
+/**
+ * @brief 指定した重要度、モジュールのメッセージが実行時の出力レベル設定で出力対象かを判定する
+ *
+ * @note 各メッセージ出力マクロは本関数がtrueの場合のみ引数を評価し、 message_output() を呼ぶ。
+ *
+ * @param severity_ メッセージの重要度
+ * @param module_ 出力元モジュール
+ *
+ * @retval true 出力対象
+ * @retval false 出力対象外(severity_、module_が範囲外の場合を含む)
+ */
+bool message_is_enabled(MESSAGE_SEVERITY severity_, MESSAGE_MODULE module_);
+
+// マクロ展開後にトークンを連結する
+#define MESSAGE_CONCAT_IMPL(a_, b_) a_##b_
+#define MESSAGE_CONCAT(a_, b_) MESSAGE_CONCAT_IMPL(a_, b_)
+
+/**
+ * @brief 各メッセージ出力マクロの共通実装
+ *
+ * 条件の前半はコンパイル時定数のため、無効な重要度では出力処理全体が削除される。
+ * 実行時の設定で出力対象外の場合は、メッセージの引数を評価しない。
+ * 無効時も引数の式はコンパイル対象となるため、メッセージでのみ使用する変数に未使用警告は出ない。
+ */
+#define MESSAGE_OUTPUT_IF_ENABLED(enable_, severity_, level_, ...) \
+    do { \
+        if((enable_) && (level_) <= MESSAGE_CONCAT(MESSAGE_COMPILE_LEVEL_, MESSAGE_MODULE_NAME) && \
+            message_is_enabled(severity_, MESSAGE_CONCAT(MESSAGE_MODULE_, MESSAGE_MODULE_NAME))) { \
+            message_output(severity_, __VA_ARGS__); \
+        } \
+    } while(0)
+
+/**
+ * @brief エラーメッセージ出力処理マクロ定義
+ *
+ */
+#define ERROR_MESSAGE(...) MESSAGE_OUTPUT_IF_ENABLED(ENABLE_MESSAGE_SEVERITY_ERROR, MESSAGE_SEVERITY_ERROR, MESSAGE_LEVEL_ERROR, __VA_ARGS__)
+
+/**
+ * @brief ワーニングメッセージ出力処理マクロ定義
+ *
+ */
+#define WARN_MESSAGE(...) MESSAGE_OUTPUT_IF_ENABLED(ENABLE_MESSAGE_SEVERITY_WARNING, MESSAGE_SEVERITY_WARNING, MESSAGE_LEVEL_WARNING, __VA_ARGS__)
+
+/**
+ * @brief インフォメーションメッセージ出力処理マクロ定義
+ *
+ */
+#define INFO_MESSAGE(...) MESSAGE_OUTPUT_IF_ENABLED(ENABLE_MESSAGE_SEVERITY_INFORMATION, MESSAGE_SEVERITY_INFORMATION, MESSAGE_LEVEL_INFORMATION, __VA_ARGS__)
+
+/**
+ * @brief デバッグメッセージ出力処理マクロ定義
+ *
+ */
+#define DEBUG_MESSAGE(...) MESSAGE_OUTPUT_IF_ENABLED(ENABLE_MESSAGE_SEVERITY_DEBUG, MESSAGE_SEVERITY_DEBUG, MESSAGE_LEVEL_DEBUG, __VA_ARGS__)
@@ -10,6 +10,8 @@
  */
 #pragma once
 
+#include <assert.h>
+
 /** @brief uint8_t型異常値 */
 #define INVALID_VALUE_U8 0xFF
 
@@ -21,3 +23,27 @@
 
 /** @brief uint64_t型異常値 */
 #define INVALID_VALUE_U64 0xFFFFFFFFFFFFFFFF
+
+/**
+ * @brief コンテナ/文字列APIの引数チェック、オブジェクト状態チェックの有効/無効切り替えスイッチ
+ *
+ * - 1(デフォルト): NULL引数や未初期化オブジェクトを検出した場合、エラーメッセージを出力してエラーコードを返す
+ * - 0: 上記のチェックをDEBUG_ASSERTに置き換える。RELEASE_BUILDではチェック自体が削除されるため、
+ *      呼び出し側で引数とオブジェクトの正当性を保証すること
+ *
+ * @note ビルド時に-DENABLE_ARGUMENT_CHECK=0を指定することで無効化できる
+ * @note バッファ満杯や範囲外アクセス等、実行時に発生し得るエラーの検出は本スイッチの影響を受けない
+ */
+#ifndef ENABLE_ARGUMENT_CHECK
+    #define ENABLE_ARGUMENT_CHECK 1
+#endif
+
+/**
+ * @brief DEBUG_BUILD時のみ有効となるアサーション
+ *
+ */
+#ifdef DEBUG_BUILD
+    #define DEBUG_ASSERT(expr_) assert(expr_)
+#else
+    #define DEBUG_ASSERT(expr_) ((void)0)
+#endif
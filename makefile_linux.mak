@@ -0,0 +1,71 @@
+TARGET = test
+BENCH_TARGET = bench
+DECODER_TARGET = message_decode
+
+SRC_DIR = src tests bench tools
+BUILD_DIR = bin
+OBJ_DIR = obj
+
+SRC_FILES = $(shell find src tests -name '*.c')
+DIRECTORIES = $(shell find $(SRC_DIR) tests -type d)
+OBJ_FILES = $(SRC_FILES:%=$(OBJ_DIR)/%.o)
+BENCH_SRC_FILES = $(shell find src bench -name '*.c')
+BENCH_OBJ_FILES = $(BENCH_SRC_FILES:%=$(OBJ_DIR)/%.o)
+TOOLS_SRC_FILES = $(shell find src -name '*.c') tools/message_decode.c
+TOOLS_OBJ_FILES = $(TOOLS_SRC_FILES:%=$(OBJ_DIR)/%.o)
+
+INCLUDE_FLAGS = -Iinclude
+
+# コンパイラは環境変数CCで切り替え可能(例: CC=clang ./build.sh all)
+ifeq ($(origin CC), default)
+	CC = gcc
+endif
+
+COMPILER_FLAGS = -Wall -Wextra -std=c17 -pthread
+LINKER_FLAGS = -pthread
+ifeq ($(BUILD_MODE), RELEASE_BUILD)
+	COMPILER_FLAGS += -O3 -DRELEASE_BUILD -DPLATFORM_LINUX
+else
+	COMPILER_FLAGS += -g -O0 -DDEBUG_BUILD -DPLATFORM_LINUX
+endif
+
+.PHONY: all
+all: scaffold link
+
+.PHONY: scaffold
+scaffold:
+	@echo --- scaffolding folder structure... ---
+	@echo Create directories into obj/
+	@mkdir -p $(addprefix $(OBJ_DIR)/,$(DIRECTORIES))
+	@echo Create bin directory.
+	@mkdir -p $(BUILD_DIR)
+	@echo Done.
+	@echo --- compiling source files... ---
+	@echo build mode - $(BUILD_MODE)
+
+$(OBJ_DIR)/%.c.o: %.c
+	@echo compiling $<...
+	$(CC) $< $(COMPILER_FLAGS) -c -o $@ $(INCLUDE_FLAGS)
+
+.PHONY: link
+link: scaffold $(OBJ_FILES)
+	@echo --- linking $(TARGET)... ---
+	@$(CC) $(OBJ_FILES) -o $(BUILD_DIR)/$(TARGET) $(LINKER_FLAGS)
+
+# ベンチマークはRELEASE_BUILDでビルドすること(./build.sh bench RELEASE_BUILD)
+.PHONY: bench
+bench: scaffold $(BENCH_OBJ_FILES)
+	@echo --- linking $(BENCH_TARGET)... ---
+	@$(CC) $(BENCH_OBJ_FILES) -o $(BUILD_DIR)/$(BENCH_TARGET) $(LINKER_FLAGS)
+
+# バイナリログ復元ツール(./build.sh tools)
+.PHONY: tools
+tools: scaffold $(TOOLS_OBJ_FILES)
+	@echo --- linking $(DECODER_TARGET)... ---
+	@$(CC) $(TOOLS_OBJ_FILES) -o $(BUILD_DIR)/$(DECODER_TARGET) $(LINKER_FLAGS)
+
+.PHONY: clean
+clean:
+	@rm -f $(TARGET)
+	@rm -rf $(BUILD_DIR)
+	@rm -rf $(OBJ_DIR)
@@ -1,12 +1,18 @@
 TARGET = test
+BENCH_TARGET = bench
+DECODER_TARGET = message_decode
 
-SRC_DIR = src tests
+SRC_DIR = src tests bench tools
 BUILD_DIR = bin
 OBJ_DIR = obj
 
 SRC_FILES = $(shell find src tests -name '*.c')
 DIRECTORIES = $(shell find $(SRC_DIR) tests -type d)
 OBJ_FILES = $(SRC_FILES:%=$(OBJ_DIR)/%.o)
+BENCH_SRC_FILES = $(shell find src bench -name '*.c')
+BENCH_OBJ_FILES = $(BENCH_SRC_FILES:%=$(OBJ_DIR)/%.o)
+TOOLS_SRC_FILES = $(shell find src -name '*.c') tools/message_decode.c
+TOOLS_OBJ_FILES = $(TOOLS_SRC_FILES:%=$(OBJ_DIR)/%.o)
 
 INCLUDE_FLAGS = -Iinclude
 
@@ -49,6 +55,18 @@ link: scaffold $(OBJ_FILES)
 	@echo --- linking $(TARGET)... ---
 	@$(CC) $(OBJ_FILES) -o $(BUILD_DIR)/$(TARGET) $(LINKER_FLAGS)
 
+# ベンチマークはRELEASE_BUILDでビルドすること(./build.sh bench RELEASE_BUILD)
+.PHONY: bench
+bench: scaffold $(BENCH_OBJ_FILES)
+	@echo --- linking $(BENCH_TARGET)... ---
+	@$(CC) $(BENCH_OBJ_FILES) -o $(BUILD_DIR)/$(BENCH_TARGET) $(LINKER_FLAGS)
+
+# バイナリログ復元ツール(./build.sh tools)
+.PHONY: tools
+tools: scaffold $(TOOLS_OBJ_FILES)
+	@echo --- linking $(DECODER_TARGET)... ---
+	@$(CC) $(TOOLS_OBJ_FILES) -o $(BUILD_DIR)/$(DECODER_TARGET) $(LINKER_FLAGS)
+
 .PHONY: clean
 clean:
 	@rm -f $(TARGET)
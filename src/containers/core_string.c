@@ -23,22 +23,67 @@
  * @copyright Copyright (c) 2025
  *
  */
+#define MESSAGE_MODULE_NAME CORE_STRING // メッセージ出力元モジュール(message.hより前に定義する)
+
 #include <stdbool.h>
 #include <stdint.h>
-#include <stdlib.h> // for strtol
-#include <limits.h> // for INT32_MAX
+#include <stdio.h>  // for vsnprintf
+#include <stdarg.h>
+#include <stdalign.h>
+#include <stdatomic.h>
 
 #include "core/core_string.h"
+#include "core/core_string_number.h"
+#include "core/core_hash.h"
 #include "core/core_memory.h"
 #include "core/message.h"
 
 #include "internal/core_string_internal_data.h"
+#include "internal/core_string_kernel.h"
 
 #include "define.h"
 
 static uint64_t pfn_string_length_from_char(const char* const str_);
 static bool pfn_core_string_copy(const char* const src_, char* const dst_, uint64_t dst_buff_size_);
+static void* pfn_string_allocate(core_arena_t* const arena_, uint64_t size_, uint8_t alignment_requirement_);
+static void pfn_string_free(core_arena_t* const arena_, void* const ptr_, uint64_t size_);
+static bool pfn_string_is_initialized(const core_string_t* const string_);
+static uint64_t pfn_string_length(const core_string_t* const string_);
+static void pfn_string_set_length(core_string_t* const string_, uint64_t length_);
+static void pfn_string_hash_invalidate(core_string_t* const string_);
+static const char* pfn_string_cbuffer(const core_string_t* const string_);
+static char* pfn_string_buffer(core_string_t* const string_);
+static CORE_STRING_ERROR_CODE pfn_string_make_empty(core_string_t* const string_);
+static CORE_STRING_ERROR_CODE pfn_string_grow(uint64_t required_size_, core_string_t* const string_);
+static CORE_STRING_ERROR_CODE pfn_string_append(const char* const src_, uint64_t src_length_, core_string_t* const dst_);
+static uint64_t pfn_string_find(const core_string_t* const string_, uint64_t offset_, const char* const needle_, uint64_t needle_length_);
+static CORE_STRING_ERROR_CODE pfn_string_slice(const core_string_t* const src_, uint64_t offset_, uint64_t length_, core_string_t* const dst_);
+
+/**
+ * @brief インラインバッファのサイズ(終端文字含む)
+ *
+ */
+#define CORE_STRING_INLINE_BUFFER_SIZE (CORE_STRING_INLINE_CAPACITY + 1)
+
+/**
+ * @brief トリム対象の文字集合(文字コードごとに1bit)
+ *
+ */
+typedef struct string_char_set_t {
+    uint64_t bits[4];   /**< 文字コードcのビットはbits[c / 64]の(c % 64)bit目 */
+} string_char_set_t;
+
+static void pfn_string_char_set_add(string_char_set_t* const set_, char c_);
+static bool pfn_string_char_set_contains(const string_char_set_t* const set_, char c_);
+static CORE_STRING_ERROR_CODE pfn_string_trim(const core_string_t* const src_, const string_char_set_t* const ltrim_set_, const string_char_set_t* const rtrim_set_, core_string_t* const dst_);
+
+/**
+ * @brief 連結、追記でバッファが不足した場合の拡張倍率(必要サイズとの大きい方を新しい容量とする)
+ *
+ */
+#define CORE_STRING_GROWTH_FACTOR 2
 
+#if ENABLE_ARGUMENT_CHECK
 /**
  * @brief 引数のNULLチェックを行い、NULLであればCORE_STRING_INVALID_ARGUMENTで処理を終了するマクロ
  *
@@ -49,6 +94,10 @@ static bool pfn_core_string_copy(const char* const src_, char* const dst_, uint6
         return CORE_STRING_INVALID_ARGUMENT; \
     } \
 
+#else
+#define CHECK_ARG_NULL_RETURN_ERROR(func_name_, arg_name_, ptr_) DEBUG_ASSERT(0 != (ptr_));
+#endif
+
 /**
  * @brief 引数のNULLチェックを行い、NULLであればワーニングを出し、リターンするマクロ
  *
@@ -68,7 +117,7 @@ CORE_STRING_ERROR_CODE core_string_create(const char* const src_, core_string_t*
     CHECK_ARG_NULL_RETURN_ERROR("core_string_create", "src_", src_);
     CHECK_ARG_NULL_RETURN_ERROR("core_string_create", "dst_", dst_);
 
-    // internal_dataとバッファを初期化し、メモリを確保する
+    // バッファを初期化し、メモリを確保する(短い文字列はインラインバッファを使用する)
     core_string_destroy(dst_);
     const uint64_t src_length = pfn_string_length_from_char(src_);
     const CORE_STRING_ERROR_CODE err_code_reserve = core_string_buffer_reserve(src_length + 1, dst_);
@@ -77,11 +126,38 @@ CORE_STRING_ERROR_CODE core_string_create(const char* const src_, core_string_t*
         return err_code_reserve;
     }
 
-    // 引数の文字列データをコピー
+    // 引数の文字列データを終端文字まで含めてコピー
+    core_copy_memory(src_, pfn_string_buffer(dst_), src_length + 1);
+    pfn_string_set_length(dst_, src_length);
+    return CORE_STRING_SUCCESS;
+}
+
+CORE_STRING_ERROR_CODE core_string_create_with_arena(const char* const src_, core_arena_t* const arena_, core_string_t* const dst_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_create_with_arena", "src_", src_);
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_create_with_arena", "arena_", arena_);
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_create_with_arena", "dst_", dst_);
+
+    // internal_dataをアリーナから確保し、以降のバッファ確保もアリーナから行われるようにする
+    // (アリーナの情報をinternal_dataに保持するため、短い文字列でもインラインバッファは使用しない)
+    core_string_destroy(dst_);
+    dst_->internal_data = pfn_string_allocate(arena_, sizeof(core_string_internal_data_t), alignof(core_string_internal_data_t));
+    if(0 == dst_->internal_data) {
+        ERROR_MESSAGE("core_string_create_with_arena - Failed to allocate internal_data memory.");
+        return CORE_STRING_MEMORY_ALLOCATE_ERROR;
+    }
+    core_zero_memory(dst_->internal_data, sizeof(core_string_internal_data_t));
     core_string_internal_data_t* internal_data = (core_string_internal_data_t*)(dst_->internal_data);
+    internal_data->arena = arena_;
+
+    const uint64_t src_length = pfn_string_length_from_char(src_);
+    const CORE_STRING_ERROR_CODE err_code_reserve = core_string_buffer_reserve(src_length + 1, dst_);
+    if(CORE_STRING_SUCCESS != err_code_reserve) {
+        ERROR_MESSAGE("core_string_create_with_arena - Failed to reserve buffer memory.");
+        return err_code_reserve;
+    }
     internal_data->length = src_length;
     if(!pfn_core_string_copy(src_, internal_data->buffer, internal_data->length + 1)) {
-        ERROR_MESSAGE("core_string_create - Failed to copy string.");
+        ERROR_MESSAGE("core_string_create_with_arena - Failed to copy string.");
         core_string_destroy(dst_);
         return CORE_STRING_RUNTIME_ERROR;
     }
@@ -92,36 +168,31 @@ CORE_STRING_ERROR_CODE core_string_copy(const core_string_t* const src_, core_st
     CHECK_ARG_NULL_RETURN_ERROR("core_string_copy", "src_", src_);
     CHECK_ARG_NULL_RETURN_ERROR("core_string_copy", "dst_", dst_);
 
-    if(0 == src_->internal_data) {
+    if(!pfn_string_is_initialized(src_)) {
         ERROR_MESSAGE("core_string_copy - Provided string is not initialized.");
         return CORE_STRING_RUNTIME_ERROR;
     }
 
-    core_string_internal_data_t* src_internal_data = (core_string_internal_data_t*)(src_->internal_data);
-    if(0 == src_internal_data->buffer || 0 == src_internal_data->length) {
+    const uint64_t src_length = pfn_string_length(src_);
+    if(0 == src_length) {
         ERROR_MESSAGE("core_string_copy - Provided string's buffer is empty.");
         return CORE_STRING_BUFFER_EMPTY;
     }
+    if(src_ == dst_) {
+        return CORE_STRING_SUCCESS;
+    }
 
-    const uint64_t src_capacity = core_string_buffer_capacity(src_);
     const uint64_t dst_capacity = core_string_buffer_capacity(dst_);
-    if(src_capacity > dst_capacity || 0 == dst_->internal_data) {
-        CORE_STRING_ERROR_CODE err_code_reserve = core_string_buffer_reserve(src_capacity, dst_);
+    if((src_length + 1) > dst_capacity) {
+        CORE_STRING_ERROR_CODE err_code_reserve = core_string_buffer_reserve(src_length + 1, dst_);
         if(CORE_STRING_SUCCESS != err_code_reserve) {
             return err_code_reserve;
         }
-    } else {
-        core_string_internal_data_t* internal_data = (core_string_internal_data_t*)(dst_->internal_data);
-        core_zero_memory(internal_data->buffer, internal_data->buff_size);
     }
 
-    core_string_internal_data_t* dst_internal_data = (core_string_internal_data_t*)(dst_->internal_data);
-    if(!pfn_core_string_copy(src_internal_data->buffer, dst_internal_data->buffer, src_internal_data->length + 1)) {
-        ERROR_MESSAGE("core_string_copy - Failed to copy buffer.");
-        core_string_destroy(dst_);
-        return CORE_STRING_RUNTIME_ERROR;
-    }
-    dst_internal_data->length = src_internal_data->length;
+    // 文字列長は既知のため、終端文字まで含めて直接コピーする
+    core_copy_memory(pfn_string_cbuffer(src_), pfn_string_buffer(dst_), src_length + 1);
+    pfn_string_set_length(dst_, src_length);
     return CORE_STRING_SUCCESS;
 }
 
@@ -131,23 +202,15 @@ CORE_STRING_ERROR_CODE core_string_copy_from_char(const char* const src_, core_s
 
     const uint64_t src_length = pfn_string_length_from_char(src_);
     const uint64_t dst_capacity = core_string_buffer_capacity(dst_);
-    if((src_length + 1) > dst_capacity || 0 == dst_->internal_data) {
+    if((src_length + 1) > dst_capacity) {
         CORE_STRING_ERROR_CODE err_code_reserve = core_string_buffer_reserve((src_length + 1), dst_);
         if(CORE_STRING_SUCCESS != err_code_reserve) {
             return err_code_reserve;
         }
-    } else {
-        core_string_internal_data_t* internal_data = (core_string_internal_data_t*)(dst_->internal_data);
-        core_zero_memory(internal_data->buffer, internal_data->buff_size);
     }
 
-    core_string_internal_data_t* dst_internal_data = (core_string_internal_data_t*)(dst_->internal_data);
-    if(!pfn_core_string_copy(src_, dst_internal_data->buffer, (src_length + 1))) {
-        ERROR_MESSAGE("core_string_copy_from_char - Failed to copy buffer.");
-        core_string_destroy(dst_);
-        return CORE_STRING_RUNTIME_ERROR;
-    }
-    dst_internal_data->length = src_length;
+    core_copy_memory(src_, pfn_string_buffer(dst_), src_length + 1);
+    pfn_string_set_length(dst_, src_length);
     return CORE_STRING_SUCCESS;
 }
 
@@ -155,35 +218,48 @@ void core_string_destroy(core_string_t* const string_) {
     CHECK_ARG_NULL_RETURN_VOID("core_string_destroy", "string_", string_);
     if(0 != string_->internal_data) {
         core_string_internal_data_t* internal_data = (core_string_internal_data_t*)(string_->internal_data);
+        core_arena_t* arena = internal_data->arena;
         if(0 != internal_data->buffer) {
-            core_free(internal_data->buffer);
+            pfn_string_free(arena, internal_data->buffer, internal_data->buff_size);
             internal_data->buffer = 0;
         }
-        core_free(string_->internal_data);
+        pfn_string_free(arena, string_->internal_data, sizeof(core_string_internal_data_t));
         string_->internal_data = 0;
     }
+    string_->inline_buffer[0] = '\0';
+    string_->inline_size = 0;
 }
 
 CORE_STRING_ERROR_CODE core_string_buffer_reserve(uint64_t buffer_size_, core_string_t* const string_) {
     CHECK_ARG_NULL_RETURN_ERROR("core_string_buffer_reserve", "string_", string_);
-    if(0 != string_->internal_data) {
+    if(pfn_string_is_initialized(string_)) {
         const uint64_t capacity = core_string_buffer_capacity(string_);
         if(capacity >= buffer_size_) {
             DEBUG_MESSAGE("core_string_buffer_reserve - Requested buffer is already reserved. Requested size = %lld, Reserved size = %lld.", buffer_size_, capacity);
             return CORE_STRING_SUCCESS;
         }
-    } else {
-        string_->internal_data = core_malloc(sizeof(core_string_internal_data_t));
+    } else if(buffer_size_ <= CORE_STRING_INLINE_BUFFER_SIZE) {
+        // インラインバッファに収まるため、ヒープ確保は行わない
+        core_zero_memory(string_->inline_buffer, sizeof(string_->inline_buffer));
+        string_->inline_size = 1;
+        return CORE_STRING_SUCCESS;
+    }
+
+    if(0 == string_->internal_data) {
+        // デフォルト状態、またはインライン文字列を保持している(既存のデータは破棄する)
+        string_->internal_data = pfn_string_allocate(0, sizeof(core_string_internal_data_t), alignof(core_string_internal_data_t));
         if(0 == string_->internal_data) {
             ERROR_MESSAGE("core_string_buffer_reserve - Failed to allocate internal_data memory.");
             return CORE_STRING_MEMORY_ALLOCATE_ERROR;
         }
         core_zero_memory(string_->internal_data, sizeof(core_string_internal_data_t));
+        string_->inline_buffer[0] = '\0';
+        string_->inline_size = 0;
     }
 
     core_string_internal_data_t* internal_data = (core_string_internal_data_t*)(string_->internal_data);
-    core_free(internal_data->buffer);
-    internal_data->buffer = core_malloc(buffer_size_);
+    pfn_string_free(internal_data->arena, internal_data->buffer, internal_data->buff_size);
+    internal_data->buffer = pfn_string_allocate(internal_data->arena, buffer_size_, 1);
     if(0 == internal_data->buffer) {
         ERROR_MESSAGE("core_string_internal_data_t - Failed to allocate buffer memory.");
         core_string_destroy(string_);
@@ -191,56 +267,77 @@ CORE_STRING_ERROR_CODE core_string_buffer_reserve(uint64_t buffer_size_, core_st
     }
     core_zero_memory(internal_data->buffer, buffer_size_);
     internal_data->buff_size = buffer_size_;
+    internal_data->length = 0;
+    pfn_string_hash_invalidate(string_);
     return CORE_STRING_SUCCESS;
 }
 
 CORE_STRING_ERROR_CODE core_string_buffer_resize(uint64_t buffer_size_, core_string_t* const string_) {
     CHECK_ARG_NULL_RETURN_ERROR("core_string_buffer_resize", "string_", string_);
 
-    if(0 != string_->internal_data) {   // 既に内部データあり
-        const uint64_t capacity = core_string_buffer_capacity(string_);
-        if(capacity >= buffer_size_) {
-            DEBUG_MESSAGE("core_string_buffer_resize - Requested buffer is already reserved. Requested size = %lld, Reserved size = %lld.", buffer_size_, capacity);
-            return CORE_STRING_SUCCESS;
-        }
+    if(!pfn_string_is_initialized(string_)) {   // 内部データがまだない(完全に新規のメモリ確保)
+        return core_string_buffer_reserve(buffer_size_, string_);
+    }
+    const uint64_t capacity = core_string_buffer_capacity(string_);
+    if(capacity >= buffer_size_) {
+        DEBUG_MESSAGE("core_string_buffer_resize - Requested buffer is already reserved. Requested size = %lld, Reserved size = %lld.", buffer_size_, capacity);
+        return CORE_STRING_SUCCESS;
+    }
 
-        // 一時退避バッファを作成し、既存のデータをコピーする
-        core_string_internal_data_t* internal_data = (core_string_internal_data_t*)(string_->internal_data);
-        const uint64_t old_length = internal_data->length;
-        char* tmp_buffer = core_malloc(old_length + 1);
-        if(0 == tmp_buffer) {
-            ERROR_MESSAGE("core_string_buffer_resize - Failed to allocate tmp_buffer memory.");
+    if(0 == string_->internal_data) {
+        // インライン文字列をヒープに移す
+        char* buffer = pfn_string_allocate(0, buffer_size_, 1);
+        if(0 == buffer) {
+            ERROR_MESSAGE("core_string_buffer_resize - Failed to allocate new buffer memory.");
             return CORE_STRING_MEMORY_ALLOCATE_ERROR;
         }
-        core_zero_memory(tmp_buffer, old_length + 1);
-        if(0 != old_length) {
-            if(!pfn_core_string_copy(internal_data->buffer, tmp_buffer, old_length + 1)) {
-                core_free(tmp_buffer);
-                ERROR_MESSAGE("core_string_buffer_resize - Failed to copy string.");
-                return CORE_STRING_RUNTIME_ERROR;
-            }
-            core_free(internal_data->buffer);
+        core_string_internal_data_t* internal_data = pfn_string_allocate(0, sizeof(core_string_internal_data_t), alignof(core_string_internal_data_t));
+        if(0 == internal_data) {
+            pfn_string_free(0, buffer, buffer_size_);
+            ERROR_MESSAGE("core_string_buffer_resize - Failed to allocate internal_data memory.");
+            return CORE_STRING_MEMORY_ALLOCATE_ERROR;
         }
-        // 既存バッファを一時的に削除し、再度メモリ確保を行う
-        internal_data->buffer = core_malloc(buffer_size_);
-        if(0 == internal_data->buffer) {
-            core_free(tmp_buffer);
+        const uint64_t old_length = pfn_string_length(string_);
+        core_zero_memory(buffer, buffer_size_);
+        core_copy_memory(string_->inline_buffer, buffer, old_length);
+        internal_data->buffer = buffer;
+        internal_data->length = old_length;
+        internal_data->buff_size = buffer_size_;
+        internal_data->arena = 0;
+        atomic_init(&internal_data->hash, 0);
+        atomic_init(&internal_data->hash_cached, false);
+        string_->internal_data = internal_data;
+        string_->inline_buffer[0] = '\0';
+        string_->inline_size = 0;
+        return CORE_STRING_SUCCESS;
+    }
+
+    core_string_internal_data_t* internal_data = (core_string_internal_data_t*)(string_->internal_data);
+    if(0 == internal_data->arena) {
+        // ヒープの場合はreallocで拡張し(その場で拡張できればコピーは発生しない)、拡張分のみ0で初期化する
+        char* buffer = core_realloc_tagged(internal_data->buffer, internal_data->buff_size, buffer_size_, MEMORY_TAG_STRING);
+        if(0 == buffer) {
             ERROR_MESSAGE("core_string_buffer_resize - Failed to allocate new buffer memory.");
             return CORE_STRING_MEMORY_ALLOCATE_ERROR;
         }
-        core_zero_memory(internal_data->buffer, buffer_size_);
+        core_zero_memory(buffer + internal_data->buff_size, buffer_size_ - internal_data->buff_size);
+        internal_data->buffer = buffer;
         internal_data->buff_size = buffer_size_;
+        return CORE_STRING_SUCCESS;
+    }
 
-        // 一時退避バッファから新規バッファにデータを戻す
-        if(!pfn_core_string_copy(tmp_buffer, internal_data->buffer, old_length + 1)) {
-            core_free(tmp_buffer);
-            ERROR_MESSAGE("core_string_buffer_resize - Failed to copy string.");
-            return CORE_STRING_RUNTIME_ERROR;
-        }
-        core_free(tmp_buffer);
-    } else {    // 内部データがまだない(完全に新規のメモリ確保)
-        return core_string_buffer_reserve(buffer_size_, string_);
+    // アリーナの場合は新規バッファを確保し、既存のデータを移す(既存バッファはアリーナのリセットで破棄される)
+    char* buffer = pfn_string_allocate(internal_data->arena, buffer_size_, 1);
+    if(0 == buffer) {
+        ERROR_MESSAGE("core_string_buffer_resize - Failed to allocate new buffer memory.");
+        return CORE_STRING_MEMORY_ALLOCATE_ERROR;
     }
+    if(0 != internal_data->length) {
+        core_copy_memory(internal_data->buffer, buffer, internal_data->length);
+    }
+    core_zero_memory(buffer + internal_data->length, buffer_size_ - internal_data->length);
+    internal_data->buffer = buffer;
+    internal_data->buff_size = buffer_size_;
     return CORE_STRING_SUCCESS;
 }
 
@@ -249,11 +346,11 @@ uint64_t core_string_buffer_capacity(const core_string_t* const string_) {
         DEBUG_MESSAGE("core_string_buffer_capacity - Argument string_ requires a valid pointer.");
         return INVALID_VALUE_U64;
     }
-    if(0 == string_->internal_data) {
-        return 0;
+    if(0 != string_->internal_data) {
+        const core_string_internal_data_t* internal_data = (const core_string_internal_data_t*)(string_->internal_data);
+        return internal_data->buff_size;
     }
-    core_string_internal_data_t* internal_data = (core_string_internal_data_t*)(string_->internal_data);
-    return internal_data->buff_size;
+    return (0 != string_->inline_size) ? CORE_STRING_INLINE_BUFFER_SIZE : 0;
 }
 
 bool core_string_is_empty(const core_string_t* const string_) {
@@ -261,14 +358,7 @@ bool core_string_is_empty(const core_string_t* const string_) {
         WARN_MESSAGE("core_string_is_empty - Argument string_ requires a valid pointer.");
         return true;
     }
-    if(0 == string_->internal_data) {
-        return true;
-    }
-    core_string_internal_data_t* internal_data = (core_string_internal_data_t*)(string_->internal_data);
-    if(0 == internal_data->length) {
-        return true;
-    }
-    return false;
+    return 0 == pfn_string_length(string_);
 }
 
 bool core_string_equal(const core_string_t* const string1_, const core_string_t* const string2_) {
@@ -276,25 +366,19 @@ bool core_string_equal(const core_string_t* const string1_, const core_string_t*
         WARN_MESSAGE("core_string_equal - Arguments string1_ and string2_ requre valid pointers.");
         return false;
     }
-    if(0 == string1_->internal_data) {
+    if(!pfn_string_is_initialized(string1_)) {
         WARN_MESSAGE("core_string_equal - Provided string1_ is not initialized.");
         return false;
     }
-    if(0 == string2_->internal_data) {
+    if(!pfn_string_is_initialized(string2_)) {
         WARN_MESSAGE("core_string_equal - Provided string2_ is not initialized.");
         return false;
     }
-    const core_string_internal_data_t* string1_internal_data = (core_string_internal_data_t*)(string1_->internal_data);
-    const core_string_internal_data_t* string2_internal_data = (core_string_internal_data_t*)(string2_->internal_data);
-    if(string1_internal_data->length != string2_internal_data->length) {
+    const uint64_t length = pfn_string_length(string1_);
+    if(length != pfn_string_length(string2_)) {
         return false;
     }
-    for(uint64_t i = 0; i != string1_internal_data->length; ++i) {
-        if(string1_internal_data->buffer[i] != string2_internal_data->buffer[i]) {
-            return false;
-        }
-    }
-    return true;
+    return core_string_kernel_equal(pfn_string_cbuffer(string1_), pfn_string_cbuffer(string2_), length);
 }
 
 bool core_string_equal_from_char(const char* const str1_, const core_string_t* const string2_) {
@@ -302,21 +386,39 @@ bool core_string_equal_from_char(const char* const str1_, const core_string_t* c
         WARN_MESSAGE("core_string_equal - Arguments string1_ and string2_ requre valid pointers.");
         return false;
     }
-    if(0 == string2_->internal_data) {
+    if(!pfn_string_is_initialized(string2_)) {
         WARN_MESSAGE("core_string_equal - Provided string2_ is not initialized.");
         return false;
     }
-    const uint64_t str1_len = pfn_string_length_from_char(str1_);
-    const core_string_internal_data_t* string2_internal_data = (core_string_internal_data_t*)(string2_->internal_data);
-    if(str1_len != string2_internal_data->length) {
+    // 長さの計算、比較ともベクトル命令で行うため、長さを先に求めて不一致なら内容を比較しない
+    const uint64_t length = pfn_string_length(string2_);
+    if(length != pfn_string_length_from_char(str1_)) {
         return false;
     }
-    for(uint64_t i = 0; i != str1_len; ++i) {
-        if(str1_[i] != string2_internal_data->buffer[i]) {
-            return false;
-        }
+    return core_string_kernel_equal(str1_, pfn_string_cbuffer(string2_), length);
+}
+
+uint64_t core_string_find_char(const core_string_t* const string_, uint64_t offset_, char c_) {
+    if(0 == string_ || !pfn_string_is_initialized(string_) || offset_ >= pfn_string_length(string_)) {
+        return INVALID_VALUE_U64;
     }
-    return true;
+    const char* buffer = pfn_string_cbuffer(string_);
+    const char* found = core_string_kernel_find_char(buffer + offset_, pfn_string_length(string_) - offset_, c_);
+    return (0 != found) ? (uint64_t)(found - buffer) : INVALID_VALUE_U64;
+}
+
+uint64_t core_string_find(const core_string_t* const string_, uint64_t offset_, const core_string_t* const needle_) {
+    if(0 == needle_ || !pfn_string_is_initialized(needle_)) {
+        return INVALID_VALUE_U64;
+    }
+    return pfn_string_find(string_, offset_, pfn_string_cbuffer(needle_), pfn_string_length(needle_));
+}
+
+uint64_t core_string_find_from_char(const core_string_t* const string_, uint64_t offset_, const char* const needle_) {
+    if(0 == needle_) {
+        return INVALID_VALUE_U64;
+    }
+    return pfn_string_find(string_, offset_, needle_, pfn_string_length_from_char(needle_));
 }
 
 uint64_t core_string_length(const core_string_t* const string_) {
@@ -324,12 +426,30 @@ uint64_t core_string_length(const core_string_t* const string_) {
         ERROR_MESSAGE("core_string_length - Argument string_ requres a valid pointer.");
         return INVALID_VALUE_U64;
     }
-    if(0 == string_->internal_data) {
+    if(!pfn_string_is_initialized(string_)) {
         ERROR_MESSAGE("core_string_length - Provided string_ is not initialized.");
         return 0;
     }
+    return pfn_string_length(string_);
+}
+
+uint64_t core_string_hash(const core_string_t* const string_) {
+    if(0 == string_) {
+        ERROR_MESSAGE("core_string_hash - Argument string_ requires a valid pointer.");
+        return 0;
+    }
     core_string_internal_data_t* internal_data = (core_string_internal_data_t*)(string_->internal_data);
-    return internal_data->length;
+    if(0 == internal_data) {
+        // インライン文字列(デフォルト状態は空文字列として扱う)は短いため、キャッシュせずに計算する
+        return core_hash_bytes(pfn_string_cbuffer(string_), pfn_string_length(string_), CORE_HASH_DEFAULT_SEED);
+    }
+    if(atomic_load_explicit(&internal_data->hash_cached, memory_order_acquire)) {
+        return atomic_load_explicit(&internal_data->hash, memory_order_relaxed);
+    }
+    const uint64_t hash = core_hash_bytes(internal_data->buffer, internal_data->length, CORE_HASH_DEFAULT_SEED);
+    atomic_store_explicit(&internal_data->hash, hash, memory_order_relaxed);
+    atomic_store_explicit(&internal_data->hash_cached, true, memory_order_release);
+    return hash;
 }
 
 const char* core_string_cstr(const core_string_t* const string_) {
@@ -337,200 +457,385 @@ const char* core_string_cstr(const core_string_t* const string_) {
         ERROR_MESSAGE("core_string_cstr - Argument string_ requires a valid pointer.");
         return 0;
     }
-    if(0 == string_->internal_data) {
+    if(!pfn_string_is_initialized(string_)) {
         DEBUG_MESSAGE("core_string_cstr - Provided string_ is not initialized.");
         return 0;
     }
-    core_string_internal_data_t* internal_data = (core_string_internal_data_t*)(string_->internal_data);
-    return internal_data->buffer;
+    return pfn_string_cbuffer(string_);
 }
 
 CORE_STRING_ERROR_CODE core_string_concat(const core_string_t* const string_, core_string_t* const dst_) {
     CHECK_ARG_NULL_RETURN_ERROR("core_string_concat", "string_", string_);
     CHECK_ARG_NULL_RETURN_ERROR("core_string_concat", "dst_", dst_);
 
-    if(0 == string_->internal_data) {
+    if(!pfn_string_is_initialized(string_)) {
         ERROR_MESSAGE("core_string_concat - Argument string_ is not initialized.");
         return CORE_STRING_RUNTIME_ERROR;
     }
-    const core_string_internal_data_t* string_internal_data = (core_string_internal_data_t*)(string_->internal_data);
-
-    uint64_t required_buffer_size = 0;
-    required_buffer_size += string_internal_data->length + 1;
-    if(0 != dst_->internal_data) {
-        const core_string_internal_data_t* dst_internal_data = (core_string_internal_data_t*)(dst_->internal_data);
-        required_buffer_size += (dst_internal_data->length + 1);
+    // string_とdst_が同一オブジェクトの場合もpfn_string_appendで扱う
+    const CORE_STRING_ERROR_CODE ret_append = pfn_string_append(pfn_string_cbuffer(string_), pfn_string_length(string_), dst_);
+    if(CORE_STRING_SUCCESS != ret_append) {
+        ERROR_MESSAGE("core_string_concat - Failed to resize destination buffer.");
+        return CORE_STRING_RUNTIME_ERROR;
     }
+    return CORE_STRING_SUCCESS;
+}
 
-    const uint64_t dst_capacity = core_string_buffer_capacity(dst_);
-    if(INVALID_VALUE_U64 == dst_capacity) {
-        ERROR_MESSAGE("core_string_concat - Failed to get destination buffer capacity.");
-        return CORE_STRING_RUNTIME_ERROR;
+CORE_STRING_ERROR_CODE core_string_append_char(char c_, core_string_t* const dst_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_append_char", "dst_", dst_);
+    if('\0' == c_) {
+        ERROR_MESSAGE("core_string_append_char - Argument c_ must not be a null character.");
+        return CORE_STRING_INVALID_ARGUMENT;
     }
-    if(required_buffer_size > dst_capacity) {
-        if(CORE_STRING_SUCCESS != core_string_buffer_resize(required_buffer_size, dst_)) {
-            ERROR_MESSAGE("core_string_concat - Failed to resize destination buffer.");
-            return CORE_STRING_RUNTIME_ERROR;
+    const uint64_t length = pfn_string_length(dst_);
+    if(length + 2 > core_string_buffer_capacity(dst_)) {
+        const CORE_STRING_ERROR_CODE ret_grow = pfn_string_grow(length + 2, dst_);
+        if(CORE_STRING_SUCCESS != ret_grow) {
+            ERROR_MESSAGE("core_string_append_char - Failed to resize destination buffer.");
+            return ret_grow;
         }
     }
+    char* buffer = pfn_string_buffer(dst_);
+    buffer[length] = c_;
+    buffer[length + 1] = '\0';
+    pfn_string_set_length(dst_, length + 1);
+    return CORE_STRING_SUCCESS;
+}
+
+CORE_STRING_ERROR_CODE core_string_append_from_char(const char* const src_, core_string_t* const dst_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_append_from_char", "src_", src_);
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_append_from_char", "dst_", dst_);
+    const CORE_STRING_ERROR_CODE ret_append = pfn_string_append(src_, pfn_string_length_from_char(src_), dst_);
+    if(CORE_STRING_SUCCESS != ret_append) {
+        ERROR_MESSAGE("core_string_append_from_char - Failed to resize destination buffer.");
+    }
+    return ret_append;
+}
+
+CORE_STRING_ERROR_CODE core_string_append_from_buffer(const char* const src_, uint64_t length_, core_string_t* const dst_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_append_from_buffer", "dst_", dst_);
+    if(0 != length_) {
+        CHECK_ARG_NULL_RETURN_ERROR("core_string_append_from_buffer", "src_", src_);
+    }
+    const CORE_STRING_ERROR_CODE ret_append = pfn_string_append(src_, length_, dst_);
+    if(CORE_STRING_SUCCESS != ret_append) {
+        ERROR_MESSAGE("core_string_append_from_buffer - Failed to resize destination buffer.");
+    }
+    return ret_append;
+}
 
-    core_string_internal_data_t* dst_internal_data = (core_string_internal_data_t*)(dst_->internal_data);
-    uint64_t dst_counter = dst_internal_data->length;
-    for(uint64_t i = 0; i != string_internal_data->length; ++i) {
-        dst_internal_data->buffer[dst_counter] = string_internal_data->buffer[i];
-        dst_counter++;
+CORE_STRING_ERROR_CODE core_string_append_format(core_string_t* const dst_, const char* const format_, ...) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_append_format", "dst_", dst_);
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_append_format", "format_", format_);
+
+    const uint64_t length = pfn_string_length(dst_);
+    const uint64_t capacity = core_string_buffer_capacity(dst_);
+    va_list args;
+    va_list args_retry;
+    va_start(args, format_);
+    va_copy(args_retry, args);
+
+    // まず現在の空き領域に直接書き込み、収まらなかった場合のみ拡張して書き直す
+    const int written = (capacity > length) ? vsnprintf(pfn_string_buffer(dst_) + length, (size_t)(capacity - length), format_, args) : vsnprintf(0, 0, format_, args);
+    va_end(args);
+    if(written < 0) {
+        va_end(args_retry);
+        ERROR_MESSAGE("core_string_append_format - Failed to format string.");
+        return CORE_STRING_RUNTIME_ERROR;
+    }
+    const uint64_t required_size = length + (uint64_t)written + 1;
+    if(required_size > capacity) {
+        const CORE_STRING_ERROR_CODE ret_grow = pfn_string_grow(required_size, dst_);
+        if(CORE_STRING_SUCCESS != ret_grow) {
+            va_end(args_retry);
+            if(capacity > length) {
+                pfn_string_buffer(dst_)[length] = '\0';    // 途中まで書き込んだ内容を取り消す
+            }
+            ERROR_MESSAGE("core_string_append_format - Failed to resize destination buffer.");
+            return ret_grow;
+        }
+        vsnprintf(pfn_string_buffer(dst_) + length, (size_t)(written + 1), format_, args_retry);
     }
-    dst_internal_data->buffer[dst_counter] = '\0';
-    dst_internal_data->length = dst_counter;
+    va_end(args_retry);
+    pfn_string_set_length(dst_, length + (uint64_t)written);
     return CORE_STRING_SUCCESS;
 }
 
-CORE_STRING_ERROR_CODE core_string_substring_copy(const core_string_t* const src_, core_string_t* const dst_, uint16_t from_, uint16_t to_) {
+CORE_STRING_ERROR_CODE core_string_substring_copy(const core_string_t* const src_, core_string_t* const dst_, uint64_t from_, uint64_t to_) {
     CHECK_ARG_NULL_RETURN_ERROR("core_string_substring_copy", "src_", src_);
     CHECK_ARG_NULL_RETURN_ERROR("core_string_substring_copy", "dst_", dst_);
     if(from_ > to_) {
-        ERROR_MESSAGE("core_string_substring_copy - Illegal argument. to_ must be larger than from_. [from_, to_] = [%d, %d].", from_, to_);
+        ERROR_MESSAGE("core_string_substring_copy - Illegal argument. to_ must be larger than from_. [from_, to_] = [%llu, %llu].", (unsigned long long)from_, (unsigned long long)to_);
         return CORE_STRING_INVALID_ARGUMENT;
     }
-    if(0 == src_->internal_data) {
+    if(!pfn_string_is_initialized(src_)) {
         ERROR_MESSAGE("core_string_substring_copy - Argument src_ is not initialized.");
         return CORE_STRING_RUNTIME_ERROR;
     }
-    const core_string_internal_data_t* src_internal_data = (core_string_internal_data_t*)(src_->internal_data);
-    if(to_ > src_internal_data->length) {
+    if(to_ >= pfn_string_length(src_)) {
         ERROR_MESSAGE("core_string_substring_copy - Provided to_ is buffer range over.");
         return CORE_STRING_INVALID_ARGUMENT;
     }
-
-    const uint64_t required_buffer_size = to_ - from_ + 2;
-    const uint64_t dst_buffer_size = core_string_buffer_capacity(dst_);
-    if(INVALID_VALUE_U64 == dst_buffer_size) {
-        ERROR_MESSAGE("core_string_substring_copy - Failed to get destination buffer capacity.");
+    const CORE_STRING_ERROR_CODE ret = pfn_string_slice(src_, from_, to_ - from_ + 1, dst_);
+    if(CORE_STRING_SUCCESS != ret) {
+        ERROR_MESSAGE("core_string_substring_copy - Failed to resize destination buffer.");
         return CORE_STRING_RUNTIME_ERROR;
     }
-    if(dst_buffer_size < required_buffer_size) {
-        if(CORE_STRING_SUCCESS != core_string_buffer_resize(required_buffer_size, dst_)) {
-            ERROR_MESSAGE("core_string_substring_copy - Failed to resize destination buffer.");
-            return CORE_STRING_RUNTIME_ERROR;
-        }
-    }
-
-    core_string_internal_data_t* dst_internal_data = (core_string_internal_data_t*)(dst_->internal_data);
-    for(uint16_t i = from_, j = 0; i <= to_; ++i, ++j) {
-        dst_internal_data->buffer[j] = src_internal_data->buffer[i];
-    }
-    dst_internal_data->buffer[to_ - from_ + 1] = '\0';
-    dst_internal_data->length = to_ - from_ + 1;
     return CORE_STRING_SUCCESS;
 }
 
 CORE_STRING_ERROR_CODE core_string_trim(const core_string_t* const src_, core_string_t* const dst_, char ltrim_, char rtrim_) {
     CHECK_ARG_NULL_RETURN_ERROR("core_string_trim", "src_", src_);
     CHECK_ARG_NULL_RETURN_ERROR("core_string_trim", "dst_", dst_);
-    if(0 == src_->internal_data) {
+    if(!pfn_string_is_initialized(src_)) {
         ERROR_MESSAGE("core_string_trim - Argument src_ is not initialized.");
         return CORE_STRING_RUNTIME_ERROR;
     }
-    const uint64_t src_length = core_string_length(src_);
-    if(INVALID_VALUE_U64 == src_length) {
-        ERROR_MESSAGE("core_string_trim - Failed to get src length.");
-        return CORE_STRING_RUNTIME_ERROR;
-    }
+    string_char_set_t ltrim_set = { { 0 } };
+    string_char_set_t rtrim_set = { { 0 } };
+    pfn_string_char_set_add(&ltrim_set, ltrim_);
+    pfn_string_char_set_add(&rtrim_set, rtrim_);
+    return pfn_string_trim(src_, &ltrim_set, &rtrim_set, dst_);
+}
 
-    uint64_t to = INVALID_VALUE_U64;
-    core_string_internal_data_t* src_internal_data = (core_string_internal_data_t*)(src_->internal_data);
-    for(int i = (int)(src_length - 1); i >= 0; --i) {
-        if(src_internal_data->buffer[i] != rtrim_) {
-            to = i;
-            break;
-        }
-    }
-    if (INVALID_VALUE_U64 == to) {
-        // 空文字列を返す
-        if(0 == dst_->internal_data) {
-            core_string_buffer_reserve(2, dst_);
-        } else {
-            core_string_internal_data_t* internal_data = (core_string_internal_data_t*)(dst_->internal_data);
-            for(uint64_t i = 0; i != internal_data->length; ++i) {
-                internal_data->buffer[i] = 0;
-            }
-        }
-        return CORE_STRING_SUCCESS;
+CORE_STRING_ERROR_CODE core_string_trim_set(const core_string_t* const src_, core_string_t* const dst_, const char* const ltrim_set_, const char* const rtrim_set_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_trim_set", "src_", src_);
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_trim_set", "dst_", dst_);
+    if(!pfn_string_is_initialized(src_)) {
+        ERROR_MESSAGE("core_string_trim_set - Argument src_ is not initialized.");
+        return CORE_STRING_RUNTIME_ERROR;
     }
-
-    uint16_t from = 0;
-    for(uint16_t i = 0; i != src_length; ++i) {
-        if(src_internal_data->buffer[i] != ltrim_) {
-            from = i;
-            break;
-        }
+    string_char_set_t ltrim_set = { { 0 } };
+    string_char_set_t rtrim_set = { { 0 } };
+    for(const char* c = ltrim_set_; 0 != c && '\0' != *c; ++c) {
+        pfn_string_char_set_add(&ltrim_set, *c);
     }
-
-    if (from > to) {
-        // 空文字列を返す
-        if(0 == dst_->internal_data) {
-            core_string_buffer_reserve(2, dst_);
-        } else {
-            core_string_internal_data_t* internal_data = (core_string_internal_data_t*)(dst_->internal_data);
-            for(uint64_t i = 0; i != internal_data->length; ++i) {
-                internal_data->buffer[i] = 0;
-            }
-        }
-        return CORE_STRING_SUCCESS;
-    } else {
-        return core_string_substring_copy(src_, dst_, from, to);
+    for(const char* c = rtrim_set_; 0 != c && '\0' != *c; ++c) {
+        pfn_string_char_set_add(&rtrim_set, *c);
     }
+    return pfn_string_trim(src_, &ltrim_set, &rtrim_set, dst_);
 }
 
 CORE_STRING_ERROR_CODE core_string_to_i32(const core_string_t* const string_, int32_t* out_value_) {
     CHECK_ARG_NULL_RETURN_ERROR("core_string_to_i32", "string_", string_);
     CHECK_ARG_NULL_RETURN_ERROR("core_string_to_i32", "out_value_", out_value_);
-    if(0 == string_->internal_data) {
+    if(!pfn_string_is_initialized(string_)) {
         ERROR_MESSAGE("core_string_to_i32 - Argument string_ is not initialized.");
         return CORE_STRING_RUNTIME_ERROR;
     }
-    core_string_internal_data_t* internal_data = (core_string_internal_data_t*)(string_->internal_data);
-    if(0 == internal_data->length) {
+    if(0 == pfn_string_length(string_)) {
         ERROR_MESSAGE("core_string_to_i32 - Provided string is empty.");
         return CORE_STRING_RUNTIME_ERROR;
     }
-    char* e = 0;
-    long tmp = strtol(internal_data->buffer, &e, 10);
-    if(*e != '\0') {
+    // 互換性のため10進数のみ受け付ける(core_string_parse_i32()が受け付ける0x形式の16進数は変換失敗とする)
+    const char* buffer = pfn_string_cbuffer(string_);
+    const uint64_t length = pfn_string_length(string_);
+    const uint64_t sign = ('+' == buffer[0] || '-' == buffer[0]) ? 1 : 0;
+    if(sign + 1 < length && '0' == buffer[sign] && ('x' == buffer[sign + 1] || 'X' == buffer[sign + 1])) {
         ERROR_MESSAGE("core_string_to_i32 - Failed to convert string.");
         return CORE_STRING_RUNTIME_ERROR;
     }
-    if (tmp < INT32_MIN || tmp > INT32_MAX) {
+    int32_t value = 0;
+    const CORE_STRING_ERROR_CODE ret = core_string_parse_i32(buffer, length, &value, 0);
+    if(CORE_STRING_OUT_OF_RANGE == ret) {
         ERROR_MESSAGE("core_string_to_i32 - Value out of int32_t range.");
         return CORE_STRING_RUNTIME_ERROR;
     }
-    *out_value_ = (int32_t)(tmp);
+    if(CORE_STRING_SUCCESS != ret) {
+        ERROR_MESSAGE("core_string_to_i32 - Failed to convert string.");
+        return CORE_STRING_RUNTIME_ERROR;
+    }
+    *out_value_ = value;
     return CORE_STRING_SUCCESS;
 }
 
+// string_が初期化済み状態(internal_dataまたはインライン文字列を保持)かを判定する
+static bool pfn_string_is_initialized(const core_string_t* const string_) {
+    return (0 != string_->internal_data) || (0 != string_->inline_size);
+}
+
+// string_の文字列長を取得する(デフォルト状態の場合は0)
+static uint64_t pfn_string_length(const core_string_t* const string_) {
+    if(0 != string_->internal_data) {
+        return ((const core_string_internal_data_t*)(string_->internal_data))->length;
+    }
+    return (0 != string_->inline_size) ? (uint64_t)(string_->inline_size - 1) : 0;
+}
+
+// string_の文字列長を設定する(length_ + 1がバッファ容量以内であることは呼び出し側が保証する)
+static void pfn_string_set_length(core_string_t* const string_, uint64_t length_) {
+    if(0 != string_->internal_data) {
+        ((core_string_internal_data_t*)(string_->internal_data))->length = length_;
+        pfn_string_hash_invalidate(string_);
+    } else {
+        string_->inline_size = (uint8_t)(length_ + 1);
+    }
+}
+
+// string_のハッシュ値のキャッシュを無効化する(インライン文字列はキャッシュを持たない)
+static void pfn_string_hash_invalidate(core_string_t* const string_) {
+    if(0 != string_->internal_data) {
+        atomic_store_explicit(&((core_string_internal_data_t*)(string_->internal_data))->hash_cached, false, memory_order_relaxed);
+    }
+}
+
+// string_の文字列バッファ先頭を取得する(デフォルト状態の場合はNULL)
+static const char* pfn_string_cbuffer(const core_string_t* const string_) {
+    if(0 != string_->internal_data) {
+        return ((const core_string_internal_data_t*)(string_->internal_data))->buffer;
+    }
+    return (0 != string_->inline_size) ? string_->inline_buffer : 0;
+}
+
+// string_の書き込み可能な文字列バッファ先頭を取得する(デフォルト状態の場合はNULL。内容が変更されるため、ハッシュ値のキャッシュを無効化する)
+static char* pfn_string_buffer(core_string_t* const string_) {
+    if(0 != string_->internal_data) {
+        pfn_string_hash_invalidate(string_);
+        return ((core_string_internal_data_t*)(string_->internal_data))->buffer;
+    }
+    return (0 != string_->inline_size) ? string_->inline_buffer : 0;
+}
+
+// string_を空文字列にする(デフォルト状態の場合はバッファを確保する)
+static CORE_STRING_ERROR_CODE pfn_string_make_empty(core_string_t* const string_) {
+    if(!pfn_string_is_initialized(string_)) {
+        return core_string_buffer_reserve(2, string_);
+    }
+    pfn_string_buffer(string_)[0] = '\0';
+    pfn_string_set_length(string_, 0);
+    return CORE_STRING_SUCCESS;
+}
+
+// string_の容量をrequired_size_以上に拡張する(現在の容量のCORE_STRING_GROWTH_FACTOR倍と必要サイズの大きい方を確保し、追記を償却O(1)にする)
+static CORE_STRING_ERROR_CODE pfn_string_grow(uint64_t required_size_, core_string_t* const string_) {
+    const uint64_t capacity = core_string_buffer_capacity(string_);
+    if(capacity >= required_size_) {
+        return CORE_STRING_SUCCESS;
+    }
+    const uint64_t grown = capacity * CORE_STRING_GROWTH_FACTOR;
+    return core_string_buffer_resize((grown > required_size_) ? grown : required_size_, string_);
+}
+
+// dst_の末尾にsrc_の先頭src_length_文字を追記する(src_がdst_のバッファ内を指していてもよい)
+static CORE_STRING_ERROR_CODE pfn_string_append(const char* const src_, uint64_t src_length_, core_string_t* const dst_) {
+    const uint64_t dst_length = pfn_string_length(dst_);
+    const uint64_t required_size = dst_length + src_length_ + 1;
+    const char* src = src_;
+    if(required_size > core_string_buffer_capacity(dst_)) {
+        // 拡張でバッファが移動するため、自身のバッファを指している場合は位置を保持しておく
+        const char* dst_buffer = pfn_string_cbuffer(dst_);
+        const bool self = (0 != dst_buffer) && (src_ >= dst_buffer) && (src_ < dst_buffer + core_string_buffer_capacity(dst_));
+        const uint64_t self_offset = self ? (uint64_t)(src_ - dst_buffer) : 0;
+        const CORE_STRING_ERROR_CODE ret_grow = pfn_string_grow(required_size, dst_);
+        if(CORE_STRING_SUCCESS != ret_grow) {
+            return ret_grow;
+        }
+        if(self) {
+            src = pfn_string_cbuffer(dst_) + self_offset;
+        }
+    }
+    char* buffer = pfn_string_buffer(dst_);
+    core_move_memory(src, buffer + dst_length, src_length_);
+    buffer[dst_length + src_length_] = '\0';
+    pfn_string_set_length(dst_, dst_length + src_length_);
+    return CORE_STRING_SUCCESS;
+}
+
+// string_のoffset_文字目以降でneedle_の先頭needle_length_文字が現れる位置を取得する
+static uint64_t pfn_string_find(const core_string_t* const string_, uint64_t offset_, const char* const needle_, uint64_t needle_length_) {
+    if(0 == string_ || !pfn_string_is_initialized(string_) || offset_ > pfn_string_length(string_)) {
+        return INVALID_VALUE_U64;
+    }
+    const uint64_t index = core_string_kernel_find(pfn_string_cbuffer(string_) + offset_, pfn_string_length(string_) - offset_, needle_, needle_length_);
+    return (INVALID_VALUE_U64 != index) ? offset_ + index : INVALID_VALUE_U64;
+}
+
+// src_のoffset_文字目からlength_文字をdst_にコピーする(範囲は呼び出し側で確認する。src_とdst_が同じオブジェクトの場合はメモリ確保なしでその場で詰める)
+static CORE_STRING_ERROR_CODE pfn_string_slice(const core_string_t* const src_, uint64_t offset_, uint64_t length_, core_string_t* const dst_) {
+    if(src_ != dst_ && core_string_buffer_capacity(dst_) < length_ + 1) {
+        const CORE_STRING_ERROR_CODE ret_resize = core_string_buffer_resize(length_ + 1, dst_);
+        if(CORE_STRING_SUCCESS != ret_resize) {
+            return ret_resize;
+        }
+    }
+    char* dst_buffer = pfn_string_buffer(dst_);
+    core_move_memory(pfn_string_cbuffer(src_) + offset_, dst_buffer, length_);
+    dst_buffer[length_] = '\0';
+    pfn_string_set_length(dst_, length_);
+    return CORE_STRING_SUCCESS;
+}
+
+// src_の左端からltrim_set_に含まれる文字、右端からrtrim_set_に含まれる文字を取り除いてdst_にコピーする
+static CORE_STRING_ERROR_CODE pfn_string_trim(const core_string_t* const src_, const string_char_set_t* const ltrim_set_, const string_char_set_t* const rtrim_set_, core_string_t* const dst_) {
+    const char* src_buffer = pfn_string_cbuffer(src_);
+    uint64_t begin = 0;
+    uint64_t end = pfn_string_length(src_);
+    while(begin != end && pfn_string_char_set_contains(ltrim_set_, src_buffer[begin])) {
+        begin++;
+    }
+    while(begin != end && pfn_string_char_set_contains(rtrim_set_, src_buffer[end - 1])) {
+        end--;
+    }
+    if(begin == end) {
+        // 空文字列を返す
+        return pfn_string_make_empty(dst_);
+    }
+    if(src_ == dst_ && 0 == begin) {
+        // その場でのトリムで左端が変わらない場合は終端文字の書き込みのみ
+        pfn_string_buffer(dst_)[end] = '\0';
+        pfn_string_set_length(dst_, end);
+        return CORE_STRING_SUCCESS;
+    }
+    return pfn_string_slice(src_, begin, end - begin, dst_);
+}
+
+// set_にc_を追加する
+static void pfn_string_char_set_add(string_char_set_t* const set_, char c_) {
+    const uint8_t code = (uint8_t)c_;
+    set_->bits[code >> 6] |= 1ull << (code & 63);
+}
+
+// set_にc_が含まれるかを判定する
+static bool pfn_string_char_set_contains(const string_char_set_t* const set_, char c_) {
+    const uint8_t code = (uint8_t)c_;
+    return 0 != (set_->bits[code >> 6] & (1ull << (code & 63)));
+}
+
 // 引数で与えた文字列の長さを取得する
 static uint64_t pfn_string_length_from_char(const char* const str_) {
     if(0 == str_) {
         WARN_MESSAGE("pfn_string_length_from_char - Argument str_ is null.");
         return 0;
     }
-    uint64_t len = 0;
-    while('\0' != str_[len]) {
-        len++;
-    }
-    return len;
+    return core_string_kernel_length(str_);
 }
 
-// char型配列dst_にchar型配列src_の中身をコピーする
+// char型配列dst_にchar型配列src_の中身を終端文字を含めてコピーする
 static bool pfn_core_string_copy(const char* const src_, char* const dst_, uint64_t dst_buff_size_) {
-    core_zero_memory(dst_, dst_buff_size_);
     const uint64_t src_len = pfn_string_length_from_char(src_);
     if((src_len + 1) > dst_buff_size_) {
         ERROR_MESSAGE("pfn_core_string_copy - Buffer too small. src length: %llu, buffer size: %llu (must be > src length).", src_len, dst_buff_size_);
         return false;
     }
-    for(uint64_t counter = 0; counter != src_len; ++counter) {
-        dst_[counter] = src_[counter];
-    }
+    core_copy_memory(src_, dst_, src_len + 1);
     return true;
 }
+
+// arena_が指定されていればアリーナから、そうでなければヒープからメモリを確保する
+static void* pfn_string_allocate(core_arena_t* const arena_, uint64_t size_, uint8_t alignment_requirement_) {
+    if(0 == arena_) {
+        return core_malloc_tagged(size_, MEMORY_TAG_STRING);
+    }
+    void* ptr = 0;
+    if(CORE_MEMORY_SUCCESS != core_arena_allocate(size_, alignment_requirement_, arena_, &ptr)) {
+        return 0;
+    }
+    return ptr;
+}
+
+// アリーナから確保した領域はcore_arena_reset()で一括破棄されるため、ヒープから確保した領域のみ解放する
+static void pfn_string_free(core_arena_t* const arena_, void* const ptr_, uint64_t size_) {
+    if(0 == arena_) {
+        core_free_tagged(ptr_, size_, MEMORY_TAG_STRING);
+    }
+}
@@ -0,0 +1,354 @@
+/**
+ * @file core_string_builder.c
+ * @author chocolate-pie24
+ * @brief 文字列ビルダーオブジェクト(core_string_builder_t)用API関数の実装ファイル
+ *
+ * @details
+ * 追記された文字列はブロックのリストに順に詰める。現在のブロックに収まらない分は新しいブロックに続けて格納するため、
+ * 1つの文字列が複数のブロックに跨がることがある(整形追記を除く)。
+ * 既存のブロックは移動・再確保しないため、追記のコストは追記する文字列長にのみ比例する。
+ *
+ * @version 0.1
+ * @date 2025-07-20
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#if defined(__linux__)
+#define _POSIX_C_SOURCE 200809L // for writev
+#endif
+
+#define MESSAGE_MODULE_NAME CORE_STRING // メッセージ出力元モジュール(message.hより前に定義する)
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>  // for vsnprintf
+#include <stdarg.h>
+#include <errno.h>
+#include <sys/uio.h>
+
+#include "core/core_string_builder.h"
+#include "core/core_string.h"
+#include "core/core_memory.h"
+#include "core/message.h"
+
+#include "internal/core_string_builder_internal_data.h"
+#include "internal/core_string_kernel.h"
+
+#include "define.h"
+
+/**
+ * @brief core_string_builder_write() で1回のwritevに渡すブロック数の上限(IOV_MAXの最小保証値以下)
+ *
+ */
+#define CORE_STRING_BUILDER_IOV_BATCH 16
+
+#if ENABLE_ARGUMENT_CHECK
+/**
+ * @brief 引数のNULLチェックを行い、NULLであればCORE_STRING_INVALID_ARGUMENTで処理を終了するマクロ
+ *
+ */
+#define CHECK_ARG_NULL_RETURN_ERROR(func_name_, arg_name_, ptr_) \
+    if(0 == ptr_) { \
+        ERROR_MESSAGE("%s - Argument %s requires a valid pointer.", func_name_, arg_name_); \
+        return CORE_STRING_INVALID_ARGUMENT; \
+    } \
+
+#else
+#define CHECK_ARG_NULL_RETURN_ERROR(func_name_, arg_name_, ptr_) DEBUG_ASSERT(0 != (ptr_));
+#endif
+
+/**
+ * @brief 引数のNULLチェックを行い、NULLであれば警告を出力して処理を終了するマクロ
+ *
+ */
+#define CHECK_ARG_NULL_RETURN_VOID(func_name_, arg_name_, ptr_) \
+    if(0 == ptr_) { \
+        WARN_MESSAGE("%s - Argument %s requires a valid pointer.", func_name_, arg_name_); \
+        return; \
+    } \
+
+static core_string_builder_internal_data_t* pfn_builder_prepare(core_string_builder_t* const builder_);
+static core_string_builder_block_t* pfn_builder_next_block(uint64_t min_capacity_, core_string_builder_internal_data_t* const internal_data_);
+static CORE_STRING_ERROR_CODE pfn_builder_append(const char* const src_, uint64_t length_, core_string_builder_internal_data_t* const internal_data_);
+
+void core_string_builder_default_create(core_string_builder_t* const builder_) {
+    CHECK_ARG_NULL_RETURN_VOID("core_string_builder_default_create", "builder_", builder_);
+    builder_->internal_data = 0;
+}
+
+CORE_STRING_ERROR_CODE core_string_builder_create(uint64_t block_size_, core_string_builder_t* const builder_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_builder_create", "builder_", builder_);
+    core_string_builder_destroy(builder_);
+
+    core_string_builder_internal_data_t* internal_data = core_malloc_tagged(sizeof(core_string_builder_internal_data_t), MEMORY_TAG_STRING);
+    if(0 == internal_data) {
+        ERROR_MESSAGE("core_string_builder_create - Failed to allocate internal_data memory.");
+        return CORE_STRING_MEMORY_ALLOCATE_ERROR;
+    }
+    core_zero_memory(internal_data, sizeof(core_string_builder_internal_data_t));
+    internal_data->block_size = (0 == block_size_) ? CORE_STRING_BUILDER_DEFAULT_BLOCK_SIZE : block_size_;
+    builder_->internal_data = internal_data;
+    return CORE_STRING_SUCCESS;
+}
+
+void core_string_builder_destroy(core_string_builder_t* const builder_) {
+    CHECK_ARG_NULL_RETURN_VOID("core_string_builder_destroy", "builder_", builder_);
+    if(0 == builder_->internal_data) {
+        return;
+    }
+    core_string_builder_internal_data_t* internal_data = (core_string_builder_internal_data_t*)(builder_->internal_data);
+    core_string_builder_block_t* block = internal_data->head;
+    while(0 != block) {
+        core_string_builder_block_t* next = block->next;
+        core_free_tagged(block, sizeof(core_string_builder_block_t) + block->capacity, MEMORY_TAG_STRING);
+        block = next;
+    }
+    core_free_tagged(internal_data, sizeof(core_string_builder_internal_data_t), MEMORY_TAG_STRING);
+    builder_->internal_data = 0;
+}
+
+void core_string_builder_reset(core_string_builder_t* const builder_) {
+    CHECK_ARG_NULL_RETURN_VOID("core_string_builder_reset", "builder_", builder_);
+    if(0 == builder_->internal_data) {
+        return;
+    }
+    // 使用済みブロックはtailまでのため、tail以降は確認しない(tailより後ろのブロックは再利用時に空にする)
+    core_string_builder_internal_data_t* internal_data = (core_string_builder_internal_data_t*)(builder_->internal_data);
+    for(core_string_builder_block_t* block = internal_data->head; 0 != block; block = block->next) {
+        block->used = 0;
+        if(block == internal_data->tail) {
+            break;
+        }
+    }
+    internal_data->tail = internal_data->head;
+    internal_data->length = 0;
+}
+
+uint64_t core_string_builder_length(const core_string_builder_t* const builder_) {
+    if(0 == builder_) {
+        WARN_MESSAGE("core_string_builder_length - Argument builder_ requires a valid pointer.");
+        return INVALID_VALUE_U64;
+    }
+    if(0 == builder_->internal_data) {
+        return 0;
+    }
+    return ((const core_string_builder_internal_data_t*)(builder_->internal_data))->length;
+}
+
+CORE_STRING_ERROR_CODE core_string_builder_append(const core_string_t* const string_, core_string_builder_t* const builder_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_builder_append", "string_", string_);
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_builder_append", "builder_", builder_);
+    core_string_builder_internal_data_t* internal_data = pfn_builder_prepare(builder_);
+    if(0 == internal_data) {
+        ERROR_MESSAGE("core_string_builder_append - Failed to create builder.");
+        return CORE_STRING_MEMORY_ALLOCATE_ERROR;
+    }
+    if(core_string_is_empty(string_)) {
+        return CORE_STRING_SUCCESS;
+    }
+    const CORE_STRING_ERROR_CODE ret_append = pfn_builder_append(core_string_cstr(string_), core_string_length(string_), internal_data);
+    if(CORE_STRING_SUCCESS != ret_append) {
+        ERROR_MESSAGE("core_string_builder_append - Failed to allocate block memory.");
+    }
+    return ret_append;
+}
+
+CORE_STRING_ERROR_CODE core_string_builder_append_from_char(const char* const src_, core_string_builder_t* const builder_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_builder_append_from_char", "src_", src_);
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_builder_append_from_char", "builder_", builder_);
+    core_string_builder_internal_data_t* internal_data = pfn_builder_prepare(builder_);
+    if(0 == internal_data) {
+        ERROR_MESSAGE("core_string_builder_append_from_char - Failed to create builder.");
+        return CORE_STRING_MEMORY_ALLOCATE_ERROR;
+    }
+    const CORE_STRING_ERROR_CODE ret_append = pfn_builder_append(src_, core_string_kernel_length(src_), internal_data);
+    if(CORE_STRING_SUCCESS != ret_append) {
+        ERROR_MESSAGE("core_string_builder_append_from_char - Failed to allocate block memory.");
+    }
+    return ret_append;
+}
+
+CORE_STRING_ERROR_CODE core_string_builder_append_format(core_string_builder_t* const builder_, const char* const format_, ...) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_builder_append_format", "builder_", builder_);
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_builder_append_format", "format_", format_);
+    core_string_builder_internal_data_t* internal_data = pfn_builder_prepare(builder_);
+    if(0 == internal_data) {
+        ERROR_MESSAGE("core_string_builder_append_format - Failed to create builder.");
+        return CORE_STRING_MEMORY_ALLOCATE_ERROR;
+    }
+
+    core_string_builder_block_t* block = internal_data->tail;
+    const uint64_t free_size = (0 != block) ? (block->capacity - block->used) : 0;
+    va_list args;
+    va_list args_retry;
+    va_start(args, format_);
+    va_copy(args_retry, args);
+
+    // まず現在のブロックの空き領域に直接書き込み、終端文字まで収まらなかった場合のみ新しいブロックに書き直す
+    const int written = (0 != free_size) ? vsnprintf(block->data + block->used, (size_t)free_size, format_, args) : vsnprintf(0, 0, format_, args);
+    va_end(args);
+    if(written < 0) {
+        va_end(args_retry);
+        ERROR_MESSAGE("core_string_builder_append_format - Failed to format string.");
+        return CORE_STRING_RUNTIME_ERROR;
+    }
+    if(0 != written && (uint64_t)written >= free_size) {
+        block = pfn_builder_next_block((uint64_t)written + 1, internal_data);
+        if(0 == block) {
+            va_end(args_retry);
+            ERROR_MESSAGE("core_string_builder_append_format - Failed to allocate block memory.");
+            return CORE_STRING_MEMORY_ALLOCATE_ERROR;
+        }
+        vsnprintf(block->data + block->used, (size_t)written + 1, format_, args_retry);
+    }
+    va_end(args_retry);
+    if(0 != written) {
+        block->used += (uint64_t)written;
+        internal_data->length += (uint64_t)written;
+    }
+    return CORE_STRING_SUCCESS;
+}
+
+CORE_STRING_ERROR_CODE core_string_builder_finalize(core_string_builder_t* const builder_, core_string_t* const dst_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_builder_finalize", "builder_", builder_);
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_builder_finalize", "dst_", dst_);
+
+    const uint64_t length = core_string_builder_length(builder_);
+    if(core_string_buffer_capacity(dst_) < length + 1) {
+        // 既存の内容は不要のため、resizeではなくreserveで確保し直す(コピーが発生しない)
+        const CORE_STRING_ERROR_CODE ret_reserve = core_string_buffer_reserve(length + 1, dst_);
+        if(CORE_STRING_SUCCESS != ret_reserve) {
+            ERROR_MESSAGE("core_string_builder_finalize - Failed to reserve destination buffer.");
+            return ret_reserve;
+        }
+    }
+    core_string_copy_from_char("", dst_);
+    if(0 == builder_->internal_data) {
+        return CORE_STRING_SUCCESS;
+    }
+
+    // 容量は確保済みのため、以降の追記で再確保は発生しない
+    core_string_builder_internal_data_t* internal_data = (core_string_builder_internal_data_t*)(builder_->internal_data);
+    for(core_string_builder_block_t* block = internal_data->head; 0 != block; block = block->next) {
+        core_string_append_from_buffer(block->data, block->used, dst_);
+        if(block == internal_data->tail) {
+            break;
+        }
+    }
+    core_string_builder_reset(builder_);
+    return CORE_STRING_SUCCESS;
+}
+
+CORE_STRING_ERROR_CODE core_string_builder_write(const core_string_builder_t* const builder_, int fd_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_builder_write", "builder_", builder_);
+    if(fd_ < 0) {
+        ERROR_MESSAGE("core_string_builder_write - Argument fd_ must be a valid file descriptor.");
+        return CORE_STRING_INVALID_ARGUMENT;
+    }
+    if(0 == builder_->internal_data) {
+        return CORE_STRING_SUCCESS;
+    }
+
+    const core_string_builder_internal_data_t* internal_data = (const core_string_builder_internal_data_t*)(builder_->internal_data);
+    const core_string_builder_block_t* block = internal_data->head;
+    const core_string_builder_block_t* const end = (0 != internal_data->tail) ? internal_data->tail->next : 0;
+    struct iovec iov[CORE_STRING_BUILDER_IOV_BATCH];
+    while(block != end) {
+        // 空でないブロックをCORE_STRING_BUILDER_IOV_BATCH個までまとめる
+        int iov_count = 0;
+        for(; block != end && iov_count != CORE_STRING_BUILDER_IOV_BATCH; block = block->next) {
+            if(0 != block->used) {
+                iov[iov_count].iov_base = (void*)block->data;
+                iov[iov_count].iov_len = (size_t)block->used;
+                iov_count++;
+            }
+        }
+
+        // 書き込まれなかった残りを書き込む
+        struct iovec* current = iov;
+        while(0 != iov_count) {
+            const ssize_t written = writev(fd_, current, iov_count);
+            if(written < 0) {
+                if(EINTR == errno) {
+                    continue;
+                }
+                ERROR_MESSAGE("core_string_builder_write - Failed to write to file descriptor %d.", fd_);
+                return CORE_STRING_RUNTIME_ERROR;
+            }
+            size_t remain = (size_t)written;
+            while(0 != iov_count && remain >= current->iov_len) {
+                remain -= current->iov_len;
+                current++;
+                iov_count--;
+            }
+            if(0 != iov_count) {
+                current->iov_base = (char*)current->iov_base + remain;
+                current->iov_len -= remain;
+            }
+        }
+    }
+    return CORE_STRING_SUCCESS;
+}
+
+// builder_の内部データを取得する(デフォルト状態の場合は標準のブロックサイズで生成する)
+static core_string_builder_internal_data_t* pfn_builder_prepare(core_string_builder_t* const builder_) {
+    if(0 == builder_->internal_data && CORE_STRING_SUCCESS != core_string_builder_create(0, builder_)) {
+        return 0;
+    }
+    return (core_string_builder_internal_data_t*)(builder_->internal_data);
+}
+
+// 容量min_capacity_以上の空のブロックをtailの次に用意してtailとする(容量が足りる空きブロックがあれば再利用する)
+static core_string_builder_block_t* pfn_builder_next_block(uint64_t min_capacity_, core_string_builder_internal_data_t* const internal_data_) {
+    core_string_builder_block_t* tail = internal_data_->tail;
+    core_string_builder_block_t* next = (0 != tail) ? tail->next : internal_data_->head;
+    if(0 != next && next->capacity >= min_capacity_) {
+        next->used = 0;
+        internal_data_->tail = next;
+        return next;
+    }
+
+    const uint64_t capacity = (internal_data_->block_size > min_capacity_) ? internal_data_->block_size : min_capacity_;
+    core_string_builder_block_t* block = core_malloc_tagged(sizeof(core_string_builder_block_t) + capacity, MEMORY_TAG_STRING);
+    if(0 == block) {
+        return 0;
+    }
+    block->next = next;
+    block->capacity = capacity;
+    block->used = 0;
+    if(0 != tail) {
+        tail->next = block;
+    } else {
+        internal_data_->head = block;
+    }
+    internal_data_->tail = block;
+    return block;
+}
+
+// src_の先頭length_文字を追記する(現在のブロックに収まらない分は新しいブロックに格納する。ブロックの確保に失敗した場合は何も追記しない)
+static CORE_STRING_ERROR_CODE pfn_builder_append(const char* const src_, uint64_t length_, core_string_builder_internal_data_t* const internal_data_) {
+    if(0 == length_) {
+        return CORE_STRING_SUCCESS;
+    }
+    core_string_builder_block_t* block = internal_data_->tail;
+    const uint64_t free_size = (0 != block) ? (block->capacity - block->used) : 0;
+    const uint64_t head_length = (length_ < free_size) ? length_ : free_size;
+    if(head_length < length_) {
+        core_string_builder_block_t* new_block = pfn_builder_next_block(length_ - head_length, internal_data_);
+        if(0 == new_block) {
+            return CORE_STRING_MEMORY_ALLOCATE_ERROR;
+        }
+        if(0 != head_length) {
+            core_copy_memory(src_, block->data + block->used, head_length);
+            block->used += head_length;
+        }
+        core_copy_memory(src_ + head_length, new_block->data, length_ - head_length);
+        new_block->used = length_ - head_length;
+    } else {
+        core_copy_memory(src_, block->data + block->used, length_);
+        block->used += length_;
+    }
+    internal_data_->length += length_;
+    return CORE_STRING_SUCCESS;
+}
@@ -0,0 +1,383 @@
+/**
+ * @file core_string_kernel.c
+ * @author chocolate-pie24
+ * @brief 文字列の長さ計算、比較、検索のベクトル命令版実装
+ *
+ * @details
+ * core_memory.cのメモリ操作と同様に、命令セットごとの関数テーブルを用意し、初回使用時に実行環境に合わせて選択する。
+ * - x86_64: SSE2(コンパイル時に常に有効)、AVX2(実行時に判定)
+ * - ARM: NEON
+ * - その他: 8byte単位のSWAR
+ *
+ * 各命令セットは「1byteごとの一致判定(cmpeq)」と「一致判定結果のビットマスク化(mask)」で表現し、
+ * マスク中の1byteあたりのビット数の違い(SSE2 / AVX2: 1bit、NEON: 4bit、SWAR: 8bit)はshiftで吸収する。
+ *
+ * @version 0.1
+ * @date 2025-07-20
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "internal/core_string_kernel.h"
+
+#include "core/core_string.h"
+
+#include "define.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <immintrin.h>
+#elif defined(__ARM_NEON)
+    #include <arm_neon.h>
+#endif
+
+#if defined(__SSE2__)
+    #define STRING_KERNEL_SSE2 1
+#elif defined(__ARM_NEON)
+    #define STRING_KERNEL_NEON 1
+#else
+    #define STRING_KERNEL_WORD 1
+#endif
+
+// AVX2はコンパイル時には有効にせず、target属性でAVX2版のみをコンパイルして実行時に切り替える
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    #define STRING_KERNEL_AVX2 1
+#endif
+
+/**
+ * @brief 文字列長の計算は終端文字より後ろ(同一ブロック内)を読むため、AddressSanitizerの検査対象から外す
+ *
+ */
+#if defined(__SANITIZE_ADDRESS__)
+    #define STRING_KERNEL_NO_SANITIZE __attribute__((no_sanitize_address))
+#elif defined(__has_feature)
+    #if __has_feature(address_sanitizer)
+        #define STRING_KERNEL_NO_SANITIZE __attribute__((no_sanitize_address))
+    #endif
+#endif
+#ifndef STRING_KERNEL_NO_SANITIZE
+    #define STRING_KERNEL_NO_SANITIZE
+#endif
+
+/**
+ * @brief 非アライメントアクセス用の8byte型(strict aliasing違反を避けるためmay_aliasを付与する)
+ *
+ */
+typedef uint64_t __attribute__((__may_alias__, __aligned__(1))) unaligned_u64_t;
+
+/**
+ * @brief 非アライメントアクセス用の4byte型
+ *
+ */
+typedef uint32_t __attribute__((__may_alias__, __aligned__(1))) unaligned_u32_t;
+
+/**
+ * @brief アライメントされたアドレスへのアクセス用の8byte型
+ *
+ */
+typedef uint64_t __attribute__((__may_alias__)) aliased_u64_t;
+
+typedef uint64_t (*pfn_string_length_t)(const char* str_);
+typedef const char* (*pfn_string_find_char_t)(const char* str_, uint64_t size_, char c_);
+typedef bool (*pfn_string_equal_t)(const char* str1_, const char* str2_, uint64_t size_);
+typedef uint64_t (*pfn_string_find_t)(const char* str_, uint64_t size_, const char* needle_, uint64_t needle_size_);
+typedef const char* (*pfn_string_find_any_t)(const char* str_, uint64_t size_, const char* set_);
+
+/**
+ * @brief 命令セットごとの文字列操作関数テーブル
+ *
+ */
+typedef struct string_kernel_table_t {
+    const char* name;                   /**< 命令セット名 */
+    uint64_t width;                     /**< 1命令で処理するサイズ(byte) */
+    pfn_string_length_t length;         /**< 文字列長 */
+    pfn_string_find_char_t find_char;   /**< 1文字検索 */
+    pfn_string_equal_t equal;           /**< 一致判定 */
+    pfn_string_find_t find;             /**< 部分文字列検索(needle_size_は2以上、size_以下) */
+    pfn_string_find_any_t find_any;     /**< 文字集合検索(set_は CORE_STRING_KERNEL_FIND_ANY_MAX 文字) */
+} string_kernel_table_t;
+
+static bool equal_small(const char* str1_, const char* str2_, uint64_t size_);
+static const string_kernel_table_t* string_kernels_get(uint64_t size_);
+
+/**
+ * @brief 命令セットごとの文字列長/1文字検索/一致判定/部分文字列検索関数を生成する
+ *
+ * @note cmpeq_は1byteごとの一致判定、mask_はその結果を一致したbyteのビットが立った整数に変換する。
+ *       mask_の結果はbyte i のビットが(i << shift_)以上((i + 1) << shift_)未満の位置にあり、byteごとに高々1bitが立つ。
+ * @note 文字列長以外は非アライメントのロードで指定範囲内のみを読む。端数は末尾width_バイトを重ねて処理する(width_未満の範囲は1byteずつ処理する)。
+ */
+#define DEFINE_STRING_KERNELS(suffix_, attr_, vec_t_, width_, shift_, load_, loadu_, set1_, cmpeq_, and_, or_, mask_, full_) \
+    attr_ STRING_KERNEL_NO_SANITIZE static uint64_t length_##suffix_(const char* str_) { \
+        const uintptr_t misalign = (uintptr_t)str_ & ((width_) - 1); \
+        const char* block = str_ - misalign; \
+        const vec_t_ zero = set1_(0); \
+        uint64_t mask = mask_(cmpeq_(load_(block), zero)) >> (misalign << (shift_)); \
+        if(0 != mask) { \
+            return (uint64_t)__builtin_ctzll(mask) >> (shift_); \
+        } \
+        /* 4ブロック単位の境界までは1ブロックずつ進める(4ブロックをまとめて読んでもページ境界を跨がないようにする) */ \
+        for(block += (width_); 0 != ((uintptr_t)block & (4 * (width_) - 1)); block += (width_)) { \
+            mask = mask_(cmpeq_(load_(block), zero)); \
+            if(0 != mask) { \
+                return (uint64_t)(block - str_) + ((uint64_t)__builtin_ctzll(mask) >> (shift_)); \
+            } \
+        } \
+        for(;; block += 4 * (width_)) { \
+            const vec_t_ e0 = cmpeq_(load_(block), zero); \
+            const vec_t_ e1 = cmpeq_(load_(block + (width_)), zero); \
+            const vec_t_ e2 = cmpeq_(load_(block + 2 * (width_)), zero); \
+            const vec_t_ e3 = cmpeq_(load_(block + 3 * (width_)), zero); \
+            if(0 != mask_(or_(or_(e0, e1), or_(e2, e3)))) { \
+                break; \
+            } \
+        } \
+        for(;; block += (width_)) { \
+            mask = mask_(cmpeq_(load_(block), zero)); \
+            if(0 != mask) { \
+                return (uint64_t)(block - str_) + ((uint64_t)__builtin_ctzll(mask) >> (shift_)); \
+            } \
+        } \
+    } \
+    attr_ static const char* find_char_##suffix_(const char* str_, uint64_t size_, char c_) { \
+        if(size_ < (width_)) { \
+            for(uint64_t i = 0; i != size_; ++i) { \
+                if(c_ == str_[i]) { \
+                    return str_ + i; \
+                } \
+            } \
+            return 0; \
+        } \
+        const vec_t_ needle = set1_(c_); \
+        uint64_t offset = 0; \
+        for(; (size_ - offset) >= 4 * (width_); offset += 4 * (width_)) { \
+            const vec_t_ e0 = cmpeq_(loadu_(str_ + offset), needle); \
+            const vec_t_ e1 = cmpeq_(loadu_(str_ + offset + (width_)), needle); \
+            const vec_t_ e2 = cmpeq_(loadu_(str_ + offset + 2 * (width_)), needle); \
+            const vec_t_ e3 = cmpeq_(loadu_(str_ + offset + 3 * (width_)), needle); \
+            if(0 != mask_(or_(or_(e0, e1), or_(e2, e3)))) { \
+                break; \
+            } \
+        } \
+        for(; (size_ - offset) >= (width_); offset += (width_)) { \
+            const uint64_t mask = mask_(cmpeq_(loadu_(str_ + offset), needle)); \
+            if(0 != mask) { \
+                return str_ + offset + ((uint64_t)__builtin_ctzll(mask) >> (shift_)); \
+            } \
+        } \
+        if(offset != size_) { \
+            const uint64_t mask = mask_(cmpeq_(loadu_(str_ + size_ - (width_)), needle)); \
+            if(0 != mask) { \
+                return str_ + size_ - (width_) + ((uint64_t)__builtin_ctzll(mask) >> (shift_)); \
+            } \
+        } \
+        return 0; \
+    } \
+    attr_ static bool equal_##suffix_(const char* str1_, const char* str2_, uint64_t size_) { \
+        if(size_ < (width_)) { \
+            return equal_small(str1_, str2_, size_); \
+        } \
+        uint64_t offset = 0; \
+        for(; (size_ - offset) >= 4 * (width_); offset += 4 * (width_)) { \
+            const vec_t_ e0 = cmpeq_(loadu_(str1_ + offset), loadu_(str2_ + offset)); \
+            const vec_t_ e1 = cmpeq_(loadu_(str1_ + offset + (width_)), loadu_(str2_ + offset + (width_))); \
+            const vec_t_ e2 = cmpeq_(loadu_(str1_ + offset + 2 * (width_)), loadu_(str2_ + offset + 2 * (width_))); \
+            const vec_t_ e3 = cmpeq_(loadu_(str1_ + offset + 3 * (width_)), loadu_(str2_ + offset + 3 * (width_))); \
+            if((full_) != mask_(and_(and_(e0, e1), and_(e2, e3)))) { \
+                return false; \
+            } \
+        } \
+        for(; (size_ - offset) >= (width_); offset += (width_)) { \
+            if((full_) != mask_(cmpeq_(loadu_(str1_ + offset), loadu_(str2_ + offset)))) { \
+                return false; \
+            } \
+        } \
+        if(offset != size_) { \
+            return (full_) == mask_(cmpeq_(loadu_(str1_ + size_ - (width_)), loadu_(str2_ + size_ - (width_)))); \
+        } \
+        return true; \
+    } \
+    attr_ static uint64_t find_##suffix_(const char* str_, uint64_t size_, const char* needle_, uint64_t needle_size_) { \
+        const vec_t_ first = set1_(needle_[0]); \
+        const vec_t_ last = set1_(needle_[needle_size_ - 1]); \
+        const uint64_t positions = size_ - needle_size_ + 1; \
+        uint64_t offset = 0; \
+        for(; (positions - offset) >= (width_); offset += (width_)) { \
+            const vec_t_ e_first = cmpeq_(loadu_(str_ + offset), first); \
+            const vec_t_ e_last = cmpeq_(loadu_(str_ + offset + needle_size_ - 1), last); \
+            uint64_t mask = mask_(and_(e_first, e_last)); \
+            while(0 != mask) { \
+                const uint64_t position = offset + ((uint64_t)__builtin_ctzll(mask) >> (shift_)); \
+                if(equal_##suffix_(str_ + position + 1, needle_ + 1, needle_size_ - 2)) { \
+                    return position; \
+                } \
+                mask &= mask - 1; \
+            } \
+        } \
+        for(; offset != positions; ++offset) { \
+            if(needle_[0] == str_[offset] && needle_[needle_size_ - 1] == str_[offset + needle_size_ - 1] && \
+               equal_##suffix_(str_ + offset + 1, needle_ + 1, needle_size_ - 2)) { \
+                return offset; \
+            } \
+        } \
+        return INVALID_VALUE_U64; \
+    } \
+    attr_ static const char* find_any_##suffix_(const char* str_, uint64_t size_, const char* set_) { \
+        if(size_ < (width_)) { \
+            for(uint64_t i = 0; i != size_; ++i) { \
+                if(set_[0] == str_[i] || set_[1] == str_[i] || set_[2] == str_[i] || set_[3] == str_[i]) { \
+                    return str_ + i; \
+                } \
+            } \
+            return 0; \
+        } \
+        const vec_t_ c0 = set1_(set_[0]); \
+        const vec_t_ c1 = set1_(set_[1]); \
+        const vec_t_ c2 = set1_(set_[2]); \
+        const vec_t_ c3 = set1_(set_[3]); \
+        uint64_t offset = 0; \
+        for(;; offset += (width_)) { \
+            /* 末尾の端数は、末尾width_バイトを読み直す(重なった部分に一致がないことは確認済み) */ \
+            if((size_ - offset) < (width_)) { \
+                if(offset == size_) { \
+                    return 0; \
+                } \
+                offset = size_ - (width_); \
+            } \
+            const vec_t_ v = loadu_(str_ + offset); \
+            const uint64_t mask = mask_(or_(or_(cmpeq_(v, c0), cmpeq_(v, c1)), or_(cmpeq_(v, c2), cmpeq_(v, c3)))); \
+            if(0 != mask) { \
+                return str_ + offset + ((uint64_t)__builtin_ctzll(mask) >> (shift_)); \
+            } \
+            if(offset == size_ - (width_)) { \
+                return 0; \
+            } \
+        } \
+    } \
+
+#if STRING_KERNEL_WORD
+// 1byteごとに、a_とb_が一致すれば0x80、一致しなければ0となる値を返す(桁上がりが隣のbyteに伝播しない方式)
+#define WORD_LOW7 0x7F7F7F7F7F7F7F7Full
+#define WORD_CMPEQ(a_, b_) (~(((((a_) ^ (b_)) & WORD_LOW7) + WORD_LOW7) | ((a_) ^ (b_)) | WORD_LOW7))
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define WORD_LOAD(ptr_) __builtin_bswap64(*(const aliased_u64_t*)(ptr_))
+#define WORD_LOADU(ptr_) __builtin_bswap64(*(const unaligned_u64_t*)(ptr_))
+#else
+#define WORD_LOAD(ptr_) (*(const aliased_u64_t*)(ptr_))
+#define WORD_LOADU(ptr_) (*(const unaligned_u64_t*)(ptr_))
+#endif
+#define WORD_SET1(c_) (0x0101010101010101ull * (uint8_t)(c_))
+#define WORD_AND(a_, b_) ((a_) & (b_))
+#define WORD_OR(a_, b_) ((a_) | (b_))
+#define WORD_MASK(v_) (v_)
+DEFINE_STRING_KERNELS(word, , uint64_t, 8, 3, WORD_LOAD, WORD_LOADU, WORD_SET1, WORD_CMPEQ, WORD_AND, WORD_OR, WORD_MASK, 0x8080808080808080ull)
+static const string_kernel_table_t s_baseline_kernels = { "word", 8, length_word, find_char_word, equal_word, find_word, find_any_word };
+#endif
+
+#if STRING_KERNEL_SSE2
+#define SSE2_LOAD(ptr_) _mm_load_si128((const __m128i*)(ptr_))
+#define SSE2_LOADU(ptr_) _mm_loadu_si128((const __m128i*)(ptr_))
+#define SSE2_MASK(v_) ((uint64_t)(uint32_t)_mm_movemask_epi8(v_))
+DEFINE_STRING_KERNELS(sse2, , __m128i, 16, 0, SSE2_LOAD, SSE2_LOADU, _mm_set1_epi8, _mm_cmpeq_epi8, _mm_and_si128, _mm_or_si128, SSE2_MASK, 0xFFFFull)
+static const string_kernel_table_t s_baseline_kernels = { "sse2", 16, length_sse2, find_char_sse2, equal_sse2, find_sse2, find_any_sse2 };
+#endif
+
+#if STRING_KERNEL_NEON
+#define NEON_LOAD(ptr_) vld1q_u8((const uint8_t*)(ptr_))
+#define NEON_SET1(c_) vdupq_n_u8((uint8_t)(c_))
+// 比較結果の各byteを4bitに縮めて64bitに詰め、byteごとに最上位の1bitのみを残す
+#define NEON_MASK(v_) (vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(v_), 4)), 0) & 0x8888888888888888ull)
+DEFINE_STRING_KERNELS(neon, , uint8x16_t, 16, 2, NEON_LOAD, NEON_LOAD, NEON_SET1, vceqq_u8, vandq_u8, vorrq_u8, NEON_MASK, 0x8888888888888888ull)
+static const string_kernel_table_t s_baseline_kernels = { "neon", 16, length_neon, find_char_neon, equal_neon, find_neon, find_any_neon };
+#endif
+
+#if STRING_KERNEL_AVX2
+#define AVX2_LOAD(ptr_) _mm256_load_si256((const __m256i*)(ptr_))
+#define AVX2_LOADU(ptr_) _mm256_loadu_si256((const __m256i*)(ptr_))
+#define AVX2_MASK(v_) ((uint64_t)(uint32_t)_mm256_movemask_epi8(v_))
+DEFINE_STRING_KERNELS(avx2, __attribute__((target("avx2"))), __m256i, 32, 0, AVX2_LOAD, AVX2_LOADU, _mm256_set1_epi8, _mm256_cmpeq_epi8, _mm256_and_si256, _mm256_or_si256, AVX2_MASK, 0xFFFFFFFFull)
+static const string_kernel_table_t s_avx2_kernels = { "avx2", 32, length_avx2, find_char_avx2, equal_avx2, find_avx2, find_any_avx2 };
+#endif
+
+/**
+ * @brief 実行環境で使用する文字列操作関数テーブル(初回使用時に決定する)
+ *
+ */
+static _Atomic(const string_kernel_table_t*) s_string_kernels = 0;
+
+uint64_t core_string_kernel_length(const char* str_) {
+    return string_kernels_get(UINT64_MAX)->length(str_);
+}
+
+const char* core_string_kernel_find_char(const char* str_, uint64_t size_, char c_) {
+    return string_kernels_get(size_)->find_char(str_, size_, c_);
+}
+
+bool core_string_kernel_equal(const char* str1_, const char* str2_, uint64_t size_) {
+    return string_kernels_get(size_)->equal(str1_, str2_, size_);
+}
+
+uint64_t core_string_kernel_find(const char* str_, uint64_t size_, const char* needle_, uint64_t needle_size_) {
+    if(0 == needle_size_) {
+        return 0;
+    }
+    if(needle_size_ > size_) {
+        return INVALID_VALUE_U64;
+    }
+    if(1 == needle_size_) {
+        const char* found = core_string_kernel_find_char(str_, size_, needle_[0]);
+        return (0 != found) ? (uint64_t)(found - str_) : INVALID_VALUE_U64;
+    }
+    return string_kernels_get(size_ - needle_size_ + 1)->find(str_, size_, needle_, needle_size_);
+}
+
+const char* core_string_kernel_find_any(const char* str_, uint64_t size_, const char* set_) {
+    return string_kernels_get(size_)->find_any(str_, size_, set_);
+}
+
+const char* core_string_kernel_name(void) {
+    return string_kernels_get(UINT64_MAX)->name;
+}
+
+// 命令幅未満の一致判定(8byte / 4byteのロードを先頭と末尾で重ねて比較する)
+static bool equal_small(const char* str1_, const char* str2_, uint64_t size_) {
+    if(size_ >= 8) {
+        for(uint64_t offset = 0; (size_ - offset) > 8; offset += 8) {
+            if(*(const unaligned_u64_t*)(str1_ + offset) != *(const unaligned_u64_t*)(str2_ + offset)) {
+                return false;
+            }
+        }
+        return *(const unaligned_u64_t*)(str1_ + size_ - 8) == *(const unaligned_u64_t*)(str2_ + size_ - 8);
+    }
+    if(size_ >= 4) {
+        return *(const unaligned_u32_t*)str1_ == *(const unaligned_u32_t*)str2_ &&
+               *(const unaligned_u32_t*)(str1_ + size_ - 4) == *(const unaligned_u32_t*)(str2_ + size_ - 4);
+    }
+    for(uint64_t i = 0; i != size_; ++i) {
+        if(str1_[i] != str2_[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// size_バイトの処理に使用する文字列操作関数テーブルを取得する(初回呼び出し時に実行環境の命令セットを判定する)
+static const string_kernel_table_t* string_kernels_get(uint64_t size_) {
+    const string_kernel_table_t* kernels = atomic_load_explicit(&s_string_kernels, memory_order_relaxed);
+    if(0 == kernels) {
+        // 複数スレッドで同時に判定しても結果は同じなので、排他は不要
+        kernels = &s_baseline_kernels;
+#if STRING_KERNEL_AVX2
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx2")) {
+            kernels = &s_avx2_kernels;
+        }
+#endif
+        atomic_store_explicit(&s_string_kernels, kernels, memory_order_relaxed);
+    }
+    // 幅の広い命令セットで扱えないサイズはベースラインで処理する
+    return (size_ < kernels->width) ? &s_baseline_kernels : kernels;
+}
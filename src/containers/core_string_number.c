@@ -0,0 +1,996 @@
+/**
+ * @file core_string_number.c
+ * @author chocolate-pie24
+ * @brief 文字列と整数、浮動小数点数の相互変換APIの実装ファイル
+ *
+ * @details
+ * 整数は、8桁単位の数字列を64bit整数1つとして読み込み、乗算3回で値に変換する(SWAR)。端数の桁は1桁ずつ処理する。
+ *
+ * 浮動小数点数は、まず仮数(有効数字19桁まで)と10進指数を整数として読み取る。
+ * 仮数が浮動小数点数の仮数部に収まり、10のべき乗が正確に表現できる範囲であれば、1回の乗算または除算で正しく丸めた値が得られる。
+ * それ以外の入力は、小数点を含まない"数字列e指数"の形に書き直してstrtod / strtofで変換する。
+ * 小数点を含まないため、strtodのロケール依存(小数点文字)の影響を受けない。
+ *
+ * 数値から文字列への変換では、整数は2桁ずつの対応表で下位桁から書き込む。
+ * 浮動小数点数はGrisu2(F. Loitsch, "Printing Floating-Point Numbers Quickly and Accurately with Integers")で、
+ * 読み戻すと元の値に戻る最短(ごく一部の値では最短より長くなる)の10進数字列を求める。
+ *
+ * @version 0.1
+ * @date 2025-07-20
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#define MESSAGE_MODULE_NAME CORE_STRING // メッセージ出力元モジュール(message.hより前に定義する)
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h> // for strtod, strtof
+#include <string.h> // for memcpy
+#include <float.h>  // for FLT_EVAL_METHOD
+#include <math.h>   // for INFINITY, NAN, isinf
+
+#include "core/core_string_number.h"
+#include "core/core_string.h"
+#include "core/core_memory.h"
+#include "core/message.h"
+
+#include "define.h"
+
+#if ENABLE_ARGUMENT_CHECK
+/**
+ * @brief 引数のNULLチェックを行い、NULLであればCORE_STRING_INVALID_ARGUMENTで処理を終了するマクロ
+ *
+ */
+#define CHECK_ARG_NULL_RETURN_ERROR(func_name_, arg_name_, ptr_) \
+    if(0 == ptr_) { \
+        ERROR_MESSAGE("%s - Argument %s requires a valid pointer.", func_name_, arg_name_); \
+        return CORE_STRING_INVALID_ARGUMENT; \
+    } \
+
+#else
+#define CHECK_ARG_NULL_RETURN_ERROR(func_name_, arg_name_, ptr_) DEBUG_ASSERT(0 != (ptr_));
+#endif
+
+/**
+ * @brief 浮動小数点数の仮数に取り込む最大桁数(10^19 < 2^64)
+ *
+ */
+#define NUMBER_MAX_MANTISSA_DIGITS 19
+
+/**
+ * @brief 10進整数の変換で8桁単位の処理を行う値の上限(value * 10^8 + 99999999がuint64_tに収まる範囲)
+ *
+ */
+#define NUMBER_CHUNK_VALUE_LIMIT 100000000000ull
+
+/**
+ * @brief 指数部の読み取り上限(これを超える桁は値を変えずに読み飛ばす。結果は無限大または0となる)
+ *
+ */
+#define NUMBER_EXPONENT_LIMIT 100000
+
+/**
+ * @brief strtodでの変換に使用するスタック上のバッファサイズ(これを超える場合はヒープから確保する)
+ *
+ */
+#define NUMBER_FALLBACK_BUFFER_SIZE 128
+
+/**
+ * @brief 高速経路で扱うfloat / doubleの仮数の上限(2^24 / 2^53)
+ *
+ */
+#define NUMBER_F32_MANTISSA_LIMIT (1ull << 24)
+#define NUMBER_F64_MANTISSA_LIMIT (1ull << 53)
+
+/**
+ * @brief 浮動小数点演算が型の精度で行われる環境でのみ高速経路を使用する(x87のように拡張精度で演算すると二重丸めが起こるため)
+ *
+ */
+#if defined(FLT_EVAL_METHOD) && (0 == FLT_EVAL_METHOD)
+    #define NUMBER_FLOAT_FAST_PATH 1
+#else
+    #define NUMBER_FLOAT_FAST_PATH 0
+#endif
+
+/**
+ * @brief 浮動小数点数の文字列から読み取った10進表現
+ *
+ * 値は mantissa * 10^exponent (truncatedがfalseの場合は正確な値)
+ */
+typedef struct number_decimal_t {
+    uint64_t mantissa;          /**< 仮数(有効数字 NUMBER_MAX_MANTISSA_DIGITS 桁まで) */
+    int64_t exponent;           /**< 10進指数 */
+    bool truncated;             /**< 仮数に取り込めなかった0以外の桁がある */
+    uint64_t digits_end;        /**< 仮数部(整数部と小数部)の終端位置 */
+    int64_t explicit_exponent;  /**< 指数部(e以降)の値 */
+} number_decimal_t;
+
+static const double s_pow10_f64[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+static const float s_pow10_f32[] = {
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f,
+};
+
+/**
+ * @brief 数値を文字列に変換する際の作業バッファサイズ(符号、仮数17桁、小数点、先頭の"0."と0、指数を含む最長の表現が収まるサイズ)
+ *
+ */
+#define NUMBER_FORMAT_BUFFER_SIZE 32
+
+/**
+ * @brief 仮数fと2進指数eで f * 2^e を表す浮動小数点数(Grisu2の演算用)
+ *
+ */
+typedef struct number_diy_fp_t {
+    uint64_t f; /**< 仮数 */
+    int32_t e;  /**< 2進指数 */
+} number_diy_fp_t;
+
+/**
+ * @brief 10^-348, 10^-340, ..., 10^340を仮数の最上位bitが立つよう正規化した値(仮数は最近接丸め)
+ *
+ */
+static const number_diy_fp_t s_cached_powers[] = {
+    { 0xFA8FD5A0081C0288ULL, -1220 }, { 0xBAAEE17FA23EBF76ULL, -1193 },
+    { 0x8B16FB203055AC76ULL, -1166 }, { 0xCF42894A5DCE35EAULL, -1140 },
+    { 0x9A6BB0AA55653B2DULL, -1113 }, { 0xE61ACF033D1A45DFULL, -1087 },
+    { 0xAB70FE17C79AC6CAULL, -1060 }, { 0xFF77B1FCBEBCDC4FULL, -1034 },
+    { 0xBE5691EF416BD60CULL, -1007 }, { 0x8DD01FAD907FFC3CULL, -980 },
+    { 0xD3515C2831559A83ULL, -954 }, { 0x9D71AC8FADA6C9B5ULL, -927 },
+    { 0xEA9C227723EE8BCBULL, -901 }, { 0xAECC49914078536DULL, -874 },
+    { 0x823C12795DB6CE57ULL, -847 }, { 0xC21094364DFB5637ULL, -821 },
+    { 0x9096EA6F3848984FULL, -794 }, { 0xD77485CB25823AC7ULL, -768 },
+    { 0xA086CFCD97BF97F4ULL, -741 }, { 0xEF340A98172AACE5ULL, -715 },
+    { 0xB23867FB2A35B28EULL, -688 }, { 0x84C8D4DFD2C63F3BULL, -661 },
+    { 0xC5DD44271AD3CDBAULL, -635 }, { 0x936B9FCEBB25C996ULL, -608 },
+    { 0xDBAC6C247D62A584ULL, -582 }, { 0xA3AB66580D5FDAF6ULL, -555 },
+    { 0xF3E2F893DEC3F126ULL, -529 }, { 0xB5B5ADA8AAFF80B8ULL, -502 },
+    { 0x87625F056C7C4A8BULL, -475 }, { 0xC9BCFF6034C13053ULL, -449 },
+    { 0x964E858C91BA2655ULL, -422 }, { 0xDFF9772470297EBDULL, -396 },
+    { 0xA6DFBD9FB8E5B88FULL, -369 }, { 0xF8A95FCF88747D94ULL, -343 },
+    { 0xB94470938FA89BCFULL, -316 }, { 0x8A08F0F8BF0F156BULL, -289 },
+    { 0xCDB02555653131B6ULL, -263 }, { 0x993FE2C6D07B7FACULL, -236 },
+    { 0xE45C10C42A2B3B06ULL, -210 }, { 0xAA242499697392D3ULL, -183 },
+    { 0xFD87B5F28300CA0EULL, -157 }, { 0xBCE5086492111AEBULL, -130 },
+    { 0x8CBCCC096F5088CCULL, -103 }, { 0xD1B71758E219652CULL, -77 },
+    { 0x9C40000000000000ULL, -50 }, { 0xE8D4A51000000000ULL, -24 },
+    { 0xAD78EBC5AC620000ULL, 3 }, { 0x813F3978F8940984ULL, 30 },
+    { 0xC097CE7BC90715B3ULL, 56 }, { 0x8F7E32CE7BEA5C70ULL, 83 },
+    { 0xD5D238A4ABE98068ULL, 109 }, { 0x9F4F2726179A2245ULL, 136 },
+    { 0xED63A231D4C4FB27ULL, 162 }, { 0xB0DE65388CC8ADA8ULL, 189 },
+    { 0x83C7088E1AAB65DBULL, 216 }, { 0xC45D1DF942711D9AULL, 242 },
+    { 0x924D692CA61BE758ULL, 269 }, { 0xDA01EE641A708DEAULL, 295 },
+    { 0xA26DA3999AEF774AULL, 322 }, { 0xF209787BB47D6B85ULL, 348 },
+    { 0xB454E4A179DD1877ULL, 375 }, { 0x865B86925B9BC5C2ULL, 402 },
+    { 0xC83553C5C8965D3DULL, 428 }, { 0x952AB45CFA97A0B3ULL, 455 },
+    { 0xDE469FBD99A05FE3ULL, 481 }, { 0xA59BC234DB398C25ULL, 508 },
+    { 0xF6C69A72A3989F5CULL, 534 }, { 0xB7DCBF5354E9BECEULL, 561 },
+    { 0x88FCF317F22241E2ULL, 588 }, { 0xCC20CE9BD35C78A5ULL, 614 },
+    { 0x98165AF37B2153DFULL, 641 }, { 0xE2A0B5DC971F303AULL, 667 },
+    { 0xA8D9D1535CE3B396ULL, 694 }, { 0xFB9B7CD9A4A7443CULL, 720 },
+    { 0xBB764C4CA7A44410ULL, 747 }, { 0x8BAB8EEFB6409C1AULL, 774 },
+    { 0xD01FEF10A657842CULL, 800 }, { 0x9B10A4E5E9913129ULL, 827 },
+    { 0xE7109BFBA19C0C9DULL, 853 }, { 0xAC2820D9623BF429ULL, 880 },
+    { 0x80444B5E7AA7CF85ULL, 907 }, { 0xBF21E44003ACDD2DULL, 933 },
+    { 0x8E679C2F5E44FF8FULL, 960 }, { 0xD433179D9C8CB841ULL, 986 },
+    { 0x9E19DB92B4E31BA9ULL, 1013 }, { 0xEB96BF6EBADF77D9ULL, 1039 },
+    { 0xAF87023B9BF0EE6BULL, 1066 },
+};
+
+static const uint64_t s_pow10_u64[] = {
+    1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull, 1000000000ull,
+    10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull, 100000000000000ull, 1000000000000000ull,
+    10000000000000000ull, 100000000000000000ull, 1000000000000000000ull, 10000000000000000000ull,
+};
+
+/**
+ * @brief 0〜99の2桁の文字列を連結した対応表
+ *
+ */
+static const char s_digit_pairs[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+static uint64_t pfn_number_load8(const char* const str_);
+static bool pfn_number_is_8digits(uint64_t chunk_);
+static uint32_t pfn_number_parse_8digits(uint64_t chunk_);
+static uint32_t pfn_number_digit(char c_);
+static uint32_t pfn_number_hex_digit(char c_);
+static uint64_t pfn_number_parse_decimal(const char* const str_, uint64_t length_, uint64_t* const out_value_, bool* const out_overflow_);
+static uint64_t pfn_number_parse_hex(const char* const str_, uint64_t length_, uint64_t* const out_value_, bool* const out_overflow_);
+static CORE_STRING_ERROR_CODE pfn_number_parse_integer(const char* const str_, uint64_t length_, bool signed_, uint64_t max_, uint64_t* const out_magnitude_, bool* const out_negative_, uint64_t* const out_consumed_);
+static CORE_STRING_ERROR_CODE pfn_number_check_consumed(CORE_STRING_ERROR_CODE ret_, uint64_t consumed_, uint64_t length_, uint64_t* const out_consumed_);
+static uint64_t pfn_number_scan_decimal(const char* const str_, uint64_t length_, number_decimal_t* const out_decimal_);
+static uint64_t pfn_number_scan_special(const char* const str_, uint64_t length_, double* const out_value_);
+static bool pfn_number_match_word(const char* const str_, uint64_t length_, const char* const word_);
+static bool pfn_number_fast_f64(const number_decimal_t* const decimal_, double* const out_value_);
+static bool pfn_number_fast_f32(const number_decimal_t* const decimal_, float* const out_value_);
+static CORE_STRING_ERROR_CODE pfn_number_convert_fallback(const char* const str_, const number_decimal_t* const decimal_, bool single_, double* const out_double_, float* const out_float_);
+static CORE_STRING_ERROR_CODE pfn_number_parse_float(const char* const str_, uint64_t length_, bool single_, double* const out_double_, float* const out_float_, uint64_t* const out_consumed_);
+static uint64_t pfn_number_write_u64(uint64_t value_, char* const buffer_);
+static number_diy_fp_t pfn_number_diy_normalize(number_diy_fp_t value_);
+static number_diy_fp_t pfn_number_diy_multiply(number_diy_fp_t lhs_, number_diy_fp_t rhs_);
+static number_diy_fp_t pfn_number_cached_power(int32_t e_, int32_t* const out_k_);
+static void pfn_number_grisu_round(char* const digits_, uint64_t length_, uint64_t delta_, uint64_t rest_, uint64_t ten_kappa_, uint64_t wp_w_);
+static uint64_t pfn_number_digit_gen(number_diy_fp_t w_, number_diy_fp_t mp_, uint64_t delta_, char* const digits_, int32_t* const k_);
+static uint64_t pfn_number_grisu2(uint64_t significand_, int32_t exponent_, bool lower_boundary_closer_, char* const digits_, int32_t* const out_k_);
+static uint64_t pfn_number_write_decimal(const char* const digits_, uint64_t length_, int32_t k_, char* const buffer_);
+static uint64_t pfn_number_write_float(uint64_t significand_, int32_t biased_exponent_, uint32_t significand_bits_, int32_t exponent_bias_, bool negative_, char* const buffer_);
+
+/**
+ * @brief 符号付き整数型の変換関数を生成する
+ *
+ */
+#define DEFINE_PARSE_SIGNED(suffix_, type_, max_) \
+    CORE_STRING_ERROR_CODE core_string_parse_##suffix_(const char* const str_, uint64_t length_, type_* const out_value_, uint64_t* const out_consumed_) { \
+        CHECK_ARG_NULL_RETURN_ERROR("core_string_parse_" #suffix_, "out_value_", out_value_); \
+        if(0 != length_) { \
+            CHECK_ARG_NULL_RETURN_ERROR("core_string_parse_" #suffix_, "str_", str_); \
+        } \
+        uint64_t magnitude = 0; \
+        bool negative = false; \
+        uint64_t consumed = 0; \
+        CORE_STRING_ERROR_CODE ret = pfn_number_parse_integer(str_, length_, true, (uint64_t)(max_), &magnitude, &negative, &consumed); \
+        ret = pfn_number_check_consumed(ret, consumed, length_, out_consumed_); \
+        if(CORE_STRING_SUCCESS == ret || CORE_STRING_OUT_OF_RANGE == ret) { \
+            /* 最小値の絶対値は正の範囲に収まらないため、1ずらして符号を反転する */ \
+            *out_value_ = (negative && 0 != magnitude) ? (type_)(-(int64_t)(magnitude - 1) - 1) : (type_)magnitude; \
+        } \
+        return ret; \
+    } \
+
+/**
+ * @brief 符号なし整数型の変換関数を生成する
+ *
+ */
+#define DEFINE_PARSE_UNSIGNED(suffix_, type_, max_) \
+    CORE_STRING_ERROR_CODE core_string_parse_##suffix_(const char* const str_, uint64_t length_, type_* const out_value_, uint64_t* const out_consumed_) { \
+        CHECK_ARG_NULL_RETURN_ERROR("core_string_parse_" #suffix_, "out_value_", out_value_); \
+        if(0 != length_) { \
+            CHECK_ARG_NULL_RETURN_ERROR("core_string_parse_" #suffix_, "str_", str_); \
+        } \
+        uint64_t magnitude = 0; \
+        bool negative = false; \
+        uint64_t consumed = 0; \
+        CORE_STRING_ERROR_CODE ret = pfn_number_parse_integer(str_, length_, false, (uint64_t)(max_), &magnitude, &negative, &consumed); \
+        ret = pfn_number_check_consumed(ret, consumed, length_, out_consumed_); \
+        if(CORE_STRING_SUCCESS == ret || CORE_STRING_OUT_OF_RANGE == ret) { \
+            *out_value_ = (type_)magnitude; \
+        } \
+        return ret; \
+    } \
+
+/**
+ * @brief core_string_tの文字列全体を変換する関数を生成する
+ *
+ */
+#define DEFINE_STRING_TO(suffix_, type_) \
+    CORE_STRING_ERROR_CODE core_string_to_##suffix_(const core_string_t* const string_, type_* const out_value_) { \
+        CHECK_ARG_NULL_RETURN_ERROR("core_string_to_" #suffix_, "string_", string_); \
+        CHECK_ARG_NULL_RETURN_ERROR("core_string_to_" #suffix_, "out_value_", out_value_); \
+        if(core_string_is_empty(string_)) { \
+            ERROR_MESSAGE("core_string_to_" #suffix_ " - Provided string is empty or not initialized."); \
+            return CORE_STRING_RUNTIME_ERROR; \
+        } \
+        const CORE_STRING_ERROR_CODE ret = core_string_parse_##suffix_(core_string_cstr(string_), core_string_length(string_), out_value_, 0); \
+        if(CORE_STRING_SUCCESS != ret) { \
+            ERROR_MESSAGE("core_string_to_" #suffix_ " - Failed to convert string."); \
+        } \
+        return ret; \
+    } \
+
+DEFINE_PARSE_SIGNED(i64, int64_t, INT64_MAX)
+DEFINE_PARSE_SIGNED(i32, int32_t, INT32_MAX)
+DEFINE_PARSE_SIGNED(i16, int16_t, INT16_MAX)
+DEFINE_PARSE_SIGNED(i8, int8_t, INT8_MAX)
+DEFINE_PARSE_UNSIGNED(u64, uint64_t, UINT64_MAX)
+DEFINE_PARSE_UNSIGNED(u32, uint32_t, UINT32_MAX)
+DEFINE_PARSE_UNSIGNED(u16, uint16_t, UINT16_MAX)
+DEFINE_PARSE_UNSIGNED(u8, uint8_t, UINT8_MAX)
+
+CORE_STRING_ERROR_CODE core_string_parse_f64(const char* const str_, uint64_t length_, double* const out_value_, uint64_t* const out_consumed_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_parse_f64", "out_value_", out_value_);
+    if(0 != length_) {
+        CHECK_ARG_NULL_RETURN_ERROR("core_string_parse_f64", "str_", str_);
+    }
+    double value = 0.0;
+    uint64_t consumed = 0;
+    CORE_STRING_ERROR_CODE ret = pfn_number_parse_float(str_, length_, false, &value, 0, &consumed);
+    ret = pfn_number_check_consumed(ret, consumed, length_, out_consumed_);
+    if(CORE_STRING_SUCCESS == ret || CORE_STRING_OUT_OF_RANGE == ret) {
+        *out_value_ = value;
+    }
+    return ret;
+}
+
+CORE_STRING_ERROR_CODE core_string_parse_f32(const char* const str_, uint64_t length_, float* const out_value_, uint64_t* const out_consumed_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_parse_f32", "out_value_", out_value_);
+    if(0 != length_) {
+        CHECK_ARG_NULL_RETURN_ERROR("core_string_parse_f32", "str_", str_);
+    }
+    float value = 0.0f;
+    uint64_t consumed = 0;
+    CORE_STRING_ERROR_CODE ret = pfn_number_parse_float(str_, length_, true, 0, &value, &consumed);
+    ret = pfn_number_check_consumed(ret, consumed, length_, out_consumed_);
+    if(CORE_STRING_SUCCESS == ret || CORE_STRING_OUT_OF_RANGE == ret) {
+        *out_value_ = value;
+    }
+    return ret;
+}
+
+CORE_STRING_ERROR_CODE core_string_append_i64(int64_t value_, core_string_t* const dst_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_append_i64", "dst_", dst_);
+    char buffer[NUMBER_FORMAT_BUFFER_SIZE];
+    const bool negative = value_ < 0;
+    buffer[0] = '-';
+    // 最小値の絶対値はint64_tに収まらないため、uint64_tで符号を反転する
+    const uint64_t magnitude = negative ? 0 - (uint64_t)value_ : (uint64_t)value_;
+    const uint64_t length = pfn_number_write_u64(magnitude, buffer + (negative ? 1 : 0)) + (negative ? 1 : 0);
+    return core_string_append_from_buffer(buffer, length, dst_);
+}
+
+CORE_STRING_ERROR_CODE core_string_append_u64(uint64_t value_, core_string_t* const dst_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_append_u64", "dst_", dst_);
+    char buffer[NUMBER_FORMAT_BUFFER_SIZE];
+    const uint64_t length = pfn_number_write_u64(value_, buffer);
+    return core_string_append_from_buffer(buffer, length, dst_);
+}
+
+CORE_STRING_ERROR_CODE core_string_append_f64(double value_, core_string_t* const dst_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_append_f64", "dst_", dst_);
+    uint64_t bits = 0;
+    memcpy(&bits, &value_, sizeof(bits));
+    char buffer[NUMBER_FORMAT_BUFFER_SIZE];
+    const uint64_t length = pfn_number_write_float(bits & ((1ull << 52) - 1), (int32_t)((bits >> 52) & 0x7FF), 52, 1075, 0 != (bits >> 63), buffer);
+    return core_string_append_from_buffer(buffer, length, dst_);
+}
+
+CORE_STRING_ERROR_CODE core_string_append_f32(float value_, core_string_t* const dst_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_append_f32", "dst_", dst_);
+    uint32_t bits = 0;
+    memcpy(&bits, &value_, sizeof(bits));
+    char buffer[NUMBER_FORMAT_BUFFER_SIZE];
+    const uint64_t length = pfn_number_write_float(bits & ((1u << 23) - 1), (int32_t)((bits >> 23) & 0xFF), 23, 150, 0 != (bits >> 31), buffer);
+    return core_string_append_from_buffer(buffer, length, dst_);
+}
+
+DEFINE_STRING_TO(i64, int64_t)
+DEFINE_STRING_TO(i16, int16_t)
+DEFINE_STRING_TO(i8, int8_t)
+DEFINE_STRING_TO(u64, uint64_t)
+DEFINE_STRING_TO(u32, uint32_t)
+DEFINE_STRING_TO(u16, uint16_t)
+DEFINE_STRING_TO(u8, uint8_t)
+DEFINE_STRING_TO(f64, double)
+DEFINE_STRING_TO(f32, float)
+
+// str_から8文字を、先頭の文字が最下位byteとなる64bit整数として読み込む
+static uint64_t pfn_number_load8(const char* const str_) {
+    uint64_t chunk = 0;
+    memcpy(&chunk, str_, sizeof(chunk));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    chunk = __builtin_bswap64(chunk);
+#endif
+    return chunk;
+}
+
+// chunk_の8byteが全て'0'〜'9'かを判定する(上位4bitが3、かつ6を足しても上位4bitが3のまま)
+static bool pfn_number_is_8digits(uint64_t chunk_) {
+    return 0x3333333333333333ull == ((chunk_ & 0xF0F0F0F0F0F0F0F0ull) | (((chunk_ + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4));
+}
+
+// 8桁の数字列を値に変換する(隣接する桁を2桁、4桁、8桁の順にまとめる)
+static uint32_t pfn_number_parse_8digits(uint64_t chunk_) {
+    chunk_ -= 0x3030303030303030ull;
+    chunk_ = (chunk_ * 10) + (chunk_ >> 8);
+    chunk_ = (((chunk_ & 0x000000FF000000FFull) * (100 + (1000000ull << 32))) + (((chunk_ >> 16) & 0x000000FF000000FFull) * (1 + (10000ull << 32)))) >> 32;
+    return (uint32_t)chunk_;
+}
+
+// c_が10進数字であればその値を、そうでなければ10以上の値を返す
+static uint32_t pfn_number_digit(char c_) {
+    return (uint32_t)(uint8_t)c_ - (uint32_t)'0';
+}
+
+// c_が16進数字であればその値を、そうでなければ16以上の値を返す
+static uint32_t pfn_number_hex_digit(char c_) {
+    const uint32_t digit = pfn_number_digit(c_);
+    if(digit < 10) {
+        return digit;
+    }
+    const uint32_t alpha = ((uint32_t)(uint8_t)c_ | 0x20) - (uint32_t)'a';
+    return (alpha < 6) ? alpha + 10 : 16;
+}
+
+// str_の先頭から連続する10進数字を読み取り、読み取った桁数を返す(uint64_tに収まらない場合もすべての桁を読み、out_overflow_をtrueにする)
+static uint64_t pfn_number_parse_decimal(const char* const str_, uint64_t length_, uint64_t* const out_value_, bool* const out_overflow_) {
+    uint64_t value = 0;
+    uint64_t i = 0;
+    bool overflow = false;
+    while((length_ - i) >= 8 && value < NUMBER_CHUNK_VALUE_LIMIT) {
+        const uint64_t chunk = pfn_number_load8(str_ + i);
+        if(!pfn_number_is_8digits(chunk)) {
+            break;
+        }
+        value = value * 100000000ull + pfn_number_parse_8digits(chunk);
+        i += 8;
+    }
+    for(; i != length_; ++i) {
+        const uint32_t digit = pfn_number_digit(str_[i]);
+        if(digit >= 10) {
+            break;
+        }
+        // UINT64_MAX = 18446744073709551615
+        if(value > 1844674407370955161ull || (1844674407370955161ull == value && digit > 5)) {
+            overflow = true;
+        } else {
+            value = value * 10 + digit;
+        }
+    }
+    *out_value_ = value;
+    *out_overflow_ = overflow;
+    return i;
+}
+
+// str_の先頭から連続する16進数字を読み取り、読み取った桁数を返す(uint64_tに収まらない場合もすべての桁を読み、out_overflow_をtrueにする)
+static uint64_t pfn_number_parse_hex(const char* const str_, uint64_t length_, uint64_t* const out_value_, bool* const out_overflow_) {
+    uint64_t value = 0;
+    uint64_t i = 0;
+    bool overflow = false;
+    for(; i != length_; ++i) {
+        const uint32_t digit = pfn_number_hex_digit(str_[i]);
+        if(digit >= 16) {
+            break;
+        }
+        if(0 != (value >> 60)) {
+            overflow = true;
+        } else {
+            value = (value << 4) | digit;
+        }
+    }
+    *out_value_ = value;
+    *out_overflow_ = overflow;
+    return i;
+}
+
+// str_の先頭から符号と整数を読み取り、絶対値と符号を返す(絶対値が正の場合はmax_、負の場合はmax_ + 1を超える場合は範囲外)
+static CORE_STRING_ERROR_CODE pfn_number_parse_integer(const char* const str_, uint64_t length_, bool signed_, uint64_t max_, uint64_t* const out_magnitude_, bool* const out_negative_, uint64_t* const out_consumed_) {
+    uint64_t i = 0;
+    bool negative = false;
+    if(0 != length_ && ('+' == str_[0] || (signed_ && '-' == str_[0]))) {
+        negative = ('-' == str_[0]);
+        i++;
+    }
+    uint64_t value = 0;
+    bool overflow = false;
+    uint64_t digits = 0;
+    if((length_ - i) > 2 && '0' == str_[i] && 'x' == (str_[i + 1] | 0x20) && pfn_number_hex_digit(str_[i + 2]) < 16) {
+        digits = 2 + pfn_number_parse_hex(str_ + i + 2, length_ - i - 2, &value, &overflow);
+    } else {
+        digits = pfn_number_parse_decimal(str_ + i, length_ - i, &value, &overflow);
+    }
+    if(0 == digits) {
+        *out_consumed_ = 0;
+        return CORE_STRING_RUNTIME_ERROR;
+    }
+    *out_consumed_ = i + digits;
+    *out_negative_ = negative;
+    const uint64_t limit = negative ? max_ + 1 : max_;
+    if(overflow || value > limit) {
+        *out_magnitude_ = limit;
+        return CORE_STRING_OUT_OF_RANGE;
+    }
+    *out_magnitude_ = value;
+    return CORE_STRING_SUCCESS;
+}
+
+// 読み取った文字数を格納する(out_consumed_がNULLの場合は、length_文字全体を読み取っていなければエラーとする)
+static CORE_STRING_ERROR_CODE pfn_number_check_consumed(CORE_STRING_ERROR_CODE ret_, uint64_t consumed_, uint64_t length_, uint64_t* const out_consumed_) {
+    if(0 != out_consumed_) {
+        *out_consumed_ = consumed_;
+        return ret_;
+    }
+    if(CORE_STRING_SUCCESS == ret_ || CORE_STRING_OUT_OF_RANGE == ret_) {
+        return (consumed_ == length_) ? ret_ : CORE_STRING_RUNTIME_ERROR;
+    }
+    return ret_;
+}
+
+// str_の先頭から符号を除く浮動小数点数を読み取り、読み取った文字数を返す(数字が1つもない場合は0)
+static uint64_t pfn_number_scan_decimal(const char* const str_, uint64_t length_, number_decimal_t* const out_decimal_) {
+    uint64_t mantissa = 0;
+    uint64_t digits = 0;    // 仮数に取り込んだ桁数(先頭の0を除く。8桁単位で取り込んだ場合は多めに数える)
+    int64_t exponent = 0;
+    bool truncated = false;
+
+    // 整数部
+    uint64_t i = 0;
+    for(; i != length_; ++i) {
+        const uint32_t digit = pfn_number_digit(str_[i]);
+        if(digit >= 10) {
+            break;
+        }
+        if(digits < NUMBER_MAX_MANTISSA_DIGITS) {
+            mantissa = mantissa * 10 + digit;
+            digits += (0 != mantissa) ? 1 : 0;
+        } else {
+            exponent++;
+            truncated |= (0 != digit);
+        }
+    }
+    uint64_t digit_count = i;
+
+    // 小数部
+    if(i != length_ && '.' == str_[i]) {
+        ++i;
+        const uint64_t fraction_begin = i;
+        while((length_ - i) >= 8 && (digits + 8) <= NUMBER_MAX_MANTISSA_DIGITS) {
+            const uint64_t chunk = pfn_number_load8(str_ + i);
+            if(!pfn_number_is_8digits(chunk)) {
+                break;
+            }
+            mantissa = mantissa * 100000000ull + pfn_number_parse_8digits(chunk);
+            exponent -= 8;
+            digits = (0 != mantissa) ? digits + 8 : 0;
+            i += 8;
+        }
+        for(; i != length_; ++i) {
+            const uint32_t digit = pfn_number_digit(str_[i]);
+            if(digit >= 10) {
+                break;
+            }
+            if(digits < NUMBER_MAX_MANTISSA_DIGITS) {
+                mantissa = mantissa * 10 + digit;
+                exponent--;
+                digits += (0 != mantissa) ? 1 : 0;
+            } else {
+                truncated |= (0 != digit);
+            }
+        }
+        digit_count += i - fraction_begin;
+    }
+    if(0 == digit_count) {
+        return 0;
+    }
+    const uint64_t digits_end = i;
+
+    // 指数部(e / Eの後ろに数字がない場合は指数部として扱わない)
+    int64_t explicit_exponent = 0;
+    if(i != length_ && 'e' == (str_[i] | 0x20)) {
+        uint64_t j = i + 1;
+        bool exponent_negative = false;
+        if(j != length_ && ('+' == str_[j] || '-' == str_[j])) {
+            exponent_negative = ('-' == str_[j]);
+            ++j;
+        }
+        if(j != length_ && pfn_number_digit(str_[j]) < 10) {
+            for(; j != length_; ++j) {
+                const uint32_t digit = pfn_number_digit(str_[j]);
+                if(digit >= 10) {
+                    break;
+                }
+                if(explicit_exponent < NUMBER_EXPONENT_LIMIT) {
+                    explicit_exponent = explicit_exponent * 10 + digit;
+                }
+            }
+            explicit_exponent = exponent_negative ? -explicit_exponent : explicit_exponent;
+            i = j;
+        }
+    }
+
+    out_decimal_->mantissa = mantissa;
+    out_decimal_->exponent = exponent + explicit_exponent;
+    out_decimal_->truncated = truncated;
+    out_decimal_->digits_end = digits_end;
+    out_decimal_->explicit_exponent = explicit_exponent;
+    return i;
+}
+
+// str_の先頭からinf / infinity / nan(大文字小文字を区別しない)を読み取り、読み取った文字数を返す(該当しない場合は0)
+static uint64_t pfn_number_scan_special(const char* const str_, uint64_t length_, double* const out_value_) {
+    if(pfn_number_match_word(str_, length_, "nan")) {
+        *out_value_ = NAN;
+        return 3;
+    }
+    if(pfn_number_match_word(str_, length_, "infinity")) {
+        *out_value_ = INFINITY;
+        return 8;
+    }
+    if(pfn_number_match_word(str_, length_, "inf")) {
+        *out_value_ = INFINITY;
+        return 3;
+    }
+    return 0;
+}
+
+// str_の先頭が小文字のword_と大文字小文字を区別せずに一致するかを判定する
+static bool pfn_number_match_word(const char* const str_, uint64_t length_, const char* const word_) {
+    uint64_t i = 0;
+    for(; '\0' != word_[i]; ++i) {
+        if(i == length_ || word_[i] != (str_[i] | 0x20)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 仮数と10のべき乗がdoubleで正確に表現できる場合に、1回の演算で正しく丸めた値を求める
+static bool pfn_number_fast_f64(const number_decimal_t* const decimal_, double* const out_value_) {
+    if(!NUMBER_FLOAT_FAST_PATH || decimal_->truncated) {
+        return false;
+    }
+    uint64_t mantissa = decimal_->mantissa;
+    int64_t exponent = decimal_->exponent;
+    if(0 == mantissa) {
+        *out_value_ = 0.0;
+        return true;
+    }
+    if(mantissa > NUMBER_F64_MANTISSA_LIMIT || exponent < -22) {
+        return false;
+    }
+    if(exponent < 0) {
+        *out_value_ = (double)mantissa / s_pow10_f64[-exponent];
+        return true;
+    }
+    // 仮数に余裕がある場合は、仮数を整数のまま10倍して指数を表の範囲に収める
+    for(; exponent > 22; --exponent) {
+        if(mantissa > NUMBER_F64_MANTISSA_LIMIT / 10) {
+            return false;
+        }
+        mantissa *= 10;
+    }
+    *out_value_ = (double)mantissa * s_pow10_f64[exponent];
+    return true;
+}
+
+// 仮数と10のべき乗がfloatで正確に表現できる場合に、1回の演算で正しく丸めた値を求める
+static bool pfn_number_fast_f32(const number_decimal_t* const decimal_, float* const out_value_) {
+    if(!NUMBER_FLOAT_FAST_PATH || decimal_->truncated) {
+        return false;
+    }
+    uint64_t mantissa = decimal_->mantissa;
+    int64_t exponent = decimal_->exponent;
+    if(0 == mantissa) {
+        *out_value_ = 0.0f;
+        return true;
+    }
+    if(mantissa > NUMBER_F32_MANTISSA_LIMIT || exponent < -10) {
+        return false;
+    }
+    if(exponent < 0) {
+        *out_value_ = (float)mantissa / s_pow10_f32[-exponent];
+        return true;
+    }
+    for(; exponent > 10; --exponent) {
+        if(mantissa > NUMBER_F32_MANTISSA_LIMIT / 10) {
+            return false;
+        }
+        mantissa *= 10;
+    }
+    *out_value_ = (float)mantissa * s_pow10_f32[exponent];
+    return true;
+}
+
+// str_の仮数部を小数点を含まない"数字列e指数"に書き直し、strtod / strtofで変換する(符号は呼び出し側で付加する)
+static CORE_STRING_ERROR_CODE pfn_number_convert_fallback(const char* const str_, const number_decimal_t* const decimal_, bool single_, double* const out_double_, float* const out_float_) {
+    // 数字列 + 'e' + 符号 + 指数(最大20桁) + 終端文字
+    const uint64_t buffer_size = decimal_->digits_end + 24;
+    char stack_buffer[NUMBER_FALLBACK_BUFFER_SIZE];
+    char* buffer = stack_buffer;
+    if(buffer_size > NUMBER_FALLBACK_BUFFER_SIZE) {
+        buffer = core_malloc_tagged(buffer_size, MEMORY_TAG_STRING);
+        if(0 == buffer) {
+            ERROR_MESSAGE("pfn_number_convert_fallback - Failed to allocate conversion buffer.");
+            return CORE_STRING_MEMORY_ALLOCATE_ERROR;
+        }
+    }
+
+    uint64_t length = 0;
+    int64_t fraction_digits = 0;
+    bool fraction = false;
+    for(uint64_t i = 0; i != decimal_->digits_end; ++i) {
+        if('.' == str_[i]) {
+            fraction = true;
+            continue;
+        }
+        buffer[length++] = str_[i];
+        fraction_digits += fraction ? 1 : 0;
+    }
+    int64_t exponent = decimal_->explicit_exponent - fraction_digits;
+    buffer[length++] = 'e';
+    if(exponent < 0) {
+        buffer[length++] = '-';
+        exponent = -exponent;
+    }
+    char exponent_digits[20];
+    uint64_t exponent_length = 0;
+    do {
+        exponent_digits[exponent_length++] = (char)('0' + (exponent % 10));
+        exponent /= 10;
+    } while(0 != exponent);
+    while(0 != exponent_length) {
+        buffer[length++] = exponent_digits[--exponent_length];
+    }
+    buffer[length] = '\0';
+
+    if(single_) {
+        *out_float_ = strtof(buffer, 0);
+    } else {
+        *out_double_ = strtod(buffer, 0);
+    }
+    if(buffer != stack_buffer) {
+        core_free_tagged(buffer, buffer_size, MEMORY_TAG_STRING);
+    }
+    const bool overflow = single_ ? isinf(*out_float_) : isinf(*out_double_);
+    return overflow ? CORE_STRING_OUT_OF_RANGE : CORE_STRING_SUCCESS;
+}
+
+// str_の先頭から浮動小数点数を読み取る(single_がtrueの場合はout_float_、falseの場合はout_double_に格納する)
+static CORE_STRING_ERROR_CODE pfn_number_parse_float(const char* const str_, uint64_t length_, bool single_, double* const out_double_, float* const out_float_, uint64_t* const out_consumed_) {
+    uint64_t i = 0;
+    bool negative = false;
+    if(0 != length_ && ('+' == str_[0] || '-' == str_[0])) {
+        negative = ('-' == str_[0]);
+        i++;
+    }
+
+    CORE_STRING_ERROR_CODE ret = CORE_STRING_SUCCESS;
+    double value_double = 0.0;
+    float value_float = 0.0f;
+    number_decimal_t decimal = { 0 };
+    uint64_t consumed = pfn_number_scan_decimal(str_ + i, length_ - i, &decimal);
+    if(0 == consumed) {
+        consumed = pfn_number_scan_special(str_ + i, length_ - i, &value_double);
+        if(0 == consumed) {
+            *out_consumed_ = 0;
+            return CORE_STRING_RUNTIME_ERROR;
+        }
+        value_float = (float)value_double;
+    } else if(single_) {
+        if(!pfn_number_fast_f32(&decimal, &value_float)) {
+            ret = pfn_number_convert_fallback(str_ + i, &decimal, true, 0, &value_float);
+        }
+    } else {
+        if(!pfn_number_fast_f64(&decimal, &value_double)) {
+            ret = pfn_number_convert_fallback(str_ + i, &decimal, false, &value_double, 0);
+        }
+    }
+    if(CORE_STRING_SUCCESS != ret && CORE_STRING_OUT_OF_RANGE != ret) {
+        *out_consumed_ = 0;
+        return ret;
+    }
+
+    *out_consumed_ = i + consumed;
+    if(single_) {
+        *out_float_ = negative ? -value_float : value_float;
+    } else {
+        *out_double_ = negative ? -value_double : value_double;
+    }
+    return ret;
+}
+
+// value_の10進表記をbuffer_に書き込み、書き込んだ文字数を返す(下位から2桁ずつ対応表で変換する)
+static uint64_t pfn_number_write_u64(uint64_t value_, char* const buffer_) {
+    uint64_t length = 1;
+    while(length != 20 && value_ >= s_pow10_u64[length]) {
+        length++;
+    }
+    char* p = buffer_ + length;
+    while(value_ >= 100) {
+        const uint64_t pair = (value_ % 100) * 2;
+        value_ /= 100;
+        p -= 2;
+        p[0] = s_digit_pairs[pair];
+        p[1] = s_digit_pairs[pair + 1];
+    }
+    if(value_ >= 10) {
+        p[-2] = s_digit_pairs[value_ * 2];
+        p[-1] = s_digit_pairs[value_ * 2 + 1];
+    } else {
+        p[-1] = (char)('0' + value_);
+    }
+    return length;
+}
+
+// value_の仮数の最上位bitが立つよう正規化する
+static number_diy_fp_t pfn_number_diy_normalize(number_diy_fp_t value_) {
+    const int32_t shift = __builtin_clzll(value_.f);
+    value_.f <<= shift;
+    value_.e -= shift;
+    return value_;
+}
+
+// lhs_ * rhs_の上位64bitを最近接丸めで求める
+static number_diy_fp_t pfn_number_diy_multiply(number_diy_fp_t lhs_, number_diy_fp_t rhs_) {
+    number_diy_fp_t result = { 0, lhs_.e + rhs_.e + 64 };
+#if defined(__SIZEOF_INT128__)
+    __extension__ const unsigned __int128 product = (unsigned __int128)lhs_.f * rhs_.f;
+    result.f = (uint64_t)(product >> 64) + (((uint64_t)product >> 63) & 1);
+#else
+    const uint64_t a = lhs_.f >> 32;
+    const uint64_t b = lhs_.f & 0xFFFFFFFFull;
+    const uint64_t c = rhs_.f >> 32;
+    const uint64_t d = rhs_.f & 0xFFFFFFFFull;
+    const uint64_t ac = a * c;
+    const uint64_t bc = b * c;
+    const uint64_t ad = a * d;
+    const uint64_t bd = b * d;
+    const uint64_t middle = (bd >> 32) + (ad & 0xFFFFFFFFull) + (bc & 0xFFFFFFFFull) + (1ull << 31);
+    result.f = ac + (ad >> 32) + (bc >> 32) + (middle >> 32);
+#endif
+    return result;
+}
+
+// 2進指数e_の値に掛けると指数が[-60, -32]に収まる10のべき乗を取得する(out_k_には掛けた10のべき乗の指数の符号を反転した値を格納する)
+static number_diy_fp_t pfn_number_cached_power(int32_t e_, int32_t* const out_k_) {
+    const double dk = (double)(-61 - e_) * 0.30102999566398114 + 347;   // log10(2)
+    int32_t k = (int32_t)dk;
+    if(dk - k > 0.0) {
+        k++;
+    }
+    const uint32_t index = (uint32_t)((k >> 3) + 1);
+    *out_k_ = -(-348 + (int32_t)(index << 3));
+    return s_cached_powers[index];
+}
+
+// 生成した数字列の最終桁を、元の値に最も近くなるまで減らす
+static void pfn_number_grisu_round(char* const digits_, uint64_t length_, uint64_t delta_, uint64_t rest_, uint64_t ten_kappa_, uint64_t wp_w_) {
+    while(rest_ < wp_w_ && delta_ - rest_ >= ten_kappa_ &&
+          (rest_ + ten_kappa_ < wp_w_ || wp_w_ - rest_ > rest_ + ten_kappa_ - wp_w_)) {
+        digits_[length_ - 1]--;
+        rest_ += ten_kappa_;
+    }
+}
+
+// 上側境界mp_から、境界の幅delta_に収まるまで10進数字を生成する(k_に最終桁の10進指数を加算する)
+static uint64_t pfn_number_digit_gen(number_diy_fp_t w_, number_diy_fp_t mp_, uint64_t delta_, char* const digits_, int32_t* const k_) {
+    const int32_t shift = -mp_.e;
+    const uint64_t one = 1ull << shift;
+    const uint64_t wp_w = mp_.f - w_.f;
+    uint32_t p1 = (uint32_t)(mp_.f >> shift);
+    uint64_t p2 = mp_.f & (one - 1);
+    int32_t kappa = 1;
+    while(kappa != 10 && p1 >= s_pow10_u64[kappa]) {
+        kappa++;
+    }
+    uint64_t length = 0;
+
+    // 整数部
+    while(kappa > 0) {
+        const uint32_t divisor = (uint32_t)s_pow10_u64[kappa - 1];
+        const uint32_t digit = p1 / divisor;
+        p1 %= divisor;
+        if(0 != digit || 0 != length) {
+            digits_[length++] = (char)('0' + digit);
+        }
+        kappa--;
+        const uint64_t rest = ((uint64_t)p1 << shift) + p2;
+        if(rest <= delta_) {
+            *k_ += kappa;
+            pfn_number_grisu_round(digits_, length, delta_, rest, s_pow10_u64[kappa] << shift, wp_w);
+            return length;
+        }
+    }
+
+    // 小数部
+    for(;;) {
+        p2 *= 10;
+        delta_ *= 10;
+        const uint32_t digit = (uint32_t)(p2 >> shift);
+        if(0 != digit || 0 != length) {
+            digits_[length++] = (char)('0' + digit);
+        }
+        p2 &= one - 1;
+        kappa--;
+        if(p2 < delta_) {
+            *k_ += kappa;
+            const int32_t index = -kappa;
+            pfn_number_grisu_round(digits_, length, delta_, p2, one, wp_w * ((index < 20) ? s_pow10_u64[index] : 0));
+            return length;
+        }
+    }
+}
+
+// significand_ * 2^exponent_(significand_は0以外)を、読み戻すと元の値に戻る短い10進数字列に変換する(値は 数字列 * 10^out_k_)
+static uint64_t pfn_number_grisu2(uint64_t significand_, int32_t exponent_, bool lower_boundary_closer_, char* const digits_, int32_t* const out_k_) {
+    // 隣接する浮動小数点数との中点を境界とし、境界の間に収まる最短の数字列を求める
+    const number_diy_fp_t value = { significand_, exponent_ };
+    const number_diy_fp_t plus = pfn_number_diy_normalize((number_diy_fp_t){ (significand_ << 1) + 1, exponent_ - 1 });
+    number_diy_fp_t minus = lower_boundary_closer_ ? (number_diy_fp_t){ (significand_ << 2) - 1, exponent_ - 2 } : (number_diy_fp_t){ (significand_ << 1) - 1, exponent_ - 1 };
+    minus.f <<= minus.e - plus.e;
+    minus.e = plus.e;
+
+    const number_diy_fp_t cached_power = pfn_number_cached_power(plus.e, out_k_);
+    const number_diy_fp_t w = pfn_number_diy_multiply(pfn_number_diy_normalize(value), cached_power);
+    number_diy_fp_t w_plus = pfn_number_diy_multiply(plus, cached_power);
+    number_diy_fp_t w_minus = pfn_number_diy_multiply(minus, cached_power);
+    // 乗算の誤差を考慮して、境界を内側に1ずつ狭める
+    w_minus.f++;
+    w_plus.f--;
+    return pfn_number_digit_gen(w, w_plus, w_plus.f - w_minus.f, digits_, out_k_);
+}
+
+// 数字列digits_ * 10^k_をbuffer_に書き込み、書き込んだ文字数を返す(10^-7以上10^21未満は固定小数点表記、それ以外は指数表記)
+static uint64_t pfn_number_write_decimal(const char* const digits_, uint64_t length_, int32_t k_, char* const buffer_) {
+    const int32_t point = (int32_t)length_ + k_;    // 小数点の位置
+    uint64_t written = 0;
+    if((int32_t)length_ <= point && point <= 21) {
+        // 123e2 -> 12300
+        memcpy(buffer_, digits_, length_);
+        written = length_;
+        for(int32_t i = (int32_t)length_; i != point; ++i) {
+            buffer_[written++] = '0';
+        }
+    } else if(0 < point && point <= 21) {
+        // 1234e-2 -> 12.34
+        memcpy(buffer_, digits_, (size_t)point);
+        buffer_[point] = '.';
+        memcpy(buffer_ + point + 1, digits_ + point, length_ - (uint64_t)point);
+        written = length_ + 1;
+    } else if(-6 < point && point <= 0) {
+        // 1234e-6 -> 0.001234
+        buffer_[written++] = '0';
+        buffer_[written++] = '.';
+        for(int32_t i = point; i != 0; ++i) {
+            buffer_[written++] = '0';
+        }
+        memcpy(buffer_ + written, digits_, length_);
+        written += length_;
+    } else {
+        // 1234e30 -> 1.234e33
+        buffer_[written++] = digits_[0];
+        if(1 != length_) {
+            buffer_[written++] = '.';
+            memcpy(buffer_ + written, digits_ + 1, length_ - 1);
+            written += length_ - 1;
+        }
+        buffer_[written++] = 'e';
+        int32_t exponent = point - 1;
+        if(exponent < 0) {
+            buffer_[written++] = '-';
+            exponent = -exponent;
+        }
+        written += pfn_number_write_u64((uint64_t)exponent, buffer_ + written);
+    }
+    return written;
+}
+
+// IEEE 754形式の浮動小数点数(仮数部、バイアス付き指数部、符号)を最短の10進表記でbuffer_に書き込み、書き込んだ文字数を返す
+static uint64_t pfn_number_write_float(uint64_t significand_, int32_t biased_exponent_, uint32_t significand_bits_, int32_t exponent_bias_, bool negative_, char* const buffer_) {
+    const int32_t max_biased_exponent = (int32_t)(exponent_bias_ - (int32_t)significand_bits_) * 2 + 1;
+    uint64_t written = 0;
+    if(biased_exponent_ == max_biased_exponent && 0 != significand_) {
+        memcpy(buffer_, "nan", 3);
+        return 3;
+    }
+    if(negative_) {
+        buffer_[written++] = '-';
+    }
+    if(biased_exponent_ == max_biased_exponent) {
+        memcpy(buffer_ + written, "inf", 3);
+        return written + 3;
+    }
+    if(0 == biased_exponent_ && 0 == significand_) {
+        buffer_[written++] = '0';
+        return written;
+    }
+
+    const uint64_t hidden_bit = 1ull << significand_bits_;
+    uint64_t significand = significand_;
+    int32_t exponent = 1 - exponent_bias_;  // 非正規化数
+    if(0 != biased_exponent_) {
+        significand += hidden_bit;
+        exponent = biased_exponent_ - exponent_bias_;
+    }
+    char digits[NUMBER_FORMAT_BUFFER_SIZE];
+    int32_t k = 0;
+    const uint64_t length = pfn_number_grisu2(significand, exponent, hidden_bit == significand && 1 < biased_exponent_, digits, &k);
+    return written + pfn_number_write_decimal(digits, length, k, buffer_ + written);
+}
@@ -0,0 +1,331 @@
+/**
+ * @file core_string_tokenizer.c
+ * @author chocolate-pie24
+ * @brief 文字列の分割イテレータ(core_string_tokenizer_t)用API関数の実装ファイル
+ *
+ * @details
+ * 区切りの検索は、区切り文字の種類に応じて以下のいずれかで行う。
+ * - 区切り文字列: core_string_kernel_find() (先頭文字と末尾文字の一致位置をベクトル命令で探す。1文字の場合は core_string_kernel_find_char())
+ * - 区切り文字集合( CORE_STRING_TOKENIZER_VECTOR_DELIMITER_MAX 文字以下): core_string_kernel_find_any()
+ * - それ以外: ビット集合を1文字ずつ参照する
+ *
+ * @version 0.1
+ * @date 2025-07-20
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#define MESSAGE_MODULE_NAME CORE_STRING // メッセージ出力元モジュール(message.hより前に定義する)
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdalign.h>
+
+#include "core/core_string_tokenizer.h"
+#include "core/core_string_view.h"
+#include "core/core_string.h"
+#include "core/message.h"
+
+#include "containers/dynamic_array.h"
+
+#include "internal/core_string_kernel.h"
+
+#include "define.h"
+
+#if ENABLE_ARGUMENT_CHECK
+/**
+ * @brief 引数のNULLチェックを行い、NULLであればCORE_STRING_INVALID_ARGUMENTで処理を終了するマクロ
+ *
+ */
+#define CHECK_ARG_NULL_RETURN_ERROR(func_name_, arg_name_, ptr_) \
+    if(0 == ptr_) { \
+        ERROR_MESSAGE("%s - Argument %s requires a valid pointer.", func_name_, arg_name_); \
+        return CORE_STRING_INVALID_ARGUMENT; \
+    } \
+
+#else
+#define CHECK_ARG_NULL_RETURN_ERROR(func_name_, arg_name_, ptr_) DEBUG_ASSERT(0 != (ptr_));
+#endif
+
+/**
+ * @brief core_string_tokenizer_collect() で配列を生成する際の初期容量(要素数)
+ *
+ */
+#define TOKENIZER_COLLECT_INITIAL_CAPACITY 16
+
+static bool pfn_tokenizer_next(core_string_tokenizer_t* const tokenizer_, core_string_view_t* const out_token_, bool* const out_quoted_);
+static void pfn_tokenizer_reset(const core_string_view_t* const source_, core_string_tokenizer_t* const tokenizer_);
+static bool pfn_tokenizer_is_delimiter(const core_string_tokenizer_t* const tokenizer_, char c_);
+static uint64_t pfn_tokenizer_delimiter_length_at(const core_string_tokenizer_t* const tokenizer_, uint64_t position_);
+static uint64_t pfn_tokenizer_find_delimiter(const core_string_tokenizer_t* const tokenizer_, uint64_t from_);
+static uint64_t pfn_tokenizer_find_closing_quote(const core_string_tokenizer_t* const tokenizer_, uint64_t from_);
+static CORE_STRING_ERROR_CODE pfn_tokenizer_array_error(DYNAMIC_ARRAY_ERROR_CODE ret_);
+
+CORE_STRING_ERROR_CODE core_string_tokenizer_create(const core_string_view_t* const source_, const char* const delimiters_, core_string_tokenizer_t* const out_tokenizer_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_tokenizer_create", "source_", source_);
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_tokenizer_create", "delimiters_", delimiters_);
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_tokenizer_create", "out_tokenizer_", out_tokenizer_);
+    if('\0' == delimiters_[0]) {
+        ERROR_MESSAGE("core_string_tokenizer_create - Argument delimiters_ requires at least one character.");
+        return CORE_STRING_INVALID_ARGUMENT;
+    }
+    pfn_tokenizer_reset(source_, out_tokenizer_);
+    for(const char* p = delimiters_; '\0' != *p; ++p) {
+        const uint8_t c = (uint8_t)*p;
+        if(0 != (out_tokenizer_->delimiter_bits[c >> 6] & (1ull << (c & 63)))) {
+            continue;   // 重複した文字
+        }
+        out_tokenizer_->delimiter_bits[c >> 6] |= 1ull << (c & 63);
+        if(out_tokenizer_->delimiter_count < CORE_STRING_TOKENIZER_VECTOR_DELIMITER_MAX) {
+            out_tokenizer_->delimiters[out_tokenizer_->delimiter_count] = *p;
+        }
+        out_tokenizer_->delimiter_count++;  // '\0'を除く255文字まで
+    }
+    // ベクトル命令では常に CORE_STRING_TOKENIZER_VECTOR_DELIMITER_MAX 文字と比較するため、不足分を先頭の文字で埋める
+    for(uint8_t i = out_tokenizer_->delimiter_count; i < CORE_STRING_TOKENIZER_VECTOR_DELIMITER_MAX; ++i) {
+        out_tokenizer_->delimiters[i] = out_tokenizer_->delimiters[0];
+    }
+    return CORE_STRING_SUCCESS;
+}
+
+CORE_STRING_ERROR_CODE core_string_tokenizer_create_separator(const core_string_view_t* const source_, const char* const separator_, core_string_tokenizer_t* const out_tokenizer_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_tokenizer_create_separator", "source_", source_);
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_tokenizer_create_separator", "separator_", separator_);
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_tokenizer_create_separator", "out_tokenizer_", out_tokenizer_);
+    if('\0' == separator_[0]) {
+        ERROR_MESSAGE("core_string_tokenizer_create_separator - Argument separator_ requires at least one character.");
+        return CORE_STRING_INVALID_ARGUMENT;
+    }
+    pfn_tokenizer_reset(source_, out_tokenizer_);
+    out_tokenizer_->separator = separator_;
+    out_tokenizer_->separator_length = core_string_kernel_length(separator_);
+    return CORE_STRING_SUCCESS;
+}
+
+CORE_STRING_ERROR_CODE core_string_tokenizer_quote_set(char quote_, core_string_tokenizer_t* const tokenizer_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_tokenizer_quote_set", "tokenizer_", tokenizer_);
+    tokenizer_->quote = quote_;
+    return CORE_STRING_SUCCESS;
+}
+
+CORE_STRING_ERROR_CODE core_string_tokenizer_skip_empty_set(bool skip_empty_, core_string_tokenizer_t* const tokenizer_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_tokenizer_skip_empty_set", "tokenizer_", tokenizer_);
+    tokenizer_->skip_empty = skip_empty_;
+    return CORE_STRING_SUCCESS;
+}
+
+bool core_string_tokenizer_next(core_string_tokenizer_t* const tokenizer_, core_string_view_t* const out_token_) {
+    if(0 == tokenizer_ || 0 == out_token_) {
+        return false;
+    }
+    bool quoted = false;
+    return pfn_tokenizer_next(tokenizer_, out_token_, &quoted);
+}
+
+bool core_string_tokenizer_next_token(core_string_tokenizer_t* const tokenizer_, core_string_token_t* const out_token_) {
+    if(0 == tokenizer_ || 0 == out_token_) {
+        return false;
+    }
+    return pfn_tokenizer_next(tokenizer_, &out_token_->view, &out_token_->quoted);
+}
+
+CORE_STRING_ERROR_CODE core_string_tokenizer_collect(core_string_tokenizer_t* const tokenizer_, dynamic_array_t* const out_tokens_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_tokenizer_collect", "tokenizer_", tokenizer_);
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_tokenizer_collect", "out_tokens_", out_tokens_);
+
+    uint64_t size = 0;
+    DYNAMIC_ARRAY_ERROR_CODE ret = dynamic_array_size(out_tokens_, &size);
+    if(DYNAMIC_ARRAY_INVALID_DARRAY == ret) {
+        ret = dynamic_array_create(sizeof(core_string_token_t), alignof(core_string_token_t), TOKENIZER_COLLECT_INITIAL_CAPACITY, out_tokens_);
+    } else if(DYNAMIC_ARRAY_SUCCESS == ret) {
+        ret = dynamic_array_element_erase(0, size, out_tokens_);
+    }
+    if(DYNAMIC_ARRAY_SUCCESS != ret) {
+        ERROR_MESSAGE("core_string_tokenizer_collect - Failed to prepare token array.");
+        return pfn_tokenizer_array_error(ret);
+    }
+    void* data = 0;
+    uint64_t stride = 0;
+    ret = dynamic_array_data(out_tokens_, &data, &stride);
+    if(DYNAMIC_ARRAY_SUCCESS != ret) {
+        ERROR_MESSAGE("core_string_tokenizer_collect - Failed to prepare token array.");
+        return pfn_tokenizer_array_error(ret);
+    }
+    if(sizeof(core_string_token_t) != stride) {
+        ERROR_MESSAGE("core_string_tokenizer_collect - Argument out_tokens_ requires an array of core_string_token_t.");
+        return CORE_STRING_INVALID_ARGUMENT;
+    }
+
+    // 引用符で囲まれていたかはトークンごとに保持する(core_string_tokenizer_unquote()で使用する)
+    core_string_token_t token = CORE_STRING_TOKEN_INITIALIZER;
+    while(pfn_tokenizer_next(tokenizer_, &token.view, &token.quoted)) {
+        ret = dynamic_array_element_push(&token, out_tokens_);
+        if(DYNAMIC_ARRAY_BUFFER_FULL == ret) {
+            uint64_t capacity = 0;
+            ret = dynamic_array_capacity(out_tokens_, &capacity);
+            if(DYNAMIC_ARRAY_SUCCESS == ret) {
+                ret = dynamic_array_resize((0 != capacity) ? capacity * 2 : TOKENIZER_COLLECT_INITIAL_CAPACITY, out_tokens_);
+            }
+            if(DYNAMIC_ARRAY_SUCCESS == ret) {
+                ret = dynamic_array_element_push(&token, out_tokens_);
+            }
+        }
+        if(DYNAMIC_ARRAY_SUCCESS != ret) {
+            ERROR_MESSAGE("core_string_tokenizer_collect - Failed to push token.");
+            return pfn_tokenizer_array_error(ret);
+        }
+    }
+    return CORE_STRING_SUCCESS;
+}
+
+CORE_STRING_ERROR_CODE core_string_tokenizer_unquote(const core_string_tokenizer_t* const tokenizer_, const core_string_token_t* const token_, core_string_t* const dst_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_tokenizer_unquote", "tokenizer_", tokenizer_);
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_tokenizer_unquote", "token_", token_);
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_tokenizer_unquote", "dst_", dst_);
+
+    const core_string_view_t* view = &token_->view;
+    CORE_STRING_ERROR_CODE ret = core_string_copy_from_char("", dst_);
+    if(CORE_STRING_SUCCESS != ret || 0 == view->length) {
+        return ret;
+    }
+    if(!token_->quoted) {
+        return core_string_append_from_buffer(view->data, view->length, dst_);
+    }
+    // 重ねた引用符の2文字目を除いた区間ごとに追記する
+    uint64_t begin = 0;
+    while(CORE_STRING_SUCCESS == ret) {
+        const char* quote = core_string_kernel_find_char(view->data + begin, view->length - begin, tokenizer_->quote);
+        if(0 == quote) {
+            return core_string_append_from_buffer(view->data + begin, view->length - begin, dst_);
+        }
+        const uint64_t end = (uint64_t)(quote - view->data) + 1;
+        ret = core_string_append_from_buffer(view->data + begin, end - begin, dst_);
+        begin = (end != view->length && tokenizer_->quote == view->data[end]) ? end + 1 : end;
+    }
+    return ret;
+}
+
+// 次のトークンをout_token_に、引用符で囲まれていたかをout_quoted_に格納する(引数は呼び出し側で確認する)
+static bool pfn_tokenizer_next(core_string_tokenizer_t* const tokenizer_, core_string_view_t* const out_token_, bool* const out_quoted_) {
+    if(tokenizer_->finished) {
+        return false;
+    }
+    uint64_t start = tokenizer_->position;
+    if(tokenizer_->skip_empty) {
+        while(start != tokenizer_->length) {
+            const uint64_t length = pfn_tokenizer_delimiter_length_at(tokenizer_, start);
+            if(0 == length) {
+                break;
+            }
+            start += length;
+        }
+        if(start == tokenizer_->length) {
+            tokenizer_->finished = true;
+            return false;
+        }
+    }
+
+    uint64_t token_end = 0;
+    uint64_t end = 0;
+    *out_quoted_ = '\0' != tokenizer_->quote && start != tokenizer_->length && tokenizer_->quote == tokenizer_->data[start];
+    if(*out_quoted_) {
+        // 引用符の内側をトークンとし、閉じ引用符の後ろは次の区切りまで読み飛ばす
+        start++;
+        token_end = pfn_tokenizer_find_closing_quote(tokenizer_, start);
+        end = (token_end == tokenizer_->length) ? token_end : pfn_tokenizer_find_delimiter(tokenizer_, token_end + 1);
+    } else {
+        end = pfn_tokenizer_find_delimiter(tokenizer_, start);
+        token_end = end;
+    }
+    out_token_->data = tokenizer_->data + start;
+    out_token_->length = token_end - start;
+
+    if(end == tokenizer_->length) {
+        tokenizer_->position = end;
+        tokenizer_->finished = true;
+    } else {
+        tokenizer_->position = end + pfn_tokenizer_delimiter_length_at(tokenizer_, end);
+    }
+    return true;
+}
+
+// tokenizer_をsource_を分割する初期状態(区切り文字未設定)にする
+static void pfn_tokenizer_reset(const core_string_view_t* const source_, core_string_tokenizer_t* const tokenizer_) {
+    const core_string_tokenizer_t initial = CORE_STRING_TOKENIZER_INITIALIZER;
+    *tokenizer_ = initial;
+    tokenizer_->data = source_->data;
+    tokenizer_->length = source_->length;
+    tokenizer_->finished = 0 == source_->data;
+}
+
+// c_が区切り文字集合に含まれるかを判定する
+static bool pfn_tokenizer_is_delimiter(const core_string_tokenizer_t* const tokenizer_, char c_) {
+    const uint8_t c = (uint8_t)c_;
+    return 0 != (tokenizer_->delimiter_bits[c >> 6] & (1ull << (c & 63)));
+}
+
+// position_から区切りが始まっていればその文字数を、そうでなければ0を返す
+static uint64_t pfn_tokenizer_delimiter_length_at(const core_string_tokenizer_t* const tokenizer_, uint64_t position_) {
+    if(0 == tokenizer_->separator) {
+        return pfn_tokenizer_is_delimiter(tokenizer_, tokenizer_->data[position_]) ? 1 : 0;
+    }
+    if(tokenizer_->length - position_ < tokenizer_->separator_length) {
+        return 0;
+    }
+    return core_string_kernel_equal(tokenizer_->data + position_, tokenizer_->separator, tokenizer_->separator_length) ? tokenizer_->separator_length : 0;
+}
+
+// from_以降で最初の区切りの位置を返す(見つからない場合は文字列長)
+static uint64_t pfn_tokenizer_find_delimiter(const core_string_tokenizer_t* const tokenizer_, uint64_t from_) {
+    const char* str = tokenizer_->data + from_;
+    const uint64_t size = tokenizer_->length - from_;
+    if(0 != tokenizer_->separator && 1 == tokenizer_->separator_length) {
+        const char* found = core_string_kernel_find_char(str, size, tokenizer_->separator[0]);
+        return (0 != found) ? (uint64_t)(found - tokenizer_->data) : tokenizer_->length;
+    }
+    if(0 != tokenizer_->separator) {
+        if(size < tokenizer_->separator_length) {
+            return tokenizer_->length;
+        }
+        const uint64_t index = core_string_kernel_find(str, size, tokenizer_->separator, tokenizer_->separator_length);
+        return (INVALID_VALUE_U64 != index) ? from_ + index : tokenizer_->length;
+    }
+    if(tokenizer_->delimiter_count <= CORE_STRING_TOKENIZER_VECTOR_DELIMITER_MAX) {
+        const char* found = core_string_kernel_find_any(str, size, tokenizer_->delimiters);
+        return (0 != found) ? (uint64_t)(found - tokenizer_->data) : tokenizer_->length;
+    }
+    for(uint64_t i = from_; i != tokenizer_->length; ++i) {
+        if(pfn_tokenizer_is_delimiter(tokenizer_, tokenizer_->data[i])) {
+            return i;
+        }
+    }
+    return tokenizer_->length;
+}
+
+// from_以降で閉じ引用符の位置を返す(重ねた引用符は読み飛ばす。見つからない場合は文字列長)
+static uint64_t pfn_tokenizer_find_closing_quote(const core_string_tokenizer_t* const tokenizer_, uint64_t from_) {
+    uint64_t position = from_;
+    for(;;) {
+        const char* quote = core_string_kernel_find_char(tokenizer_->data + position, tokenizer_->length - position, tokenizer_->quote);
+        if(0 == quote) {
+            return tokenizer_->length;
+        }
+        position = (uint64_t)(quote - tokenizer_->data);
+        if(position + 1 == tokenizer_->length || tokenizer_->quote != tokenizer_->data[position + 1]) {
+            return position;
+        }
+        position += 2;
+    }
+}
+
+// dynamic_array_tのエラーコードをCORE_STRING_ERROR_CODEに変換する
+static CORE_STRING_ERROR_CODE pfn_tokenizer_array_error(DYNAMIC_ARRAY_ERROR_CODE ret_) {
+    switch(ret_) {
+        case DYNAMIC_ARRAY_MEMORY_ALLOCATE_ERROR:
+            return CORE_STRING_MEMORY_ALLOCATE_ERROR;
+        case DYNAMIC_ARRAY_INVALID_ARGUMENT:
+            return CORE_STRING_INVALID_ARGUMENT;
+        default:
+            return CORE_STRING_RUNTIME_ERROR;
+    }
+}
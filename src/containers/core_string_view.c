@@ -0,0 +1,224 @@
+/**
+ * @file core_string_view.c
+ * @author chocolate-pie24
+ * @brief 文字列ビュー(core_string_view_t)用API関数の実装ファイル
+ *
+ * @details
+ * ビューを生成、加工する関数は参照先の文字列を変更せず、先頭ポインタと長さのみを計算する。
+ * 検索、比較は長さが分かっているため、終端文字を探す走査を行わずにベクトル命令版の関数(core_string_kernel.c)で処理する。
+ *
+ * @version 0.1
+ * @date 2025-07-20
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#define MESSAGE_MODULE_NAME CORE_STRING // メッセージ出力元モジュール(message.hより前に定義する)
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h> // for memcmp
+
+#include "core/core_string_view.h"
+#include "core/core_string.h"
+#include "core/message.h"
+
+#include "internal/core_string_kernel.h"
+
+#include "define.h"
+
+#if ENABLE_ARGUMENT_CHECK
+/**
+ * @brief 引数のNULLチェックを行い、NULLであればCORE_STRING_INVALID_ARGUMENTで処理を終了するマクロ
+ *
+ */
+#define CHECK_ARG_NULL_RETURN_ERROR(func_name_, arg_name_, ptr_) \
+    if(0 == ptr_) { \
+        ERROR_MESSAGE("%s - Argument %s requires a valid pointer.", func_name_, arg_name_); \
+        return CORE_STRING_INVALID_ARGUMENT; \
+    } \
+
+#else
+#define CHECK_ARG_NULL_RETURN_ERROR(func_name_, arg_name_, ptr_) DEBUG_ASSERT(0 != (ptr_));
+#endif
+
+static bool pfn_view_match(const core_string_view_t* const view_, uint64_t offset_, const core_string_view_t* const other_);
+
+CORE_STRING_ERROR_CODE core_string_view_from_string(const core_string_t* const string_, core_string_view_t* const out_view_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_view_from_string", "string_", string_);
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_view_from_string", "out_view_", out_view_);
+    if(0 == core_string_buffer_capacity(string_)) {    // デフォルト状態
+        out_view_->data = 0;
+        out_view_->length = 0;
+        return CORE_STRING_SUCCESS;
+    }
+    out_view_->data = core_string_cstr(string_);
+    out_view_->length = core_string_length(string_);
+    return CORE_STRING_SUCCESS;
+}
+
+CORE_STRING_ERROR_CODE core_string_view_from_char(const char* const str_, core_string_view_t* const out_view_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_view_from_char", "str_", str_);
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_view_from_char", "out_view_", out_view_);
+    out_view_->data = str_;
+    out_view_->length = core_string_kernel_length(str_);
+    return CORE_STRING_SUCCESS;
+}
+
+CORE_STRING_ERROR_CODE core_string_view_from_buffer(const char* const data_, uint64_t length_, core_string_view_t* const out_view_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_view_from_buffer", "out_view_", out_view_);
+    if(0 != length_) {
+        CHECK_ARG_NULL_RETURN_ERROR("core_string_view_from_buffer", "data_", data_);
+    }
+    out_view_->data = data_;
+    out_view_->length = length_;
+    return CORE_STRING_SUCCESS;
+}
+
+CORE_STRING_ERROR_CODE core_string_view_substring(const core_string_view_t* const view_, uint64_t offset_, uint64_t length_, core_string_view_t* const out_view_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_view_substring", "view_", view_);
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_view_substring", "out_view_", out_view_);
+    if(offset_ > view_->length) {
+        ERROR_MESSAGE("core_string_view_substring - Argument offset_ is out of range. offset = %llu, length = %llu.", (unsigned long long)offset_, (unsigned long long)view_->length);
+        return CORE_STRING_INVALID_ARGUMENT;
+    }
+    const uint64_t remain = view_->length - offset_;
+    out_view_->length = (length_ < remain) ? length_ : remain;
+    out_view_->data = (0 != view_->data) ? view_->data + offset_ : 0;
+    return CORE_STRING_SUCCESS;
+}
+
+CORE_STRING_ERROR_CODE core_string_view_trim(const core_string_view_t* const view_, char ltrim_, char rtrim_, core_string_view_t* const out_view_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_view_trim", "view_", view_);
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_view_trim", "out_view_", out_view_);
+    uint64_t begin = 0;
+    uint64_t end = view_->length;
+    while(begin != end && ltrim_ == view_->data[begin]) {
+        begin++;
+    }
+    while(begin != end && rtrim_ == view_->data[end - 1]) {
+        end--;
+    }
+    out_view_->data = (0 != view_->data) ? view_->data + begin : 0;
+    out_view_->length = end - begin;
+    return CORE_STRING_SUCCESS;
+}
+
+bool core_string_view_split(core_string_view_t* const rest_, char delimiter_, core_string_view_t* const out_token_) {
+    if(0 == rest_ || 0 == out_token_ || 0 == rest_->data) {
+        return false;
+    }
+    const char* delimiter = core_string_kernel_find_char(rest_->data, rest_->length, delimiter_);
+    out_token_->data = rest_->data;
+    if(0 == delimiter) {
+        // 区切り文字がなければ残り全てが最後のトークン
+        out_token_->length = rest_->length;
+        rest_->data = 0;
+        rest_->length = 0;
+        return true;
+    }
+    out_token_->length = (uint64_t)(delimiter - rest_->data);
+    rest_->data = delimiter + 1;
+    rest_->length -= out_token_->length + 1;
+    return true;
+}
+
+uint64_t core_string_view_find_char(const core_string_view_t* const view_, uint64_t offset_, char c_) {
+    if(0 == view_ || offset_ >= view_->length) {
+        return INVALID_VALUE_U64;
+    }
+    const char* found = core_string_kernel_find_char(view_->data + offset_, view_->length - offset_, c_);
+    return (0 != found) ? (uint64_t)(found - view_->data) : INVALID_VALUE_U64;
+}
+
+uint64_t core_string_view_find(const core_string_view_t* const view_, uint64_t offset_, const core_string_view_t* const needle_) {
+    if(0 == view_ || 0 == needle_ || offset_ > view_->length) {
+        return INVALID_VALUE_U64;
+    }
+    const uint64_t index = core_string_kernel_find(view_->data + offset_, view_->length - offset_, needle_->data, needle_->length);
+    return (INVALID_VALUE_U64 != index) ? offset_ + index : INVALID_VALUE_U64;
+}
+
+bool core_string_view_equal(const core_string_view_t* const view1_, const core_string_view_t* const view2_) {
+    if(0 == view1_ || 0 == view2_ || view1_->length != view2_->length) {
+        return false;
+    }
+    return pfn_view_match(view1_, 0, view2_);
+}
+
+bool core_string_view_equal_from_char(const char* const str1_, const core_string_view_t* const view2_) {
+    if(0 == str1_ || 0 == view2_) {
+        return false;
+    }
+    for(uint64_t i = 0; i != view2_->length; ++i) {
+        if('\0' == str1_[i] || str1_[i] != view2_->data[i]) {    // view2_が'\0'を含む場合もstr1_の終端を越えて読まない
+            return false;
+        }
+    }
+    return '\0' == str1_[view2_->length];
+}
+
+int core_string_view_compare(const core_string_view_t* const view1_, const core_string_view_t* const view2_) {
+    if(0 == view1_ || 0 == view2_) {
+        return 0;
+    }
+    const uint64_t length = (view1_->length < view2_->length) ? view1_->length : view2_->length;
+    const int ret = (0 != length) ? memcmp(view1_->data, view2_->data, (size_t)length) : 0;
+    if(0 != ret) {
+        return ret;
+    }
+    if(view1_->length == view2_->length) {
+        return 0;
+    }
+    return (view1_->length < view2_->length) ? -1 : 1;
+}
+
+bool core_string_view_starts_with(const core_string_view_t* const view_, const core_string_view_t* const prefix_) {
+    if(0 == view_ || 0 == prefix_ || prefix_->length > view_->length) {
+        return false;
+    }
+    return pfn_view_match(view_, 0, prefix_);
+}
+
+bool core_string_view_ends_with(const core_string_view_t* const view_, const core_string_view_t* const suffix_) {
+    if(0 == view_ || 0 == suffix_ || suffix_->length > view_->length) {
+        return false;
+    }
+    return pfn_view_match(view_, view_->length - suffix_->length, suffix_);
+}
+
+CORE_STRING_ERROR_CODE core_string_view_to_string(const core_string_view_t* const view_, core_string_t* const dst_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_view_to_string", "view_", view_);
+    CHECK_ARG_NULL_RETURN_ERROR("core_string_view_to_string", "dst_", dst_);
+
+    // 空のビューはdst_を空にするのみ(dst_自身を参照していても一時文字列を経由しない)
+    if(0 != view_->length && !core_string_is_empty(dst_)) {
+        const char* dst_buffer = core_string_cstr(dst_);
+        if(view_->data >= dst_buffer && view_->data < dst_buffer + core_string_length(dst_)) {
+            // dst_自身を参照している場合は、一度別の文字列にコピーしてから移す
+            core_string_t tmp = CORE_STRING_INITIALIZER;
+            CORE_STRING_ERROR_CODE ret = core_string_append_from_buffer(view_->data, view_->length, &tmp);
+            if(CORE_STRING_SUCCESS == ret) {
+                ret = core_string_copy(&tmp, dst_);
+            }
+            core_string_destroy(&tmp);
+            if(CORE_STRING_SUCCESS != ret) {
+                ERROR_MESSAGE("core_string_view_to_string - Failed to copy string.");
+            }
+            return ret;
+        }
+    }
+    CORE_STRING_ERROR_CODE ret = core_string_copy_from_char("", dst_);
+    if(CORE_STRING_SUCCESS == ret) {
+        ret = core_string_append_from_buffer(view_->data, view_->length, dst_);
+    }
+    if(CORE_STRING_SUCCESS != ret) {
+        ERROR_MESSAGE("core_string_view_to_string - Failed to copy string.");
+    }
+    return ret;
+}
+
+// view_のoffset_文字目からother_の長さ分がother_と一致するかを判定する(範囲は呼び出し側で確認する)
+static bool pfn_view_match(const core_string_view_t* const view_, uint64_t offset_, const core_string_view_t* const other_) {
+    return core_string_kernel_equal(view_->data + offset_, other_->data, other_->length);
+}
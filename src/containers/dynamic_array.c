@@ -1,16 +1,21 @@
+#define MESSAGE_MODULE_NAME DYNAMIC_ARRAY // メッセージ出力元モジュール(message.hより前に定義する)
+
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdalign.h>
 
+#include "define.h"
+
 #include "containers/dynamic_array.h"
 
-#include "internal/dynamic_array_internal_data.h"
+#include "containers/internal/dynamic_array_internal_data.h"
 
 #include "core/message.h"
 #include "core/core_memory.h"
 
+#if ENABLE_ARGUMENT_CHECK
 /**
- * @brief 引数のNULLチェックを行い、NULLであればCORE_STRING_INVALID_ARGUMENTで処理を終了するマクロ
+ * @brief 引数のNULLチェックを行い、NULLであればDYNAMIC_ARRAY_INVALID_ARGUMENTで処理を終了するマクロ
  *
  */
 #define CHECK_ARG_NULL_RETURN_ERROR(func_name_, arg_name_, ptr_) \
@@ -19,6 +24,21 @@
         return DYNAMIC_ARRAY_INVALID_ARGUMENT; \
     } \
 
+/**
+ * @brief dynamic_array_が初期化済みかをチェックし、未初期化であればDYNAMIC_ARRAY_INVALID_DARRAYで処理を終了するマクロ
+ *
+ */
+#define CHECK_DARRAY_VALID_RETURN_ERROR(func_name_, dynamic_array_) \
+    if(0 == (dynamic_array_)->internal_data) { \
+        ERROR_MESSAGE("%s - Provided dynamic_array_ is not initialized. Call dynamic_array_create.", func_name_); \
+        return DYNAMIC_ARRAY_INVALID_DARRAY; \
+    } \
+
+#else
+#define CHECK_ARG_NULL_RETURN_ERROR(func_name_, arg_name_, ptr_) DEBUG_ASSERT(0 != (ptr_));
+#define CHECK_DARRAY_VALID_RETURN_ERROR(func_name_, dynamic_array_) DEBUG_ASSERT(0 != (dynamic_array_)->internal_data);
+#endif
+
 /**
  * @brief 引数のNULLチェックを行い、NULLであればワーニングを出し、リターンするマクロ
  *
@@ -29,6 +49,21 @@
         return; \
     } \
 
+/**
+ * @brief 自動拡張時、max_element_countが0の場合に確保する要素数
+ *
+ */
+#define DARRAY_GROWTH_INITIAL_COUNT 4
+
+static DYNAMIC_ARRAY_ERROR_CODE darray_create(uint64_t element_size_, uint8_t alignment_requirement_, uint64_t max_element_count_, core_arena_t* const arena_, dynamic_array_t* const dynamic_array_);
+static void* darray_allocate(core_arena_t* const arena_, uint64_t size_, uint8_t alignment_requirement_);
+static void darray_free(core_arena_t* const arena_, void* const ptr_, uint64_t size_);
+static DYNAMIC_ARRAY_ERROR_CODE darray_grow(dynamic_array_internal_data_t* const internal_data_, uint64_t max_element_count_);
+static DYNAMIC_ARRAY_ERROR_CODE darray_ensure_capacity(const char* const func_name_, dynamic_array_internal_data_t* const internal_data_, uint64_t required_count_);
+static DYNAMIC_ARRAY_ERROR_CODE darray_copy_in(const char* const func_name_, const void* const objects_, uint64_t count_, uint64_t element_index_, dynamic_array_internal_data_t* const internal_data_);
+static uint64_t darray_self_offset(const dynamic_array_internal_data_t* const internal_data_, const void* const ptr_);
+static void darray_copy_shifted(const char* const base_, uint64_t src_offset_, uint64_t size_, uint64_t split_, uint64_t shift_, char* dst_);
+
 void dynamic_array_default_create(dynamic_array_t* const dynamic_array_) {
     CHECK_ARG_NULL_RETURN_VOID("dynamic_array_default_create", "dynamic_array_", dynamic_array_);
     dynamic_array_->internal_data = 0;
@@ -36,38 +71,28 @@ void dynamic_array_default_create(dynamic_array_t* const dynamic_array_) {
 
 DYNAMIC_ARRAY_ERROR_CODE dynamic_array_create(uint64_t element_size_, uint8_t alignment_requirement_, uint64_t max_element_count_, dynamic_array_t* const dynamic_array_) {
     CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_create", "dynamic_array_", dynamic_array_);
-    if(0 == element_size_ || 0 == alignment_requirement_) {
-        ERROR_MESSAGE("dynamic_array_create - Arguments element_size_ and alignment_requirement_ require non zero value.");
+    return darray_create(element_size_, alignment_requirement_, max_element_count_, 0, dynamic_array_);
+}
+
+DYNAMIC_ARRAY_ERROR_CODE dynamic_array_create_with_arena(uint64_t element_size_, uint8_t alignment_requirement_, uint64_t max_element_count_, core_arena_t* const arena_, dynamic_array_t* const dynamic_array_) {
+    CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_create_with_arena", "dynamic_array_", dynamic_array_);
+    CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_create_with_arena", "arena_", arena_);
+    if(0 != (alignment_requirement_ & (alignment_requirement_ - 1))) {
+        ERROR_MESSAGE("dynamic_array_create_with_arena - Argument alignment_requirement_ must be a power of two.");
         return DYNAMIC_ARRAY_INVALID_ARGUMENT;
     }
-    dynamic_array_destroy(dynamic_array_);
-    dynamic_array_->internal_data = core_malloc(sizeof(dynamic_array_internal_data_t));
-    if(0 == dynamic_array_->internal_data) {
-        ERROR_MESSAGE("dynamic_array_create - Failed to allocate internal_data memory.");
-        return DYNAMIC_ARRAY_MEMORY_ALLOCATE_ERROR;
-    }
-    core_zero_memory(dynamic_array_->internal_data, sizeof(dynamic_array_internal_data_t));
-    dynamic_array_internal_data_t* internal_data = (dynamic_array_internal_data_t*)(dynamic_array_->internal_data);
-    internal_data->alignment_requirement = alignment_requirement_;
-    internal_data->element_size = element_size_;
-    internal_data->max_element_count = max_element_count_;
-
-    uint64_t diff = element_size_ % internal_data->alignment_requirement;   // アライメントのズレ量
-    uint64_t padding_size = internal_data->alignment_requirement - diff;    // パディングサイズ
-    padding_size = padding_size % internal_data->alignment_requirement;     // ピッタリの時のために計算
-    internal_data->aligned_element_size = internal_data->element_size + padding_size;
-
-    return dynamic_array_reserve(max_element_count_, dynamic_array_);
+    return darray_create(element_size_, alignment_requirement_, max_element_count_, arena_, dynamic_array_);
 }
 
 void dynamic_array_destroy(dynamic_array_t* const dynamic_array_) {
     CHECK_ARG_NULL_RETURN_VOID("dynamic_array_destroy", "dynamic_array_", dynamic_array_);
     if(0 != dynamic_array_->internal_data) {
         dynamic_array_internal_data_t* internal_data = (dynamic_array_internal_data_t*)(dynamic_array_->internal_data);
-        core_free(internal_data->memory_pool);
+        core_arena_t* arena = internal_data->arena;
+        darray_free(arena, internal_data->memory_pool, internal_data->buffer_capacity);
         internal_data->memory_pool = 0;
+        darray_free(arena, dynamic_array_->internal_data, sizeof(dynamic_array_internal_data_t));
     }
-    core_free(dynamic_array_->internal_data);
     dynamic_array_->internal_data = 0;
 }
 
@@ -77,21 +102,27 @@ DYNAMIC_ARRAY_ERROR_CODE dynamic_array_reserve(uint64_t max_element_count_, dyna
         WARN_MESSAGE("dynamic_array_reserve - Argument max_element_count_ is 0. Nothing to be done.");
         return DYNAMIC_ARRAY_SUCCESS;
     }
-    if(0 != dynamic_array_->internal_data) {
-        dynamic_array_internal_data_t* internal_data = (dynamic_array_internal_data_t*)(dynamic_array_->internal_data);
-        core_free(internal_data->memory_pool);
-        internal_data->memory_pool = 0;
-        internal_data->buffer_capacity = 0;
-        internal_data->element_count = 0;
-    }
+    CHECK_DARRAY_VALID_RETURN_ERROR("dynamic_array_reserve", dynamic_array_);
     dynamic_array_internal_data_t* internal_data = (dynamic_array_internal_data_t*)(dynamic_array_->internal_data);
-    internal_data->memory_pool = core_malloc(internal_data->max_element_count * internal_data->aligned_element_size);
+    if(internal_data->aligned_element_size > (UINT64_MAX / max_element_count_)) {
+        ERROR_MESSAGE("dynamic_array_reserve - Provided max_element_count_ is too big.");
+        return DYNAMIC_ARRAY_INVALID_ARGUMENT;
+    }
+    darray_free(internal_data->arena, internal_data->memory_pool, internal_data->buffer_capacity);
+    internal_data->memory_pool = 0;
+    internal_data->buffer_capacity = 0;
+    internal_data->element_count = 0;
+
+    const uint64_t buffer_capacity = max_element_count_ * internal_data->aligned_element_size;
+    internal_data->memory_pool = darray_allocate(internal_data->arena, buffer_capacity, internal_data->alignment_requirement);
     if(0 == internal_data->memory_pool) {
         ERROR_MESSAGE("dynamic_array_reserve - Failed to allocate memory_pool memory.");
+        internal_data->max_element_count = 0;
         return DYNAMIC_ARRAY_MEMORY_ALLOCATE_ERROR;
     }
-    core_zero_memory(internal_data->memory_pool, internal_data->max_element_count * internal_data->aligned_element_size);
-    internal_data->buffer_capacity = internal_data->max_element_count * internal_data->aligned_element_size;
+    core_zero_memory(internal_data->memory_pool, buffer_capacity);
+    internal_data->buffer_capacity = buffer_capacity;
+    internal_data->max_element_count = max_element_count_;
     return DYNAMIC_ARRAY_SUCCESS;
 }
 
@@ -109,90 +140,140 @@ DYNAMIC_ARRAY_ERROR_CODE dynamic_array_resize(uint64_t max_element_count_, dynam
         ERROR_MESSAGE("dynamic_array_resize - Cannot resize to smaller max_element_count than current element_count.");
         return DYNAMIC_ARRAY_INVALID_ARGUMENT;
     }
-    char* buffer = core_malloc(internal_data->buffer_capacity);
-    if(0 == buffer) {
-        ERROR_MESSAGE("dynamic_array_resize - Failed to allocate swap memory.");
-        return DYNAMIC_ARRAY_MEMORY_ALLOCATE_ERROR;
-    }
-    char* src_ptr = (char*)(internal_data->memory_pool);
-    const uint64_t copy_size = internal_data->element_count * internal_data->aligned_element_size;
-    for(uint64_t i = 0; i != copy_size; ++i) {
-        buffer[i] = src_ptr[i];
+    return darray_grow(internal_data, max_element_count_);
+}
+
+DYNAMIC_ARRAY_ERROR_CODE dynamic_array_growth_policy_set(uint16_t growth_factor_percent_, dynamic_array_t* const dynamic_array_) {
+    CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_growth_policy_set", "dynamic_array_", dynamic_array_);
+    if(0 != growth_factor_percent_ && growth_factor_percent_ <= 100) {
+        ERROR_MESSAGE("dynamic_array_growth_policy_set - Argument growth_factor_percent_ must be 0 or greater than 100.");
+        return DYNAMIC_ARRAY_INVALID_ARGUMENT;
     }
-    core_free(internal_data->memory_pool);
-    internal_data->memory_pool = 0;
-    const uint64_t escape_count = internal_data->element_count;
-    DYNAMIC_ARRAY_ERROR_CODE result_reserve = dynamic_array_reserve(max_element_count_, dynamic_array_);
-    if(DYNAMIC_ARRAY_SUCCESS != result_reserve) {
-        ERROR_MESSAGE("dynamic_array_resize - Failed to reserve memory_pool.");
-        core_free(buffer);
-        return result_reserve;
-    }
-    char* dst_ptr = (char*)(internal_data->memory_pool);
-    for(uint64_t i = 0; i != internal_data->buffer_capacity; ++i) {
-        dst_ptr[i] = buffer[i];
-    }
-    core_free(buffer);
-    internal_data->element_count = escape_count;
-    internal_data->max_element_count = max_element_count_;
+    CHECK_DARRAY_VALID_RETURN_ERROR("dynamic_array_growth_policy_set", dynamic_array_);
+    dynamic_array_internal_data_t* internal_data = (dynamic_array_internal_data_t*)(dynamic_array_->internal_data);
+    internal_data->growth_factor_percent = growth_factor_percent_;
     return DYNAMIC_ARRAY_SUCCESS;
 }
 
 DYNAMIC_ARRAY_ERROR_CODE dynamic_array_capacity(const dynamic_array_t* const dynamic_array_, uint64_t* const out_capacity_) {
     CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_capacity", "dynamic_array_", dynamic_array_);
     CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_capacity", "out_capacity_", out_capacity_);
-    if(0 == dynamic_array_->internal_data) {
-        ERROR_MESSAGE("dynamic_array_capacity - Provided dynamic_array_ is not initialized. Call dynamic_array_create.");
-        return DYNAMIC_ARRAY_INVALID_DARRAY;
-    } else {
-        dynamic_array_internal_data_t* internal_data = (dynamic_array_internal_data_t*)(dynamic_array_->internal_data);
-        *out_capacity_ = internal_data->buffer_capacity / internal_data->aligned_element_size;
-        return DYNAMIC_ARRAY_SUCCESS;
-    }
+    CHECK_DARRAY_VALID_RETURN_ERROR("dynamic_array_capacity", dynamic_array_);
+    dynamic_array_internal_data_t* internal_data = (dynamic_array_internal_data_t*)(dynamic_array_->internal_data);
+    *out_capacity_ = internal_data->buffer_capacity / internal_data->aligned_element_size;
+    return DYNAMIC_ARRAY_SUCCESS;
 }
 
 DYNAMIC_ARRAY_ERROR_CODE dynamic_array_size(const dynamic_array_t* const dynamic_array_, uint64_t* const out_size_) {
     CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_size", "dynamic_array_", dynamic_array_);
     CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_size", "out_size_", out_size_);
-    if(0 == dynamic_array_->internal_data) {
-        ERROR_MESSAGE("dynamic_array_size - Provided dynamic_array_ is not initialized. Call dynamic_array_create.");
-        return DYNAMIC_ARRAY_INVALID_DARRAY;
-    } else {
-        dynamic_array_internal_data_t* internal_data = (dynamic_array_internal_data_t*)(dynamic_array_->internal_data);
-        *out_size_ = internal_data->element_count;
-        return DYNAMIC_ARRAY_SUCCESS;
-    }
+    CHECK_DARRAY_VALID_RETURN_ERROR("dynamic_array_size", dynamic_array_);
+    dynamic_array_internal_data_t* internal_data = (dynamic_array_internal_data_t*)(dynamic_array_->internal_data);
+    *out_size_ = internal_data->element_count;
+    return DYNAMIC_ARRAY_SUCCESS;
 }
 
 DYNAMIC_ARRAY_ERROR_CODE dynamic_array_element_push(const void* const object_, dynamic_array_t* const dynamic_array_) {
     CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_element_push", "dynamic_array_", dynamic_array_);
     CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_element_push", "object_", object_);
-    if(0 == dynamic_array_->internal_data) {
-        ERROR_MESSAGE("dynamic_array_element_push - Provided dynamic_array_ is not initialized. Call dynamic_array_create.");
-        return DYNAMIC_ARRAY_INVALID_DARRAY;
-    } else {
-        dynamic_array_internal_data_t* internal_data = (dynamic_array_internal_data_t*)(dynamic_array_->internal_data);
-        if(internal_data->element_count == internal_data->max_element_count) {
-            ERROR_MESSAGE("dynamic_array_element_push - Dynamic array buffer full.");
-            return DYNAMIC_ARRAY_BUFFER_FULL;
+    CHECK_DARRAY_VALID_RETURN_ERROR("dynamic_array_element_push", dynamic_array_);
+    dynamic_array_internal_data_t* internal_data = (dynamic_array_internal_data_t*)(dynamic_array_->internal_data);
+    const char* src_ptr = (const char*)object_;
+    if(internal_data->element_count == internal_data->max_element_count) {
+        // 拡張でバッファが移動するため、自身の要素を指している場合は位置を保持しておく
+        const uint64_t self_offset = darray_self_offset(internal_data, object_);
+        const DYNAMIC_ARRAY_ERROR_CODE result_capacity = darray_ensure_capacity("dynamic_array_element_push", internal_data, internal_data->element_count + 1);
+        if(DYNAMIC_ARRAY_SUCCESS != result_capacity) {
+            return result_capacity;
         }
-        char* dst_ptr = (char*)(internal_data->memory_pool + (internal_data->aligned_element_size * internal_data->element_count));
-        char* src_ptr = (char*)object_;
-        for(uint64_t i = 0; i != internal_data->element_size; ++i) {
-            dst_ptr[i] = src_ptr[i];
+        if(INVALID_VALUE_U64 != self_offset) {
+            src_ptr = (const char*)(internal_data->memory_pool) + self_offset;
         }
-        internal_data->element_count++;
     }
+    char* dst_ptr = (char*)(internal_data->memory_pool + (internal_data->aligned_element_size * internal_data->element_count));
+    core_copy_memory(src_ptr, dst_ptr, internal_data->element_size);
+    internal_data->element_count++;
+    return DYNAMIC_ARRAY_SUCCESS;
+}
+
+DYNAMIC_ARRAY_ERROR_CODE dynamic_array_element_push_n(const void* const objects_, uint64_t count_, dynamic_array_t* const dynamic_array_) {
+    CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_element_push_n", "dynamic_array_", dynamic_array_);
+    CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_element_push_n", "objects_", objects_);
+    CHECK_DARRAY_VALID_RETURN_ERROR("dynamic_array_element_push_n", dynamic_array_);
+    dynamic_array_internal_data_t* internal_data = (dynamic_array_internal_data_t*)(dynamic_array_->internal_data);
+    return darray_copy_in("dynamic_array_element_push_n", objects_, count_, internal_data->element_count, internal_data);
+}
+
+DYNAMIC_ARRAY_ERROR_CODE dynamic_array_element_insert(uint64_t element_index_, const void* const objects_, uint64_t count_, dynamic_array_t* const dynamic_array_) {
+    CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_element_insert", "dynamic_array_", dynamic_array_);
+    CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_element_insert", "objects_", objects_);
+    CHECK_DARRAY_VALID_RETURN_ERROR("dynamic_array_element_insert", dynamic_array_);
+    dynamic_array_internal_data_t* internal_data = (dynamic_array_internal_data_t*)(dynamic_array_->internal_data);
+    if(element_index_ > internal_data->element_count) {
+        ERROR_MESSAGE("dynamic_array_element_insert - Requested element_index_ is out of range.");
+        return DYNAMIC_ARRAY_OUT_OF_RANGE;
+    }
+    return darray_copy_in("dynamic_array_element_insert", objects_, count_, element_index_, internal_data);
+}
+
+DYNAMIC_ARRAY_ERROR_CODE dynamic_array_element_erase(uint64_t element_index_, uint64_t count_, dynamic_array_t* const dynamic_array_) {
+    CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_element_erase", "dynamic_array_", dynamic_array_);
+    CHECK_DARRAY_VALID_RETURN_ERROR("dynamic_array_element_erase", dynamic_array_);
+    dynamic_array_internal_data_t* internal_data = (dynamic_array_internal_data_t*)(dynamic_array_->internal_data);
+    if(element_index_ > internal_data->element_count || count_ > (internal_data->element_count - element_index_)) {
+        ERROR_MESSAGE("dynamic_array_element_erase - Requested range is out of range.");
+        return DYNAMIC_ARRAY_OUT_OF_RANGE;
+    }
+    if(0 == count_) {
+        return DYNAMIC_ARRAY_SUCCESS;
+    }
+    // 削除範囲より後ろの要素を前に詰め、空いた末尾を0クリアする(未使用領域は常に0を保つ)
+    char* base = (char*)(internal_data->memory_pool);
+    const uint64_t stride = internal_data->aligned_element_size;
+    const uint64_t tail_count = internal_data->element_count - element_index_ - count_;
+    core_move_memory(base + (element_index_ + count_) * stride, base + element_index_ * stride, tail_count * stride);
+    core_zero_memory(base + (element_index_ + tail_count) * stride, count_ * stride);
+    internal_data->element_count -= count_;
+    return DYNAMIC_ARRAY_SUCCESS;
+}
+
+DYNAMIC_ARRAY_ERROR_CODE dynamic_array_append(const dynamic_array_t* const src_, dynamic_array_t* const dst_) {
+    CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_append", "src_", src_);
+    CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_append", "dst_", dst_);
+    if(0 == src_->internal_data || 0 == dst_->internal_data) {
+        ERROR_MESSAGE("dynamic_array_append - Provided dynamic_array is not initialized. Call dynamic_array_create.");
+        return DYNAMIC_ARRAY_INVALID_DARRAY;
+    }
+    const dynamic_array_internal_data_t* src_internal_data = (const dynamic_array_internal_data_t*)(src_->internal_data);
+    dynamic_array_internal_data_t* dst_internal_data = (dynamic_array_internal_data_t*)(dst_->internal_data);
+    if(src_internal_data->element_size != dst_internal_data->element_size || src_internal_data->aligned_element_size != dst_internal_data->aligned_element_size) {
+        ERROR_MESSAGE("dynamic_array_append - Element layouts of src_ and dst_ do not match.");
+        return DYNAMIC_ARRAY_INVALID_ARGUMENT;
+    }
+    const uint64_t src_count = src_internal_data->element_count;
+    if(0 == src_count) {
+        return DYNAMIC_ARRAY_SUCCESS;
+    }
+    if(src_count > (UINT64_MAX - dst_internal_data->element_count)) {
+        ERROR_MESSAGE("dynamic_array_append - Resulting element count is too big.");
+        return DYNAMIC_ARRAY_INVALID_ARGUMENT;
+    }
+    const DYNAMIC_ARRAY_ERROR_CODE result_capacity = darray_ensure_capacity("dynamic_array_append", dst_internal_data, dst_internal_data->element_count + src_count);
+    if(DYNAMIC_ARRAY_SUCCESS != result_capacity) {
+        return result_capacity;
+    }
+    // src_とdst_が同一の場合、拡張によってsrc側のバッファも移動しているため、拡張後に参照する
+    const uint64_t stride = dst_internal_data->aligned_element_size;
+    char* dst_ptr = (char*)(dst_internal_data->memory_pool) + dst_internal_data->element_count * stride;
+    core_copy_memory(src_internal_data->memory_pool, dst_ptr, src_count * stride);
+    dst_internal_data->element_count += src_count;
     return DYNAMIC_ARRAY_SUCCESS;
 }
 
 DYNAMIC_ARRAY_ERROR_CODE dynamic_array_element_ref(uint64_t element_index_, const dynamic_array_t* const dynamic_array_, void* const out_object_) {
     CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_element_ref", "dynamic_array_", dynamic_array_);
     CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_element_ref", "out_object_", out_object_);
-    if(0 == dynamic_array_->internal_data) {
-        ERROR_MESSAGE("dynamic_array_element_ref - Provided dynamic_array_ is not initialized.");
-        return DYNAMIC_ARRAY_INVALID_DARRAY;
-    }
+    CHECK_DARRAY_VALID_RETURN_ERROR("dynamic_array_element_ref", dynamic_array_);
     dynamic_array_internal_data_t* internal_data = (dynamic_array_internal_data_t*)(dynamic_array_->internal_data);
     if(element_index_ >= internal_data->element_count) {
         ERROR_MESSAGE("dynamic_array_element_ref - Requested element_index_ is out of range.");
@@ -200,30 +281,258 @@ DYNAMIC_ARRAY_ERROR_CODE dynamic_array_element_ref(uint64_t element_index_, cons
     }
     char* base = (char*)(internal_data->memory_pool);
     char* src_ptr = base + (internal_data->aligned_element_size * element_index_);
-    char* dst_ptr = (char*)(out_object_);
-    for(uint64_t i = 0; i != internal_data->aligned_element_size; ++i) {
-        dst_ptr[i] = src_ptr[i];
-    }
+    core_copy_memory(src_ptr, out_object_, internal_data->element_size);
     return DYNAMIC_ARRAY_SUCCESS;
 }
 
 DYNAMIC_ARRAY_ERROR_CODE dynamic_array_element_set(uint64_t element_index_, void* object_, dynamic_array_t* const dynamic_array_) {
     CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_element_set", "dynamic_array_", dynamic_array_);
     CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_element_set", "object_", object_);
-    if(0 == dynamic_array_->internal_data) {
-        ERROR_MESSAGE("dynamic_array_element_set - Provided dynamic_array_ is not initialized.");
-        return DYNAMIC_ARRAY_INVALID_DARRAY;
-    }
+    CHECK_DARRAY_VALID_RETURN_ERROR("dynamic_array_element_set", dynamic_array_);
     dynamic_array_internal_data_t* internal_data = (dynamic_array_internal_data_t*)(dynamic_array_->internal_data);
     if(element_index_ >= internal_data->element_count) {
         ERROR_MESSAGE("dynamic_array_element_set - Requested element_index_ is out of range.");
         return DYNAMIC_ARRAY_OUT_OF_RANGE;
     }
 
-    char* src_ptr = (char*)(object_);
     char* dst_ptr = internal_data->memory_pool + (internal_data->aligned_element_size * element_index_);
-    for(uint64_t i = 0; i != internal_data->element_size; ++i) {
-        dst_ptr[i] = src_ptr[i];
+    core_copy_memory(object_, dst_ptr, internal_data->element_size);
+    return DYNAMIC_ARRAY_SUCCESS;
+}
+
+DYNAMIC_ARRAY_ERROR_CODE dynamic_array_element_ptr(uint64_t element_index_, dynamic_array_t* const dynamic_array_, void** const out_ptr_) {
+    CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_element_ptr", "dynamic_array_", dynamic_array_);
+    CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_element_ptr", "out_ptr_", out_ptr_);
+    CHECK_DARRAY_VALID_RETURN_ERROR("dynamic_array_element_ptr", dynamic_array_);
+    dynamic_array_internal_data_t* internal_data = (dynamic_array_internal_data_t*)(dynamic_array_->internal_data);
+    if(element_index_ >= internal_data->element_count) {
+        ERROR_MESSAGE("dynamic_array_element_ptr - Requested element_index_ is out of range.");
+        return DYNAMIC_ARRAY_OUT_OF_RANGE;
+    }
+    *out_ptr_ = (char*)(internal_data->memory_pool) + (internal_data->aligned_element_size * element_index_);
+    return DYNAMIC_ARRAY_SUCCESS;
+}
+
+DYNAMIC_ARRAY_ERROR_CODE dynamic_array_element_const_ptr(uint64_t element_index_, const dynamic_array_t* const dynamic_array_, const void** const out_ptr_) {
+    CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_element_const_ptr", "dynamic_array_", dynamic_array_);
+    CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_element_const_ptr", "out_ptr_", out_ptr_);
+    CHECK_DARRAY_VALID_RETURN_ERROR("dynamic_array_element_const_ptr", dynamic_array_);
+    const dynamic_array_internal_data_t* internal_data = (const dynamic_array_internal_data_t*)(dynamic_array_->internal_data);
+    if(element_index_ >= internal_data->element_count) {
+        ERROR_MESSAGE("dynamic_array_element_const_ptr - Requested element_index_ is out of range.");
+        return DYNAMIC_ARRAY_OUT_OF_RANGE;
     }
+    *out_ptr_ = (const char*)(internal_data->memory_pool) + (internal_data->aligned_element_size * element_index_);
+    return DYNAMIC_ARRAY_SUCCESS;
+}
+
+DYNAMIC_ARRAY_ERROR_CODE dynamic_array_data(dynamic_array_t* const dynamic_array_, void** const out_data_, uint64_t* const out_stride_) {
+    CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_data", "dynamic_array_", dynamic_array_);
+    CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_data", "out_data_", out_data_);
+    CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_data", "out_stride_", out_stride_);
+    CHECK_DARRAY_VALID_RETURN_ERROR("dynamic_array_data", dynamic_array_);
+    dynamic_array_internal_data_t* internal_data = (dynamic_array_internal_data_t*)(dynamic_array_->internal_data);
+    *out_data_ = internal_data->memory_pool;
+    *out_stride_ = internal_data->aligned_element_size;
+    return DYNAMIC_ARRAY_SUCCESS;
+}
+
+DYNAMIC_ARRAY_ERROR_CODE dynamic_array_span(dynamic_array_t* const dynamic_array_, dynamic_array_span_t* const out_span_) {
+    CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_span", "dynamic_array_", dynamic_array_);
+    CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_span", "out_span_", out_span_);
+    CHECK_DARRAY_VALID_RETURN_ERROR("dynamic_array_span", dynamic_array_);
+    dynamic_array_internal_data_t* internal_data = (dynamic_array_internal_data_t*)(dynamic_array_->internal_data);
+    char* begin = (char*)(internal_data->memory_pool);
+    out_span_->begin = begin;
+    out_span_->end = (0 == begin) ? begin : begin + (internal_data->aligned_element_size * internal_data->element_count);  // NULLへの加算を避ける
+    out_span_->stride = internal_data->aligned_element_size;
+    out_span_->count = internal_data->element_count;
     return DYNAMIC_ARRAY_SUCCESS;
 }
+
+DYNAMIC_ARRAY_ERROR_CODE dynamic_array_const_span(const dynamic_array_t* const dynamic_array_, dynamic_array_const_span_t* const out_span_) {
+    CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_const_span", "dynamic_array_", dynamic_array_);
+    CHECK_ARG_NULL_RETURN_ERROR("dynamic_array_const_span", "out_span_", out_span_);
+    CHECK_DARRAY_VALID_RETURN_ERROR("dynamic_array_const_span", dynamic_array_);
+    const dynamic_array_internal_data_t* internal_data = (const dynamic_array_internal_data_t*)(dynamic_array_->internal_data);
+    const char* begin = (const char*)(internal_data->memory_pool);
+    out_span_->begin = begin;
+    out_span_->end = (0 == begin) ? begin : begin + (internal_data->aligned_element_size * internal_data->element_count);
+    out_span_->stride = internal_data->aligned_element_size;
+    out_span_->count = internal_data->element_count;
+    return DYNAMIC_ARRAY_SUCCESS;
+}
+
+// dynamic_array_create / dynamic_array_create_with_arenaの共通処理(arena_がNULLの場合はヒープから確保する)
+static DYNAMIC_ARRAY_ERROR_CODE darray_create(uint64_t element_size_, uint8_t alignment_requirement_, uint64_t max_element_count_, core_arena_t* const arena_, dynamic_array_t* const dynamic_array_) {
+    if(0 == element_size_ || 0 == alignment_requirement_) {
+        ERROR_MESSAGE("dynamic_array_create - Arguments element_size_ and alignment_requirement_ require non zero value.");
+        return DYNAMIC_ARRAY_INVALID_ARGUMENT;
+    }
+    dynamic_array_destroy(dynamic_array_);
+    dynamic_array_->internal_data = darray_allocate(arena_, sizeof(dynamic_array_internal_data_t), alignof(dynamic_array_internal_data_t));
+    if(0 == dynamic_array_->internal_data) {
+        ERROR_MESSAGE("dynamic_array_create - Failed to allocate internal_data memory.");
+        return DYNAMIC_ARRAY_MEMORY_ALLOCATE_ERROR;
+    }
+    core_zero_memory(dynamic_array_->internal_data, sizeof(dynamic_array_internal_data_t));
+    dynamic_array_internal_data_t* internal_data = (dynamic_array_internal_data_t*)(dynamic_array_->internal_data);
+    internal_data->alignment_requirement = alignment_requirement_;
+    internal_data->element_size = element_size_;
+    internal_data->max_element_count = max_element_count_;
+    internal_data->arena = arena_;
+
+    uint64_t diff = element_size_ % internal_data->alignment_requirement;   // アライメントのズレ量
+    uint64_t padding_size = internal_data->alignment_requirement - diff;    // パディングサイズ
+    padding_size = padding_size % internal_data->alignment_requirement;     // ピッタリの時のために計算
+    internal_data->aligned_element_size = internal_data->element_size + padding_size;
+
+    return dynamic_array_reserve(max_element_count_, dynamic_array_);
+}
+
+// 格納済みの要素を保持したまま、バッファをmax_element_count_個分に再確保する
+// ヒープの場合はrealloc相当で1回のみ移動し、アリーナの場合は新領域へコピーする(旧領域はアリーナのリセットまで残る)
+static DYNAMIC_ARRAY_ERROR_CODE darray_grow(dynamic_array_internal_data_t* const internal_data_, uint64_t max_element_count_) {
+    if(internal_data_->aligned_element_size > (UINT64_MAX / max_element_count_)) {
+        ERROR_MESSAGE("darray_grow - Provided max_element_count_ is too big.");
+        return DYNAMIC_ARRAY_INVALID_ARGUMENT;
+    }
+    const uint64_t new_capacity = max_element_count_ * internal_data_->aligned_element_size;
+    const uint64_t used_size = internal_data_->element_count * internal_data_->aligned_element_size;
+    char* new_pool = 0;
+    if(0 == internal_data_->arena) {
+        new_pool = core_realloc_tagged(internal_data_->memory_pool, internal_data_->buffer_capacity, new_capacity, MEMORY_TAG_DARRAY);
+    } else {
+        new_pool = darray_allocate(internal_data_->arena, new_capacity, internal_data_->alignment_requirement);
+        if(0 != new_pool && 0 != used_size) {
+            core_copy_memory(internal_data_->memory_pool, new_pool, used_size);
+        }
+    }
+    if(0 == new_pool) {
+        ERROR_MESSAGE("darray_grow - Failed to allocate new memory_pool.");
+        return DYNAMIC_ARRAY_MEMORY_ALLOCATE_ERROR;
+    }
+    core_zero_memory(new_pool + used_size, new_capacity - used_size);
+    internal_data_->memory_pool = new_pool;
+    internal_data_->buffer_capacity = new_capacity;
+    internal_data_->max_element_count = max_element_count_;
+    return DYNAMIC_ARRAY_SUCCESS;
+}
+
+// required_count_個の要素を格納できるよう、必要に応じて拡張率に従ってバッファを拡張する
+// 自動拡張が無効でバッファが不足する場合はDYNAMIC_ARRAY_BUFFER_FULLを返す
+static DYNAMIC_ARRAY_ERROR_CODE darray_ensure_capacity(const char* const func_name_, dynamic_array_internal_data_t* const internal_data_, uint64_t required_count_) {
+    if(required_count_ <= internal_data_->max_element_count) {
+        return DYNAMIC_ARRAY_SUCCESS;
+    }
+    if(0 == internal_data_->growth_factor_percent) {
+        ERROR_MESSAGE("%s - Dynamic array buffer full.", func_name_);
+        return DYNAMIC_ARRAY_BUFFER_FULL;
+    }
+    uint64_t next_count = (0 == internal_data_->max_element_count) ? DARRAY_GROWTH_INITIAL_COUNT : internal_data_->max_element_count;
+    while(next_count < required_count_) {
+        if(next_count > (UINT64_MAX / internal_data_->growth_factor_percent)) {
+            next_count = required_count_;   // これ以上拡張率を掛けられない場合は必要な分のみ確保する
+            break;
+        }
+        const uint64_t grown_count = next_count * internal_data_->growth_factor_percent / 100;
+        next_count = (grown_count <= next_count) ? (next_count + 1) : grown_count;  // 要素数が少なく拡張率を掛けても増えない場合
+    }
+    const DYNAMIC_ARRAY_ERROR_CODE result_grow = darray_grow(internal_data_, next_count);
+    if(DYNAMIC_ARRAY_SUCCESS != result_grow) {
+        ERROR_MESSAGE("%s - Failed to grow buffer.", func_name_);
+    }
+    return result_grow;
+}
+
+// 連続したcount_個のオブジェクトobjects_をelement_index_の位置に挿入する(後続の要素は後ろにずらす)
+// 容量確認は1回のみ行い、要素サイズとアライメント後のサイズが等しい場合は1回のコピーで格納する
+static DYNAMIC_ARRAY_ERROR_CODE darray_copy_in(const char* const func_name_, const void* const objects_, uint64_t count_, uint64_t element_index_, dynamic_array_internal_data_t* const internal_data_) {
+    if(0 == count_) {
+        return DYNAMIC_ARRAY_SUCCESS;
+    }
+    if(count_ > (UINT64_MAX - internal_data_->element_count)) {
+        ERROR_MESSAGE("%s - Resulting element count is too big.", func_name_);
+        return DYNAMIC_ARRAY_INVALID_ARGUMENT;
+    }
+    // objects_が自身の要素を指している場合、拡張でバッファが移動するため先頭からの位置を保持しておく
+    const uint64_t self_offset = darray_self_offset(internal_data_, objects_);
+    const DYNAMIC_ARRAY_ERROR_CODE result_capacity = darray_ensure_capacity(func_name_, internal_data_, internal_data_->element_count + count_);
+    if(DYNAMIC_ARRAY_SUCCESS != result_capacity) {
+        return result_capacity;
+    }
+    char* base = (char*)(internal_data_->memory_pool);
+    const uint64_t stride = internal_data_->aligned_element_size;
+    const uint64_t tail_count = internal_data_->element_count - element_index_;
+    if(0 != tail_count) {
+        core_move_memory(base + element_index_ * stride, base + (element_index_ + count_) * stride, tail_count * stride);
+    }
+    char* dst_ptr = base + element_index_ * stride;
+    const uint64_t element_size = internal_data_->element_size;
+    if(INVALID_VALUE_U64 != self_offset) {
+        // 挿入位置以降の入力は後ろにずらした位置から読む(入力と挿入先は重ならない)
+        const uint64_t split = element_index_ * stride;
+        const uint64_t shift = count_ * stride;
+        if(element_size == stride) {
+            darray_copy_shifted(base, self_offset, count_ * stride, split, shift, dst_ptr);
+        } else {
+            for(uint64_t i = 0; i != count_; ++i) {
+                darray_copy_shifted(base, self_offset + i * element_size, element_size, split, shift, dst_ptr + i * stride);
+            }
+        }
+    } else if(element_size == stride) {
+        core_copy_memory(objects_, dst_ptr, count_ * stride);
+    } else {
+        // 入力は要素サイズ間隔で詰まっているため、パディング分を空けながらコピーする(パディング領域は常に0のまま)
+        const char* src_ptr = (const char*)objects_;
+        for(uint64_t i = 0; i != count_; ++i) {
+            core_copy_memory(src_ptr + i * element_size, dst_ptr + i * stride, element_size);
+        }
+    }
+    internal_data_->element_count += count_;
+    return DYNAMIC_ARRAY_SUCCESS;
+}
+
+// ptr_が格納済みの要素の範囲内を指していればバッファ先頭からのオフセットを、そうでなければINVALID_VALUE_U64を返す
+static uint64_t darray_self_offset(const dynamic_array_internal_data_t* const internal_data_, const void* const ptr_) {
+    const char* base = (const char*)(internal_data_->memory_pool);
+    const char* ptr = (const char*)ptr_;
+    if(0 == base || ptr < base || ptr >= base + internal_data_->element_count * internal_data_->aligned_element_size) {
+        return INVALID_VALUE_U64;
+    }
+    return (uint64_t)(ptr - base);
+}
+
+// 挿入前のオフセットsrc_offset_からsize_ byteをdst_にコピーする
+// 挿入前のsplit_以降の領域はshift_ byte後ろへ移動済みのため、その部分は移動先から読む
+static void darray_copy_shifted(const char* const base_, uint64_t src_offset_, uint64_t size_, uint64_t split_, uint64_t shift_, char* dst_) {
+    if(src_offset_ < split_) {
+        const uint64_t head = (size_ < split_ - src_offset_) ? size_ : (split_ - src_offset_);
+        core_copy_memory(base_ + src_offset_, dst_, head);
+        src_offset_ += head;
+        dst_ += head;
+        size_ -= head;
+    }
+    if(0 != size_) {
+        core_copy_memory(base_ + src_offset_ + shift_, dst_, size_);
+    }
+}
+
+// arena_が指定されていればアリーナから、そうでなければヒープからメモリを確保する
+static void* darray_allocate(core_arena_t* const arena_, uint64_t size_, uint8_t alignment_requirement_) {
+    if(0 == arena_) {
+        return core_malloc_tagged(size_, MEMORY_TAG_DARRAY);
+    }
+    void* ptr = 0;
+    if(CORE_MEMORY_SUCCESS != core_arena_allocate(size_, alignment_requirement_, arena_, &ptr)) {
+        return 0;
+    }
+    return ptr;
+}
+
+// アリーナから確保した領域はcore_arena_reset()で一括破棄されるため、ヒープから確保した領域のみ解放する
+static void darray_free(core_arena_t* const arena_, void* const ptr_, uint64_t size_) {
+    if(0 == arena_) {
+        core_free_tagged(ptr_, size_, MEMORY_TAG_DARRAY);
+    }
+}
@@ -0,0 +1,587 @@
+/**
+ * @file hash_map.c
+ * @author chocolate-pie24
+ * @brief ハッシュマップオブジェクト(hash_map_t)用API関数の実装ファイル
+ *
+ * @details
+ * Swiss Table方式のオープンアドレス法で実装する。
+ * - 制御バイト: 空き(HASH_MAP_CTRL_EMPTY)、削除済み(HASH_MAP_CTRL_DELETED)、使用中(ハッシュ値の下位7bit、最上位bitは0)
+ * - ハッシュ値の上位57bitで最初に調べるグループを決め、グループ単位の三角数列(1, 2, 3, ...個先)で探索する。
+ *   グループ数は2の冪乗のため、全てのグループを1回ずつ調べる
+ * - 検索は空きスロットを含むグループで打ち切る。削除時、同じグループに空きスロットがあれば
+ *   そのグループより先へ探索が進むことはないため、削除済みではなく空きに戻す
+ * - グループ内の比較は、core_string_kernel.cと同様に命令セットごとの一致判定とビットマスク化で行う
+ *   (SSE2: 16スロット / 1bit、NEON: 16スロット / 4bit、SWAR: 8スロット / 8bit)
+ *
+ * @version 0.1
+ * @date 2025-08-15
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#define MESSAGE_MODULE_NAME HASH_MAP // メッセージ出力元モジュール(message.hより前に定義する)
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdalign.h>
+#include <string.h> // for memcpy, memcmp, memset
+
+#include "define.h"
+
+#include "containers/hash_map.h"
+
+#include "internal/hash_map_internal_data.h"
+#include "internal/core_string_kernel.h"
+
+#include "core/message.h"
+#include "core/core_memory.h"
+#include "core/core_hash.h"
+#include "core/core_string.h"
+#include "core/core_string_view.h"
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+    #define HASH_MAP_GROUP_SSE2 1
+#elif defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define HASH_MAP_GROUP_NEON 1
+#else
+    #define HASH_MAP_GROUP_WORD 1
+#endif
+
+#if ENABLE_ARGUMENT_CHECK
+#define CHECK_ARG_NULL_RETURN_ERROR(func_name_, arg_name_, ptr_) \
+    if(0 == ptr_) { \
+        ERROR_MESSAGE("%s - Argument %s requires a valid pointer.", func_name_, arg_name_); \
+        return HASH_MAP_INVALID_ARGUMENT; \
+    } \
+
+#define CHECK_VALID_MAP_RETURN_ERROR(func_name_, map_) \
+    if(0 == (map_)->internal_data) { \
+        ERROR_MESSAGE("%s - Provided map is not initialized. Call hash_map_create.", func_name_); \
+        return HASH_MAP_INVALID_MAP; \
+    } \
+
+#else
+#define CHECK_ARG_NULL_RETURN_ERROR(func_name_, arg_name_, ptr_) DEBUG_ASSERT(0 != (ptr_));
+#define CHECK_VALID_MAP_RETURN_ERROR(func_name_, map_) DEBUG_ASSERT(0 != (map_)->internal_data);
+#endif
+
+#define CHECK_ARG_NULL_RETURN_VOID(func_name_, arg_name_, ptr_) \
+    if(0 == ptr_) { \
+        WARN_MESSAGE("%s - Argument %s requires a valid pointer.", func_name_, arg_name_); \
+        return; \
+    } \
+
+/**
+ * @brief 空きスロットの制御バイト
+ *
+ */
+#define HASH_MAP_CTRL_EMPTY ((uint8_t)0x80)
+
+/**
+ * @brief 削除済みスロットの制御バイト
+ *
+ */
+#define HASH_MAP_CTRL_DELETED ((uint8_t)0xFE)
+
+/**
+ * @brief 1グループのスロット数(HASH_MAP_GROUP_WIDTH)と、マスクのビット位置からスロット番号を求めるシフト量(HASH_MAP_GROUP_SHIFT)
+ *
+ */
+#if HASH_MAP_GROUP_SSE2
+    #define HASH_MAP_GROUP_WIDTH 16
+    #define HASH_MAP_GROUP_SHIFT 0
+#elif HASH_MAP_GROUP_NEON
+    #define HASH_MAP_GROUP_WIDTH 16
+    #define HASH_MAP_GROUP_SHIFT 2
+#else
+    #define HASH_MAP_GROUP_WIDTH 8
+    #define HASH_MAP_GROUP_SHIFT 3
+#endif
+
+static void hash_map_free_slots(hash_map_internal_data_t* const internal_data_);
+static HASH_MAP_ERROR_CODE hash_map_create_internal(const char* const func_name_, uint64_t key_size_, uint8_t key_alignment_, uint64_t value_size_, uint8_t value_alignment_, uint64_t max_element_count_, bool string_key_, hash_map_t* const map_);
+static HASH_MAP_ERROR_CODE hash_map_resize(hash_map_internal_data_t* const internal_data_, uint64_t slot_count_);
+static bool hash_map_slot_count_for(uint64_t element_count_, uint64_t* const out_slot_count_);
+static uint64_t hash_map_hash_key(const hash_map_internal_data_t* const internal_data_, const void* const key_);
+static bool hash_map_key_equal(const hash_map_internal_data_t* const internal_data_, const void* const key_, const char* const slot_);
+static uint64_t hash_map_find_slot(const hash_map_internal_data_t* const internal_data_, const void* const key_, uint64_t hash_);
+static uint64_t hash_map_find_free_slot(const hash_map_internal_data_t* const internal_data_, uint64_t hash_);
+static uint64_t hash_map_group_match(const uint8_t* const group_, uint8_t h2_);
+static uint64_t hash_map_group_match_empty(const uint8_t* const group_);
+static uint64_t hash_map_group_match_free(const uint8_t* const group_);
+static uint64_t align_up(uint64_t value_, uint64_t alignment_);
+static bool is_power_of_two(uint64_t val_);
+
+void hash_map_default_create(hash_map_t* const map_) {
+    CHECK_ARG_NULL_RETURN_VOID("hash_map_default_create", "map_", map_);
+    map_->internal_data = 0;
+}
+
+HASH_MAP_ERROR_CODE hash_map_create(uint64_t key_size_, uint8_t key_alignment_, uint64_t value_size_, uint8_t value_alignment_, uint64_t max_element_count_, hash_map_t* const map_) {
+    CHECK_ARG_NULL_RETURN_ERROR("hash_map_create", "map_", map_);
+    if(0 == key_size_) {
+        ERROR_MESSAGE("hash_map_create - Argument key_size_ requires non zero value.");
+        return HASH_MAP_INVALID_ARGUMENT;
+    }
+    return hash_map_create_internal("hash_map_create", key_size_, key_alignment_, value_size_, value_alignment_, max_element_count_, false, map_);
+}
+
+HASH_MAP_ERROR_CODE hash_map_create_string_key(uint64_t value_size_, uint8_t value_alignment_, uint64_t max_element_count_, hash_map_t* const map_) {
+    CHECK_ARG_NULL_RETURN_ERROR("hash_map_create_string_key", "map_", map_);
+    return hash_map_create_internal("hash_map_create_string_key", sizeof(core_string_t), alignof(core_string_t), value_size_, value_alignment_, max_element_count_, true, map_);
+}
+
+void hash_map_destroy(hash_map_t* const map_) {
+    CHECK_ARG_NULL_RETURN_VOID("hash_map_destroy", "map_", map_);
+    if(0 != map_->internal_data) {
+        hash_map_internal_data_t* internal_data = (hash_map_internal_data_t*)(map_->internal_data);
+        hash_map_clear(map_);
+        hash_map_free_slots(internal_data);
+        core_free_tagged(internal_data, sizeof(hash_map_internal_data_t), MEMORY_TAG_HASH_MAP);
+    }
+    map_->internal_data = 0;
+}
+
+HASH_MAP_ERROR_CODE hash_map_reserve(uint64_t max_element_count_, hash_map_t* const map_) {
+    CHECK_ARG_NULL_RETURN_ERROR("hash_map_reserve", "map_", map_);
+    CHECK_VALID_MAP_RETURN_ERROR("hash_map_reserve", map_);
+    hash_map_internal_data_t* internal_data = (hash_map_internal_data_t*)(map_->internal_data);
+    uint64_t slot_count = 0;
+    if(!hash_map_slot_count_for(max_element_count_, &slot_count)) {
+        ERROR_MESSAGE("hash_map_reserve - Provided max_element_count_ is too big.");
+        return HASH_MAP_INVALID_ARGUMENT;
+    }
+    if(slot_count <= internal_data->slot_count) {
+        return HASH_MAP_SUCCESS;
+    }
+    return hash_map_resize(internal_data, slot_count);
+}
+
+HASH_MAP_ERROR_CODE hash_map_rehash(uint64_t slot_count_, hash_map_t* const map_) {
+    CHECK_ARG_NULL_RETURN_ERROR("hash_map_rehash", "map_", map_);
+    CHECK_VALID_MAP_RETURN_ERROR("hash_map_rehash", map_);
+    hash_map_internal_data_t* internal_data = (hash_map_internal_data_t*)(map_->internal_data);
+    uint64_t slot_count = 0;
+    if(slot_count_ > (UINT64_MAX >> 2) || !hash_map_slot_count_for(internal_data->element_count, &slot_count)) {
+        ERROR_MESSAGE("hash_map_rehash - Provided slot_count_ is too big.");
+        return HASH_MAP_INVALID_ARGUMENT;
+    }
+    while(slot_count < slot_count_) {
+        slot_count <<= 1;
+    }
+    return hash_map_resize(internal_data, slot_count);
+}
+
+HASH_MAP_ERROR_CODE hash_map_insert(const void* const key_, const void* const value_, hash_map_t* const map_) {
+    CHECK_ARG_NULL_RETURN_ERROR("hash_map_insert", "map_", map_);
+    CHECK_ARG_NULL_RETURN_ERROR("hash_map_insert", "key_", key_);
+    CHECK_VALID_MAP_RETURN_ERROR("hash_map_insert", map_);
+    hash_map_internal_data_t* internal_data = (hash_map_internal_data_t*)(map_->internal_data);
+    if(0 != internal_data->value_size) {
+        CHECK_ARG_NULL_RETURN_ERROR("hash_map_insert", "value_", value_);
+    }
+
+    const uint64_t hash = hash_map_hash_key(internal_data, key_);
+    uint64_t index = hash_map_find_slot(internal_data, key_, hash);
+    if(INVALID_VALUE_U64 != index) {
+        char* slot = internal_data->slots + index * internal_data->slot_size;
+        core_copy_memory(value_, slot + internal_data->value_offset, internal_data->value_size);
+        return HASH_MAP_SUCCESS;
+    }
+
+    index = (0 != internal_data->slot_count) ? hash_map_find_free_slot(internal_data, hash) : INVALID_VALUE_U64;
+    if(INVALID_VALUE_U64 == index || (0 == internal_data->growth_left && HASH_MAP_CTRL_EMPTY == internal_data->control[index])) {
+        // 空きスロットを使い切った場合、削除済みスロットが多ければ同じスロット数で回収し、そうでなければ2倍に拡張する
+        // (hash_map_reserve()で確保したスロット数を下回らないよう、現在のスロット数より小さくはしない)
+        uint64_t slot_count = 0;
+        if(!hash_map_slot_count_for(internal_data->element_count + 1, &slot_count)) {
+            ERROR_MESSAGE("hash_map_insert - Element count is too big.");
+            return HASH_MAP_INVALID_ARGUMENT;
+        }
+        if(slot_count < internal_data->slot_count) {
+            slot_count = internal_data->slot_count;
+        }
+        if(slot_count <= internal_data->slot_count && internal_data->element_count * 16 > internal_data->slot_count * 7) {
+            slot_count = internal_data->slot_count * 2;
+        }
+        const HASH_MAP_ERROR_CODE ret_resize = hash_map_resize(internal_data, slot_count);
+        if(HASH_MAP_SUCCESS != ret_resize) {
+            ERROR_MESSAGE("hash_map_insert - Failed to grow slots.");
+            return ret_resize;
+        }
+        index = hash_map_find_free_slot(internal_data, hash);
+    }
+
+    char* slot = internal_data->slots + index * internal_data->slot_size;
+    if(internal_data->string_key) {
+        core_string_view_t view = CORE_STRING_VIEW_INITIALIZER;
+        core_string_view_from_string((const core_string_t*)key_, &view);
+        core_string_t key = CORE_STRING_INITIALIZER;
+        const CORE_STRING_ERROR_CODE ret_copy = (0 == view.length) ? core_string_copy_from_char("", &key) : core_string_append_from_buffer(view.data, view.length, &key);
+        if(CORE_STRING_SUCCESS != ret_copy) {
+            ERROR_MESSAGE("hash_map_insert - Failed to copy key string.");
+            core_string_destroy(&key);
+            return HASH_MAP_MEMORY_ALLOCATE_ERROR;
+        }
+        core_copy_memory(&key, slot, sizeof(core_string_t));    // core_string_tは自身を指すポインタを持たないため、バイト列として移動できる
+    } else {
+        core_copy_memory(key_, slot, internal_data->key_size);
+    }
+    core_copy_memory(value_, slot + internal_data->value_offset, internal_data->value_size);
+    if(HASH_MAP_CTRL_EMPTY == internal_data->control[index]) {
+        internal_data->growth_left--;
+    }
+    internal_data->control[index] = (uint8_t)(hash & 0x7F);
+    internal_data->element_count++;
+    return HASH_MAP_SUCCESS;
+}
+
+HASH_MAP_ERROR_CODE hash_map_find(const void* const key_, const hash_map_t* const map_, void** const out_value_) {
+    CHECK_ARG_NULL_RETURN_ERROR("hash_map_find", "map_", map_);
+    CHECK_ARG_NULL_RETURN_ERROR("hash_map_find", "key_", key_);
+    CHECK_ARG_NULL_RETURN_ERROR("hash_map_find", "out_value_", out_value_);
+    CHECK_VALID_MAP_RETURN_ERROR("hash_map_find", map_);
+    const hash_map_internal_data_t* internal_data = (const hash_map_internal_data_t*)(map_->internal_data);
+    const uint64_t index = hash_map_find_slot(internal_data, key_, hash_map_hash_key(internal_data, key_));
+    if(INVALID_VALUE_U64 == index) {
+        return HASH_MAP_NOT_FOUND;
+    }
+    *out_value_ = internal_data->slots + index * internal_data->slot_size + internal_data->value_offset;
+    return HASH_MAP_SUCCESS;
+}
+
+HASH_MAP_ERROR_CODE hash_map_erase(const void* const key_, hash_map_t* const map_) {
+    CHECK_ARG_NULL_RETURN_ERROR("hash_map_erase", "map_", map_);
+    CHECK_ARG_NULL_RETURN_ERROR("hash_map_erase", "key_", key_);
+    CHECK_VALID_MAP_RETURN_ERROR("hash_map_erase", map_);
+    hash_map_internal_data_t* internal_data = (hash_map_internal_data_t*)(map_->internal_data);
+    const uint64_t index = hash_map_find_slot(internal_data, key_, hash_map_hash_key(internal_data, key_));
+    if(INVALID_VALUE_U64 == index) {
+        return HASH_MAP_NOT_FOUND;
+    }
+    if(internal_data->string_key) {
+        core_string_destroy((core_string_t*)(internal_data->slots + index * internal_data->slot_size));
+    }
+    const uint8_t* group = internal_data->control + (index & ~(uint64_t)(HASH_MAP_GROUP_WIDTH - 1));
+    if(0 != hash_map_group_match_empty(group)) {
+        internal_data->control[index] = HASH_MAP_CTRL_EMPTY;
+        internal_data->growth_left++;
+    } else {
+        internal_data->control[index] = HASH_MAP_CTRL_DELETED;
+    }
+    internal_data->element_count--;
+    return HASH_MAP_SUCCESS;
+}
+
+HASH_MAP_ERROR_CODE hash_map_clear(hash_map_t* const map_) {
+    CHECK_ARG_NULL_RETURN_ERROR("hash_map_clear", "map_", map_);
+    CHECK_VALID_MAP_RETURN_ERROR("hash_map_clear", map_);
+    hash_map_internal_data_t* internal_data = (hash_map_internal_data_t*)(map_->internal_data);
+    if(internal_data->string_key) {
+        for(uint64_t i = 0; i != internal_data->slot_count && 0 != internal_data->element_count; ++i) {
+            if(0 == (internal_data->control[i] & 0x80)) {
+                core_string_destroy((core_string_t*)(internal_data->slots + i * internal_data->slot_size));
+                internal_data->element_count--;
+            }
+        }
+    }
+    if(0 != internal_data->slot_count) {
+        memset(internal_data->control, HASH_MAP_CTRL_EMPTY, internal_data->slot_count);
+    }
+    internal_data->element_count = 0;
+    internal_data->growth_left = internal_data->slot_count - internal_data->slot_count / 8;
+    return HASH_MAP_SUCCESS;
+}
+
+HASH_MAP_ERROR_CODE hash_map_size(const hash_map_t* const map_, uint64_t* const out_size_) {
+    CHECK_ARG_NULL_RETURN_ERROR("hash_map_size", "map_", map_);
+    CHECK_ARG_NULL_RETURN_ERROR("hash_map_size", "out_size_", out_size_);
+    CHECK_VALID_MAP_RETURN_ERROR("hash_map_size", map_);
+    const hash_map_internal_data_t* internal_data = (const hash_map_internal_data_t*)(map_->internal_data);
+    *out_size_ = internal_data->element_count;
+    return HASH_MAP_SUCCESS;
+}
+
+HASH_MAP_ERROR_CODE hash_map_slot_count(const hash_map_t* const map_, uint64_t* const out_slot_count_) {
+    CHECK_ARG_NULL_RETURN_ERROR("hash_map_slot_count", "map_", map_);
+    CHECK_ARG_NULL_RETURN_ERROR("hash_map_slot_count", "out_slot_count_", out_slot_count_);
+    CHECK_VALID_MAP_RETURN_ERROR("hash_map_slot_count", map_);
+    const hash_map_internal_data_t* internal_data = (const hash_map_internal_data_t*)(map_->internal_data);
+    *out_slot_count_ = internal_data->slot_count;
+    return HASH_MAP_SUCCESS;
+}
+
+bool hash_map_iterate(const hash_map_t* const map_, uint64_t* const cursor_, const void** const out_key_, void** const out_value_) {
+    if(0 == map_ || 0 == cursor_ || 0 == out_key_ || 0 == out_value_ || 0 == map_->internal_data) {
+        return false;
+    }
+    const hash_map_internal_data_t* internal_data = (const hash_map_internal_data_t*)(map_->internal_data);
+    for(uint64_t i = *cursor_; i < internal_data->slot_count; ++i) {
+        if(0 == (internal_data->control[i] & 0x80)) {
+            char* slot = internal_data->slots + i * internal_data->slot_size;
+            *out_key_ = slot;
+            *out_value_ = slot + internal_data->value_offset;
+            *cursor_ = i + 1;
+            return true;
+        }
+    }
+    *cursor_ = internal_data->slot_count;
+    return false;
+}
+
+const char* hash_map_error_code_to_string(HASH_MAP_ERROR_CODE err_code_) {
+    switch(err_code_) {
+        case HASH_MAP_SUCCESS:
+            return "hash map error code: success.";
+        case HASH_MAP_INVALID_ARGUMENT:
+            return "hash map error code: invalid argument.";
+        case HASH_MAP_MEMORY_ALLOCATE_ERROR:
+            return "hash map error code: failed to allocate memory.";
+        case HASH_MAP_INVALID_MAP:
+            return "hash map error code: invalid map.";
+        case HASH_MAP_NOT_FOUND:
+            return "hash map error code: key not found.";
+        default:
+            return "hash map error code: undefined error.";
+    }
+}
+
+// スロット配列を解放する(文字列キーの破棄は行わない)
+static void hash_map_free_slots(hash_map_internal_data_t* const internal_data_) {
+    if(0 != internal_data_->allocated_memory) {
+        core_free_tagged(internal_data_->allocated_memory, (size_t)internal_data_->allocated_size, MEMORY_TAG_HASH_MAP);
+    }
+    internal_data_->allocated_memory = 0;
+    internal_data_->allocated_size = 0;
+    internal_data_->control = 0;
+    internal_data_->slots = 0;
+    internal_data_->slot_count = 0;
+    internal_data_->group_mask = 0;
+    internal_data_->growth_left = 0;
+}
+
+static HASH_MAP_ERROR_CODE hash_map_create_internal(const char* const func_name_, uint64_t key_size_, uint8_t key_alignment_, uint64_t value_size_, uint8_t value_alignment_, uint64_t max_element_count_, bool string_key_, hash_map_t* const map_) {
+    if(!is_power_of_two(key_alignment_) || !is_power_of_two(value_alignment_)) {
+        ERROR_MESSAGE("%s - Alignment requirements must be a power of two.", func_name_);
+        return HASH_MAP_INVALID_ARGUMENT;
+    }
+    const uint64_t limit = UINT64_MAX >> 8;
+    uint64_t slot_count = 0;
+    if(key_size_ > limit || value_size_ > limit || !hash_map_slot_count_for(max_element_count_, &slot_count)) {
+        ERROR_MESSAGE("%s - Provided size is too big.", func_name_);
+        return HASH_MAP_INVALID_ARGUMENT;
+    }
+
+    hash_map_destroy(map_);
+    hash_map_internal_data_t* internal_data = core_malloc_tagged(sizeof(hash_map_internal_data_t), MEMORY_TAG_HASH_MAP);
+    if(0 == internal_data) {
+        ERROR_MESSAGE("%s - Failed to allocate internal data memory.", func_name_);
+        return HASH_MAP_MEMORY_ALLOCATE_ERROR;
+    }
+    core_zero_memory(internal_data, sizeof(hash_map_internal_data_t));
+    internal_data->key_size = key_size_;
+    internal_data->value_size = value_size_;
+    internal_data->value_offset = align_up(key_size_, value_alignment_);
+    internal_data->slot_alignment = (key_alignment_ > value_alignment_) ? key_alignment_ : value_alignment_;
+    internal_data->slot_size = align_up(internal_data->value_offset + value_size_, internal_data->slot_alignment);
+    internal_data->string_key = string_key_;
+    if(0 != max_element_count_) {
+        const HASH_MAP_ERROR_CODE ret_resize = hash_map_resize(internal_data, slot_count);
+        if(HASH_MAP_SUCCESS != ret_resize) {
+            ERROR_MESSAGE("%s - Failed to allocate slots.", func_name_);
+            core_free_tagged(internal_data, sizeof(hash_map_internal_data_t), MEMORY_TAG_HASH_MAP);
+            return ret_resize;
+        }
+    }
+    map_->internal_data = internal_data;
+    return HASH_MAP_SUCCESS;
+}
+
+// slot_count_個のスロットを確保し、格納済みの要素を再配置する(キーはバイト列として移動し、再確保は行わない)
+static HASH_MAP_ERROR_CODE hash_map_resize(hash_map_internal_data_t* const internal_data_, uint64_t slot_count_) {
+    const uint64_t alignment = (internal_data_->slot_alignment > HASH_MAP_GROUP_WIDTH) ? internal_data_->slot_alignment : HASH_MAP_GROUP_WIDTH;
+    const uint64_t limit = (uint64_t)SIZE_MAX / 4;
+    if(internal_data_->slot_size > (limit / slot_count_)) {
+        ERROR_MESSAGE("hash_map_resize - Provided slot_count_ is too big.");
+        return HASH_MAP_INVALID_ARGUMENT;
+    }
+    const uint64_t control_size = align_up(slot_count_, internal_data_->slot_alignment);
+    const uint64_t allocated_size = control_size + slot_count_ * internal_data_->slot_size + alignment;
+    void* allocated_memory = core_malloc_tagged((size_t)allocated_size, MEMORY_TAG_HASH_MAP);
+    if(0 == allocated_memory) {
+        ERROR_MESSAGE("hash_map_resize - Failed to allocate memory.");
+        return HASH_MAP_MEMORY_ALLOCATE_ERROR;
+    }
+
+    hash_map_internal_data_t old = *internal_data_;
+    char* base = (char*)allocated_memory + (align_up((uintptr_t)allocated_memory, alignment) - (uintptr_t)allocated_memory);
+    internal_data_->allocated_memory = allocated_memory;
+    internal_data_->allocated_size = allocated_size;
+    internal_data_->control = (uint8_t*)base;
+    internal_data_->slots = base + control_size;
+    internal_data_->slot_count = slot_count_;
+    internal_data_->group_mask = slot_count_ / HASH_MAP_GROUP_WIDTH - 1;
+    internal_data_->growth_left = slot_count_ - slot_count_ / 8 - old.element_count;
+    memset(internal_data_->control, HASH_MAP_CTRL_EMPTY, slot_count_);
+
+    // 再配置先は空きスロットのみのため、キーの比較は不要
+    for(uint64_t i = 0; i != old.slot_count; ++i) {
+        if(0 != (old.control[i] & 0x80)) {
+            continue;
+        }
+        const char* src = old.slots + i * old.slot_size;
+        const uint64_t hash = hash_map_hash_key(internal_data_, src);
+        const uint64_t index = hash_map_find_free_slot(internal_data_, hash);
+        internal_data_->control[index] = (uint8_t)(hash & 0x7F);
+        core_copy_memory(src, internal_data_->slots + index * internal_data_->slot_size, old.slot_size);
+    }
+    hash_map_free_slots(&old);
+    return HASH_MAP_SUCCESS;
+}
+
+// element_count_個の要素を格納できる(使用率7/8以下となる)2の冪乗のスロット数を求める
+static bool hash_map_slot_count_for(uint64_t element_count_, uint64_t* const out_slot_count_) {
+    if(element_count_ > (UINT64_MAX >> 4)) {
+        return false;
+    }
+    const uint64_t required = element_count_ + (element_count_ + 6) / 7;    // ceil(element_count_ * 8 / 7)
+    uint64_t slot_count = HASH_MAP_GROUP_WIDTH;
+    while(slot_count - slot_count / 8 < element_count_ || slot_count < required) {
+        slot_count <<= 1;
+    }
+    *out_slot_count_ = slot_count;
+    return true;
+}
+
+// 文字列キーはcore_string_hash()を使用する(ヒープ文字列はキャッシュされるため、再配置時にも再計算しない)
+static uint64_t hash_map_hash_key(const hash_map_internal_data_t* const internal_data_, const void* const key_) {
+    if(internal_data_->string_key) {
+        return core_string_hash((const core_string_t*)key_);
+    }
+    return core_hash_bytes(key_, internal_data_->key_size, CORE_HASH_DEFAULT_SEED);
+}
+
+// 検索キーkey_とスロットslot_に格納されたキーが一致するかを判定する
+static bool hash_map_key_equal(const hash_map_internal_data_t* const internal_data_, const void* const key_, const char* const slot_) {
+    if(internal_data_->string_key) {
+        core_string_view_t lhs = CORE_STRING_VIEW_INITIALIZER;
+        core_string_view_t rhs = CORE_STRING_VIEW_INITIALIZER;
+        core_string_view_from_string((const core_string_t*)key_, &lhs);
+        core_string_view_from_string((const core_string_t*)slot_, &rhs);
+        return lhs.length == rhs.length && core_string_kernel_equal(lhs.data, rhs.data, lhs.length);
+    }
+    // 整数キー等、よく使うサイズは定数サイズの比較に展開させる
+    switch(internal_data_->key_size) {
+        case 4:
+            return 0 == memcmp(key_, slot_, 4);
+        case 8:
+            return 0 == memcmp(key_, slot_, 8);
+        case 16:
+            return 0 == memcmp(key_, slot_, 16);
+        default:
+            return 0 == memcmp(key_, slot_, internal_data_->key_size);
+    }
+}
+
+// key_が格納されているスロット番号を返す(見つからない場合は INVALID_VALUE_U64)
+static uint64_t hash_map_find_slot(const hash_map_internal_data_t* const internal_data_, const void* const key_, uint64_t hash_) {
+    if(0 == internal_data_->slot_count) {
+        return INVALID_VALUE_U64;
+    }
+    const uint8_t h2 = (uint8_t)(hash_ & 0x7F);
+    uint64_t group = (hash_ >> 7) & internal_data_->group_mask;
+    for(uint64_t step = 1;; ++step) {
+        const uint8_t* control = internal_data_->control + group * HASH_MAP_GROUP_WIDTH;
+        uint64_t mask = hash_map_group_match(control, h2);
+        while(0 != mask) {
+            const uint64_t index = group * HASH_MAP_GROUP_WIDTH + ((uint64_t)__builtin_ctzll(mask) >> HASH_MAP_GROUP_SHIFT);
+            if(hash_map_key_equal(internal_data_, key_, internal_data_->slots + index * internal_data_->slot_size)) {
+                return index;
+            }
+            mask &= mask - 1;
+        }
+        if(0 != hash_map_group_match_empty(control) || step > internal_data_->group_mask) {
+            return INVALID_VALUE_U64;
+        }
+        group = (group + step) & internal_data_->group_mask;
+    }
+}
+
+// hash_の探索順で最初の空き、または削除済みスロットの番号を返す(使用率は7/8以下のため必ず見つかる)
+static uint64_t hash_map_find_free_slot(const hash_map_internal_data_t* const internal_data_, uint64_t hash_) {
+    uint64_t group = (hash_ >> 7) & internal_data_->group_mask;
+    for(uint64_t step = 1;; ++step) {
+        const uint64_t mask = hash_map_group_match_free(internal_data_->control + group * HASH_MAP_GROUP_WIDTH);
+        if(0 != mask) {
+            return group * HASH_MAP_GROUP_WIDTH + ((uint64_t)__builtin_ctzll(mask) >> HASH_MAP_GROUP_SHIFT);
+        }
+        group = (group + step) & internal_data_->group_mask;
+    }
+}
+
+#if HASH_MAP_GROUP_SSE2
+// 制御バイトがh2_と一致するスロットのマスク
+static uint64_t hash_map_group_match(const uint8_t* const group_, uint8_t h2_) {
+    const __m128i control = _mm_load_si128((const __m128i*)group_);
+    return (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(control, _mm_set1_epi8((char)h2_)));
+}
+
+// 空きスロットのマスク
+static uint64_t hash_map_group_match_empty(const uint8_t* const group_) {
+    const __m128i control = _mm_load_si128((const __m128i*)group_);
+    return (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(control, _mm_set1_epi8((char)HASH_MAP_CTRL_EMPTY)));
+}
+
+// 空き、または削除済みスロットのマスク(最上位bitが1の制御バイト)
+static uint64_t hash_map_group_match_free(const uint8_t* const group_) {
+    return (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_load_si128((const __m128i*)group_));
+}
+#elif HASH_MAP_GROUP_NEON
+// 比較結果の各byteを4bitに縮めて64bitに詰め、byteごとに最上位の1bitのみを残す
+#define NEON_MASK(v_) (vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(v_), 4)), 0) & 0x8888888888888888ull)
+
+static uint64_t hash_map_group_match(const uint8_t* const group_, uint8_t h2_) {
+    return NEON_MASK(vceqq_u8(vld1q_u8(group_), vdupq_n_u8(h2_)));
+}
+
+static uint64_t hash_map_group_match_empty(const uint8_t* const group_) {
+    return NEON_MASK(vceqq_u8(vld1q_u8(group_), vdupq_n_u8(HASH_MAP_CTRL_EMPTY)));
+}
+
+static uint64_t hash_map_group_match_free(const uint8_t* const group_) {
+    return NEON_MASK(vcltq_s8(vreinterpretq_s8_u8(vld1q_u8(group_)), vdupq_n_s8(0)));
+}
+#else
+// 0x00となるbyteを検出する(一致したbyteより上位のbyteに偽陽性が出る場合があるが、キーを比較するため問題ない)
+static uint64_t hash_map_group_match(const uint8_t* const group_, uint8_t h2_) {
+    uint64_t control = 0;
+    memcpy(&control, group_, sizeof(control));
+    const uint64_t x = control ^ (0x0101010101010101ull * h2_);
+    return (x - 0x0101010101010101ull) & ~x & 0x8080808080808080ull;
+}
+
+// 空き(0x80)は最上位bitが1かつbit1が0、削除済み(0xFE)はbit1が1であることで区別する
+static uint64_t hash_map_group_match_empty(const uint8_t* const group_) {
+    uint64_t control = 0;
+    memcpy(&control, group_, sizeof(control));
+    return control & (~control << 6) & 0x8080808080808080ull;
+}
+
+static uint64_t hash_map_group_match_free(const uint8_t* const group_) {
+    uint64_t control = 0;
+    memcpy(&control, group_, sizeof(control));
+    return control & 0x8080808080808080ull;
+}
+#endif
+
+// value_をalignment_(2の冪乗)の倍数に切り上げる
+static uint64_t align_up(uint64_t value_, uint64_t alignment_) {
+    return (value_ + (alignment_ - 1)) & ~(alignment_ - 1);
+}
+
+// 引数val_が2の冪乗かを判定する
+static bool is_power_of_two(uint64_t val_) {
+    return (0 != val_) && (0 == (val_ & (val_ - 1)));
+}
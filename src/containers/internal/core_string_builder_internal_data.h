@@ -0,0 +1,41 @@
+/**
+ * @file core_string_builder_internal_data.h
+ * @brief core_string_builder_tの内部実装に関する構造体定義（非公開ヘッダ）
+ *
+ * このヘッダファイルは、core_string_builderモジュール内部で使用される
+ * core_string_builder_internal_data_t構造体を定義する。
+ * API利用者がこのヘッダを直接インクルードする必要はない。
+ *
+ * @note 内部用ヘッダであり、公開インターフェースでは使用しないこと。
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @struct core_string_builder_block_t
+ * @brief 文字列を格納するブロック。ヘッダの直後にcapacityバイトのデータ領域が続く。
+ *
+ */
+typedef struct core_string_builder_block_t {
+    struct core_string_builder_block_t* next;   /**< 次のブロック(末尾の場合はNULL) */
+    uint64_t capacity;                          /**< データ領域の容量(byte) */
+    uint64_t used;                              /**< データ領域の使用量(byte) */
+    char data[];                                /**< データ領域(終端文字は格納しない) */
+} core_string_builder_block_t;
+
+/**
+ * @struct core_string_builder_internal_data_t
+ * @brief core_string_builder_tの内部構造体。ブロックのリストとメタ情報を保持する。
+ *
+ * headからtailまでのブロックに文字列が格納されている。
+ * tailより後ろのブロックは core_string_builder_reset() 後に再利用を待つ空きブロックである。
+ *
+ */
+typedef struct core_string_builder_internal_data_t {
+    core_string_builder_block_t* head;  /**< 先頭ブロック(ブロック未確保の場合はNULL) */
+    core_string_builder_block_t* tail;  /**< 追記中のブロック(ブロック未確保の場合はNULL) */
+    uint64_t length;                    /**< 文字列の合計長 */
+    uint64_t block_size;                /**< 1ブロックあたりの標準の容量(byte) */
+} core_string_builder_internal_data_t;
@@ -12,6 +12,10 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "core/core_memory.h"
 
 /**
  * @struct core_string_internal_data_t
@@ -21,9 +25,14 @@
  * 利用者が直接この構造体にアクセスすることは想定されておらず、
  * core_string.c内でのみ使用される。
  *
+ * hash / hash_cachedは core_string_hash() の計算結果のキャッシュであり、文字列を変更する処理で無効化する。
+ * constなオブジェクトに対しても書き込むため、複数スレッドからの同時読み出しで競合しないようアトミック変数とする。
  */
 typedef struct core_string_internal_data_t {
     char* buffer;       /**< ヌル終端された文字列バッファ */
     uint64_t length;    /**< 文字列長（終端文字を除く） */
     uint64_t buff_size; /**< バッファサイズ（終端文字含む） */
+    core_arena_t* arena;    /**< メモリ確保元アリーナ(NULLの場合はヒープから確保する) */
+    _Atomic uint64_t hash;      /**< キャッシュしたハッシュ値(hash_cachedがtrueの場合のみ有効) */
+    _Atomic bool hash_cached;   /**< hashが現在の文字列のハッシュ値を保持している */
 } core_string_internal_data_t;
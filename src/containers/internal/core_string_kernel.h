@@ -0,0 +1,81 @@
+/**
+ * @file core_string_kernel.h
+ * @brief 文字列の長さ計算、比較、検索を行うベクトル命令版関数の宣言（非公開ヘッダ）
+ *
+ * core_string / core_string_view / core_string_builder / core_string_tokenizerの各モジュールから使用する。
+ * API利用者がこのヘッダを直接インクルードする必要はない。
+ *
+ * @note 内部用ヘッダであり、公開インターフェースでは使用しないこと。引数の検証は呼び出し側で行う。
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief core_string_kernel_find_any() で一度に検索できる文字数
+ *
+ */
+#define CORE_STRING_KERNEL_FIND_ANY_MAX 4
+
+/**
+ * @brief 終端文字までの文字列長を取得する(strlen相当)
+ *
+ * @note 終端文字を含むブロックまでを、ブロック単位のアライメントされたロードで読む。
+ *       ロードはページ境界を跨がないため、文字列の終端より後ろの読み込みでフォルトすることはない。
+ *
+ * @param str_ 対象文字列(NULL不可)
+ *
+ * @return 文字列長(終端文字を含まない)
+ */
+uint64_t core_string_kernel_length(const char* str_);
+
+/**
+ * @brief str_の先頭size_文字から、最初にc_が現れる位置を検索する(memchr相当)
+ *
+ * @param str_ 検索対象(size_が0の場合はNULLでもよい)
+ * @param size_ 検索する文字数
+ * @param c_ 検索する文字
+ *
+ * @return 見つかった位置のポインタ。見つからない場合はNULL
+ */
+const char* core_string_kernel_find_char(const char* str_, uint64_t size_, char c_);
+
+/**
+ * @brief str1_とstr2_の先頭size_文字が一致するかを判定する
+ *
+ * @param str1_ 比較対象1(size_が0の場合はNULLでもよい)
+ * @param str2_ 比較対象2(size_が0の場合はNULLでもよい)
+ * @param size_ 比較する文字数
+ *
+ * @retval true 一致
+ * @retval false 不一致
+ */
+bool core_string_kernel_equal(const char* str1_, const char* str2_, uint64_t size_);
+
+/**
+ * @brief str_の先頭size_文字から、最初にneedle_が現れる位置を検索する
+ *
+ * @note needle_の先頭文字と末尾文字が一致する位置をベクトル命令でまとめて探し、候補位置でのみ全体を比較する
+ *
+ * @param str_ 検索対象
+ * @param size_ 検索対象の文字数
+ * @param needle_ 検索する文字列
+ * @param needle_size_ 検索する文字列の文字数(0の場合は0を返す)
+ *
+ * @return 見つかった位置(str_の先頭からのインデックス)。見つからない場合は INVALID_VALUE_U64
+ */
+uint64_t core_string_kernel_find(const char* str_, uint64_t size_, const char* needle_, uint64_t needle_size_);
+
+/**
+ * @brief str_の先頭size_文字から、set_のいずれかの文字が最初に現れる位置を検索する
+ *
+ * @note 1ブロックを CORE_STRING_KERNEL_FIND_ANY_MAX 回の一致判定でまとめて調べる
+ *
+ * @param str_ 検索対象(size_が0の場合はNULLでもよい)
+ * @param size_ 検索対象の文字数
+ * @param set_ 検索する文字の集合(ちょうど CORE_STRING_KERNEL_FIND_ANY_MAX 文字。文字数が少ない場合は同じ文字を重ねて埋める)
+ *
+ * @return 見つかった位置へのポインタ。見つからない場合はNULL
+ */
+const char* core_string_kernel_find_any(const char* str_, uint64_t size_, const char* set_);
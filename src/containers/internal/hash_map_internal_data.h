@@ -0,0 +1,38 @@
+/**
+ * @file hash_map_internal_data.h
+ * @brief hash_map_tの内部実装に関する構造体定義（非公開ヘッダ）
+ *
+ * このヘッダファイルは、hash_mapモジュール内部で使用される
+ * hash_map_internal_data_t構造体を定義する。
+ * API利用者がこのヘッダを直接インクルードする必要はない。
+ *
+ * @note 内部用ヘッダであり、公開インターフェースでは使用しないこと。
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @struct hash_map_internal_data_t
+ * @brief hash_map_tの内部構造体
+ *
+ * 制御バイト配列とスロット配列は1回のメモリ確保でまとめて確保する(制御バイト配列が先頭)。
+ * スロットは[キー][パディング][値][パディング]の順に格納する。
+ */
+typedef struct hash_map_internal_data_t {
+    uint8_t* control;           /**< スロットごとの制御バイト(空き / 削除済み / ハッシュ値の下位7bit) */
+    char* slots;                /**< スロット配列 */
+    uint64_t slot_count;        /**< スロット数(0または2の冪乗) */
+    uint64_t group_mask;        /**< グループ番号を求めるためのマスク(グループ数 - 1) */
+    uint64_t element_count;     /**< 格納済みの要素数 */
+    uint64_t growth_left;       /**< 再配置が必要になるまでに空きスロットへ格納できる要素数 */
+    uint64_t key_size;          /**< キーのサイズ(byte) */
+    uint64_t value_size;        /**< 値のサイズ(byte) */
+    uint64_t value_offset;      /**< スロット先頭から値までのオフセット(byte) */
+    uint64_t slot_size;         /**< アライメントされた各スロットのサイズ(byte) */
+    uint64_t slot_alignment;    /**< スロットのアライメント要件 */
+    bool string_key;            /**< キーがcore_string_tの場合true */
+    void* allocated_memory;     /**< 確保した領域の先頭(アライメント調整前) */
+    uint64_t allocated_size;    /**< 確保した領域のサイズ(byte) */
+} hash_map_internal_data_t;
@@ -0,0 +1,49 @@
+/**
+ * @file ring_queue_internal_data.h
+ * @brief ring_queue_tの内部実装に関する構造体定義（非公開ヘッダ）
+ *
+ * このヘッダファイルは、ring_queueモジュール内部で使用される
+ * ring_queue_internal_data_t構造体を定義する。
+ * API利用者がこのヘッダを直接インクルードする必要はない。
+ *
+ * @note 内部用ヘッダであり、公開インターフェースでは使用しないこと。
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+
+#include "containers/ring_queue.h"
+
+/**
+ * @brief false sharing防止のためのキャッシュラインサイズ(byte)
+ *
+ */
+#define RING_QUEUE_CACHE_LINE_SIZE 64
+
+/**
+ * @struct ring_queue_internal_data_t
+ * @brief ring_queue_tの内部構造体
+ *
+ * プロデューサのみが更新するtail、コンシューマのみが更新するhead、生成後は読み取り専用となる管理データを
+ * それぞれ別のキャッシュラインに配置する。
+ * 構造体、シーケンス番号配列、オブジェクト格納先バッファは1回のメモリ確保でまとめて確保する。
+ */
+typedef struct ring_queue_internal_data_t {
+    alignas(RING_QUEUE_CACHE_LINE_SIZE) _Atomic uint64_t tail;  /**< 次にpushする位置(プロデューサが更新) */
+    uint64_t cached_head;                                       /**< プロデューサが最後に観測したhead(SPSCのみ使用) */
+
+    alignas(RING_QUEUE_CACHE_LINE_SIZE) _Atomic uint64_t head;  /**< 次にpopする位置(コンシューマが更新) */
+    uint64_t cached_tail;                                       /**< コンシューマが最後に観測したtail(SPSCのみ使用) */
+
+    alignas(RING_QUEUE_CACHE_LINE_SIZE) uint64_t element_size;  /**< 格納するオブジェクトのサイズ(byte) */
+    uint64_t aligned_element_size;  /**< アライメントされた各オブジェクトに必要なメモリ領域 */
+    uint64_t max_element_count;     /**< 最大格納数(2の冪乗) */
+    uint64_t index_mask;            /**< 位置からスロット番号を求めるためのマスク(max_element_count - 1) */
+    RING_QUEUE_MODE mode;           /**< 動作モード */
+    _Atomic uint64_t* sequences;    /**< スロットごとのシーケンス番号(MPMCのみ使用) */
+    char* memory_pool;              /**< オブジェクト格納先バッファ */
+    void* allocated_memory;         /**< 確保した領域の先頭(アライメント調整前) */
+    uint64_t allocated_size;        /**< 確保した領域のサイズ(byte) */
+} ring_queue_internal_data_t;
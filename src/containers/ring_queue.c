@@ -0,0 +1,286 @@
+/**
+ * @file ring_queue.c
+ * @author chocolate-pie24
+ * @brief ロックフリーリングキューオブジェクト(ring_queue_t)用API関数の実装ファイル
+ *
+ * @version 0.1
+ * @date 2025-08-10
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#define MESSAGE_MODULE_NAME RING_QUEUE // メッセージ出力元モジュール(message.hより前に定義する)
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+
+#include "define.h"
+
+#include "containers/ring_queue.h"
+
+#include "internal/ring_queue_internal_data.h"
+
+#include "core/message.h"
+#include "core/core_memory.h"
+
+#if ENABLE_ARGUMENT_CHECK
+#define CHECK_ARG_NULL_RETURN_ERROR(func_name_, arg_name_, ptr_) \
+    if(0 == ptr_) { \
+        ERROR_MESSAGE("%s - Argument %s requires a valid pointer.", func_name_, arg_name_); \
+        return RING_QUEUE_INVALID_ARGUMENT; \
+    } \
+
+#define CHECK_VALID_QUEUE_RETURN_ERROR(func_name_, queue_) \
+    if(0 == (queue_)->internal_data) { \
+        ERROR_MESSAGE("%s - Provided queue is not initialized. Call ring_queue_create.", func_name_); \
+        return RING_QUEUE_INVALID_QUEUE; \
+    } \
+
+#else
+#define CHECK_ARG_NULL_RETURN_ERROR(func_name_, arg_name_, ptr_) DEBUG_ASSERT(0 != (ptr_));
+#define CHECK_VALID_QUEUE_RETURN_ERROR(func_name_, queue_) DEBUG_ASSERT(0 != (queue_)->internal_data);
+#endif
+
+#define CHECK_ARG_NULL_RETURN_VOID(func_name_, arg_name_, ptr_) \
+    if(0 == ptr_) { \
+        WARN_MESSAGE("%s - Argument %s requires a valid pointer.", func_name_, arg_name_); \
+        return; \
+    } \
+
+static bool is_power_of_two(uint64_t val_);
+static uint64_t align_up(uint64_t value_, uint64_t alignment_);
+static RING_QUEUE_ERROR_CODE ring_queue_push_spsc(ring_queue_internal_data_t* const internal_data_, const void* const data_);
+static RING_QUEUE_ERROR_CODE ring_queue_pop_spsc(ring_queue_internal_data_t* const internal_data_, void* const out_data_);
+static RING_QUEUE_ERROR_CODE ring_queue_push_mpmc(ring_queue_internal_data_t* const internal_data_, const void* const data_);
+static RING_QUEUE_ERROR_CODE ring_queue_pop_mpmc(ring_queue_internal_data_t* const internal_data_, void* const out_data_);
+
+void ring_queue_default_create(ring_queue_t* const queue_) {
+    CHECK_ARG_NULL_RETURN_VOID("ring_queue_default_create", "queue_", queue_);
+    queue_->internal_data = 0;
+}
+
+RING_QUEUE_ERROR_CODE ring_queue_create(uint64_t element_size_, uint8_t alignment_requirement_, uint64_t max_element_count_, RING_QUEUE_MODE mode_, ring_queue_t* const queue_) {
+    CHECK_ARG_NULL_RETURN_ERROR("ring_queue_create", "queue_", queue_);
+    if(0 == element_size_ || 0 == alignment_requirement_ || 0 == max_element_count_) {
+        ERROR_MESSAGE("ring_queue_create - Arguments element_size_ , alignment_requirement_ and max_element_count_ require non zero value.");
+        return RING_QUEUE_INVALID_ARGUMENT;
+    }
+    if(!is_power_of_two(alignment_requirement_) || !is_power_of_two(max_element_count_)) {
+        ERROR_MESSAGE("ring_queue_create - Arguments alignment_requirement_ and max_element_count_ must be a power of two.");
+        return RING_QUEUE_INVALID_ARGUMENT;
+    }
+    if(RING_QUEUE_MODE_SPSC != mode_ && RING_QUEUE_MODE_MPMC != mode_) {
+        ERROR_MESSAGE("ring_queue_create - Argument mode_ is not valid.");
+        return RING_QUEUE_INVALID_ARGUMENT;
+    }
+
+    // 構造体 / シーケンス番号配列 / バッファの順に配置し、各領域の先頭をキャッシュライン(またはアライメント要件)境界に揃える
+    const uint64_t alignment = (alignment_requirement_ > RING_QUEUE_CACHE_LINE_SIZE) ? alignment_requirement_ : RING_QUEUE_CACHE_LINE_SIZE;
+    const uint64_t aligned_element_size = align_up(element_size_, alignment_requirement_);
+    const uint64_t limit = (uint64_t)SIZE_MAX / 4;  // 以下の加算でオーバーフローしないための上限
+    if(aligned_element_size > (limit / max_element_count_) || sizeof(_Atomic uint64_t) > (limit / max_element_count_)) {
+        ERROR_MESSAGE("ring_queue_create - Provided max_element_count_ is too big.");
+        return RING_QUEUE_INVALID_ARGUMENT;
+    }
+    const uint64_t header_size = align_up(sizeof(ring_queue_internal_data_t), alignment);
+    const uint64_t sequences_size = (RING_QUEUE_MODE_MPMC == mode_) ? align_up(sizeof(_Atomic uint64_t) * max_element_count_, alignment) : 0;
+    const uint64_t buffer_size = aligned_element_size * max_element_count_;
+    const uint64_t allocated_size = header_size + sequences_size + buffer_size + alignment;
+
+    ring_queue_destroy(queue_);
+    void* allocated_memory = core_malloc_tagged((size_t)allocated_size, MEMORY_TAG_QUEUE);
+    if(0 == allocated_memory) {
+        ERROR_MESSAGE("ring_queue_create - Failed to allocate memory.");
+        return RING_QUEUE_MEMORY_ALLOCATE_ERROR;
+    }
+    char* base = (char*)allocated_memory + (align_up((uintptr_t)allocated_memory, alignment) - (uintptr_t)allocated_memory);
+    core_zero_memory(base, header_size + sequences_size + buffer_size);
+
+    ring_queue_internal_data_t* internal_data = (ring_queue_internal_data_t*)base;
+    atomic_init(&internal_data->tail, 0);
+    atomic_init(&internal_data->head, 0);
+    internal_data->cached_head = 0;
+    internal_data->cached_tail = 0;
+    internal_data->element_size = element_size_;
+    internal_data->aligned_element_size = aligned_element_size;
+    internal_data->max_element_count = max_element_count_;
+    internal_data->index_mask = max_element_count_ - 1;
+    internal_data->mode = mode_;
+    internal_data->sequences = 0;
+    if(RING_QUEUE_MODE_MPMC == mode_) {
+        internal_data->sequences = (_Atomic uint64_t*)(base + header_size);
+        for(uint64_t i = 0; i != max_element_count_; ++i) {
+            atomic_init(&internal_data->sequences[i], i);
+        }
+    }
+    internal_data->memory_pool = base + header_size + sequences_size;
+    internal_data->allocated_memory = allocated_memory;
+    internal_data->allocated_size = allocated_size;
+    queue_->internal_data = internal_data;
+    return RING_QUEUE_SUCCESS;
+}
+
+void ring_queue_destroy(ring_queue_t* const queue_) {
+    CHECK_ARG_NULL_RETURN_VOID("ring_queue_destroy", "queue_", queue_);
+    if(0 != queue_->internal_data) {
+        ring_queue_internal_data_t* internal_data = (ring_queue_internal_data_t*)(queue_->internal_data);
+        core_free_tagged(internal_data->allocated_memory, (size_t)internal_data->allocated_size, MEMORY_TAG_QUEUE);
+    }
+    queue_->internal_data = 0;
+}
+
+RING_QUEUE_ERROR_CODE ring_queue_push(ring_queue_t* const queue_, const void* const data_) {
+    CHECK_ARG_NULL_RETURN_ERROR("ring_queue_push", "queue_", queue_);
+    CHECK_ARG_NULL_RETURN_ERROR("ring_queue_push", "data_", data_);
+    CHECK_VALID_QUEUE_RETURN_ERROR("ring_queue_push", queue_);
+    ring_queue_internal_data_t* internal_data = (ring_queue_internal_data_t*)(queue_->internal_data);
+    if(RING_QUEUE_MODE_SPSC == internal_data->mode) {
+        return ring_queue_push_spsc(internal_data, data_);
+    }
+    return ring_queue_push_mpmc(internal_data, data_);
+}
+
+RING_QUEUE_ERROR_CODE ring_queue_pop(ring_queue_t* const queue_, void* const out_data_) {
+    CHECK_ARG_NULL_RETURN_ERROR("ring_queue_pop", "queue_", queue_);
+    CHECK_ARG_NULL_RETURN_ERROR("ring_queue_pop", "out_data_", out_data_);
+    CHECK_VALID_QUEUE_RETURN_ERROR("ring_queue_pop", queue_);
+    ring_queue_internal_data_t* internal_data = (ring_queue_internal_data_t*)(queue_->internal_data);
+    if(RING_QUEUE_MODE_SPSC == internal_data->mode) {
+        return ring_queue_pop_spsc(internal_data, out_data_);
+    }
+    return ring_queue_pop_mpmc(internal_data, out_data_);
+}
+
+RING_QUEUE_ERROR_CODE ring_queue_capacity(const ring_queue_t* const queue_, uint64_t* const out_capacity_) {
+    CHECK_ARG_NULL_RETURN_ERROR("ring_queue_capacity", "queue_", queue_);
+    CHECK_ARG_NULL_RETURN_ERROR("ring_queue_capacity", "out_capacity_", out_capacity_);
+    CHECK_VALID_QUEUE_RETURN_ERROR("ring_queue_capacity", queue_);
+    const ring_queue_internal_data_t* internal_data = (const ring_queue_internal_data_t*)(queue_->internal_data);
+    *out_capacity_ = internal_data->max_element_count;
+    return RING_QUEUE_SUCCESS;
+}
+
+RING_QUEUE_ERROR_CODE ring_queue_size(const ring_queue_t* const queue_, uint64_t* const out_size_) {
+    CHECK_ARG_NULL_RETURN_ERROR("ring_queue_size", "queue_", queue_);
+    CHECK_ARG_NULL_RETURN_ERROR("ring_queue_size", "out_size_", out_size_);
+    CHECK_VALID_QUEUE_RETURN_ERROR("ring_queue_size", queue_);
+    ring_queue_internal_data_t* internal_data = (ring_queue_internal_data_t*)(queue_->internal_data);
+    // headを先に読むことで、tail - headが負にならないようにする(読む間にpopが進んだ場合は過大になるため上限で丸める)
+    const uint64_t head = atomic_load_explicit(&internal_data->head, memory_order_acquire);
+    const uint64_t tail = atomic_load_explicit(&internal_data->tail, memory_order_acquire);
+    const uint64_t size = (tail > head) ? (tail - head) : 0;
+    *out_size_ = (size > internal_data->max_element_count) ? internal_data->max_element_count : size;
+    return RING_QUEUE_SUCCESS;
+}
+
+const char* ring_queue_error_code_to_string(RING_QUEUE_ERROR_CODE err_code_) {
+    switch(err_code_) {
+        case RING_QUEUE_SUCCESS:
+            return "ring queue error code: success.";
+        case RING_QUEUE_MEMORY_ALLOCATE_ERROR:
+            return "ring queue error code: failed to allocate memory.";
+        case RING_QUEUE_INVALID_ARGUMENT:
+            return "ring queue error code: invalid argument.";
+        case RING_QUEUE_INVALID_QUEUE:
+            return "ring queue error code: invalid queue.";
+        case RING_QUEUE_EMPTY:
+            return "ring queue error code: queue is empty.";
+        case RING_QUEUE_FULL:
+            return "ring queue error code: queue is full.";
+        default:
+            return "ring queue error code: undefined error.";
+    }
+}
+
+// 引数val_が2の冪乗かを判定する
+static bool is_power_of_two(uint64_t val_) {
+    return (0 != val_) && (0 == (val_ & (val_ - 1)));
+}
+
+// value_をalignment_(2の冪乗)の倍数に切り上げる
+static uint64_t align_up(uint64_t value_, uint64_t alignment_) {
+    return (value_ + alignment_ - 1) & ~(alignment_ - 1);
+}
+
+// SPSC版push。tailはプロデューサのみが更新するため、CASは不要。
+// headの読み込みはキャッシュ(cached_head)で満杯の可能性がある場合のみ行い、コンシューマ側キャッシュラインへのアクセスを減らす。
+// 満杯 / 空はスピン待ちの中で頻繁に発生するため、エラーメッセージは出力しない(ring_queue_pop_spsc / mpmcも同様)
+static RING_QUEUE_ERROR_CODE ring_queue_push_spsc(ring_queue_internal_data_t* const internal_data_, const void* const data_) {
+    const uint64_t tail = atomic_load_explicit(&internal_data_->tail, memory_order_relaxed);
+    if((tail - internal_data_->cached_head) >= internal_data_->max_element_count) {
+        internal_data_->cached_head = atomic_load_explicit(&internal_data_->head, memory_order_acquire);
+        if((tail - internal_data_->cached_head) >= internal_data_->max_element_count) {
+            return RING_QUEUE_FULL;
+        }
+    }
+    char* dst = internal_data_->memory_pool + ((tail & internal_data_->index_mask) * internal_data_->aligned_element_size);
+    core_copy_memory(data_, dst, internal_data_->element_size);
+    atomic_store_explicit(&internal_data_->tail, tail + 1, memory_order_release);
+    return RING_QUEUE_SUCCESS;
+}
+
+// SPSC版pop。headはコンシューマのみが更新するため、CASは不要。
+static RING_QUEUE_ERROR_CODE ring_queue_pop_spsc(ring_queue_internal_data_t* const internal_data_, void* const out_data_) {
+    const uint64_t head = atomic_load_explicit(&internal_data_->head, memory_order_relaxed);
+    if(head == internal_data_->cached_tail) {
+        internal_data_->cached_tail = atomic_load_explicit(&internal_data_->tail, memory_order_acquire);
+        if(head == internal_data_->cached_tail) {
+            return RING_QUEUE_EMPTY;
+        }
+    }
+    const char* src = internal_data_->memory_pool + ((head & internal_data_->index_mask) * internal_data_->aligned_element_size);
+    core_copy_memory(src, out_data_, internal_data_->element_size);
+    atomic_store_explicit(&internal_data_->head, head + 1, memory_order_release);
+    return RING_QUEUE_SUCCESS;
+}
+
+// MPMC版push。スロットのシーケンス番号が書き込み位置と一致する場合のみ、CASでtailを進めてスロットを獲得する。
+// 書き込み完了後にシーケンス番号を位置+1に更新し、コンシューマに公開する。
+static RING_QUEUE_ERROR_CODE ring_queue_push_mpmc(ring_queue_internal_data_t* const internal_data_, const void* const data_) {
+    uint64_t pos = atomic_load_explicit(&internal_data_->tail, memory_order_relaxed);
+    for(;;) {
+        const uint64_t sequence = atomic_load_explicit(&internal_data_->sequences[pos & internal_data_->index_mask], memory_order_acquire);
+        const int64_t diff = (int64_t)(sequence - pos);
+        if(0 == diff) {
+            if(atomic_compare_exchange_weak_explicit(&internal_data_->tail, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+            // CAS失敗時はposが最新のtailに更新されているため、そのまま再試行する
+        } else if(diff < 0) {
+            return RING_QUEUE_FULL; // 1周前の要素がまだpopされていない
+        } else {
+            pos = atomic_load_explicit(&internal_data_->tail, memory_order_relaxed);    // 他のプロデューサに先を越された
+        }
+    }
+    const uint64_t index = pos & internal_data_->index_mask;
+    char* dst = internal_data_->memory_pool + (index * internal_data_->aligned_element_size);
+    core_copy_memory(data_, dst, internal_data_->element_size);
+    atomic_store_explicit(&internal_data_->sequences[index], pos + 1, memory_order_release);
+    return RING_QUEUE_SUCCESS;
+}
+
+// MPMC版pop。スロットのシーケンス番号が位置+1(書き込み完了)の場合のみ、CASでheadを進めてスロットを獲得する。
+// 読み出し完了後にシーケンス番号を次の周回の書き込み位置(位置+格納数)に更新し、プロデューサに返却する。
+static RING_QUEUE_ERROR_CODE ring_queue_pop_mpmc(ring_queue_internal_data_t* const internal_data_, void* const out_data_) {
+    uint64_t pos = atomic_load_explicit(&internal_data_->head, memory_order_relaxed);
+    for(;;) {
+        const uint64_t sequence = atomic_load_explicit(&internal_data_->sequences[pos & internal_data_->index_mask], memory_order_acquire);
+        const int64_t diff = (int64_t)(sequence - (pos + 1));
+        if(0 == diff) {
+            if(atomic_compare_exchange_weak_explicit(&internal_data_->head, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if(diff < 0) {
+            return RING_QUEUE_EMPTY;    // まだ書き込まれていない
+        } else {
+            pos = atomic_load_explicit(&internal_data_->head, memory_order_relaxed);    // 他のコンシューマに先を越された
+        }
+    }
+    const uint64_t index = pos & internal_data_->index_mask;
+    const char* src = internal_data_->memory_pool + (index * internal_data_->aligned_element_size);
+    core_copy_memory(src, out_data_, internal_data_->element_size);
+    atomic_store_explicit(&internal_data_->sequences[index], pos + internal_data_->max_element_count, memory_order_release);
+    return RING_QUEUE_SUCCESS;
+}
@@ -9,13 +9,18 @@
  * @copyright Copyright (c) 2025
  *
  */
+#define MESSAGE_MODULE_NAME STACK // メッセージ出力元モジュール(message.hより前に定義する)
+
 #include <stdint.h>
 #include <stdbool.h>
 #include <inttypes.h>
+#include <stdalign.h>
+
+#include "define.h"
 
 #include "containers/stack.h"
 
-#include "internal/stack_internal_data.h"
+#include "containers/internal/stack_internal_data.h"
 
 #include "core/message.h"
 #include "core/core_memory.h"
@@ -27,12 +32,24 @@ typedef enum FLAG_BIT_POSITION {
     FLAG_BIT_MAX = 0x03,
 } FLAG_BIT_POSITION;
 
+#if ENABLE_ARGUMENT_CHECK
 #define CHECK_ARG_NULL_RETURN_ERROR(func_name_, arg_name_, ptr_) \
     if(0 == ptr_) { \
         ERROR_MESSAGE("%s - Argument %s requires a valid pointer.", func_name_, arg_name_); \
         return STACK_ERROR_INVALID_ARGUMENT; \
     } \
 
+#define CHECK_VALID_STACK_RETURN_ERROR(func_name_, stack_) \
+    if(!valid_stack(stack_)) { \
+        ERROR_MESSAGE("%s - Provided stack is not valid.", func_name_); \
+        return STACK_ERROR_INVALID_STACK; \
+    } \
+
+#else
+#define CHECK_ARG_NULL_RETURN_ERROR(func_name_, arg_name_, ptr_) DEBUG_ASSERT(0 != (ptr_));
+#define CHECK_VALID_STACK_RETURN_ERROR(func_name_, stack_) DEBUG_ASSERT(valid_stack(stack_));
+#endif
+
 #define CHECK_ARG_NULL_RETURN_VOID(func_name_, arg_name_, ptr_) \
     if(0 == ptr_) { \
         WARN_MESSAGE("%s - Argument %s requires a valid pointer.", func_name_, arg_name_); \
@@ -43,6 +60,9 @@ static bool valid_stack(const stack_t* const stack_);
 static void flag_set(FLAG_BIT_POSITION bit_pos_, bool should_on_, uint8_t* dst_);
 static bool flag_get(FLAG_BIT_POSITION bit_pos_, uint8_t flags_);
 static bool is_power_of_two(uint64_t val_);
+static STACK_ERROR_CODE stack_create_internal(uint64_t element_size_, uint8_t alignment_requirement_, uint64_t max_element_count_, core_arena_t* const arena_, stack_t* const stack_);
+static void* stack_allocate(core_arena_t* const arena_, uint64_t size_, uint8_t alignment_requirement_);
+static void stack_free(core_arena_t* const arena_, void* const ptr_, uint64_t size_);
 
 void stack_default_create(stack_t* const stack_) {
     CHECK_ARG_NULL_RETURN_VOID("stack_default_create", "stack_", stack_);
@@ -51,67 +71,24 @@ void stack_default_create(stack_t* const stack_) {
 
 STACK_ERROR_CODE stack_create(uint64_t element_size_, uint8_t alignment_requirement_, uint64_t max_element_count_, stack_t* const stack_) {
     CHECK_ARG_NULL_RETURN_ERROR("stack_create", "stack_", stack_);
-    if(0 == element_size_ || 0 == alignment_requirement_ || 0 == max_element_count_) {
-        ERROR_MESSAGE("stack_create - Arguments element_size_ , alignment_requirement_ and max_element_count_ require non zero value.");
-        return STACK_ERROR_INVALID_ARGUMENT;
-    }
-    if(!is_power_of_two(alignment_requirement_)) {
-        ERROR_MESSAGE("stack_create - Argument alignment_requirement_ must be a power of two.");
-        return STACK_ERROR_INVALID_ARGUMENT;
-    }
-    stack_destroy(stack_);
-    stack_->internal_data = core_malloc(sizeof(stack_internal_data_t));
-    if(0 == stack_->internal_data) {
-        ERROR_MESSAGE("stack_create - Failed to allocate internal_data memory.");
-        return STACK_ERROR_MEMORY_ALLOCATE_ERROR;
-    }
-    core_zero_memory(stack_->internal_data, sizeof(stack_internal_data_t));
-    stack_internal_data_t* internal_data = (stack_internal_data_t*)(stack_->internal_data);
-    internal_data->valid_flags = 0;
-
-    internal_data->alignment_requirement = alignment_requirement_;
-    flag_set(FLAG_BIT_ALIGNMENT_REQUIREMENT, true, &internal_data->valid_flags);
-    if(0 != element_size_) {
-        internal_data->element_size = element_size_;
-        flag_set(FLAG_BIT_ELEMENT_SIZE, true, &internal_data->valid_flags);
-    } else {
-        ERROR_MESSAGE("stack_create - Argument element_size_ requires non-zero value.");
-        return STACK_ERROR_INVALID_ARGUMENT;
-    }
-    internal_data->max_element_count = max_element_count_;
-    if(0 != max_element_count_) {
-        flag_set(FLAG_BIT_MAX_ELEMENT_COUNT, true, &internal_data->valid_flags);
-    }
-
-    const uint64_t diff = element_size_ % internal_data->alignment_requirement;   // アライメントのズレ量
-    uint64_t padding_size = internal_data->alignment_requirement - diff;    // パディングサイズ
-    padding_size = padding_size % internal_data->alignment_requirement;     // ピッタリの時のために計算
-    internal_data->aligned_element_size = internal_data->element_size + padding_size;
-    if(internal_data->aligned_element_size > (UINT64_MAX / max_element_count_)) {
-        ERROR_MESSAGE("stack_create - Provided max_element_count_ is too big.");
-        return STACK_ERROR_INVALID_ARGUMENT;
-    }
-    internal_data->buffer_size = internal_data->aligned_element_size * internal_data->max_element_count;
-    internal_data->top_index = 0;
-
-    internal_data->memory_pool = core_malloc(internal_data->buffer_size);
-    if(0 == internal_data->memory_pool) {
-        ERROR_MESSAGE("stack_create - Failed to allocate memory_pool memory.");
-        return STACK_ERROR_MEMORY_ALLOCATE_ERROR;
-    }
-    core_zero_memory(internal_data->memory_pool, internal_data->buffer_size);
+    return stack_create_internal(element_size_, alignment_requirement_, max_element_count_, 0, stack_);
+}
 
-    return STACK_ERROR_CODE_SUCCESS;
+STACK_ERROR_CODE stack_create_with_arena(uint64_t element_size_, uint8_t alignment_requirement_, uint64_t max_element_count_, core_arena_t* const arena_, stack_t* const stack_) {
+    CHECK_ARG_NULL_RETURN_ERROR("stack_create_with_arena", "stack_", stack_);
+    CHECK_ARG_NULL_RETURN_ERROR("stack_create_with_arena", "arena_", arena_);
+    return stack_create_internal(element_size_, alignment_requirement_, max_element_count_, arena_, stack_);
 }
 
 void stack_destroy(stack_t* const stack_) {
     CHECK_ARG_NULL_RETURN_VOID("stack_destroy", "stack_", stack_);
     if(0 != stack_->internal_data) {
         stack_internal_data_t* internal_data = (stack_internal_data_t*)(stack_->internal_data);
-        core_free(internal_data->memory_pool);
+        core_arena_t* arena = internal_data->arena;
+        stack_free(arena, internal_data->memory_pool, internal_data->buffer_size);
         internal_data->memory_pool = 0;
+        stack_free(arena, stack_->internal_data, sizeof(stack_internal_data_t));
     }
-    core_free(stack_->internal_data);
     stack_->internal_data = 0;
 }
 
@@ -121,10 +98,7 @@ STACK_ERROR_CODE stack_reserve(uint64_t max_element_count_, stack_t* const stack
         ERROR_MESSAGE("stack_reserve - Argument max_element_count_ requires a non-zero value.");
         return STACK_ERROR_INVALID_ARGUMENT;
     }
-    if(!valid_stack(stack_)) {
-        ERROR_MESSAGE("stack_reserve - Provided stack is not valid.");
-        return STACK_ERROR_INVALID_STACK;
-    }
+    CHECK_VALID_STACK_RETURN_ERROR("stack_reserve", stack_);
     stack_internal_data_t* internal_data = (stack_internal_data_t*)(stack_->internal_data);
     if(internal_data->aligned_element_size > (UINT64_MAX / max_element_count_)) {
         ERROR_MESSAGE("stack_reserve - Provided max_element_count_ is too big.");
@@ -132,7 +106,7 @@ STACK_ERROR_CODE stack_reserve(uint64_t max_element_count_, stack_t* const stack
     }
 
     const uint64_t new_buffer_size = internal_data->aligned_element_size * max_element_count_;
-    void* new_buffer = core_malloc(new_buffer_size);
+    void* new_buffer = stack_allocate(internal_data->arena, new_buffer_size, internal_data->alignment_requirement);
     if(0 == new_buffer) {
         ERROR_MESSAGE("stack_reserve - Failed to allocate new buffer memory.");
         return STACK_ERROR_MEMORY_ALLOCATE_ERROR;
@@ -140,12 +114,13 @@ STACK_ERROR_CODE stack_reserve(uint64_t max_element_count_, stack_t* const stack
     core_zero_memory(new_buffer, new_buffer_size);
 
     void* old_buffer_ptr = internal_data->memory_pool;
+    const uint64_t old_buffer_size = internal_data->buffer_size;
     internal_data->memory_pool = new_buffer;
     internal_data->max_element_count = max_element_count_;
     internal_data->buffer_size = internal_data->aligned_element_size * max_element_count_;
     internal_data->top_index = 0;
 
-    core_free((void*)old_buffer_ptr);
+    stack_free(internal_data->arena, (void*)old_buffer_ptr, old_buffer_size);
     return STACK_ERROR_CODE_SUCCESS;
 }
 
@@ -155,10 +130,7 @@ STACK_ERROR_CODE stack_resize(uint64_t max_element_count_, stack_t* const stack_
         ERROR_MESSAGE("stack_resize - Argument max_element_count_ requires a non-zero value.");
         return STACK_ERROR_INVALID_ARGUMENT;
     }
-    if(!valid_stack(stack_)) {
-        ERROR_MESSAGE("stack_resize - Provided stack is not valid.");
-        return STACK_ERROR_INVALID_STACK;
-    }
+    CHECK_VALID_STACK_RETURN_ERROR("stack_resize", stack_);
     stack_internal_data_t* internal_data = (stack_internal_data_t*)(stack_->internal_data);
     if(max_element_count_ <= internal_data->max_element_count) {
         ERROR_MESSAGE("stack_resize - Shrinking the buffer is not allowed.");
@@ -176,50 +148,46 @@ STACK_ERROR_CODE stack_resize(uint64_t max_element_count_, stack_t* const stack_
 
     // 新バッファメモリ確保
     const uint64_t new_buffer_size = internal_data->aligned_element_size * max_element_count_;
-    void* new_buffer = core_malloc(new_buffer_size);
+    void* new_buffer = stack_allocate(internal_data->arena, new_buffer_size, internal_data->alignment_requirement);
     if(0 == new_buffer) {
         ERROR_MESSAGE("stack_resize - Failed to allocate new buffer memory.");
         return STACK_ERROR_MEMORY_ALLOCATE_ERROR;
     }
-    core_zero_memory(new_buffer, new_buffer_size);
 
-    // 旧バッファからデータコピー
+    // 旧バッファからデータコピー(コピーしない残りの領域のみ0クリアする)
     char* old_buffer_ptr = (char*)(internal_data->memory_pool);
     char* new_buffer_ptr = (char*)(new_buffer);
-    for(uint64_t i = 0; i != (internal_data->aligned_element_size * internal_data->top_index); ++i) {
-        new_buffer_ptr[i] = old_buffer_ptr[i];
-    }
+    const uint64_t copy_size = internal_data->aligned_element_size * internal_data->top_index;
+    core_copy_memory(old_buffer_ptr, new_buffer_ptr, copy_size);
+    core_zero_memory(new_buffer_ptr + copy_size, new_buffer_size - copy_size);
 
     // ポインタ差し替え
+    const uint64_t old_buffer_size = internal_data->buffer_size;
     internal_data->memory_pool = new_buffer;
 
     internal_data->max_element_count = max_element_count_;
     internal_data->buffer_size = new_buffer_size;
 
-    core_free((void*)(old_buffer_ptr));
+    stack_free(internal_data->arena, (void*)(old_buffer_ptr), old_buffer_size);
     return STACK_ERROR_CODE_SUCCESS;
 }
 
 STACK_ERROR_CODE stack_push(stack_t* const stack_, const void* const data_) {
     CHECK_ARG_NULL_RETURN_ERROR("stack_push", "stack_", stack_);
     CHECK_ARG_NULL_RETURN_ERROR("stack_push", "data_", data_);
-    if(!valid_stack(stack_)) {    // internal_dataが0の場合にstack_full=trueとなるため、この判定と下のstack_fullの判定を入れ替えないこと！！
-        ERROR_MESSAGE("stack_push - Provided stack is not valid.");
-        return STACK_ERROR_INVALID_STACK;
-    }
-    if(stack_full(stack_)) {
+    CHECK_VALID_STACK_RETURN_ERROR("stack_push", stack_);
+    stack_internal_data_t* internal_data = (stack_internal_data_t*)(stack_->internal_data);
+    if(internal_data->top_index >= internal_data->max_element_count) {
         ERROR_MESSAGE("stack_push - Provided stack is full.");
         return STACK_ERROR_STACK_FULL;
     }
-    stack_internal_data_t* internal_data = (stack_internal_data_t*)(stack_->internal_data);
     char* base = (char*)(internal_data->memory_pool);
     char* dst = base + (internal_data->top_index * internal_data->aligned_element_size);
     char* src = (char*)(data_);
-    core_zero_memory((void*)dst, internal_data->aligned_element_size);  // この後のコピーではelement_size分しかコピーされないため、パディング領域が未初期化になる。
-                                                                        // この場合、resizeでバッファをコピーする際に未初期化領域にアクセスすることになり、valgrind等でワーニングが出る
-    for(uint64_t i = 0; i != internal_data->element_size; ++i) {
-        dst[i] = src[i];
-    }
+    core_copy_memory(src, dst, internal_data->element_size);
+    // element_size分しかコピーしないため、パディング領域を0クリアしておく。
+    // 未初期化のままだと、resizeでバッファをコピーする際に未初期化領域にアクセスすることになり、valgrind等でワーニングが出る
+    core_zero_memory((void*)(dst + internal_data->element_size), internal_data->aligned_element_size - internal_data->element_size);
     internal_data->top_index++;
     return STACK_ERROR_CODE_SUCCESS;
 }
@@ -227,21 +195,16 @@ STACK_ERROR_CODE stack_push(stack_t* const stack_, const void* const data_) {
 STACK_ERROR_CODE stack_pop(const stack_t* const stack_, void* const out_data_) {
     CHECK_ARG_NULL_RETURN_ERROR("stack_pop", "stack_", stack_);
     CHECK_ARG_NULL_RETURN_ERROR("stack_pop", "out_data_", out_data_);
-    if(!valid_stack(stack_)) {    // internal_dataが0の場合にstack_empty=trueとなるため、この判定と下のstack_emptyの判定を入れ替えないこと！！
-        ERROR_MESSAGE("stack_pop - Provided stack is not valid.");
-        return STACK_ERROR_INVALID_STACK;
-    }
-    if(stack_empty(stack_)) {
+    CHECK_VALID_STACK_RETURN_ERROR("stack_pop", stack_);
+    stack_internal_data_t* internal_data = (stack_internal_data_t*)(stack_->internal_data);
+    if(0 == internal_data->top_index) {
         ERROR_MESSAGE("stack_pop - Provided stack is empty.");
         return STACK_ERROR_STACK_EMPTY;
     }
-    stack_internal_data_t* internal_data = (stack_internal_data_t*)(stack_->internal_data);
     char* dst = (char*)(out_data_);
     char* base = (char*)(internal_data->memory_pool);
     char* src = base + ((internal_data->top_index - 1) * internal_data->aligned_element_size);
-    for(uint64_t i = 0; i != internal_data->element_size; ++i) {
-        dst[i] = src[i];
-    }
+    core_copy_memory(src, dst, internal_data->element_size);
     internal_data->top_index--;
     return STACK_ERROR_CODE_SUCCESS;
 }
@@ -249,15 +212,12 @@ STACK_ERROR_CODE stack_pop(const stack_t* const stack_, void* const out_data_) {
 STACK_ERROR_CODE stack_pop_peek_ptr(const stack_t* const stack_, const void* *out_data_) {
     CHECK_ARG_NULL_RETURN_ERROR("stack_pop_peek_ptr", "stack_", stack_);
     CHECK_ARG_NULL_RETURN_ERROR("stack_pop_peek_ptr", "out_data_", out_data_);
-    if(!valid_stack(stack_)) {    // internal_dataが0の場合にstack_empty=trueとなるため、この判定と下のstack_emptyの判定を入れ替えないこと！！
-        ERROR_MESSAGE("stack_pop_peek_ptr - Provided stack is not valid.");
-        return STACK_ERROR_INVALID_STACK;
-    }
-    if(stack_empty(stack_)) {
+    CHECK_VALID_STACK_RETURN_ERROR("stack_pop_peek_ptr", stack_);
+    stack_internal_data_t* internal_data = (stack_internal_data_t*)(stack_->internal_data);
+    if(0 == internal_data->top_index) {
         ERROR_MESSAGE("stack_pop_peek_ptr - Provided stack is empty.");
         return STACK_ERROR_STACK_EMPTY;
     }
-    stack_internal_data_t* internal_data = (stack_internal_data_t*)(stack_->internal_data);
     char* base = (char*)(internal_data->memory_pool);
     *out_data_ = (const void*)(base + (internal_data->top_index - 1) * internal_data->aligned_element_size);
 
@@ -266,25 +226,19 @@ STACK_ERROR_CODE stack_pop_peek_ptr(const stack_t* const stack_, const void* *ou
 
 STACK_ERROR_CODE stack_discard_top(const stack_t* const stack_) {
     CHECK_ARG_NULL_RETURN_ERROR("stack_discard_top", "stack_", stack_);
-    if(!valid_stack(stack_)) {    // internal_dataが0の場合にstack_empty=trueとなるため、この判定と下のstack_emptyの判定を入れ替えないこと！！
-        ERROR_MESSAGE("stack_discard_top - Provided stack is not valid.");
-        return STACK_ERROR_INVALID_STACK;
-    }
-    if(stack_empty(stack_)) {
+    CHECK_VALID_STACK_RETURN_ERROR("stack_discard_top", stack_);
+    stack_internal_data_t* internal_data = (stack_internal_data_t*)(stack_->internal_data);
+    if(0 == internal_data->top_index) {
         ERROR_MESSAGE("stack_discard_top - Provided stack is empty.");
         return STACK_ERROR_STACK_EMPTY;
     }
-    stack_internal_data_t* internal_data = (stack_internal_data_t*)(stack_->internal_data);
     internal_data->top_index--;
     return STACK_ERROR_CODE_SUCCESS;
 }
 
 STACK_ERROR_CODE stack_clear(stack_t* const stack_) {
     CHECK_ARG_NULL_RETURN_ERROR("stack_clear", "stack_", stack_);
-    if(!valid_stack(stack_)) {    // internal_dataが0の場合にstack_empty=trueとなるため、この判定と下のstack_emptyの判定を入れ替えないこと！！
-        ERROR_MESSAGE("stack_clear - Provided stack is not valid.");
-        return STACK_ERROR_INVALID_STACK;
-    }
+    CHECK_VALID_STACK_RETURN_ERROR("stack_clear", stack_);
     stack_internal_data_t* internal_data = (stack_internal_data_t*)(stack_->internal_data);
     internal_data->top_index = 0;
     return STACK_ERROR_CODE_SUCCESS;
@@ -293,10 +247,7 @@ STACK_ERROR_CODE stack_clear(stack_t* const stack_) {
 STACK_ERROR_CODE stack_capacity(const stack_t* const stack_, uint64_t* const out_capacity_) {
     CHECK_ARG_NULL_RETURN_ERROR("stack_capacity", "stack_", stack_);
     CHECK_ARG_NULL_RETURN_ERROR("stack_capacity", "out_capacity_", out_capacity_);
-    if(!valid_stack(stack_)) {
-        ERROR_MESSAGE("stack_capacity - Provided stack is not valid.");
-        return STACK_ERROR_INVALID_STACK;
-    }
+    CHECK_VALID_STACK_RETURN_ERROR("stack_capacity", stack_);
     stack_internal_data_t* internal_data = (stack_internal_data_t*)(stack_->internal_data);
     *out_capacity_ = internal_data->max_element_count;
     return STACK_ERROR_CODE_SUCCESS;
@@ -421,3 +372,78 @@ static bool flag_get(FLAG_BIT_POSITION bit_pos_, uint8_t flags_) {
 static bool is_power_of_two(uint64_t val_) {
     return (0 != val_) && (0 == (val_ & (val_ - 1)));
 }
+
+// stack_create / stack_create_with_arenaの共通処理(arena_がNULLの場合はヒープから確保する)
+static STACK_ERROR_CODE stack_create_internal(uint64_t element_size_, uint8_t alignment_requirement_, uint64_t max_element_count_, core_arena_t* const arena_, stack_t* const stack_) {
+    if(0 == element_size_ || 0 == alignment_requirement_ || 0 == max_element_count_) {
+        ERROR_MESSAGE("stack_create - Arguments element_size_ , alignment_requirement_ and max_element_count_ require non zero value.");
+        return STACK_ERROR_INVALID_ARGUMENT;
+    }
+    if(!is_power_of_two(alignment_requirement_)) {
+        ERROR_MESSAGE("stack_create - Argument alignment_requirement_ must be a power of two.");
+        return STACK_ERROR_INVALID_ARGUMENT;
+    }
+    stack_destroy(stack_);
+    stack_->internal_data = stack_allocate(arena_, sizeof(stack_internal_data_t), alignof(stack_internal_data_t));
+    if(0 == stack_->internal_data) {
+        ERROR_MESSAGE("stack_create - Failed to allocate internal_data memory.");
+        return STACK_ERROR_MEMORY_ALLOCATE_ERROR;
+    }
+    core_zero_memory(stack_->internal_data, sizeof(stack_internal_data_t));
+    stack_internal_data_t* internal_data = (stack_internal_data_t*)(stack_->internal_data);
+    internal_data->valid_flags = 0;
+    internal_data->arena = arena_;
+
+    internal_data->alignment_requirement = alignment_requirement_;
+    flag_set(FLAG_BIT_ALIGNMENT_REQUIREMENT, true, &internal_data->valid_flags);
+    if(0 != element_size_) {
+        internal_data->element_size = element_size_;
+        flag_set(FLAG_BIT_ELEMENT_SIZE, true, &internal_data->valid_flags);
+    } else {
+        ERROR_MESSAGE("stack_create - Argument element_size_ requires non-zero value.");
+        return STACK_ERROR_INVALID_ARGUMENT;
+    }
+    internal_data->max_element_count = max_element_count_;
+    if(0 != max_element_count_) {
+        flag_set(FLAG_BIT_MAX_ELEMENT_COUNT, true, &internal_data->valid_flags);
+    }
+
+    const uint64_t diff = element_size_ % internal_data->alignment_requirement;   // アライメントのズレ量
+    uint64_t padding_size = internal_data->alignment_requirement - diff;    // パディングサイズ
+    padding_size = padding_size % internal_data->alignment_requirement;     // ピッタリの時のために計算
+    internal_data->aligned_element_size = internal_data->element_size + padding_size;
+    if(internal_data->aligned_element_size > (UINT64_MAX / max_element_count_)) {
+        ERROR_MESSAGE("stack_create - Provided max_element_count_ is too big.");
+        return STACK_ERROR_INVALID_ARGUMENT;
+    }
+    internal_data->buffer_size = internal_data->aligned_element_size * internal_data->max_element_count;
+    internal_data->top_index = 0;
+
+    internal_data->memory_pool = stack_allocate(arena_, internal_data->buffer_size, internal_data->alignment_requirement);
+    if(0 == internal_data->memory_pool) {
+        ERROR_MESSAGE("stack_create - Failed to allocate memory_pool memory.");
+        return STACK_ERROR_MEMORY_ALLOCATE_ERROR;
+    }
+    core_zero_memory(internal_data->memory_pool, internal_data->buffer_size);
+
+    return STACK_ERROR_CODE_SUCCESS;
+}
+
+// arena_が指定されていればアリーナから、そうでなければヒープからメモリを確保する
+static void* stack_allocate(core_arena_t* const arena_, uint64_t size_, uint8_t alignment_requirement_) {
+    if(0 == arena_) {
+        return core_malloc_tagged(size_, MEMORY_TAG_STACK);
+    }
+    void* ptr = 0;
+    if(CORE_MEMORY_SUCCESS != core_arena_allocate(size_, alignment_requirement_, arena_, &ptr)) {
+        return 0;
+    }
+    return ptr;
+}
+
+// アリーナから確保した領域はcore_arena_reset()で一括破棄されるため、ヒープから確保した領域のみ解放する
+static void stack_free(core_arena_t* const arena_, void* const ptr_, uint64_t size_) {
+    if(0 == arena_) {
+        core_free_tagged(ptr_, size_, MEMORY_TAG_STACK);
+    }
+}
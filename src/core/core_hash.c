@@ -0,0 +1,496 @@
+/**
+ * @file core_hash.c
+ * @author chocolate-pie24
+ * @brief 非暗号学的64bitハッシュ関数の実装
+ *
+ * @details
+ * - CORE_HASH_LONG_THRESHOLD byte以下: wyhash方式。16byte以下は先頭と末尾を重ねて読み、それより長い入力は48byte単位で3系列を並行して混合する
+ * - それより長い入力: xxh3方式。8レーンの累積値に、64byteのストライプごとに
+ *   「入力 ^ 鍵」の上位32bit x 下位32bitの積と、隣のレーンの入力を加算する。
+ *   HASH_STRIPES_PER_BLOCK ストライプごとに累積値を攪拌し、最後に入力末尾の64byteを累積して8レーンを1つに畳み込む
+ *
+ * 累積と攪拌はcore_string_kernel.cと同様に命令セットごとの関数テーブルで実装し、初回使用時に実行環境に合わせて選択する。
+ * - x86_64: SSE2(コンパイル時に常に有効)、AVX2(実行時に判定)
+ * - ARM: NEON
+ * - その他: 64bit整数演算
+ * どの実装も同じ演算を行うため、命令セットによらず同じハッシュ値となる。
+ *
+ * @version 0.1
+ * @date 2025-07-20
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#define MESSAGE_MODULE_NAME CORE_HASH // メッセージ出力元モジュール(message.hより前に定義する)
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <string.h> // for memcpy
+
+#include "core/core_hash.h"
+#include "core/message.h"
+
+#include "define.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <immintrin.h>
+#elif defined(__ARM_NEON)
+    #include <arm_neon.h>
+#endif
+
+#if defined(__SSE2__)
+    #define HASH_KERNEL_SSE2 1
+#elif defined(__ARM_NEON)
+    #define HASH_KERNEL_NEON 1
+#else
+    #define HASH_KERNEL_WORD 1
+#endif
+
+// AVX2はコンパイル時には有効にせず、target属性でAVX2版のみをコンパイルして実行時に切り替える
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    #define HASH_KERNEL_AVX2 1
+#endif
+
+#if ENABLE_ARGUMENT_CHECK
+#define CHECK_ARG_NULL_RETURN_ERROR(func_name_, arg_name_, ptr_) \
+    if(0 == ptr_) { \
+        ERROR_MESSAGE("%s - Argument %s requires a valid pointer.", func_name_, arg_name_); \
+        return CORE_HASH_INVALID_ARGUMENT; \
+    } \
+
+#else
+#define CHECK_ARG_NULL_RETURN_ERROR(func_name_, arg_name_, ptr_) DEBUG_ASSERT(0 != (ptr_));
+#endif
+
+/**
+ * @brief 累積値の攪拌間隔(ストライプ数)
+ *
+ */
+#define HASH_STRIPES_PER_BLOCK 16
+
+#define HASH_PRIME32_1 0x9E3779B1ull
+#define HASH_PRIME32_2 0x85EBCA77ull
+#define HASH_PRIME32_3 0xC2B2AE3Dull
+#define HASH_PRIME64_1 0x9E3779B185EBCA87ull
+#define HASH_PRIME64_2 0xC2B2AE3D27D4EB4Full
+#define HASH_PRIME64_3 0x165667B19E3779F9ull
+#define HASH_PRIME64_4 0x85EBCA77C2B2AE63ull
+#define HASH_PRIME64_5 0x27D4EB2F165667C5ull
+
+/**
+ * @brief 短い入力の混合に使用する定数(wyhashと同じ値)
+ *
+ */
+static const uint64_t s_short_secret[4] = {
+    0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull,
+};
+
+/**
+ * @brief 長い入力の累積に使用する鍵
+ *
+ * ブロック内のn番目のストライプは[n, n + 8)、攪拌は[16, 24)、最終ストライプは[11, 19)、畳み込みは[3, 11)を使用する。
+ */
+static const uint64_t s_long_secret[24] = {
+    0x4063e00bcd986211ull, 0x807011ebbb313dc0ull, 0x43bd4d7e779b1868ull, 0x220d7ec88f2b9479ull,
+    0x278cd57fecfa04a7ull, 0x766e1ed369de33bcull, 0x954eb03939ccef49ull, 0x0747011eabddfd30ull,
+    0x61d11b0d2cd6f7a0ull, 0x6fd352e4f53c07a1ull, 0xd8d378d7b0af1cc3ull, 0xd59eac4d96259993ull,
+    0x2d5e700971427abcull, 0xc641b3593c048f38ull, 0xd7027ea8270c7065ull, 0xace90949cab5d462ull,
+    0x07c51b93c9d62408ull, 0x3bfbee7236bb6ed2ull, 0xfaf90dcfcb457799ull, 0x0495a646f04c4918ull,
+    0x3c809c06ab097505ull, 0xa6fe78c270944945ull, 0xdd5ea9110f1a8b4aull, 0xad7f6ef6febda639ull,
+};
+
+/**
+ * @brief CORE_HASH_DEFAULT_SEED を短い入力用に混合した値(hash_map_t等、標準シードでの呼び出しで乗算を1回省略する)
+ *
+ */
+#define HASH_DEFAULT_SEED_MIXED 0x16d54717a54eabcbull
+
+#define HASH_SCRAMBLE_KEY (s_long_secret + 16)
+#define HASH_LAST_STRIPE_KEY (s_long_secret + 11)
+#define HASH_MERGE_KEY (s_long_secret + 3)
+
+typedef void (*pfn_hash_accumulate_t)(uint64_t* acc_, const unsigned char* input_, uint64_t stripe_count_, const uint64_t* key_);
+typedef void (*pfn_hash_scramble_t)(uint64_t* acc_, const uint64_t* key_);
+
+/**
+ * @brief 命令セットごとの累積 / 攪拌関数テーブル
+ *
+ */
+typedef struct hash_kernel_table_t {
+    const char* name;                   /**< 命令セット名 */
+    pfn_hash_accumulate_t accumulate;   /**< stripe_count_個のストライプを累積する(i番目のストライプはkey_ + iの鍵を使用する) */
+    pfn_hash_scramble_t scramble;       /**< 累積値を攪拌する */
+} hash_kernel_table_t;
+
+static uint64_t hash_short(const unsigned char* input_, uint64_t length_, uint64_t seed_);
+static uint64_t hash_long(const unsigned char* input_, uint64_t length_, uint64_t seed_);
+static void hash_long_init(uint64_t* acc_, uint64_t seed_);
+static void hash_long_accumulate(uint64_t* acc_, const unsigned char* input_, uint64_t stripe_count_, uint64_t* block_stripe_, const hash_kernel_table_t* kernels_);
+static uint64_t hash_long_finalize(uint64_t* acc_, const unsigned char* last_stripe_, uint64_t length_, uint64_t seed_, const hash_kernel_table_t* kernels_);
+static const hash_kernel_table_t* hash_kernels_get(void);
+
+uint64_t core_hash_bytes(const void* const data_, uint64_t length_, uint64_t seed_) {
+    if(0 == data_ && 0 != length_) {
+        ERROR_MESSAGE("core_hash_bytes - Argument data_ requires a valid pointer.");
+        length_ = 0;
+    }
+    if(length_ <= CORE_HASH_LONG_THRESHOLD) {
+        return hash_short((const unsigned char*)data_, length_, seed_);
+    }
+    return hash_long((const unsigned char*)data_, length_, seed_);
+}
+
+CORE_HASH_ERROR_CODE core_hash_state_init(uint64_t seed_, core_hash_state_t* const state_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_hash_state_init", "state_", state_);
+    hash_long_init(state_->acc, seed_);
+    state_->seed = seed_;
+    state_->total_length = 0;
+    state_->stripe_count = 0;
+    state_->buffer_size = 0;
+    return CORE_HASH_SUCCESS;
+}
+
+CORE_HASH_ERROR_CODE core_hash_state_update(const void* const data_, uint64_t length_, core_hash_state_t* const state_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_hash_state_update", "state_", state_);
+    if(0 == length_) {
+        return CORE_HASH_SUCCESS;
+    }
+    CHECK_ARG_NULL_RETURN_ERROR("core_hash_state_update", "data_", data_);
+    const unsigned char* input = (const unsigned char*)data_;
+    state_->total_length += length_;
+    if(state_->buffer_size + length_ <= CORE_HASH_LONG_THRESHOLD) {
+        memcpy(state_->buffer + state_->buffer_size, input, length_);
+        state_->buffer_size += length_;
+        return CORE_HASH_SUCCESS;
+    }
+
+    // 後続の入力があることが確定したストライプのみ累積する(最後の1byte以上はdigestまで保持する)
+    const hash_kernel_table_t* kernels = hash_kernels_get();
+    if(0 != state_->buffer_size) {
+        const uint64_t fill = CORE_HASH_LONG_THRESHOLD - state_->buffer_size;
+        memcpy(state_->buffer + state_->buffer_size, input, fill);
+        input += fill;
+        length_ -= fill;
+        hash_long_accumulate(state_->acc, state_->buffer, CORE_HASH_LONG_THRESHOLD / CORE_HASH_STRIPE_SIZE, &state_->stripe_count, kernels);
+        memcpy(state_->last_stripe, state_->buffer + CORE_HASH_LONG_THRESHOLD - CORE_HASH_STRIPE_SIZE, CORE_HASH_STRIPE_SIZE);
+        state_->buffer_size = 0;
+    }
+    if(length_ > CORE_HASH_LONG_THRESHOLD) {
+        const uint64_t stripe_count = (length_ - 1) / CORE_HASH_STRIPE_SIZE;
+        hash_long_accumulate(state_->acc, input, stripe_count, &state_->stripe_count, kernels);
+        input += stripe_count * CORE_HASH_STRIPE_SIZE;
+        length_ -= stripe_count * CORE_HASH_STRIPE_SIZE;
+        memcpy(state_->last_stripe, input - CORE_HASH_STRIPE_SIZE, CORE_HASH_STRIPE_SIZE);
+    }
+    memcpy(state_->buffer, input, length_);
+    state_->buffer_size = length_;
+    return CORE_HASH_SUCCESS;
+}
+
+uint64_t core_hash_state_digest(const core_hash_state_t* const state_) {
+    if(0 == state_) {
+        ERROR_MESSAGE("core_hash_state_digest - Argument state_ requires a valid pointer.");
+        return 0;
+    }
+    if(state_->total_length <= CORE_HASH_LONG_THRESHOLD) {
+        return hash_short(state_->buffer, state_->total_length, state_->seed);
+    }
+    // state_を変更しないよう、累積値の複製に残りのストライプを累積する
+    const hash_kernel_table_t* kernels = hash_kernels_get();
+    uint64_t acc[8];
+    memcpy(acc, state_->acc, sizeof(acc));
+    uint64_t block_stripe = state_->stripe_count;
+    hash_long_accumulate(acc, state_->buffer, (state_->buffer_size - 1) / CORE_HASH_STRIPE_SIZE, &block_stripe, kernels);
+
+    // 最終ストライプは入力末尾の64byte(保持している入力が足りない場合は累積済みの入力の末尾で補う)
+    unsigned char last_stripe[CORE_HASH_STRIPE_SIZE];
+    const unsigned char* last = state_->buffer + state_->buffer_size - CORE_HASH_STRIPE_SIZE;
+    if(state_->buffer_size < CORE_HASH_STRIPE_SIZE) {
+        const uint64_t carry = CORE_HASH_STRIPE_SIZE - state_->buffer_size;
+        memcpy(last_stripe, state_->last_stripe + state_->buffer_size, carry);
+        memcpy(last_stripe + carry, state_->buffer, state_->buffer_size);
+        last = last_stripe;
+    }
+    return hash_long_finalize(acc, last, state_->total_length, state_->seed, kernels);
+}
+
+const char* core_hash_kernel_name(void) {
+    return hash_kernels_get()->name;
+}
+
+const char* core_hash_error_code_to_string(CORE_HASH_ERROR_CODE err_code_) {
+    switch(err_code_) {
+        case CORE_HASH_SUCCESS:
+            return "core hash error code: success.";
+        case CORE_HASH_INVALID_ARGUMENT:
+            return "core hash error code: invalid argument.";
+        default:
+            return "core hash error code: undefined error.";
+    }
+}
+
+// 64bit x 64bit の128bit積の下位を返し、上位をout_high_に格納する(128bit整数型がない処理系では32bit x 32bitの積で組み立てる)
+static inline uint64_t hash_multiply(uint64_t a_, uint64_t b_, uint64_t* const out_high_) {
+#if defined(__SIZEOF_INT128__)
+    __extension__ const unsigned __int128 product = (unsigned __int128)a_ * b_;
+    *out_high_ = (uint64_t)(product >> 64);
+    return (uint64_t)product;
+#else
+    const uint64_t a_low = a_ & 0xFFFFFFFFull;
+    const uint64_t a_high = a_ >> 32;
+    const uint64_t b_low = b_ & 0xFFFFFFFFull;
+    const uint64_t b_high = b_ >> 32;
+    const uint64_t low_low = a_low * b_low;
+    const uint64_t high_low = a_high * b_low;
+    const uint64_t low_high = a_low * b_high;
+    const uint64_t middle = (low_low >> 32) + (high_low & 0xFFFFFFFFull) + low_high;
+    *out_high_ = a_high * b_high + (high_low >> 32) + (middle >> 32);
+    return (middle << 32) | (low_low & 0xFFFFFFFFull);
+#endif
+}
+
+// 64bit x 64bit の128bit積の上位と下位のXOR
+static inline uint64_t hash_mix(uint64_t a_, uint64_t b_) {
+    uint64_t high = 0;
+    const uint64_t low = hash_multiply(a_, b_, &high);
+    return low ^ high;
+}
+
+static inline uint64_t hash_read64(const unsigned char* const p_) {
+    uint64_t value = 0;
+    memcpy(&value, p_, sizeof(value));
+    return value;
+}
+
+static inline uint64_t hash_read32(const unsigned char* const p_) {
+    uint32_t value = 0;
+    memcpy(&value, p_, sizeof(value));
+    return value;
+}
+
+// wyhash方式(CORE_HASH_LONG_THRESHOLD byte以下の入力)
+static uint64_t hash_short(const unsigned char* input_, uint64_t length_, uint64_t seed_) {
+    const uint64_t* secret = s_short_secret;
+    const unsigned char* p = input_;
+    uint64_t seed = (CORE_HASH_DEFAULT_SEED == seed_) ? HASH_DEFAULT_SEED_MIXED : (seed_ ^ hash_mix(seed_ ^ secret[0], secret[1]));
+    uint64_t a = 0;
+    uint64_t b = 0;
+    if(length_ <= 16) {
+        if(length_ >= 4) {
+            const uint64_t shift = (length_ >> 3) << 2;
+            a = (hash_read32(p) << 32) | hash_read32(p + shift);
+            b = (hash_read32(p + length_ - 4) << 32) | hash_read32(p + length_ - 4 - shift);
+        } else if(length_ > 0) {
+            a = ((uint64_t)p[0] << 16) | ((uint64_t)p[length_ >> 1] << 8) | p[length_ - 1];
+        }
+    } else {
+        uint64_t i = length_;
+        if(i > 48) {
+            uint64_t see1 = seed;
+            uint64_t see2 = seed;
+            do {
+                seed = hash_mix(hash_read64(p) ^ secret[1], hash_read64(p + 8) ^ seed);
+                see1 = hash_mix(hash_read64(p + 16) ^ secret[2], hash_read64(p + 24) ^ see1);
+                see2 = hash_mix(hash_read64(p + 32) ^ secret[3], hash_read64(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while(i > 48);
+            seed ^= see1 ^ see2;
+        }
+        while(i > 16) {
+            seed = hash_mix(hash_read64(p) ^ secret[1], hash_read64(p + 8) ^ seed);
+            p += 16;
+            i -= 16;
+        }
+        a = hash_read64(p + i - 16);
+        b = hash_read64(p + i - 8);
+    }
+    a ^= secret[1];
+    b ^= seed;
+    uint64_t high = 0;
+    a = hash_multiply(a, b, &high);
+    b = high;
+    return hash_mix(a ^ secret[0] ^ length_, b ^ secret[1]);
+}
+
+// xxh3方式(CORE_HASH_LONG_THRESHOLD byteより長い入力)
+static uint64_t hash_long(const unsigned char* input_, uint64_t length_, uint64_t seed_) {
+    const hash_kernel_table_t* kernels = hash_kernels_get();
+    uint64_t acc[8];
+    uint64_t block_stripe = 0;
+    hash_long_init(acc, seed_);
+    hash_long_accumulate(acc, input_, (length_ - 1) / CORE_HASH_STRIPE_SIZE, &block_stripe, kernels);
+    return hash_long_finalize(acc, input_ + length_ - CORE_HASH_STRIPE_SIZE, length_, seed_, kernels);
+}
+
+static void hash_long_init(uint64_t* acc_, uint64_t seed_) {
+    static const uint64_t init[8] = {
+        HASH_PRIME32_3, HASH_PRIME64_1, HASH_PRIME64_2, HASH_PRIME64_3, HASH_PRIME64_4, HASH_PRIME32_2, HASH_PRIME64_5, HASH_PRIME32_1,
+    };
+    for(uint64_t i = 0; i != 8; ++i) {
+        acc_[i] = init[i] + ((0 != (i & 1)) ? (0 - seed_) : seed_);
+    }
+}
+
+// stripe_count_個のストライプを累積する(block_stripe_はブロック内の位置で、ブロック境界で累積値を攪拌する)
+static void hash_long_accumulate(uint64_t* acc_, const unsigned char* input_, uint64_t stripe_count_, uint64_t* block_stripe_, const hash_kernel_table_t* kernels_) {
+    while(0 != stripe_count_) {
+        uint64_t count = HASH_STRIPES_PER_BLOCK - *block_stripe_;
+        if(count > stripe_count_) {
+            count = stripe_count_;
+        }
+        kernels_->accumulate(acc_, input_, count, s_long_secret + *block_stripe_);
+        input_ += count * CORE_HASH_STRIPE_SIZE;
+        stripe_count_ -= count;
+        *block_stripe_ += count;
+        if(HASH_STRIPES_PER_BLOCK == *block_stripe_) {
+            kernels_->scramble(acc_, HASH_SCRAMBLE_KEY);
+            *block_stripe_ = 0;
+        }
+    }
+}
+
+// 最終ストライプを累積し、8レーンを1つのハッシュ値に畳み込む
+static uint64_t hash_long_finalize(uint64_t* acc_, const unsigned char* last_stripe_, uint64_t length_, uint64_t seed_, const hash_kernel_table_t* kernels_) {
+    kernels_->accumulate(acc_, last_stripe_, 1, HASH_LAST_STRIPE_KEY);
+    uint64_t hash = (length_ * HASH_PRIME64_1) ^ seed_;
+    for(uint64_t i = 0; i != 4; ++i) {
+        hash += hash_mix(acc_[2 * i] ^ HASH_MERGE_KEY[2 * i], acc_[2 * i + 1] ^ HASH_MERGE_KEY[2 * i + 1]);
+    }
+    hash ^= hash >> 37;
+    hash *= 0x165667919E3779F9ull;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+#if HASH_KERNEL_WORD
+static void accumulate_word(uint64_t* acc_, const unsigned char* input_, uint64_t stripe_count_, const uint64_t* key_) {
+    for(uint64_t s = 0; s != stripe_count_; ++s) {
+        const unsigned char* p = input_ + s * CORE_HASH_STRIPE_SIZE;
+        for(uint64_t i = 0; i != 8; ++i) {
+            const uint64_t value = hash_read64(p + 8 * i);
+            const uint64_t key = value ^ key_[s + i];
+            acc_[i ^ 1] += value;
+            acc_[i] += (key & 0xFFFFFFFFull) * (key >> 32);
+        }
+    }
+}
+
+static void scramble_word(uint64_t* acc_, const uint64_t* key_) {
+    for(uint64_t i = 0; i != 8; ++i) {
+        uint64_t acc = acc_[i];
+        acc ^= acc >> 47;
+        acc ^= key_[i];
+        acc_[i] = acc * HASH_PRIME32_1;
+    }
+}
+
+static const hash_kernel_table_t s_baseline_kernels = { "word", accumulate_word, scramble_word };
+#endif
+
+/**
+ * @brief SSE2 / AVX2の累積 / 攪拌関数を生成する
+ *
+ * @note 64bitレーンごとに、_mm_mul_epu32で下位32bit同士の積を求める(上位32bitはshuffleで下位に移す)。
+ *       隣のレーンの入力はshuffleで64bit単位に入れ替えて加算する。
+ */
+#define DEFINE_HASH_KERNELS_X86(suffix_, attr_, vec_t_, lanes_, loadu_, storeu_, xor_, add_, mul_epu32_, shuffle_epi32_, srli_epi64_, slli_epi64_, set1_epi32_) \
+    attr_ static void accumulate_##suffix_(uint64_t* acc_, const unsigned char* input_, uint64_t stripe_count_, const uint64_t* key_) { \
+        vec_t_ acc[8 / (lanes_)]; \
+        for(uint64_t j = 0; j != 8 / (lanes_); ++j) { \
+            acc[j] = loadu_((const vec_t_*)(acc_ + j * (lanes_))); \
+        } \
+        for(uint64_t s = 0; s != stripe_count_; ++s) { \
+            const unsigned char* p = input_ + s * CORE_HASH_STRIPE_SIZE; \
+            for(uint64_t j = 0; j != 8 / (lanes_); ++j) { \
+                const vec_t_ value = loadu_((const vec_t_*)(p + j * (lanes_) * 8)); \
+                const vec_t_ key = xor_(value, loadu_((const vec_t_*)(key_ + s + j * (lanes_)))); \
+                const vec_t_ product = mul_epu32_(key, shuffle_epi32_(key, _MM_SHUFFLE(0, 3, 0, 1))); \
+                acc[j] = add_(acc[j], add_(product, shuffle_epi32_(value, _MM_SHUFFLE(1, 0, 3, 2)))); \
+            } \
+        } \
+        for(uint64_t j = 0; j != 8 / (lanes_); ++j) { \
+            storeu_((vec_t_*)(acc_ + j * (lanes_)), acc[j]); \
+        } \
+    } \
+    attr_ static void scramble_##suffix_(uint64_t* acc_, const uint64_t* key_) { \
+        const vec_t_ prime = set1_epi32_((int)HASH_PRIME32_1); \
+        for(uint64_t j = 0; j != 8 / (lanes_); ++j) { \
+            vec_t_ acc = loadu_((const vec_t_*)(acc_ + j * (lanes_))); \
+            acc = xor_(acc, srli_epi64_(acc, 47)); \
+            acc = xor_(acc, loadu_((const vec_t_*)(key_ + j * (lanes_)))); \
+            const vec_t_ low = mul_epu32_(acc, prime); \
+            const vec_t_ high = mul_epu32_(srli_epi64_(acc, 32), prime); \
+            storeu_((vec_t_*)(acc_ + j * (lanes_)), add_(low, slli_epi64_(high, 32))); \
+        } \
+    } \
+
+#if HASH_KERNEL_SSE2
+DEFINE_HASH_KERNELS_X86(sse2, , __m128i, 2, _mm_loadu_si128, _mm_storeu_si128, _mm_xor_si128, _mm_add_epi64, _mm_mul_epu32, _mm_shuffle_epi32, _mm_srli_epi64, _mm_slli_epi64, _mm_set1_epi32)
+static const hash_kernel_table_t s_baseline_kernels = { "sse2", accumulate_sse2, scramble_sse2 };
+#endif
+
+#if HASH_KERNEL_AVX2
+DEFINE_HASH_KERNELS_X86(avx2, __attribute__((target("avx2"))), __m256i, 4, _mm256_loadu_si256, _mm256_storeu_si256, _mm256_xor_si256, _mm256_add_epi64, _mm256_mul_epu32, _mm256_shuffle_epi32, _mm256_srli_epi64, _mm256_slli_epi64, _mm256_set1_epi32)
+static const hash_kernel_table_t s_avx2_kernels = { "avx2", accumulate_avx2, scramble_avx2 };
+#endif
+
+#if HASH_KERNEL_NEON
+// 下位32bit(vmovn)と上位32bit(vshrn)を取り出してvmull_u32で64bitの積を求める
+static void accumulate_neon(uint64_t* acc_, const unsigned char* input_, uint64_t stripe_count_, const uint64_t* key_) {
+    uint64x2_t acc[4];
+    for(uint64_t j = 0; j != 4; ++j) {
+        acc[j] = vld1q_u64(acc_ + 2 * j);
+    }
+    for(uint64_t s = 0; s != stripe_count_; ++s) {
+        const unsigned char* p = input_ + s * CORE_HASH_STRIPE_SIZE;
+        for(uint64_t j = 0; j != 4; ++j) {
+            const uint64x2_t value = vreinterpretq_u64_u8(vld1q_u8(p + 16 * j));
+            const uint64x2_t key = veorq_u64(value, vld1q_u64(key_ + s + 2 * j));
+            const uint64x2_t product = vmull_u32(vmovn_u64(key), vshrn_n_u64(key, 32));
+            acc[j] = vaddq_u64(acc[j], vaddq_u64(product, vextq_u64(value, value, 1)));
+        }
+    }
+    for(uint64_t j = 0; j != 4; ++j) {
+        vst1q_u64(acc_ + 2 * j, acc[j]);
+    }
+}
+
+static void scramble_neon(uint64_t* acc_, const uint64_t* key_) {
+    const uint32x2_t prime = vdup_n_u32((uint32_t)HASH_PRIME32_1);
+    for(uint64_t j = 0; j != 4; ++j) {
+        uint64x2_t acc = vld1q_u64(acc_ + 2 * j);
+        acc = veorq_u64(acc, vshrq_n_u64(acc, 47));
+        acc = veorq_u64(acc, vld1q_u64(key_ + 2 * j));
+        const uint64x2_t low = vmull_u32(vmovn_u64(acc), prime);
+        const uint64x2_t high = vmull_u32(vshrn_n_u64(acc, 32), prime);
+        vst1q_u64(acc_ + 2 * j, vaddq_u64(low, vshlq_n_u64(high, 32)));
+    }
+}
+
+static const hash_kernel_table_t s_baseline_kernels = { "neon", accumulate_neon, scramble_neon };
+#endif
+
+/**
+ * @brief 実行環境で使用する累積 / 攪拌関数テーブル(初回使用時に決定する)
+ *
+ */
+static _Atomic(const hash_kernel_table_t*) s_hash_kernels = 0;
+
+// 累積 / 攪拌関数テーブルを取得する(初回呼び出し時に実行環境の命令セットを判定する)
+static const hash_kernel_table_t* hash_kernels_get(void) {
+    const hash_kernel_table_t* kernels = atomic_load_explicit(&s_hash_kernels, memory_order_relaxed);
+    if(0 == kernels) {
+        // 複数スレッドで同時に判定しても結果は同じなので、排他は不要
+        kernels = &s_baseline_kernels;
+#if HASH_KERNEL_AVX2
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx2")) {
+            kernels = &s_avx2_kernels;
+        }
+#endif
+        atomic_store_explicit(&s_hash_kernels, kernels, memory_order_relaxed);
+    }
+    return kernels;
+}
@@ -8,19 +8,264 @@
  * @copyright Copyright (c) 2025
  *
  */
+#define MESSAGE_MODULE_NAME CORE_MEMORY // メッセージ出力元モジュール(message.hより前に定義する)
+
 #include <stdint.h>
 #include <stddef.h>
 #include <stdlib.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <inttypes.h>
 
 #include "core/core_memory.h"
+#include "core/message.h"
+
+#include "internal/core_arena_internal_data.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <immintrin.h>
+#elif defined(__ARM_NEON)
+    #include <arm_neon.h>
+#endif
+
+#if defined(__SSE2__)
+    #define MEMORY_KERNEL_SSE2 1
+#elif defined(__ARM_NEON)
+    #define MEMORY_KERNEL_NEON 1
+#else
+    #define MEMORY_KERNEL_WORD 1
+#endif
+
+// AVX2はコンパイル時には有効にせず、target属性でAVX2版のみをコンパイルして実行時に切り替える
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    #define MEMORY_KERNEL_AVX2 1
+#endif
+
+/**
+ * @brief 管理データ直後の割り当て用領域先頭に適用するアライメント(byte)
+ *
+ */
+#define ARENA_POOL_ALIGNMENT 16
+
+#define CHECK_ARG_NULL_RETURN_ERROR(func_name_, arg_name_, ptr_) \
+    if(0 == ptr_) { \
+        ERROR_MESSAGE("%s - Argument %s requires a valid pointer.", func_name_, arg_name_); \
+        return CORE_MEMORY_INVALID_ARGUMENT; \
+    } \
+
+#define CHECK_ARG_NULL_RETURN_VOID(func_name_, arg_name_, ptr_) \
+    if(0 == ptr_) { \
+        WARN_MESSAGE("%s - Argument %s requires a valid pointer.", func_name_, arg_name_); \
+        return; \
+    } \
+
+/**
+ * @brief この値未満のサイズはベクトル命令を使用せずに処理する(byte)
+ *
+ */
+#define MEMORY_SMALL_SIZE 16
+
+/**
+ * @brief 非アライメントアクセス用の8byte型(strict aliasing違反を避けるためmay_aliasを付与する)
+ *
+ */
+typedef uint64_t __attribute__((__may_alias__, __aligned__(1))) unaligned_u64_t;
+
+/**
+ * @brief 非アライメントアクセス用の4byte型
+ *
+ */
+typedef uint32_t __attribute__((__may_alias__, __aligned__(1))) unaligned_u32_t;
+
+/**
+ * @brief アライメントされたアドレスへのアクセス用の8byte型
+ *
+ */
+typedef uint64_t __attribute__((__may_alias__)) aliased_u64_t;
+
+typedef void (*pfn_zero_memory_t)(unsigned char* dst_, uint64_t size_);
+typedef void (*pfn_move_memory_t)(const unsigned char* src_, unsigned char* dst_, uint64_t size_);
+
+/**
+ * @brief 命令セットごとのメモリ操作関数テーブル
+ *
+ */
+typedef struct memory_kernel_table_t {
+    const char* name;                   /**< 命令セット名 */
+    uint64_t width;                     /**< 1命令で処理するサイズ(byte)。各関数はこのサイズ以上の領域のみを扱う */
+    pfn_zero_memory_t zero;             /**< 0クリア */
+    pfn_move_memory_t move_forward;     /**< 前方からのコピー(dst_がsrc_より前方にあれば領域が重なっていてもよい) */
+    pfn_move_memory_t move_backward;    /**< 後方からのコピー(dst_がsrc_より後方にあれば領域が重なっていてもよい) */
+} memory_kernel_table_t;
 
-void core_zero_memory(void* const buff_, uint32_t buff_size_) {
-    char* const tmp = buff_;
-    for(uint32_t i = 0; i != buff_size_; ++i) {
-        tmp[i] = 0;
+/**
+ * @brief メモリ種別ごとの使用量カウンタ
+ * @note 加算/減算はrelaxedで行う。他の処理との順序保証は不要で、カウンタ自体の値が壊れなければ良い。
+ */
+typedef struct memory_tracking_counter_t {
+    _Atomic uint64_t current_bytes;     /**< 現在確保されているメモリ量(byte) */
+    _Atomic uint64_t peak_bytes;        /**< current_bytesの最大値(byte) */
+    _Atomic uint64_t allocation_count;  /**< 確保回数の累計 */
+    _Atomic uint64_t free_count;        /**< 解放回数の累計 */
+} memory_tracking_counter_t;
+
+#if ENABLE_MEMORY_TRACKING
+static memory_tracking_counter_t s_memory_counters[MEMORY_TAG_MAX];
+#endif
+
+static bool is_power_of_two(uint64_t val_);
+static uint64_t arena_header_size(void);
+static void zero_memory_small(unsigned char* dst_, uint64_t size_);
+static void move_memory_small(const unsigned char* src_, unsigned char* dst_, uint64_t size_);
+static const memory_kernel_table_t* memory_kernels_get(uint64_t size_);
+#if ENABLE_MEMORY_TRACKING
+static void memory_tracking_add(MEMORY_TAG tag_, uint64_t size_);
+static void memory_tracking_sub(MEMORY_TAG tag_, uint64_t size_);
+static void memory_tracking_peak_update(memory_tracking_counter_t* counter_, uint64_t current_);
+#endif
+
+/**
+ * @brief 命令セットごとの0クリア/前方コピー/後方コピー関数を生成する
+ *
+ * @note 先頭と末尾のwidth_バイトは非アライメントのロード/ストアで処理し、その間はdst側をwidth_にアライメントしたストアで処理する。
+ *       先頭と末尾の処理はその間の処理と重なるが、同じ値を書き込むので問題無い。
+ *       先頭の未アライメント分は1〜width_バイトなので、size_ >= width_であればoffsetがsize_を超えることは無い。
+ * @note コピーは先頭/末尾のロードを最初に、ストアを最後に行い、間の処理もロードを全て済ませてからストアするため、
+ *       コピー方向が正しければ領域が重なっていてもよい。
+ */
+#define DEFINE_MEMORY_KERNELS(suffix_, attr_, vec_t_, width_, setzero_, loadu_, storeu_, store_) \
+    attr_ static void zero_memory_##suffix_(unsigned char* dst_, uint64_t size_) { \
+        const vec_t_ zero = setzero_; \
+        uint64_t offset = (width_) - ((uintptr_t)dst_ & ((width_) - 1)); \
+        storeu_(dst_, zero); \
+        for(; (size_ - offset) >= 4 * (width_); offset += 4 * (width_)) { \
+            store_(dst_ + offset, zero); \
+            store_(dst_ + offset + (width_), zero); \
+            store_(dst_ + offset + 2 * (width_), zero); \
+            store_(dst_ + offset + 3 * (width_), zero); \
+        } \
+        for(; (size_ - offset) >= (width_); offset += (width_)) { \
+            store_(dst_ + offset, zero); \
+        } \
+        storeu_(dst_ + size_ - (width_), zero); \
+    } \
+    attr_ static void move_forward_##suffix_(const unsigned char* src_, unsigned char* dst_, uint64_t size_) { \
+        const vec_t_ head = loadu_(src_); \
+        const vec_t_ tail = loadu_(src_ + size_ - (width_)); \
+        uint64_t offset = (width_) - ((uintptr_t)dst_ & ((width_) - 1)); \
+        for(; (size_ - offset) >= 4 * (width_); offset += 4 * (width_)) { \
+            const vec_t_ v0 = loadu_(src_ + offset); \
+            const vec_t_ v1 = loadu_(src_ + offset + (width_)); \
+            const vec_t_ v2 = loadu_(src_ + offset + 2 * (width_)); \
+            const vec_t_ v3 = loadu_(src_ + offset + 3 * (width_)); \
+            store_(dst_ + offset, v0); \
+            store_(dst_ + offset + (width_), v1); \
+            store_(dst_ + offset + 2 * (width_), v2); \
+            store_(dst_ + offset + 3 * (width_), v3); \
+        } \
+        for(; (size_ - offset) >= (width_); offset += (width_)) { \
+            const vec_t_ v = loadu_(src_ + offset); \
+            store_(dst_ + offset, v); \
+        } \
+        storeu_(dst_, head); \
+        storeu_(dst_ + size_ - (width_), tail); \
+    } \
+    attr_ static void move_backward_##suffix_(const unsigned char* src_, unsigned char* dst_, uint64_t size_) { \
+        const vec_t_ head = loadu_(src_); \
+        const vec_t_ tail = loadu_(src_ + size_ - (width_)); \
+        uint64_t remain = (uintptr_t)(dst_ + size_) & ((width_) - 1); \
+        remain = size_ - ((0 == remain) ? (width_) : remain); \
+        for(; remain >= 4 * (width_); remain -= 4 * (width_)) { \
+            const vec_t_ v3 = loadu_(src_ + remain - (width_)); \
+            const vec_t_ v2 = loadu_(src_ + remain - 2 * (width_)); \
+            const vec_t_ v1 = loadu_(src_ + remain - 3 * (width_)); \
+            const vec_t_ v0 = loadu_(src_ + remain - 4 * (width_)); \
+            store_(dst_ + remain - (width_), v3); \
+            store_(dst_ + remain - 2 * (width_), v2); \
+            store_(dst_ + remain - 3 * (width_), v1); \
+            store_(dst_ + remain - 4 * (width_), v0); \
+        } \
+        for(; remain >= (width_); remain -= (width_)) { \
+            const vec_t_ v = loadu_(src_ + remain - (width_)); \
+            store_(dst_ + remain - (width_), v); \
+        } \
+        storeu_(dst_ + size_ - (width_), tail); \
+        storeu_(dst_, head); \
+    } \
+
+#if MEMORY_KERNEL_WORD
+#define WORD_SETZERO ((uint64_t)0)
+#define WORD_LOADU(ptr_) (*(const unaligned_u64_t*)(ptr_))
+#define WORD_STOREU(ptr_, val_) (*(unaligned_u64_t*)(ptr_) = (val_))
+#define WORD_STORE(ptr_, val_) (*(aliased_u64_t*)(ptr_) = (val_))
+DEFINE_MEMORY_KERNELS(word, , uint64_t, 8, WORD_SETZERO, WORD_LOADU, WORD_STOREU, WORD_STORE)
+static const memory_kernel_table_t s_baseline_kernels = { "word", 8, zero_memory_word, move_forward_word, move_backward_word };
+#endif
+
+#if MEMORY_KERNEL_SSE2
+#define SSE2_LOADU(ptr_) _mm_loadu_si128((const __m128i*)(ptr_))
+#define SSE2_STOREU(ptr_, val_) _mm_storeu_si128((__m128i*)(ptr_), (val_))
+#define SSE2_STORE(ptr_, val_) _mm_store_si128((__m128i*)(ptr_), (val_))
+DEFINE_MEMORY_KERNELS(sse2, , __m128i, 16, _mm_setzero_si128(), SSE2_LOADU, SSE2_STOREU, SSE2_STORE)
+static const memory_kernel_table_t s_baseline_kernels = { "sse2", 16, zero_memory_sse2, move_forward_sse2, move_backward_sse2 };
+#endif
+
+#if MEMORY_KERNEL_NEON
+#define NEON_LOADU(ptr_) vld1q_u8((const uint8_t*)(ptr_))
+#define NEON_STOREU(ptr_, val_) vst1q_u8((uint8_t*)(ptr_), (val_))
+DEFINE_MEMORY_KERNELS(neon, , uint8x16_t, 16, vdupq_n_u8(0), NEON_LOADU, NEON_STOREU, NEON_STOREU)
+static const memory_kernel_table_t s_baseline_kernels = { "neon", 16, zero_memory_neon, move_forward_neon, move_backward_neon };
+#endif
+
+#if MEMORY_KERNEL_AVX2
+#define AVX2_LOADU(ptr_) _mm256_loadu_si256((const __m256i*)(ptr_))
+#define AVX2_STOREU(ptr_, val_) _mm256_storeu_si256((__m256i*)(ptr_), (val_))
+#define AVX2_STORE(ptr_, val_) _mm256_store_si256((__m256i*)(ptr_), (val_))
+DEFINE_MEMORY_KERNELS(avx2, __attribute__((target("avx2"))), __m256i, 32, _mm256_setzero_si256(), AVX2_LOADU, AVX2_STOREU, AVX2_STORE)
+static const memory_kernel_table_t s_avx2_kernels = { "avx2", 32, zero_memory_avx2, move_forward_avx2, move_backward_avx2 };
+#endif
+
+/**
+ * @brief 実行環境で使用するメモリ操作関数テーブル(初回使用時に決定する)
+ *
+ */
+static _Atomic(const memory_kernel_table_t*) s_memory_kernels = 0;
+
+void core_zero_memory(void* const buff_, uint64_t buff_size_) {
+    if(buff_size_ < MEMORY_SMALL_SIZE) {
+        zero_memory_small(buff_, buff_size_);
+        return;
+    }
+    memory_kernels_get(buff_size_)->zero(buff_, buff_size_);
+}
+
+void core_copy_memory(const void* const src_, void* const dst_, uint64_t size_) {
+    if(size_ < MEMORY_SMALL_SIZE) {
+        move_memory_small(src_, dst_, size_);
+        return;
+    }
+    memory_kernels_get(size_)->move_forward(src_, dst_, size_);
+}
+
+void core_move_memory(const void* const src_, void* const dst_, uint64_t size_) {
+    if(size_ < MEMORY_SMALL_SIZE) {
+        move_memory_small(src_, dst_, size_);
+        return;
+    }
+    const memory_kernel_table_t* kernels = memory_kernels_get(size_);
+    const uintptr_t src = (uintptr_t)src_;
+    const uintptr_t dst = (uintptr_t)dst_;
+    if(dst <= src || dst >= (src + size_)) {
+        kernels->move_forward(src_, dst_, size_);
+    } else {
+        kernels->move_backward(src_, dst_, size_);
     }
 }
 
+const char* core_memory_kernel_name(void) {
+    return memory_kernels_get(UINT64_MAX)->name;
+}
+
 void* core_malloc(size_t memory_size_) {
     void* memory_pool = malloc(memory_size_);
     return memory_pool;
@@ -29,3 +274,301 @@ void* core_malloc(size_t memory_size_) {
 void core_free(void* memory_pool_) {
     free(memory_pool_);
 }
+
+void* core_malloc_tagged(size_t memory_size_, MEMORY_TAG tag_) {
+    if(tag_ >= MEMORY_TAG_MAX) {
+        ERROR_MESSAGE("core_malloc_tagged - Provided tag_ is not valid.");
+        return 0;
+    }
+    void* memory_pool = malloc(memory_size_);
+#if ENABLE_MEMORY_TRACKING
+    if(0 != memory_pool) {
+        memory_tracking_add(tag_, memory_size_);
+    }
+#endif
+    return memory_pool;
+}
+
+void core_free_tagged(void* memory_pool_, size_t memory_size_, MEMORY_TAG tag_) {
+    if(0 == memory_pool_) {
+        return;
+    }
+    if(tag_ >= MEMORY_TAG_MAX) {
+        ERROR_MESSAGE("core_free_tagged - Provided tag_ is not valid.");
+        return;
+    }
+#if ENABLE_MEMORY_TRACKING
+    memory_tracking_sub(tag_, memory_size_);
+#else
+    (void)memory_size_;
+#endif
+    free(memory_pool_);
+}
+
+void* core_realloc_tagged(void* memory_pool_, size_t old_size_, size_t new_size_, MEMORY_TAG tag_) {
+    if(tag_ >= MEMORY_TAG_MAX) {
+        ERROR_MESSAGE("core_realloc_tagged - Provided tag_ is not valid.");
+        return 0;
+    }
+    if(0 == new_size_) {
+        ERROR_MESSAGE("core_realloc_tagged - Argument new_size_ requires a non-zero value.");
+        return 0;
+    }
+    if(0 == memory_pool_) {
+        return core_malloc_tagged(new_size_, tag_);
+    }
+    void* new_pool = realloc(memory_pool_, new_size_);
+    if(0 == new_pool) {
+        return 0;
+    }
+#if ENABLE_MEMORY_TRACKING
+    memory_tracking_counter_t* counter = &s_memory_counters[tag_];
+    if(new_size_ >= old_size_) {
+        const uint64_t diff = new_size_ - old_size_;
+        const uint64_t current = atomic_fetch_add_explicit(&counter->current_bytes, diff, memory_order_relaxed) + diff;
+        memory_tracking_peak_update(counter, current);
+    } else {
+        atomic_fetch_sub_explicit(&counter->current_bytes, old_size_ - new_size_, memory_order_relaxed);
+    }
+#else
+    (void)old_size_;
+#endif
+    return new_pool;
+}
+
+CORE_MEMORY_ERROR_CODE core_memory_report(MEMORY_TAG tag_, core_memory_stats_t* const out_stats_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_memory_report", "out_stats_", out_stats_);
+    if(tag_ >= MEMORY_TAG_MAX) {
+        ERROR_MESSAGE("core_memory_report - Provided tag_ is not valid.");
+        return CORE_MEMORY_INVALID_ARGUMENT;
+    }
+#if ENABLE_MEMORY_TRACKING
+    const memory_tracking_counter_t* counter = &s_memory_counters[tag_];
+    out_stats_->current_bytes = atomic_load_explicit(&counter->current_bytes, memory_order_relaxed);
+    out_stats_->peak_bytes = atomic_load_explicit(&counter->peak_bytes, memory_order_relaxed);
+    out_stats_->allocation_count = atomic_load_explicit(&counter->allocation_count, memory_order_relaxed);
+    out_stats_->free_count = atomic_load_explicit(&counter->free_count, memory_order_relaxed);
+#else
+    core_zero_memory(out_stats_, sizeof(core_memory_stats_t));
+#endif
+    return CORE_MEMORY_SUCCESS;
+}
+
+void core_memory_report_print(void) {
+    INFO_MESSAGE("core_memory_report_print - Memory usage per tag.");
+    uint64_t total_current = 0;
+    for(uint32_t i = 0; i != MEMORY_TAG_MAX; ++i) {
+        core_memory_stats_t stats = { 0 };
+        core_memory_report((MEMORY_TAG)i, &stats);
+        total_current += stats.current_bytes;
+        INFO_MESSAGE("\t%-8s current: %" PRIu64 " byte, peak: %" PRIu64 " byte, allocation: %" PRIu64 ", free: %" PRIu64,
+            core_memory_tag_to_string((MEMORY_TAG)i), stats.current_bytes, stats.peak_bytes, stats.allocation_count, stats.free_count);
+    }
+    INFO_MESSAGE("\tTOTAL    current: %" PRIu64 " byte", total_current);
+}
+
+const char* core_memory_tag_to_string(MEMORY_TAG tag_) {
+    switch(tag_) {
+        case MEMORY_TAG_STRING:
+            return "STRING";
+        case MEMORY_TAG_DARRAY:
+            return "DARRAY";
+        case MEMORY_TAG_STACK:
+            return "STACK";
+        case MEMORY_TAG_QUEUE:
+            return "QUEUE";
+        case MEMORY_TAG_HASH_MAP:
+            return "HASHMAP";
+        case MEMORY_TAG_ARENA:
+            return "ARENA";
+        case MEMORY_TAG_MESSAGE:
+            return "MESSAGE";
+        case MEMORY_TAG_USER:
+            return "USER";
+        default:
+            return "UNDEFINED";
+    }
+}
+
+CORE_MEMORY_ERROR_CODE core_arena_create(uint64_t capacity_, core_arena_t* const arena_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_arena_create", "arena_", arena_);
+    if(0 == capacity_) {
+        ERROR_MESSAGE("core_arena_create - Argument capacity_ requires a non-zero value.");
+        return CORE_MEMORY_INVALID_ARGUMENT;
+    }
+    const uint64_t header_size = arena_header_size();
+    if(capacity_ > (UINT64_MAX - header_size)) {
+        ERROR_MESSAGE("core_arena_create - Provided capacity_ is too big.");
+        return CORE_MEMORY_INVALID_ARGUMENT;
+    }
+    core_arena_destroy(arena_);
+    char* block = core_malloc_tagged(header_size + capacity_, MEMORY_TAG_ARENA);
+    if(0 == block) {
+        ERROR_MESSAGE("core_arena_create - Failed to allocate arena memory.");
+        return CORE_MEMORY_MEMORY_ALLOCATE_ERROR;
+    }
+    core_arena_internal_data_t* internal_data = (core_arena_internal_data_t*)block;
+    internal_data->capacity = capacity_;
+    internal_data->offset = 0;
+    internal_data->memory_pool = block + header_size;
+    arena_->internal_data = internal_data;
+    return CORE_MEMORY_SUCCESS;
+}
+
+void core_arena_destroy(core_arena_t* const arena_) {
+    CHECK_ARG_NULL_RETURN_VOID("core_arena_destroy", "arena_", arena_);
+    if(0 != arena_->internal_data) {
+        // 管理データと割り当て用領域は一つのブロック
+        const core_arena_internal_data_t* internal_data = (const core_arena_internal_data_t*)(arena_->internal_data);
+        core_free_tagged(arena_->internal_data, arena_header_size() + internal_data->capacity, MEMORY_TAG_ARENA);
+    }
+    arena_->internal_data = 0;
+}
+
+CORE_MEMORY_ERROR_CODE core_arena_allocate(uint64_t size_, uint8_t alignment_requirement_, core_arena_t* const arena_, void** const out_ptr_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_arena_allocate", "arena_", arena_);
+    CHECK_ARG_NULL_RETURN_ERROR("core_arena_allocate", "out_ptr_", out_ptr_);
+    if(0 == size_) {
+        ERROR_MESSAGE("core_arena_allocate - Argument size_ requires a non-zero value.");
+        return CORE_MEMORY_INVALID_ARGUMENT;
+    }
+    if(!is_power_of_two(alignment_requirement_)) {
+        ERROR_MESSAGE("core_arena_allocate - Argument alignment_requirement_ must be a power of two.");
+        return CORE_MEMORY_INVALID_ARGUMENT;
+    }
+    if(0 == arena_->internal_data) {
+        ERROR_MESSAGE("core_arena_allocate - Provided arena_ is not initialized. Call core_arena_create.");
+        return CORE_MEMORY_INVALID_ARENA;
+    }
+    core_arena_internal_data_t* internal_data = (core_arena_internal_data_t*)(arena_->internal_data);
+
+    // 先頭アドレスそのものをアライメントに合わせるため、オフセットではなくアドレスで切り上げる
+    const uintptr_t base = (uintptr_t)(internal_data->memory_pool);
+    const uintptr_t mask = (uintptr_t)(alignment_requirement_ - 1);
+    const uint64_t aligned_offset = (uint64_t)(((base + internal_data->offset + mask) & ~mask) - base);
+    if(aligned_offset > internal_data->capacity || size_ > (internal_data->capacity - aligned_offset)) {
+        ERROR_MESSAGE("core_arena_allocate - Arena is full. Requested size = %llu, Remaining size = %llu.", (unsigned long long)size_, (unsigned long long)(internal_data->capacity - internal_data->offset));
+        return CORE_MEMORY_ARENA_FULL;
+    }
+    *out_ptr_ = internal_data->memory_pool + aligned_offset;
+    internal_data->offset = aligned_offset + size_;
+    return CORE_MEMORY_SUCCESS;
+}
+
+CORE_MEMORY_ERROR_CODE core_arena_reset(core_arena_t* const arena_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_arena_reset", "arena_", arena_);
+    if(0 == arena_->internal_data) {
+        ERROR_MESSAGE("core_arena_reset - Provided arena_ is not initialized. Call core_arena_create.");
+        return CORE_MEMORY_INVALID_ARENA;
+    }
+    core_arena_internal_data_t* internal_data = (core_arena_internal_data_t*)(arena_->internal_data);
+    internal_data->offset = 0;
+    return CORE_MEMORY_SUCCESS;
+}
+
+CORE_MEMORY_ERROR_CODE core_arena_usage(const core_arena_t* const arena_, uint64_t* const out_used_, uint64_t* const out_capacity_) {
+    CHECK_ARG_NULL_RETURN_ERROR("core_arena_usage", "arena_", arena_);
+    CHECK_ARG_NULL_RETURN_ERROR("core_arena_usage", "out_used_", out_used_);
+    CHECK_ARG_NULL_RETURN_ERROR("core_arena_usage", "out_capacity_", out_capacity_);
+    if(0 == arena_->internal_data) {
+        ERROR_MESSAGE("core_arena_usage - Provided arena_ is not initialized. Call core_arena_create.");
+        return CORE_MEMORY_INVALID_ARENA;
+    }
+    const core_arena_internal_data_t* internal_data = (const core_arena_internal_data_t*)(arena_->internal_data);
+    *out_used_ = internal_data->offset;
+    *out_capacity_ = internal_data->capacity;
+    return CORE_MEMORY_SUCCESS;
+}
+
+// 引数val_が2の冪乗かを判定する
+static bool is_power_of_two(uint64_t val_) {
+    return (0 != val_) && (0 == (val_ & (val_ - 1)));
+}
+
+// アリーナ管理データ領域のサイズ(割り当て用領域の先頭をARENA_POOL_ALIGNMENTに揃えるためのパディングを含む)
+static uint64_t arena_header_size(void) {
+    return (sizeof(core_arena_internal_data_t) + (ARENA_POOL_ALIGNMENT - 1)) & ~(uint64_t)(ARENA_POOL_ALIGNMENT - 1);
+}
+
+// MEMORY_SMALL_SIZE未満の領域を0クリアする
+static void zero_memory_small(unsigned char* dst_, uint64_t size_) {
+    if(size_ >= 8) {
+        *(unaligned_u64_t*)dst_ = 0;
+        *(unaligned_u64_t*)(dst_ + size_ - 8) = 0;
+    } else if(size_ >= 4) {
+        *(unaligned_u32_t*)dst_ = 0;
+        *(unaligned_u32_t*)(dst_ + size_ - 4) = 0;
+    } else {
+        for(uint64_t i = 0; i != size_; ++i) {
+            dst_[i] = 0;
+        }
+    }
+}
+
+// MEMORY_SMALL_SIZE未満の領域をコピーする(ロードを全て済ませてからストアするため、領域が重なっていてもよい)
+static void move_memory_small(const unsigned char* src_, unsigned char* dst_, uint64_t size_) {
+    if(size_ >= 8) {
+        const uint64_t head = *(const unaligned_u64_t*)src_;
+        const uint64_t tail = *(const unaligned_u64_t*)(src_ + size_ - 8);
+        *(unaligned_u64_t*)dst_ = head;
+        *(unaligned_u64_t*)(dst_ + size_ - 8) = tail;
+    } else if(size_ >= 4) {
+        const uint32_t head = *(const unaligned_u32_t*)src_;
+        const uint32_t tail = *(const unaligned_u32_t*)(src_ + size_ - 4);
+        *(unaligned_u32_t*)dst_ = head;
+        *(unaligned_u32_t*)(dst_ + size_ - 4) = tail;
+    } else if(0 != size_) {
+        // 1〜3byteは先頭、中央、末尾の3点で全てを網羅できる
+        const unsigned char first = src_[0];
+        const unsigned char middle = src_[size_ >> 1];
+        const unsigned char last = src_[size_ - 1];
+        dst_[0] = first;
+        dst_[size_ >> 1] = middle;
+        dst_[size_ - 1] = last;
+    }
+}
+
+// size_バイトの処理に使用するメモリ操作関数テーブルを取得する(初回呼び出し時に実行環境の命令セットを判定する)
+static const memory_kernel_table_t* memory_kernels_get(uint64_t size_) {
+    const memory_kernel_table_t* kernels = atomic_load_explicit(&s_memory_kernels, memory_order_relaxed);
+    if(0 == kernels) {
+        // 複数スレッドで同時に判定しても結果は同じなので、排他は不要
+        kernels = &s_baseline_kernels;
+#if MEMORY_KERNEL_AVX2
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx2")) {
+            kernels = &s_avx2_kernels;
+        }
+#endif
+        atomic_store_explicit(&s_memory_kernels, kernels, memory_order_relaxed);
+    }
+    // 幅の広い命令セットで扱えないサイズはベースラインで処理する(ベースラインの幅はMEMORY_SMALL_SIZE以下)
+    return (size_ < kernels->width) ? &s_baseline_kernels : kernels;
+}
+
+#if ENABLE_MEMORY_TRACKING
+// メモリ種別tag_の使用量にsize_を加算し、最大値を更新する
+static void memory_tracking_add(MEMORY_TAG tag_, uint64_t size_) {
+    memory_tracking_counter_t* counter = &s_memory_counters[tag_];
+    const uint64_t current = atomic_fetch_add_explicit(&counter->current_bytes, size_, memory_order_relaxed) + size_;
+    atomic_fetch_add_explicit(&counter->allocation_count, 1, memory_order_relaxed);
+    memory_tracking_peak_update(counter, current);
+}
+
+// メモリ種別tag_の使用量からsize_を減算する
+static void memory_tracking_sub(MEMORY_TAG tag_, uint64_t size_) {
+    memory_tracking_counter_t* counter = &s_memory_counters[tag_];
+    atomic_fetch_sub_explicit(&counter->current_bytes, size_, memory_order_relaxed);
+    atomic_fetch_add_explicit(&counter->free_count, 1, memory_order_relaxed);
+}
+
+// current_がcounter_の最大値を超えていれば最大値を更新する
+static void memory_tracking_peak_update(memory_tracking_counter_t* counter_, uint64_t current_) {
+    uint64_t peak = atomic_load_explicit(&counter_->peak_bytes, memory_order_relaxed);
+    while(current_ > peak) {
+        if(atomic_compare_exchange_weak_explicit(&counter_->peak_bytes, &peak, current_, memory_order_relaxed, memory_order_relaxed)) {
+            break;
+        }
+    }
+}
+#endif
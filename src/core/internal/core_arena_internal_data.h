@@ -0,0 +1,26 @@
+/**
+ * @file core_arena_internal_data.h
+ * @brief core_arena_tの内部実装に関する構造体定義（非公開ヘッダ）
+ *
+ * このヘッダファイルは、core_memoryモジュール内部で使用される
+ * core_arena_internal_data_t構造体を定義する。
+ * API利用者がこのヘッダを直接インクルードする必要はない。
+ *
+ * @note 内部用ヘッダであり、公開インターフェースでは使用しないこと。
+ */
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @struct core_arena_internal_data_t
+ * @brief core_arena_tの内部構造体。割り当て用領域と使用済み位置を保持する。
+ *
+ * 本構造体と割り当て用領域は一つのメモリブロックとして確保され、memory_poolは本構造体の直後を指す。
+ *
+ */
+typedef struct core_arena_internal_data_t {
+    uint64_t capacity;      /**< memory_poolのサイズ(byte) */
+    uint64_t offset;        /**< memory_pool先頭からの使用済みサイズ(byte) */
+    char* memory_pool;      /**< 割り当て用領域 */
+} core_arena_internal_data_t;
@@ -0,0 +1,31 @@
+/**
+ * @file message_binary_internal.h
+ * @brief message.cからバイナリ出力(message_binary.c)を呼び出すための関数宣言（非公開ヘッダ）
+ *
+ * API利用者がこのヘッダを直接インクルードする必要はない。
+ *
+ * @note 内部用ヘッダであり、公開インターフェースでは使用しないこと。
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdarg.h>
+
+#include "core/message.h"
+
+/**
+ * @brief バイナリ出力中かを判定する
+ *
+ * @retval true バイナリ出力中( message_output() は message_binary_vwrite() を使用する)
+ * @retval false テキスト出力
+ */
+bool message_binary_active(void);
+
+/**
+ * @brief メッセージの引数をバイナリ形式でファイルに書き込む
+ *
+ * @param severity_ メッセージの重要度(定義済みであることは呼び出し側で確認する)
+ * @param format_ フォーマット文字列
+ * @param args_ フォーマットに対応する引数
+ */
+void message_binary_vwrite(MESSAGE_SEVERITY severity_, const char* const format_, va_list args_);
@@ -2,95 +2,474 @@
  * @file message.c
  * @author chocolate-pie24
  * @brief メッセージ標準出力機能実装
+ *
+ * @details
+ * メッセージはヘッダ(色指定 + 重要度)、本文、末尾(色指定解除 + 改行)を1つのバッファに整形し、1回の書き込みで出力する。
+ * 整形用バッファはスレッドローカルの固定長配列を使用するため、メッセージ出力でヒープ確保は発生しない。
+ * また、core_string等の他モジュールに依存しないため、それらのモジュールのエラー処理からも安全に呼び出せる。
+ *
+ * message_async_start()で非同期出力を開始すると、整形したメッセージを固定長のレコードとしてring_queue_t(MPMC)に格納し、
+ * 書き込みスレッドがレコードをまとめてwritevで出力する。呼び出し元スレッドはキューへのコピーのみで戻る。
+ * ring_queue_tは満杯 / 空でメッセージを出力しないため、キュー操作から本モジュールが再帰的に呼ばれることはない。
+ *
+ * message_binary_start()でバイナリ出力を開始した場合は、整形せずにmessage_binary.cへ引数をそのまま渡す。
+ *
  * @version 0.1
  * @date 2025-07-20
  *
  * @copyright Copyright (c) 2025
  *
  */
+#if defined(__linux__)
+#define _POSIX_C_SOURCE 200809L // for nanosleep, writev
+#endif
+
 #include <stdint.h>
 #include <stdbool.h>
-#include <memory.h>
+#include <string.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <stdarg.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <errno.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
 
 #include "core/message.h"
-#include "core/core_string.h"
-#include "core/core_memory.h"
 
-static CORE_STRING_ERROR_CODE msg_header_create(MESSAGE_SEVERITY severity_, core_string_t* const header_);
+#include "containers/ring_queue.h"
+
+#include "internal/message_binary_internal.h"
+
+/**
+ * @brief 文字列リテラルとその長さ
+ *
+ */
+typedef struct message_literal_t {
+    const char* str;    /**< 文字列 */
+    uint64_t length;    /**< 文字列長(終端文字を除く) */
+} message_literal_t;
+
+#define MESSAGE_LITERAL(str_) { str_, sizeof(str_) - 1 }
+
+/**
+ * @brief 重要度ごとのメッセージ先頭文字列(MESSAGE_SEVERITYの値をインデックスとする)
+ *
+ */
+static const message_literal_t s_headers[] = {
+    MESSAGE_LITERAL("\033[1;31m[ERROR] "),
+    MESSAGE_LITERAL("\033[1;33m[WARNING] "),
+    MESSAGE_LITERAL("\033[1;35m[INFORMATION] "),
+    MESSAGE_LITERAL("\033[1;34m[DEBUG] "),
+};
+
+/**
+ * @brief メッセージ末尾文字列(色指定を解除して改行する)
+ *
+ */
+static const message_literal_t s_tail = MESSAGE_LITERAL("\033[0m\n");
+
+/**
+ * @brief 本文が切り詰められた場合に末尾に付加する文字列
+ *
+ */
+static const message_literal_t s_truncated_mark = MESSAGE_LITERAL("...");
+
+/**
+ * @brief message_output()用のスレッドローカル整形バッファ
+ *
+ */
+static _Thread_local char s_message_buffer[MESSAGE_BUFFER_SIZE];
+
+/**
+ * @brief 非同期出力時にキューに格納するレコード
+ *
+ */
+typedef struct message_record_t {
+    uint32_t length;    /**< textの文字数(終端文字を除く) */
+    uint32_t severity;  /**< メッセージ重要度 */
+    char text[MESSAGE_ASYNC_RECORD_SIZE - 2 * sizeof(uint32_t)];    /**< 整形済みメッセージ */
+} message_record_t;
+
+_Static_assert(MESSAGE_ASYNC_RECORD_SIZE >= 64, "MESSAGE_ASYNC_RECORD_SIZE is too small.");
+
+// 書き込みスレッドが1回のwritevでまとめて出力する最大レコード数
+#define MESSAGE_ASYNC_BATCH_COUNT 64
+
+// 書き込みスレッドがキューが空の場合に待機する時間(ns)
+#define MESSAGE_ASYNC_IDLE_WAIT_NS 100000
+
+/**
+ * @brief 非同期出力の状態
+ *
+ */
+typedef struct message_async_state_t {
+    ring_queue_t queue;                 /**< レコード受け渡し用キュー(MPMC) */
+    MESSAGE_ASYNC_POLICY policy;        /**< キューが満杯の場合の動作 */
+    int file_fd;                        /**< 出力先ファイル(-1の場合は標準出力 / 標準エラー出力) */
+    pthread_t writer;                   /**< 書き込みスレッド */
+    atomic_bool active;                 /**< message_outputがキューを使用するか */
+    atomic_bool running;                /**< 書き込みスレッドの継続フラグ */
+    _Atomic uint64_t producers;         /**< activeを確認してからキューへの格納を終えるまでのスレッド数(終了処理はこれが0になるまで待つ) */
+    _Atomic uint64_t dropped_count;     /**< キュー満杯で破棄したメッセージ数 */
+    _Atomic uint64_t flush_requested;   /**< message_async_flush()の要求番号 */
+    _Atomic uint64_t flush_completed;   /**< 書き込みスレッドが出力を完了した要求番号 */
+    bool atexit_registered;             /**< 終了時の書き出し処理をatexitに登録済みか */
+} message_async_state_t;
+
+static message_async_state_t s_async;
+
+/**
+ * @brief 非同期出力時のスレッドローカル整形バッファ(整形後、そのままキューにコピーする)
+ *
+ */
+static _Thread_local message_record_t s_record;
+
+/**
+ * @brief 実行時の出力レベル(全体)
+ *
+ */
+static _Atomic uint8_t s_level = MESSAGE_LEVEL_DEBUG;
+
+/**
+ * @brief モジュール個別の実行時出力レベル(MESSAGE_MODULEの値をインデックスとする)
+ *
+ * 0初期化で個別設定なしとするため、出力レベル + 1を格納する(0: 全体の設定に従う)。
+ */
+static _Atomic uint8_t s_module_levels[MESSAGE_MODULE_MAX];
+
+static bool valid_severity(MESSAGE_SEVERITY severity_);
+static uint64_t message_vformat(MESSAGE_SEVERITY severity_, char* const buffer_, uint64_t buffer_size_, const char* const format_, va_list args_);
+static void message_async_enqueue(MESSAGE_SEVERITY severity_, const char* const format_, va_list args_);
+static void* message_async_writer(void* arg_);
+static uint64_t message_async_drain(message_record_t* const batch_);
+static void message_async_write_batch(const message_record_t* const batch_, uint64_t count_);
+static void message_async_writev_all(int fd_, struct iovec* iov_, int count_);
+static void message_async_shutdown(bool destroy_queue_);
+static void message_async_wait(void);
+static void message_async_atexit(void);
 
 void message_output(MESSAGE_SEVERITY severity_, const char* const format_, ...) {
+    if(!valid_severity(severity_)) {
+        fputs("message_output - Undefined message severity.\n", stderr);
+        return;
+    }
+    va_list args;
+    va_start(args, format_);
+    if(message_binary_active()) {
+        message_binary_vwrite(severity_, format_, args);
+        va_end(args);
+        return;
+    }
+    if(atomic_load_explicit(&s_async.active, memory_order_relaxed)) {
+        // 格納中であることを示してからactiveを確認し直す(終了処理はactiveを下ろした後、格納中のスレッドがなくなるまで待つ)
+        atomic_fetch_add_explicit(&s_async.producers, 1, memory_order_seq_cst);
+        if(atomic_load_explicit(&s_async.active, memory_order_seq_cst)) {
+            message_async_enqueue(severity_, format_, args);
+            atomic_fetch_sub_explicit(&s_async.producers, 1, memory_order_release);
+            va_end(args);
+            return;
+        }
+        atomic_fetch_sub_explicit(&s_async.producers, 1, memory_order_release);
+    }
+    const uint64_t length = message_vformat(severity_, s_message_buffer, MESSAGE_BUFFER_SIZE, format_, args);
+    va_end(args);
+
+    // エラーは標準エラー出力、それ以外は標準出力に1回の書き込みで出力する
     FILE* out = (MESSAGE_SEVERITY_ERROR == severity_) ? stderr : stdout;
+    fwrite(s_message_buffer, 1, (size_t)length, out);
+}
 
-    core_string_t header = CORE_STRING_INITIALIZER;
-    if(CORE_STRING_SUCCESS != msg_header_create(severity_, &header)) {
-        fprintf(out, "message_output - Failed to create message header.\n");
-        return;
+uint64_t message_format(MESSAGE_SEVERITY severity_, char* const buffer_, uint64_t buffer_size_, const char* const format_, ...) {
+    va_list args;
+    va_start(args, format_);
+    const uint64_t length = message_vformat(severity_, buffer_, buffer_size_, format_, args);
+    va_end(args);
+    return length;
+}
+
+MESSAGE_ERROR_CODE message_async_start(const message_async_config_t* const config_) {
+    if(0 == config_) {
+        fputs("message_async_start - Argument config_ requires a valid pointer.\n", stderr);
+        return MESSAGE_INVALID_ARGUMENT;
+    }
+    if(MESSAGE_ASYNC_POLICY_DROP != config_->policy && MESSAGE_ASYNC_POLICY_BLOCK != config_->policy) {
+        fputs("message_async_start - Argument config_->policy is not valid.\n", stderr);
+        return MESSAGE_INVALID_ARGUMENT;
+    }
+    if(atomic_load_explicit(&s_async.active, memory_order_acquire)) {
+        fputs("message_async_start - Asynchronous output is already started.\n", stderr);
+        return MESSAGE_ALREADY_STARTED;
     }
 
-    core_string_t tail = CORE_STRING_INITIALIZER;
-    if(CORE_STRING_SUCCESS != core_string_copy_from_char("\033[0m\n", &tail)) {
-        fprintf(out, "message_output - Failed to create message tail.\n");
-        return;
+    // 容量の妥当性(0 / 2の冪乗)はring_queue_createで確認する
+    const RING_QUEUE_ERROR_CODE ret_queue = ring_queue_create(sizeof(message_record_t), alignof(message_record_t), config_->queue_capacity, RING_QUEUE_MODE_MPMC, &s_async.queue);
+    if(RING_QUEUE_SUCCESS != ret_queue) {
+        fputs("message_async_start - Failed to create message queue.\n", stderr);
+        return (RING_QUEUE_MEMORY_ALLOCATE_ERROR == ret_queue) ? MESSAGE_MEMORY_ALLOCATE_ERROR : MESSAGE_INVALID_ARGUMENT;
     }
+    s_async.file_fd = -1;
+    if(0 != config_->file_path) {
+        s_async.file_fd = open(config_->file_path, O_WRONLY | O_CREAT | O_APPEND, 0644);
+        if(s_async.file_fd < 0) {
+            fprintf(stderr, "message_async_start - Failed to open %s.\n", config_->file_path);
+            ring_queue_destroy(&s_async.queue);
+            return MESSAGE_RUNTIME_ERROR;
+        }
+    }
+    s_async.policy = config_->policy;
+    atomic_store_explicit(&s_async.dropped_count, 0, memory_order_relaxed);
+    atomic_store_explicit(&s_async.flush_requested, 0, memory_order_relaxed);
+    atomic_store_explicit(&s_async.flush_completed, 0, memory_order_relaxed);
+    atomic_store_explicit(&s_async.running, true, memory_order_release);
 
-    core_string_t message = CORE_STRING_INITIALIZER;
-    if(CORE_STRING_SUCCESS != core_string_copy(&header, &message)) {
-        fprintf(out, "message_output - Failed to copy message header.\n");
-        return;
+    // 同期出力でstdioにバッファリングされている分を先に出力し、出力順序を保つ
+    fflush(stdout);
+    fflush(stderr);
+    if(0 != pthread_create(&s_async.writer, 0, message_async_writer, 0)) {
+        fputs("message_async_start - Failed to create writer thread.\n", stderr);
+        atomic_store_explicit(&s_async.running, false, memory_order_release);
+        if(s_async.file_fd >= 0) {
+            close(s_async.file_fd);
+            s_async.file_fd = -1;
+        }
+        ring_queue_destroy(&s_async.queue);
+        return MESSAGE_RUNTIME_ERROR;
     }
-    core_string_t body = CORE_STRING_INITIALIZER;
-    if (CORE_STRING_SUCCESS != core_string_copy_from_char(format_, &body)) {
-        fprintf(out, "message_output - Failed to copy message body.\n");
+    if(!s_async.atexit_registered) {
+        s_async.atexit_registered = (0 == atexit(message_async_atexit));
+    }
+    atomic_store_explicit(&s_async.active, true, memory_order_release);
+    return MESSAGE_SUCCESS;
+}
+
+void message_async_stop(void) {
+    message_async_shutdown(true);
+}
+
+void message_async_flush(void) {
+    if(!atomic_load_explicit(&s_async.active, memory_order_acquire)) {
         return;
     }
-    if(CORE_STRING_SUCCESS != core_string_concat(&body, &message)) {
-        fprintf(out, "message_output - Failed to copy message format.\n");
+    const uint64_t request = atomic_fetch_add_explicit(&s_async.flush_requested, 1, memory_order_acq_rel) + 1;
+    // 書き込みスレッドが終了処理に入った場合は、残りの出力はstop側で完了する
+    while(atomic_load_explicit(&s_async.flush_completed, memory_order_acquire) < request && atomic_load_explicit(&s_async.running, memory_order_acquire)) {
+        message_async_wait();
+    }
+}
+
+void message_level_set(uint8_t level_) {
+    if(MESSAGE_LEVEL_DEBUG < level_) {
         return;
     }
-    if(CORE_STRING_SUCCESS != core_string_concat(&tail, &message)) {
-        fprintf(out, "message_output - Failed to copy message tail.\n");
+    atomic_store_explicit(&s_level, level_, memory_order_relaxed);
+}
+
+uint8_t message_level_get(void) {
+    return atomic_load_explicit(&s_level, memory_order_relaxed);
+}
+
+void message_module_level_set(MESSAGE_MODULE module_, uint8_t level_) {
+    if(0 > (int)module_ || MESSAGE_MODULE_MAX <= module_) {
         return;
     }
+    if(MESSAGE_LEVEL_INHERIT == level_) {
+        atomic_store_explicit(&s_module_levels[module_], 0, memory_order_relaxed);
+    } else if(MESSAGE_LEVEL_DEBUG >= level_) {
+        atomic_store_explicit(&s_module_levels[module_], (uint8_t)(level_ + 1), memory_order_relaxed);
+    }
+}
 
-    va_list args;
-    va_start(args, format_);
-    vprintf(core_string_cstr(&message), args);
-    va_end(args);
+bool message_is_enabled(MESSAGE_SEVERITY severity_, MESSAGE_MODULE module_) {
+    if(!valid_severity(severity_) || 0 > (int)module_ || MESSAGE_MODULE_MAX <= module_) {
+        return false;
+    }
+    const uint8_t module_level = atomic_load_explicit(&s_module_levels[module_], memory_order_relaxed);
+    const uint8_t level = (0 != module_level) ? (uint8_t)(module_level - 1) : atomic_load_explicit(&s_level, memory_order_relaxed);
+    return (uint8_t)severity_ < level;  // MESSAGE_SEVERITY_ERROR(0)はMESSAGE_LEVEL_ERROR(1)以上で出力
+}
 
-    core_string_destroy(&header);
-    core_string_destroy(&tail);
-    core_string_destroy(&message);
+uint64_t message_async_dropped_count(void) {
+    return atomic_load_explicit(&s_async.dropped_count, memory_order_relaxed);
 }
 
-/**
- * @brief メッセージの重要度種別に応じてメッセージ先頭に付加する文字列を生成する
- *
- * @param severity_ メッセージ重要度
- * @param header_ メッセージ先頭文字列格納先バッファ
- * @return true 生成成功
- * @return false 生成失敗
- */
-static CORE_STRING_ERROR_CODE msg_header_create(MESSAGE_SEVERITY severity_, core_string_t* const header_) {
-    FILE* out = (MESSAGE_SEVERITY_ERROR == severity_) ? stderr : stdout;
-    CORE_STRING_ERROR_CODE ret = CORE_STRING_SUCCESS;
-    switch(severity_) {
-        case MESSAGE_SEVERITY_ERROR:
-            ret = core_string_copy_from_char("\033[1;31m[ERROR] ", header_);
-            break;
-        case MESSAGE_SEVERITY_WARNING:
-            ret = core_string_copy_from_char("\033[1;33m[WARNING] ", header_);
-            break;
-        case MESSAGE_SEVERITY_INFORMATION:
-            ret = core_string_copy_from_char("\033[1;35m[INFORMATION] ", header_);
-            break;
-        case MESSAGE_SEVERITY_DEBUG:
-            ret = core_string_copy_from_char("\033[1;34m[DEBUG] ", header_);
+// 引数severity_が定義済みの重要度かを判定する
+static bool valid_severity(MESSAGE_SEVERITY severity_) {
+    return (uint64_t)severity_ < (sizeof(s_headers) / sizeof(s_headers[0]));
+}
+
+// ヘッダ + 本文 + 末尾をbuffer_に整形し、書き込んだ文字数(終端文字を除く)を返す
+// 本文がバッファに収まらない場合は切り詰め、末尾に"..."を付加する(ヘッダと末尾は常に出力する)
+static uint64_t message_vformat(MESSAGE_SEVERITY severity_, char* const buffer_, uint64_t buffer_size_, const char* const format_, va_list args_) {
+    if(0 == buffer_ || 0 == buffer_size_) {
+        return 0;
+    }
+    buffer_[0] = '\0';
+    if(0 == format_ || !valid_severity(severity_)) {
+        return 0;
+    }
+    const message_literal_t* header = &s_headers[severity_];
+    if((header->length + s_truncated_mark.length + s_tail.length + 1) > buffer_size_) {
+        return 0;   // ヘッダと末尾も格納できない
+    }
+
+    memcpy(buffer_, header->str, (size_t)header->length);
+    uint64_t length = header->length;
+
+    const uint64_t body_capacity = buffer_size_ - length - s_tail.length;   // 本文の終端文字分を含む
+    const int body_length = vsnprintf(buffer_ + length, (size_t)body_capacity, format_, args_);
+    if(body_length > 0) {
+        if((uint64_t)body_length < body_capacity) {
+            length += (uint64_t)body_length;
+        } else {
+            length += body_capacity - 1;
+            memcpy(buffer_ + length - s_truncated_mark.length, s_truncated_mark.str, (size_t)s_truncated_mark.length);
+        }
+    }
+
+    memcpy(buffer_ + length, s_tail.str, (size_t)s_tail.length);
+    length += s_tail.length;
+    buffer_[length] = '\0';
+    return length;
+}
+
+// メッセージをスレッドローカルのレコードに整形し、キューに格納する
+static void message_async_enqueue(MESSAGE_SEVERITY severity_, const char* const format_, va_list args_) {
+    s_record.severity = (uint32_t)severity_;
+    s_record.length = (uint32_t)message_vformat(severity_, s_record.text, sizeof(s_record.text), format_, args_);
+    RING_QUEUE_ERROR_CODE ret = ring_queue_push(&s_async.queue, &s_record);
+    if(RING_QUEUE_FULL == ret && MESSAGE_ASYNC_POLICY_BLOCK == s_async.policy) {
+        // 書き込みスレッドが終了した後はキューが空かないため、待たずに破棄する
+        while(RING_QUEUE_FULL == ret && atomic_load_explicit(&s_async.running, memory_order_acquire)) {
+            sched_yield();
+            ret = ring_queue_push(&s_async.queue, &s_record);
+        }
+    }
+    if(RING_QUEUE_SUCCESS != ret) {
+        atomic_fetch_add_explicit(&s_async.dropped_count, 1, memory_order_relaxed);
+    }
+}
+
+// 書き込みスレッド。キューが空になるたびにflush要求に応答し、終了要求後はキューを空にしてから終了する
+static void* message_async_writer(void* arg_) {
+    (void)arg_;
+    message_record_t batch[MESSAGE_ASYNC_BATCH_COUNT];
+    for(;;) {
+        // 要求番号とフラグはキューを空にする前に読む(読んだ時点までにpushされたメッセージは必ず出力される)
+        const bool running = atomic_load_explicit(&s_async.running, memory_order_acquire);
+        const uint64_t flush_request = atomic_load_explicit(&s_async.flush_requested, memory_order_acquire);
+        if(0 != message_async_drain(batch)) {
+            continue;
+        }
+        atomic_store_explicit(&s_async.flush_completed, flush_request, memory_order_release);
+        if(!running) {
             break;
-        default:
-            fprintf(out, "msg_header_create - Undefined message severity.\n");
-            ret = CORE_STRING_RUNTIME_ERROR;
+        }
+        const struct timespec idle_wait = { 0, MESSAGE_ASYNC_IDLE_WAIT_NS };
+        nanosleep(&idle_wait, 0);
+    }
+    return 0;
+}
+
+// キューが空になるまでレコードを取り出して出力し、出力したレコード数を返す
+static uint64_t message_async_drain(message_record_t* const batch_) {
+    uint64_t total = 0;
+    for(;;) {
+        uint64_t count = 0;
+        while(MESSAGE_ASYNC_BATCH_COUNT != count && RING_QUEUE_SUCCESS == ring_queue_pop(&s_async.queue, &batch_[count])) {
+            count++;
+        }
+        if(0 == count) {
+            return total;
+        }
+        message_async_write_batch(batch_, count);
+        total += count;
     }
-    return ret;
+}
+
+// 出力先が同じ連続したレコードを1回のwritevで出力する
+static void message_async_write_batch(const message_record_t* const batch_, uint64_t count_) {
+    struct iovec iov[MESSAGE_ASYNC_BATCH_COUNT];
+    int iov_count = 0;
+    int current_fd = -1;
+    for(uint64_t i = 0; i != count_; ++i) {
+        int fd = s_async.file_fd;
+        if(fd < 0) {
+            fd = (MESSAGE_SEVERITY_ERROR == batch_[i].severity) ? STDERR_FILENO : STDOUT_FILENO;
+        }
+        if(fd != current_fd && 0 != iov_count) {
+            message_async_writev_all(current_fd, iov, iov_count);
+            iov_count = 0;
+        }
+        current_fd = fd;
+        iov[iov_count].iov_base = (void*)batch_[i].text;
+        iov[iov_count].iov_len = batch_[i].length;
+        iov_count++;
+    }
+    if(0 != iov_count) {
+        message_async_writev_all(current_fd, iov, iov_count);
+    }
+}
+
+// 部分書き込みを考慮し、iov_の内容をすべて書き出す(書き込みエラーの場合は残りを破棄する)
+static void message_async_writev_all(int fd_, struct iovec* iov_, int count_) {
+    while(count_ > 0) {
+        const ssize_t written = writev(fd_, iov_, count_);
+        if(written < 0) {
+            if(EINTR == errno) {
+                continue;
+            }
+            return;
+        }
+        size_t remain = (size_t)written;
+        while(count_ > 0 && remain >= iov_->iov_len) {
+            remain -= iov_->iov_len;
+            iov_++;
+            count_--;
+        }
+        if(count_ > 0) {
+            iov_->iov_base = (char*)iov_->iov_base + remain;
+            iov_->iov_len -= remain;
+        }
+    }
+}
+
+// 非同期出力を終了する(destroy_queue_がfalseの場合はキューを書き出すのみで破棄しない)
+static void message_async_shutdown(bool destroy_queue_) {
+    if(!atomic_load_explicit(&s_async.active, memory_order_acquire)) {
+        return;
+    }
+    // 以降のメッセージは同期出力とし、既にキューへ格納中のスレッドが終えるまで書き込みスレッドを動かしたまま待つ
+    // (BLOCKで満杯のキューを待っているスレッドも、書き込みスレッドがキューを空けることで格納を終えられる)
+    atomic_store_explicit(&s_async.active, false, memory_order_seq_cst);
+    while(0 != atomic_load_explicit(&s_async.producers, memory_order_seq_cst)) {
+        sched_yield();
+    }
+    // 書き込みスレッドはキューを空にしてから終了する
+    atomic_store_explicit(&s_async.running, false, memory_order_release);
+    pthread_join(s_async.writer, 0);
+    if(s_async.file_fd >= 0) {
+        close(s_async.file_fd);
+        s_async.file_fd = -1;
+    }
+    if(destroy_queue_) {
+        ring_queue_destroy(&s_async.queue);
+    }
+}
+
+// flush完了待ちの間、CPUを譲る
+static void message_async_wait(void) {
+    const struct timespec wait = { 0, MESSAGE_ASYNC_IDLE_WAIT_NS / 10 };
+    nanosleep(&wait, 0);
+}
+
+// プロセス終了時に未出力のメッセージを書き出す
+// 他スレッドが出力を続けている可能性があるため、キューは破棄しない(プロセス終了とともに解放される)
+static void message_async_atexit(void) {
+    message_async_shutdown(false);
 }
@@ -0,0 +1,873 @@
+/**
+ * @file message_binary.c
+ * @author chocolate-pie24
+ * @brief メッセージのバイナリ出力 / 復元機能実装
+ *
+ * @details
+ * バイナリ出力中のmessage_output()は、フォーマット文字列を解析して引数の値のみをスレッドローカルのバッファに詰め、
+ * ファイル上の書き込み位置をアトミックに確保してからメモリマップしたファイルにコピーする。文字列への整形は行わない。
+ *
+ * ファイルの構成は次の通り(数値はすべて実行環境のバイトオーダー)。
+ * - 先頭MESSAGE_BINARY_DATA_OFFSET byte: ファイルヘッダ(message_binary_file_header_t)
+ * - 以降: レコード(message_binary_record_header_t + 内容)の並び。各レコードは8byte境界に揃える
+ *   - フォーマットレコード: 内容はフォーマット文字列(終端文字を含む)。format_idはフォーマット文字列のポインタ値
+ *   - メッセージレコード: 内容は変換指定の順に並べた引数の値
+ *     - 整数、文字、ポインタ、'*'で指定した幅 / 精度: 8byte(符号付き変換は符号拡張)
+ *     - 浮動小数点数: double(8byte)
+ *     - 文字列: 文字数(4byte) + 文字列 + 終端文字、8byte境界まで0埋め
+ *
+ * 書き込み途中で異常終了した場合も、ファイルは0で初期化されているため、サイズが0のレコードまでを復元できる。
+ *
+ * @version 0.1
+ * @date 2025-08-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#if defined(__linux__)
+#define _POSIX_C_SOURCE 200809L // for clock_gettime, ftruncate, strnlen
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <wchar.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "core/message.h"
+#include "core/core_memory.h"
+
+#include "internal/message_binary_internal.h"
+
+// ファイル先頭の識別子
+#define MESSAGE_BINARY_MAGIC "CPLOGBIN"
+
+// ファイル形式のバージョン
+#define MESSAGE_BINARY_VERSION 1
+
+// 最初のレコードの位置(ファイルヘッダのサイズを含む)
+#define MESSAGE_BINARY_DATA_OFFSET 64
+
+// 出力済みフォーマット文字列を記録するテーブルのサイズ(2の冪乗)
+#define MESSAGE_BINARY_FORMAT_TABLE_SIZE 1024
+
+// メッセージレコード1件の最大サイズ(byte)
+#define MESSAGE_BINARY_RECORD_MAX_SIZE MESSAGE_BUFFER_SIZE
+
+// レコードサイズの境界
+#define MESSAGE_BINARY_RECORD_ALIGNMENT 8
+
+/**
+ * @brief バイナリログファイルのヘッダ
+ *
+ */
+typedef struct message_binary_file_header_t {
+    char magic[8];              /**< MESSAGE_BINARY_MAGIC(終端文字なし) */
+    uint32_t version;           /**< MESSAGE_BINARY_VERSION */
+    uint32_t data_offset;       /**< 最初のレコードの位置 */
+    uint64_t file_size;         /**< 出力開始時のファイルサイズ */
+    uint64_t used_size;         /**< 使用済みサイズ(出力終了時に書き込む。0の場合は出力中または異常終了) */
+    uint64_t dropped_count;     /**< ファイルが満杯で破棄したメッセージ数(出力終了時に書き込む) */
+} message_binary_file_header_t;
+
+_Static_assert(sizeof(message_binary_file_header_t) <= MESSAGE_BINARY_DATA_OFFSET, "message_binary_file_header_t is too large.");
+
+/**
+ * @brief レコード種別
+ *
+ */
+typedef enum MESSAGE_BINARY_RECORD_TYPE {
+    MESSAGE_BINARY_RECORD_FORMAT = 0x01,    /**< フォーマット文字列 */
+    MESSAGE_BINARY_RECORD_MESSAGE = 0x02,   /**< メッセージ */
+} MESSAGE_BINARY_RECORD_TYPE;
+
+// メッセージレコードのフラグ: バッファに収まらず、引数の途中で記録を打ち切った
+#define MESSAGE_BINARY_FLAG_TRUNCATED 0x0001
+
+/**
+ * @brief レコードヘッダ
+ *
+ */
+typedef struct message_binary_record_header_t {
+    uint32_t size;          /**< レコードサイズ(ヘッダを含む。MESSAGE_BINARY_RECORD_ALIGNMENTの倍数) */
+    uint8_t type;           /**< MESSAGE_BINARY_RECORD_TYPE */
+    uint8_t severity;       /**< メッセージ重要度(メッセージレコードのみ) */
+    uint16_t flags;         /**< MESSAGE_BINARY_FLAG_* */
+    uint64_t timestamp_ns;  /**< UNIX時刻(ns) */
+    uint64_t format_id;     /**< フォーマットID(フォーマット文字列のポインタ値) */
+} message_binary_record_header_t;
+
+/**
+ * @brief printf変換指定の長さ修飾子
+ *
+ */
+typedef enum MESSAGE_BINARY_LENGTH {
+    MESSAGE_BINARY_LENGTH_NONE,
+    MESSAGE_BINARY_LENGTH_HH,
+    MESSAGE_BINARY_LENGTH_H,
+    MESSAGE_BINARY_LENGTH_L,
+    MESSAGE_BINARY_LENGTH_LL,
+    MESSAGE_BINARY_LENGTH_J,
+    MESSAGE_BINARY_LENGTH_Z,
+    MESSAGE_BINARY_LENGTH_T,
+    MESSAGE_BINARY_LENGTH_LONG_DOUBLE,
+} MESSAGE_BINARY_LENGTH;
+
+/**
+ * @brief フォーマット文字列中の1つの変換指定
+ *
+ */
+typedef struct message_binary_spec_t {
+    const char* begin;              /**< '%'の位置 */
+    const char* length_begin;       /**< 長さ修飾子の位置(フラグ、幅、精度の直後) */
+    const char* end;                /**< 変換指定の直後 */
+    MESSAGE_BINARY_LENGTH length;   /**< 長さ修飾子 */
+    char conversion;                /**< 変換指定子('%'を含む)。未対応の場合は'\0' */
+    bool width_star;                /**< 幅を'*'で指定 */
+    bool precision_star;            /**< 精度を'*'で指定 */
+} message_binary_spec_t;
+
+/**
+ * @brief バイナリ出力の状態
+ *
+ */
+typedef struct message_binary_state_t {
+    atomic_bool active;                     /**< message_outputがバイナリ出力を使用するか */
+    int fd;                                 /**< 出力先ファイル */
+    char* map;                              /**< ファイル全体のマップ先 */
+    uint64_t file_size;                     /**< ファイルサイズ */
+    _Atomic uint64_t offset;                /**< 次のレコードの書き込み位置 */
+    _Atomic uint64_t dropped_count;         /**< ファイルが満杯で破棄したメッセージ数 */
+    _Atomic uintptr_t formats[MESSAGE_BINARY_FORMAT_TABLE_SIZE];  /**< 出力済みフォーマット文字列(オープンアドレス法) */
+    bool atexit_registered;                 /**< 終了時の処理をatexitに登録済みか */
+} message_binary_state_t;
+
+/**
+ * @brief 復元時のフォーマット文字列一覧の要素
+ *
+ */
+typedef struct message_binary_format_entry_t {
+    uint64_t format_id;     /**< フォーマットID */
+    const char* format;     /**< フォーマット文字列(マップしたファイル上) */
+} message_binary_format_entry_t;
+
+/**
+ * @brief 復元時のレコード内容の読み出し位置
+ *
+ */
+typedef struct message_binary_reader_t {
+    const char* cursor;     /**< 次に読み出す位置 */
+    const char* end;        /**< レコードの終端 */
+} message_binary_reader_t;
+
+static message_binary_state_t s_binary;
+
+/**
+ * @brief メッセージレコード整形用のスレッドローカルバッファ(8byte境界に揃えるためuint64_tで確保する)
+ *
+ */
+static _Thread_local uint64_t s_staging[MESSAGE_BINARY_RECORD_MAX_SIZE / sizeof(uint64_t)];
+
+static uint64_t now_ns(void);
+static uint64_t align_record_size(uint64_t size_);
+static bool next_spec(const char* format_, message_binary_spec_t* out_spec_);
+static void register_format(const char* format_, uint64_t timestamp_);
+static bool reserve(uint64_t size_, uint64_t* out_offset_);
+static bool put_u64(char* buffer_, uint64_t* length_, uint64_t value_);
+static bool put_string(char* buffer_, uint64_t* length_, const char* string_);
+static bool encode_args(const char* format_, va_list args_, char* buffer_, uint64_t* length_);
+static void message_binary_atexit(void);
+static bool record_valid(const char* record_, uint64_t remain_);
+static int compare_format_entry(const void* lhs_, const void* rhs_);
+static const char* find_format(const message_binary_format_entry_t* entries_, uint64_t count_, uint64_t format_id_);
+static bool read_u64(message_binary_reader_t* reader_, uint64_t* out_value_);
+static bool read_string(message_binary_reader_t* reader_, const char** out_string_);
+static void append_text(char* body_, uint64_t* length_, uint64_t capacity_, const char* text_, uint64_t text_length_);
+static void decode_body(const char* format_, message_binary_reader_t* reader_, bool truncated_, char* body_, uint64_t capacity_);
+
+MESSAGE_ERROR_CODE message_binary_start(const char* const file_path_, uint64_t file_size_) {
+    if(0 == file_path_) {
+        fputs("message_binary_start - Argument file_path_ requires a valid pointer.\n", stderr);
+        return MESSAGE_INVALID_ARGUMENT;
+    }
+    if(file_size_ < MESSAGE_BINARY_DATA_OFFSET + MESSAGE_BINARY_RECORD_MAX_SIZE) {
+        fputs("message_binary_start - Argument file_size_ is too small.\n", stderr);
+        return MESSAGE_INVALID_ARGUMENT;
+    }
+    if(atomic_load_explicit(&s_binary.active, memory_order_acquire)) {
+        fputs("message_binary_start - Binary output is already started.\n", stderr);
+        return MESSAGE_ALREADY_STARTED;
+    }
+
+    // ftruncateで確保した領域は0で初期化されるため、書き込み途中で終了してもサイズ0のレコードが終端となる
+    const int fd = open(file_path_, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if(fd < 0) {
+        fprintf(stderr, "message_binary_start - Failed to open %s.\n", file_path_);
+        return MESSAGE_RUNTIME_ERROR;
+    }
+    if(0 != ftruncate(fd, (off_t)file_size_)) {
+        fprintf(stderr, "message_binary_start - Failed to resize %s.\n", file_path_);
+        close(fd);
+        return MESSAGE_RUNTIME_ERROR;
+    }
+    void* map = mmap(0, (size_t)file_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if(MAP_FAILED == map) {
+        fprintf(stderr, "message_binary_start - Failed to map %s.\n", file_path_);
+        close(fd);
+        return MESSAGE_RUNTIME_ERROR;
+    }
+
+    // 出力中のページフォールトを避けるため、開始時に全ページへ書き込んで割り当てておく
+    const long page_size = sysconf(_SC_PAGESIZE);
+    const uint64_t stride = (page_size > 0) ? (uint64_t)page_size : 4096;
+    volatile char* pages = (volatile char*)map;
+    for(uint64_t offset = 0; offset < file_size_; offset += stride) {
+        pages[offset] = 0;
+    }
+
+    message_binary_file_header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, MESSAGE_BINARY_MAGIC, sizeof(header.magic));
+    header.version = MESSAGE_BINARY_VERSION;
+    header.data_offset = MESSAGE_BINARY_DATA_OFFSET;
+    header.file_size = file_size_;
+    memcpy(map, &header, sizeof(header));
+
+    s_binary.fd = fd;
+    s_binary.map = (char*)map;
+    s_binary.file_size = file_size_;
+    for(uint64_t i = 0; i != MESSAGE_BINARY_FORMAT_TABLE_SIZE; ++i) {
+        atomic_store_explicit(&s_binary.formats[i], 0, memory_order_relaxed);
+    }
+    atomic_store_explicit(&s_binary.offset, MESSAGE_BINARY_DATA_OFFSET, memory_order_relaxed);
+    atomic_store_explicit(&s_binary.dropped_count, 0, memory_order_relaxed);
+
+    // テキスト出力でstdioにバッファリングされている分を先に出力しておく
+    fflush(stdout);
+    fflush(stderr);
+    if(!s_binary.atexit_registered) {
+        s_binary.atexit_registered = (0 == atexit(message_binary_atexit));
+    }
+    atomic_store_explicit(&s_binary.active, true, memory_order_release);
+    return MESSAGE_SUCCESS;
+}
+
+void message_binary_stop(void) {
+    if(!atomic_load_explicit(&s_binary.active, memory_order_acquire)) {
+        return;
+    }
+    atomic_store_explicit(&s_binary.active, false, memory_order_release);
+
+    // 満杯で確保に失敗したレコードの分もoffsetは進んでいるため、ファイルサイズで制限する
+    uint64_t used_size = atomic_load_explicit(&s_binary.offset, memory_order_acquire);
+    if(used_size > s_binary.file_size) {
+        used_size = s_binary.file_size;
+    }
+    message_binary_file_header_t* header = (message_binary_file_header_t*)s_binary.map;
+    header->used_size = used_size;
+    header->dropped_count = atomic_load_explicit(&s_binary.dropped_count, memory_order_relaxed);
+
+    msync(s_binary.map, (size_t)s_binary.file_size, MS_SYNC);
+    munmap(s_binary.map, (size_t)s_binary.file_size);
+    if(0 != ftruncate(s_binary.fd, (off_t)used_size)) {
+        fputs("message_binary_stop - Failed to truncate binary log file.\n", stderr);
+    }
+    close(s_binary.fd);
+    s_binary.map = 0;
+    s_binary.fd = -1;
+    s_binary.file_size = 0;
+}
+
+uint64_t message_binary_dropped_count(void) {
+    return atomic_load_explicit(&s_binary.dropped_count, memory_order_relaxed);
+}
+
+bool message_binary_active(void) {
+    return atomic_load_explicit(&s_binary.active, memory_order_acquire);
+}
+
+void message_binary_vwrite(MESSAGE_SEVERITY severity_, const char* const format_, va_list args_) {
+    const uint64_t timestamp = now_ns();
+    register_format(format_, timestamp);
+
+    char* staging = (char*)s_staging;
+    uint64_t length = sizeof(message_binary_record_header_t);
+    const bool completed = encode_args(format_, args_, staging, &length);
+    length = align_record_size(length);
+
+    message_binary_record_header_t header;
+    header.size = (uint32_t)length;
+    header.type = MESSAGE_BINARY_RECORD_MESSAGE;
+    header.severity = (uint8_t)severity_;
+    header.flags = completed ? 0 : MESSAGE_BINARY_FLAG_TRUNCATED;
+    header.timestamp_ns = timestamp;
+    header.format_id = (uint64_t)(uintptr_t)format_;
+    memcpy(staging, &header, sizeof(header));
+
+    uint64_t offset = 0;
+    if(!reserve(length, &offset)) {
+        atomic_fetch_add_explicit(&s_binary.dropped_count, 1, memory_order_relaxed);
+        return;
+    }
+    memcpy(s_binary.map + offset, staging, (size_t)length);
+}
+
+MESSAGE_ERROR_CODE message_binary_decode(const char* const file_path_, FILE* const out_) {
+    if(0 == file_path_ || 0 == out_) {
+        fputs("message_binary_decode - Arguments file_path_ and out_ require valid pointers.\n", stderr);
+        return MESSAGE_INVALID_ARGUMENT;
+    }
+    const int fd = open(file_path_, O_RDONLY);
+    if(fd < 0) {
+        fprintf(stderr, "message_binary_decode - Failed to open %s.\n", file_path_);
+        return MESSAGE_RUNTIME_ERROR;
+    }
+    struct stat file_stat;
+    if(0 != fstat(fd, &file_stat)) {
+        fprintf(stderr, "message_binary_decode - Failed to stat %s.\n", file_path_);
+        close(fd);
+        return MESSAGE_RUNTIME_ERROR;
+    }
+    const uint64_t file_size = (uint64_t)file_stat.st_size;
+    if(file_size < MESSAGE_BINARY_DATA_OFFSET) {
+        fprintf(stderr, "message_binary_decode - %s is not a binary log file.\n", file_path_);
+        close(fd);
+        return MESSAGE_INVALID_FILE;
+    }
+    void* map = mmap(0, (size_t)file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(MAP_FAILED == map) {
+        fprintf(stderr, "message_binary_decode - Failed to map %s.\n", file_path_);
+        return MESSAGE_RUNTIME_ERROR;
+    }
+    const char* data = (const char*)map;
+
+    message_binary_file_header_t header;
+    memcpy(&header, data, sizeof(header));
+    if(0 != memcmp(header.magic, MESSAGE_BINARY_MAGIC, sizeof(header.magic)) || MESSAGE_BINARY_VERSION != header.version ||
+        MESSAGE_BINARY_DATA_OFFSET != header.data_offset || header.used_size > file_size) {
+        fprintf(stderr, "message_binary_decode - %s is not a binary log file.\n", file_path_);
+        munmap(map, (size_t)file_size);
+        return MESSAGE_INVALID_FILE;
+    }
+    // 出力中または異常終了したファイルは、サイズ0のレコードまでを有効とする
+    const uint64_t used_size = (0 != header.used_size) ? header.used_size : file_size;
+
+    // 1パス目: フォーマットレコードを集める(メッセージより後に書き込まれる場合もあるため、先に全体を走査する)
+    MESSAGE_ERROR_CODE ret = MESSAGE_SUCCESS;
+    uint64_t format_count = 0;
+    uint64_t end = MESSAGE_BINARY_DATA_OFFSET;
+    while(end < used_size && record_valid(data + end, used_size - end)) {
+        const message_binary_record_header_t* record = (const message_binary_record_header_t*)(data + end);
+        if(MESSAGE_BINARY_RECORD_FORMAT == record->type) {
+            format_count++;
+        }
+        end += record->size;
+    }
+    if(end < used_size && 0 != ((const message_binary_record_header_t*)(data + end))->size) {
+        ret = MESSAGE_INVALID_FILE;     // 途中のレコードが破損している(それまでのレコードは復元する)
+    }
+
+    message_binary_format_entry_t* entries = 0;
+    if(0 != format_count) {
+        entries = (message_binary_format_entry_t*)core_malloc_tagged(sizeof(message_binary_format_entry_t) * format_count, MEMORY_TAG_MESSAGE);
+        if(0 == entries) {
+            fputs("message_binary_decode - Failed to allocate format table.\n", stderr);
+            munmap(map, (size_t)file_size);
+            return MESSAGE_MEMORY_ALLOCATE_ERROR;
+        }
+        uint64_t index = 0;
+        for(uint64_t offset = MESSAGE_BINARY_DATA_OFFSET; offset != end; ) {
+            const message_binary_record_header_t* record = (const message_binary_record_header_t*)(data + offset);
+            if(MESSAGE_BINARY_RECORD_FORMAT == record->type) {
+                entries[index].format_id = record->format_id;
+                entries[index].format = (const char*)(record + 1);
+                index++;
+            }
+            offset += record->size;
+        }
+        qsort(entries, (size_t)format_count, sizeof(message_binary_format_entry_t), compare_format_entry);
+    }
+
+    // 2パス目: メッセージレコードを復元する
+    char body[MESSAGE_BUFFER_SIZE];
+    char line[MESSAGE_BUFFER_SIZE];
+    for(uint64_t offset = MESSAGE_BINARY_DATA_OFFSET; offset != end; ) {
+        const message_binary_record_header_t* record = (const message_binary_record_header_t*)(data + offset);
+        offset += record->size;
+        if(MESSAGE_BINARY_RECORD_MESSAGE != record->type) {
+            continue;
+        }
+        const char* format = find_format(entries, format_count, record->format_id);
+        if(0 == format) {
+            snprintf(body, sizeof(body), "(unknown format 0x%llx)", (unsigned long long)record->format_id);
+        } else {
+            message_binary_reader_t reader = { (const char*)(record + 1), (const char*)record + record->size };
+            decode_body(format, &reader, 0 != (record->flags & MESSAGE_BINARY_FLAG_TRUNCATED), body, sizeof(body));
+        }
+        const uint64_t length = message_format((MESSAGE_SEVERITY)record->severity, line, sizeof(line), "%s", body);
+        fprintf(out_, "%llu.%09llu ", (unsigned long long)(record->timestamp_ns / 1000000000ull), (unsigned long long)(record->timestamp_ns % 1000000000ull));
+        fwrite(line, 1, (size_t)length, out_);
+    }
+    if(0 != header.dropped_count) {
+        fprintf(out_, "(%llu messages dropped)\n", (unsigned long long)header.dropped_count);
+    }
+
+    if(0 != entries) {
+        core_free_tagged(entries, sizeof(message_binary_format_entry_t) * format_count, MEMORY_TAG_MESSAGE);
+    }
+    munmap(map, (size_t)file_size);
+    if(MESSAGE_SUCCESS != ret) {
+        fprintf(stderr, "message_binary_decode - %s is corrupted.\n", file_path_);
+    }
+    return ret;
+}
+
+// UNIX時刻(ns)を取得する
+static uint64_t now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+// レコードサイズをMESSAGE_BINARY_RECORD_ALIGNMENTの倍数に切り上げる
+static uint64_t align_record_size(uint64_t size_) {
+    return (size_ + MESSAGE_BINARY_RECORD_ALIGNMENT - 1) & ~(uint64_t)(MESSAGE_BINARY_RECORD_ALIGNMENT - 1);
+}
+
+// format_から次の変換指定を探してout_spec_に格納する。変換指定がない場合はfalse
+// 未対応の変換指定の場合はconversionを'\0'とする(記録 / 復元ともにそこで打ち切る)
+static bool next_spec(const char* format_, message_binary_spec_t* out_spec_) {
+    const char* p = strchr(format_, '%');
+    if(0 == p) {
+        return false;
+    }
+    out_spec_->begin = p;
+    out_spec_->length = MESSAGE_BINARY_LENGTH_NONE;
+    out_spec_->width_star = false;
+    out_spec_->precision_star = false;
+    p++;
+    while('-' == *p || '+' == *p || ' ' == *p || '#' == *p || '0' == *p) {
+        p++;
+    }
+    if('*' == *p) {
+        out_spec_->width_star = true;
+        p++;
+    } else {
+        while(*p >= '0' && *p <= '9') {
+            p++;
+        }
+    }
+    if('.' == *p) {
+        p++;
+        if('*' == *p) {
+            out_spec_->precision_star = true;
+            p++;
+        } else {
+            while(*p >= '0' && *p <= '9') {
+                p++;
+            }
+        }
+    }
+    out_spec_->length_begin = p;
+    switch(*p) {
+    case 'h':
+        p++;
+        out_spec_->length = MESSAGE_BINARY_LENGTH_H;
+        if('h' == *p) {
+            p++;
+            out_spec_->length = MESSAGE_BINARY_LENGTH_HH;
+        }
+        break;
+    case 'l':
+        p++;
+        out_spec_->length = MESSAGE_BINARY_LENGTH_L;
+        if('l' == *p) {
+            p++;
+            out_spec_->length = MESSAGE_BINARY_LENGTH_LL;
+        }
+        break;
+    case 'j': p++; out_spec_->length = MESSAGE_BINARY_LENGTH_J; break;
+    case 'z': p++; out_spec_->length = MESSAGE_BINARY_LENGTH_Z; break;
+    case 't': p++; out_spec_->length = MESSAGE_BINARY_LENGTH_T; break;
+    case 'L': p++; out_spec_->length = MESSAGE_BINARY_LENGTH_LONG_DOUBLE; break;
+    default: break;
+    }
+    switch(*p) {
+    case '%': case 'd': case 'i': case 'o': case 'u': case 'x': case 'X': case 'c':
+    case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+    case 's': case 'p': case 'n':
+        out_spec_->conversion = *p;
+        break;
+    default:
+        out_spec_->conversion = '\0';
+        break;
+    }
+    out_spec_->end = ('\0' != *p) ? p + 1 : p;
+    return true;
+}
+
+// format_を初めて出力する場合はフォーマットレコードを書き込む
+// テーブルが満杯の場合は毎回書き込む(復元時は重複を許容する)
+static void register_format(const char* format_, uint64_t timestamp_) {
+    const uintptr_t key = (uintptr_t)format_;
+    uint64_t index = ((uint64_t)key * 0x9E3779B97F4A7C15ull) >> 54;    // 上位10bit(MESSAGE_BINARY_FORMAT_TABLE_SIZE = 1024)
+    for(uint64_t i = 0; i != MESSAGE_BINARY_FORMAT_TABLE_SIZE; ++i) {
+        uintptr_t current = atomic_load_explicit(&s_binary.formats[index], memory_order_relaxed);
+        if(key == current) {
+            return;
+        }
+        if(0 == current) {
+            if(atomic_compare_exchange_strong_explicit(&s_binary.formats[index], &current, key, memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+            if(key == current) {
+                return;     // 他スレッドが同じフォーマットを登録した
+            }
+        }
+        index = (index + 1) & (MESSAGE_BINARY_FORMAT_TABLE_SIZE - 1);
+    }
+
+    const uint64_t format_length = strlen(format_) + 1;
+    const uint64_t size = align_record_size(sizeof(message_binary_record_header_t) + format_length);
+    uint64_t offset = 0;
+    if(size > UINT32_MAX || !reserve(size, &offset)) {
+        return;     // 該当メッセージは復元時に"unknown format"となる
+    }
+    message_binary_record_header_t header;
+    header.size = (uint32_t)size;
+    header.type = MESSAGE_BINARY_RECORD_FORMAT;
+    header.severity = 0;
+    header.flags = 0;
+    header.timestamp_ns = timestamp_;
+    header.format_id = (uint64_t)key;
+    memcpy(s_binary.map + offset, &header, sizeof(header));
+    memcpy(s_binary.map + offset + sizeof(header), format_, (size_t)format_length);
+}
+
+// ファイル上にsize_ byteの領域を確保し、その位置をout_offset_に格納する。満杯の場合はfalse
+static bool reserve(uint64_t size_, uint64_t* out_offset_) {
+    const uint64_t offset = atomic_fetch_add_explicit(&s_binary.offset, size_, memory_order_relaxed);
+    if(offset > s_binary.file_size || size_ > s_binary.file_size - offset) {
+        return false;
+    }
+    *out_offset_ = offset;
+    return true;
+}
+
+// buffer_の末尾に8byteの値を追加する。バッファに収まらない場合はfalse
+static bool put_u64(char* buffer_, uint64_t* length_, uint64_t value_) {
+    if(*length_ + sizeof(uint64_t) > MESSAGE_BINARY_RECORD_MAX_SIZE) {
+        return false;
+    }
+    memcpy(buffer_ + *length_, &value_, sizeof(uint64_t));
+    *length_ += sizeof(uint64_t);
+    return true;
+}
+
+// buffer_の末尾に文字数 + 文字列 + 終端文字を追加する
+// バッファに収まらない場合は収まる分だけ追加してfalseを返す
+static bool put_string(char* buffer_, uint64_t* length_, const char* string_) {
+    const uint64_t header_size = sizeof(uint32_t);
+    if(*length_ + header_size + 1 > MESSAGE_BINARY_RECORD_MAX_SIZE) {
+        return false;
+    }
+    const uint64_t capacity = MESSAGE_BINARY_RECORD_MAX_SIZE - *length_ - header_size - 1;
+    const uint64_t string_length = strnlen(string_, (size_t)capacity + 1);  // 収まらないことが分かれば十分
+    const uint32_t stored_length = (uint32_t)((string_length < capacity) ? string_length : capacity);
+    const uint64_t end = *length_ + header_size + stored_length;
+    const uint64_t aligned_end = align_record_size(end + 1);    // capacityの計算から、MESSAGE_BINARY_RECORD_MAX_SIZEを超えない
+    memcpy(buffer_ + *length_, &stored_length, header_size);
+    memcpy(buffer_ + *length_ + header_size, string_, (size_t)stored_length);
+    memset(buffer_ + end, 0, (size_t)(aligned_end - end));     // 終端文字と境界までの埋め
+    *length_ = aligned_end;
+    return stored_length == string_length;
+}
+
+// format_の変換指定に従ってargs_から値を取り出し、buffer_に追加する。すべて収まった場合はtrue
+static bool encode_args(const char* format_, va_list args_, char* buffer_, uint64_t* length_) {
+    const char* cursor = format_;
+    message_binary_spec_t spec;
+    while(next_spec(cursor, &spec)) {
+        cursor = spec.end;
+        if('\0' == spec.conversion) {
+            break;
+        }
+        if(spec.width_star && !put_u64(buffer_, length_, (uint64_t)(int64_t)va_arg(args_, int))) {
+            return false;
+        }
+        if(spec.precision_star && !put_u64(buffer_, length_, (uint64_t)(int64_t)va_arg(args_, int))) {
+            return false;
+        }
+        uint64_t value = 0;
+        switch(spec.conversion) {
+        case '%':
+            continue;
+        case 'd':
+        case 'i':
+            switch(spec.length) {
+            case MESSAGE_BINARY_LENGTH_HH: value = (uint64_t)(int64_t)(signed char)va_arg(args_, int); break;
+            case MESSAGE_BINARY_LENGTH_H: value = (uint64_t)(int64_t)(short)va_arg(args_, int); break;
+            case MESSAGE_BINARY_LENGTH_L: value = (uint64_t)(int64_t)va_arg(args_, long); break;
+            case MESSAGE_BINARY_LENGTH_LL: value = (uint64_t)(int64_t)va_arg(args_, long long); break;
+            case MESSAGE_BINARY_LENGTH_J: value = (uint64_t)(int64_t)va_arg(args_, intmax_t); break;
+            case MESSAGE_BINARY_LENGTH_Z: value = (uint64_t)va_arg(args_, size_t); break;
+            case MESSAGE_BINARY_LENGTH_T: value = (uint64_t)(int64_t)va_arg(args_, ptrdiff_t); break;
+            default: value = (uint64_t)(int64_t)va_arg(args_, int); break;
+            }
+            break;
+        case 'o':
+        case 'u':
+        case 'x':
+        case 'X':
+            switch(spec.length) {
+            case MESSAGE_BINARY_LENGTH_HH: value = (unsigned char)va_arg(args_, unsigned int); break;
+            case MESSAGE_BINARY_LENGTH_H: value = (unsigned short)va_arg(args_, unsigned int); break;
+            case MESSAGE_BINARY_LENGTH_L: value = va_arg(args_, unsigned long); break;
+            case MESSAGE_BINARY_LENGTH_LL: value = va_arg(args_, unsigned long long); break;
+            case MESSAGE_BINARY_LENGTH_J: value = va_arg(args_, uintmax_t); break;
+            case MESSAGE_BINARY_LENGTH_Z: value = va_arg(args_, size_t); break;
+            case MESSAGE_BINARY_LENGTH_T: value = (uint64_t)va_arg(args_, ptrdiff_t); break;
+            default: value = va_arg(args_, unsigned int); break;
+            }
+            break;
+        case 'c':
+            if(MESSAGE_BINARY_LENGTH_L == spec.length) {
+                (void)va_arg(args_, wint_t);    // ワイド文字は記録しない
+                continue;
+            }
+            value = (uint64_t)(int64_t)va_arg(args_, int);
+            break;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A': {
+            const double real = (MESSAGE_BINARY_LENGTH_LONG_DOUBLE == spec.length) ? (double)va_arg(args_, long double) : va_arg(args_, double);
+            memcpy(&value, &real, sizeof(value));
+            break;
+        }
+        case 's':
+            if(MESSAGE_BINARY_LENGTH_L == spec.length) {
+                (void)va_arg(args_, wchar_t*);  // ワイド文字列は記録しない
+                continue;
+            } else {
+                const char* string = va_arg(args_, const char*);
+                if(!put_string(buffer_, length_, (0 != string) ? string : "(null)")) {
+                    return false;
+                }
+                continue;
+            }
+        case 'p':
+            value = (uint64_t)(uintptr_t)va_arg(args_, void*);
+            break;
+        case 'n':
+            (void)va_arg(args_, void*);     // 書き込み先は記録しない
+            continue;
+        default:
+            continue;
+        }
+        if(!put_u64(buffer_, length_, value)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// プロセス終了時にファイルを切り詰めて閉じる
+static void message_binary_atexit(void) {
+    message_binary_stop();
+}
+
+// record_が残りサイズremain_に収まる有効なレコードかを判定する
+static bool record_valid(const char* record_, uint64_t remain_) {
+    if(remain_ < sizeof(message_binary_record_header_t)) {
+        return false;
+    }
+    const message_binary_record_header_t* header = (const message_binary_record_header_t*)record_;
+    if(header->size < sizeof(message_binary_record_header_t) || header->size > remain_ || 0 != (header->size % MESSAGE_BINARY_RECORD_ALIGNMENT)) {
+        return false;
+    }
+    if(MESSAGE_BINARY_RECORD_FORMAT == header->type) {
+        // フォーマット文字列がレコード内で終端していること
+        return 0 != memchr(record_ + sizeof(message_binary_record_header_t), '\0', header->size - sizeof(message_binary_record_header_t));
+    }
+    return MESSAGE_BINARY_RECORD_MESSAGE == header->type && header->severity <= MESSAGE_SEVERITY_DEBUG;
+}
+
+// qsort用: フォーマットIDの昇順
+static int compare_format_entry(const void* lhs_, const void* rhs_) {
+    const uint64_t lhs = ((const message_binary_format_entry_t*)lhs_)->format_id;
+    const uint64_t rhs = ((const message_binary_format_entry_t*)rhs_)->format_id;
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+// フォーマットIDに対応するフォーマット文字列を二分探索する。見つからない場合は0
+static const char* find_format(const message_binary_format_entry_t* entries_, uint64_t count_, uint64_t format_id_) {
+    uint64_t low = 0;
+    uint64_t high = count_;
+    while(low < high) {
+        const uint64_t mid = low + (high - low) / 2;
+        if(entries_[mid].format_id < format_id_) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return (low < count_ && entries_[low].format_id == format_id_) ? entries_[low].format : 0;
+}
+
+// レコードから8byteの値を読み出す。残りがない場合はfalse
+static bool read_u64(message_binary_reader_t* reader_, uint64_t* out_value_) {
+    if((uint64_t)(reader_->end - reader_->cursor) < sizeof(uint64_t)) {
+        return false;
+    }
+    memcpy(out_value_, reader_->cursor, sizeof(uint64_t));
+    reader_->cursor += sizeof(uint64_t);
+    return true;
+}
+
+// レコードから文字列を読み出す。残りがない、または文字数が不正な場合はfalse
+static bool read_string(message_binary_reader_t* reader_, const char** out_string_) {
+    uint32_t string_length = 0;
+    if((uint64_t)(reader_->end - reader_->cursor) < sizeof(uint32_t)) {
+        return false;
+    }
+    memcpy(&string_length, reader_->cursor, sizeof(uint32_t));
+    const uint64_t size = align_record_size(sizeof(uint32_t) + (uint64_t)string_length + 1);
+    if((uint64_t)(reader_->end - reader_->cursor) < size || '\0' != reader_->cursor[sizeof(uint32_t) + string_length]) {
+        return false;
+    }
+    *out_string_ = reader_->cursor + sizeof(uint32_t);
+    reader_->cursor += size;
+    return true;
+}
+
+// body_の末尾にtext_を追加する(収まらない分は切り捨てる)
+static void append_text(char* body_, uint64_t* length_, uint64_t capacity_, const char* text_, uint64_t text_length_) {
+    const uint64_t remain = capacity_ - 1 - *length_;
+    const uint64_t copy_length = (text_length_ < remain) ? text_length_ : remain;
+    memcpy(body_ + *length_, text_, (size_t)copy_length);
+    *length_ += copy_length;
+    body_[*length_] = '\0';
+}
+
+// フォーマット文字列とレコードの引数から本文を復元する
+// 変換指定ごとに、'*'を記録した値に置き換え、長さ修飾子を記録した値の型に合わせたフォーマットを作ってsnprintfする
+static void decode_body(const char* format_, message_binary_reader_t* reader_, bool truncated_, char* body_, uint64_t capacity_) {
+    uint64_t length = 0;
+    body_[0] = '\0';
+    const char* cursor = format_;
+    message_binary_spec_t spec;
+    while(next_spec(cursor, &spec)) {
+        append_text(body_, &length, capacity_, cursor, (uint64_t)(spec.begin - cursor));
+        if('\0' == spec.conversion) {
+            cursor = spec.begin;
+            break;
+        }
+        cursor = spec.end;
+        if('%' == spec.conversion) {
+            append_text(body_, &length, capacity_, "%", 1);
+            continue;
+        }
+
+        // フラグ、幅、精度部分を作る
+        char spec_format[64];
+        uint64_t spec_length = 0;
+        bool completed = true;
+        spec_format[spec_length++] = '%';
+        for(const char* p = spec.begin + 1; p != spec.length_begin && completed; ++p) {
+            if(spec_length + 24 > sizeof(spec_format)) {
+                completed = false;  // 異常に長い変換指定
+                break;
+            }
+            if('*' != *p) {
+                spec_format[spec_length++] = *p;
+                continue;
+            }
+            uint64_t star = 0;
+            if(!read_u64(reader_, &star)) {
+                completed = false;
+                break;
+            }
+            const bool precision = ('.' == p[-1]);
+            if(precision && (int64_t)star < 0) {
+                spec_length--;      // 負の精度は指定なしとして扱う
+                continue;
+            }
+            spec_length += (uint64_t)snprintf(spec_format + spec_length, sizeof(spec_format) - spec_length, "%lld", (long long)(int64_t)star);
+        }
+
+        const char* string = 0;
+        uint64_t value = 0;
+        const bool wide = (MESSAGE_BINARY_LENGTH_L == spec.length) && ('c' == spec.conversion || 's' == spec.conversion);
+        if(completed && 'n' != spec.conversion && !wide) {
+            completed = ('s' == spec.conversion) ? read_string(reader_, &string) : read_u64(reader_, &value);
+        }
+        if(!completed) {
+            if(truncated_) {
+                append_text(body_, &length, capacity_, "...", 3);
+            }
+            return;
+        }
+        if('n' == spec.conversion || wide) {
+            continue;
+        }
+        if(0 != strchr("diouxX", spec.conversion)) {
+            spec_format[spec_length++] = 'l';
+            spec_format[spec_length++] = 'l';
+        }
+        spec_format[spec_length++] = spec.conversion;
+        spec_format[spec_length] = '\0';
+
+        const uint64_t remain = capacity_ - length;
+        int written = 0;
+        switch(spec.conversion) {
+        case 'd':
+        case 'i':
+            written = snprintf(body_ + length, (size_t)remain, spec_format, (long long)(int64_t)value);
+            break;
+        case 'o':
+        case 'u':
+        case 'x':
+        case 'X':
+            written = snprintf(body_ + length, (size_t)remain, spec_format, (unsigned long long)value);
+            break;
+        case 'c':
+            written = snprintf(body_ + length, (size_t)remain, spec_format, (int)(int64_t)value);
+            break;
+        case 's':
+            written = snprintf(body_ + length, (size_t)remain, spec_format, string);
+            break;
+        case 'p':
+            written = snprintf(body_ + length, (size_t)remain, spec_format, (void*)(uintptr_t)value);
+            break;
+        default: {
+            double real = 0.0;
+            memcpy(&real, &value, sizeof(real));
+            written = snprintf(body_ + length, (size_t)remain, spec_format, real);
+            break;
+        }
+        }
+        if(written > 0) {
+            length += ((uint64_t)written < remain) ? (uint64_t)written : remain - 1;
+        }
+    }
+    append_text(body_, &length, capacity_, cursor, strlen(cursor));
+    if(truncated_ && reader_->cursor == reader_->end) {
+        // 文字列引数の途中で打ち切った場合
+        append_text(body_, &length, capacity_, "...", 3);
+    }
+}
@@ -0,0 +1,3 @@
+#pragma once
+
+void test_core_string_number(void);
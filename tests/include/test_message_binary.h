@@ -0,0 +1,3 @@
+#pragma once
+
+void test_message_binary(void);
@@ -1,14 +1,58 @@
+#include "include/test_core_memory.h"
+#include "include/test_core_hash.h"
 #include "include/test_core_string.h"
+#include "include/test_core_string_builder.h"
+#include "include/test_core_string_view.h"
+#include "include/test_core_string_tokenizer.h"
+#include "include/test_core_string_number.h"
+#include "include/test_message.h"
+#include "include/test_message_binary.h"
 #include "include/test_dynamic_array.h"
 #include "include/test_stack.h"
+#include "include/test_typed_dynamic_array.h"
+#include "include/test_typed_stack.h"
+#include "include/test_ring_queue.h"
+#include "include/test_hash_map.h"
 
 #include "core//message.h"
 
 int main(void) {
+    INFO_MESSAGE("[TEST] core_memory: started");
+    test_core_memory();
+    INFO_MESSAGE("[TEST] core_memory: success");
+
+    INFO_MESSAGE("[TEST] core_hash: started");
+    test_core_hash();
+    INFO_MESSAGE("[TEST] core_hash: success");
+
     INFO_MESSAGE("[TEST] core_string_t: started");
     test_core_string();
     INFO_MESSAGE("[TEST] core_string_t: success");
 
+    INFO_MESSAGE("[TEST] core_string_builder_t: started");
+    test_core_string_builder();
+    INFO_MESSAGE("[TEST] core_string_builder_t: success");
+
+    INFO_MESSAGE("[TEST] core_string_view_t: started");
+    test_core_string_view();
+    INFO_MESSAGE("[TEST] core_string_view_t: success");
+
+    INFO_MESSAGE("[TEST] core_string_tokenizer_t: started");
+    test_core_string_tokenizer();
+    INFO_MESSAGE("[TEST] core_string_tokenizer_t: success");
+
+    INFO_MESSAGE("[TEST] core_string_number: started");
+    test_core_string_number();
+    INFO_MESSAGE("[TEST] core_string_number: success");
+
+    INFO_MESSAGE("[TEST] message: started");
+    test_message();
+    INFO_MESSAGE("[TEST] message: success");
+
+    INFO_MESSAGE("[TEST] message binary: started");
+    test_message_binary();
+    INFO_MESSAGE("[TEST] message binary: success");
+
     INFO_MESSAGE("[TEST] dynamic_array_t: started");
     test_dynamic_array();
     INFO_MESSAGE("[TEST] dynamic_array_t: success");
@@ -17,5 +61,21 @@ int main(void) {
     test_stack();
     INFO_MESSAGE("[TEST] stack_t: success");
 
+    INFO_MESSAGE("[TEST] typed dynamic array: started");
+    test_typed_dynamic_array();
+    INFO_MESSAGE("[TEST] typed dynamic array: success");
+
+    INFO_MESSAGE("[TEST] typed stack: started");
+    test_typed_stack();
+    INFO_MESSAGE("[TEST] typed stack: success");
+
+    INFO_MESSAGE("[TEST] ring_queue_t: started");
+    test_ring_queue();
+    INFO_MESSAGE("[TEST] ring_queue_t: success");
+
+    INFO_MESSAGE("[TEST] hash_map_t: started");
+    test_hash_map();
+    INFO_MESSAGE("[TEST] hash_map_t: success");
+
     return 0;
 }
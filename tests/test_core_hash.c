@@ -0,0 +1,128 @@
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "include/test_core_hash.h"
+
+#include "core/core_hash.h"
+
+// 入力の最大長(長い入力の累積処理で、攪拌のブロック境界を複数回跨ぐ長さ)
+#define TEST_INPUT_SIZE 5000
+
+static unsigned char s_input[TEST_INPUT_SIZE];
+
+static void test_known_values(void);
+static void test_seed_and_bit_flip(void);
+static void test_state(void);
+static void test_invalid_argument(void);
+static void test_kernel_name(void);
+static void test_error_code_to_string(void);
+
+void test_core_hash(void) {
+    for(uint64_t i = 0; i != TEST_INPUT_SIZE; ++i) {
+        s_input[i] = (unsigned char)(i * 131 + 7);
+    }
+    test_known_values();
+    test_seed_and_bit_flip();
+    test_state();
+    test_invalid_argument();
+    test_kernel_name();
+    test_error_code_to_string();
+}
+
+// 命令セット(AVX2 / SSE2 / NEON / 64bit整数演算)によらず同じ値となることを、既知の値との比較で確認する
+static void test_known_values(void) {
+    static const struct {
+        uint64_t length;
+        uint64_t hash;
+    } expected[] = {
+        { 0, 0xe4917dbfbc583a95ull },
+        { 3, 0x7d7feee644f9262eull },
+        { 17, 0xbf0cf846f4fb11bfull },
+        { 49, 0xf8bf263912601444ull },
+        { 256, 0xb94222cb69e50655ull },    // 短い入力の最大長
+        { 257, 0xd6eaf1561ccf4681ull },
+        { 321, 0x72ba10c6ea02a1f3ull },
+        { 1025, 0xa44f3896e3591c2eull },   // 攪拌のブロック境界(16ストライプ)を跨ぐ
+        { 4999, 0x7cffb67a09a86d56ull },
+    };
+    for(uint64_t i = 0; i != sizeof(expected) / sizeof(expected[0]); ++i) {
+        assert(core_hash_bytes(s_input, expected[i].length, CORE_HASH_DEFAULT_SEED) == expected[i].hash);
+    }
+    assert(core_hash_bytes(s_input, 1000, 1) == 0x3c152e4459559f02ull);
+    assert(core_hash_bytes(NULL, 0, CORE_HASH_DEFAULT_SEED) == core_hash_bytes(s_input, 0, CORE_HASH_DEFAULT_SEED));
+}
+
+static void test_seed_and_bit_flip(void) {
+    static const uint64_t lengths[] = { 1, 4, 8, 16, 17, 48, 49, 64, 256, 257, 1000 };
+    for(uint64_t i = 0; i != sizeof(lengths) / sizeof(lengths[0]); ++i) {
+        const uint64_t length = lengths[i];
+        const uint64_t hash = core_hash_bytes(s_input, length, CORE_HASH_DEFAULT_SEED);
+        assert(hash == core_hash_bytes(s_input, length, CORE_HASH_DEFAULT_SEED));
+        assert(hash != core_hash_bytes(s_input, length, CORE_HASH_DEFAULT_SEED + 1));
+        assert(hash != core_hash_bytes(s_input, length - 1, CORE_HASH_DEFAULT_SEED));
+
+        // 1bitの変化で、出力の約半数のbitが変化する
+        uint64_t changed = 0;
+        for(uint64_t bit = 0; bit != length * 8; ++bit) {
+            s_input[bit / 8] ^= (unsigned char)(1u << (bit % 8));
+            const uint64_t flipped = core_hash_bytes(s_input, length, CORE_HASH_DEFAULT_SEED);
+            s_input[bit / 8] ^= (unsigned char)(1u << (bit % 8));
+            assert(flipped != hash);
+            changed += (uint64_t)__builtin_popcountll(flipped ^ hash);
+        }
+        assert(changed >= length * 8 * 28 && changed <= length * 8 * 36);
+    }
+}
+
+// 分割の仕方によらず、core_hash_bytesと同じ値となることを確認する
+static void test_state(void) {
+    static const uint64_t chunks[] = { 1, 7, 63, 64, 65, 255, 256, 257, 1000, TEST_INPUT_SIZE };
+    core_hash_state_t state;
+    for(uint64_t length = 0; length <= 2200; length += 13) {
+        const uint64_t expected = core_hash_bytes(s_input, length, 5);
+        for(uint64_t c = 0; c != sizeof(chunks) / sizeof(chunks[0]); ++c) {
+            assert(core_hash_state_init(5, &state) == CORE_HASH_SUCCESS);
+            for(uint64_t offset = 0; offset < length; offset += chunks[c]) {
+                const uint64_t size = (length - offset < chunks[c]) ? (length - offset) : chunks[c];
+                assert(core_hash_state_update(s_input + offset, size, &state) == CORE_HASH_SUCCESS);
+            }
+            assert(core_hash_state_digest(&state) == expected);
+        }
+    }
+
+    // digestは状態を変更しないため、途中で取得した後も入力を追加できる
+    assert(core_hash_state_init(CORE_HASH_DEFAULT_SEED, &state) == CORE_HASH_SUCCESS);
+    assert(core_hash_state_digest(&state) == core_hash_bytes(NULL, 0, CORE_HASH_DEFAULT_SEED));
+    for(uint64_t offset = 0; offset != TEST_INPUT_SIZE; offset += 100) {
+        assert(core_hash_state_update(s_input + offset, 100, &state) == CORE_HASH_SUCCESS);
+        assert(core_hash_state_digest(&state) == core_hash_bytes(s_input, offset + 100, CORE_HASH_DEFAULT_SEED));
+    }
+    assert(core_hash_state_update(NULL, 0, &state) == CORE_HASH_SUCCESS);  // 長さ0の入力はNULLでもよい
+    assert(core_hash_state_digest(&state) == core_hash_bytes(s_input, TEST_INPUT_SIZE, CORE_HASH_DEFAULT_SEED));
+}
+
+static void test_invalid_argument(void) {
+    core_hash_state_t state;
+    assert(core_hash_state_init(0, NULL) == CORE_HASH_INVALID_ARGUMENT);
+    assert(core_hash_state_init(0, &state) == CORE_HASH_SUCCESS);
+    assert(core_hash_state_update(s_input, 1, NULL) == CORE_HASH_INVALID_ARGUMENT);
+    assert(core_hash_state_update(NULL, 1, &state) == CORE_HASH_INVALID_ARGUMENT);
+    assert(core_hash_state_digest(&state) == core_hash_bytes(NULL, 0, 0));     // 失敗した追加は反映されない
+    assert(core_hash_state_digest(NULL) == 0);
+
+    // NULLに長さを指定した場合は長さ0として扱う
+    assert(core_hash_bytes(NULL, 10, 0) == core_hash_bytes(NULL, 0, 0));
+}
+
+static void test_kernel_name(void) {
+    const char* name = core_hash_kernel_name();
+    assert(name != NULL);
+    assert(strcmp(name, "avx2") == 0 || strcmp(name, "sse2") == 0 || strcmp(name, "neon") == 0 || strcmp(name, "word") == 0);
+}
+
+static void test_error_code_to_string(void) {
+    assert(strcmp(core_hash_error_code_to_string(CORE_HASH_SUCCESS), "core hash error code: success.") == 0);
+    assert(strcmp(core_hash_error_code_to_string(CORE_HASH_INVALID_ARGUMENT), "core hash error code: invalid argument.") == 0);
+    assert(strcmp(core_hash_error_code_to_string((CORE_HASH_ERROR_CODE)0xFF), "core hash error code: undefined error.") == 0);
+}
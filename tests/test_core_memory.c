@@ -0,0 +1,333 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdalign.h>
+
+#include "include/test_core_memory.h"
+
+#include "core/core_memory.h"
+#include "core/core_string.h"
+#include "containers/dynamic_array.h"
+#include "containers/stack.h"
+
+static void test_arena_create_and_destroy(void);
+static void test_arena_allocate_alignment(void);
+static void test_arena_full_and_reset(void);
+static void test_arena_invalid_arguments(void);
+static void test_memory_tracking_tagged(void);
+static void test_memory_tracking_realloc(void);
+static void test_memory_tracking_containers(void);
+static void test_memory_tracking_invalid_arguments(void);
+static void test_zero_memory(void);
+static void test_copy_memory(void);
+static void test_move_memory(void);
+
+void test_core_memory(void) {
+    test_arena_create_and_destroy();
+    test_arena_allocate_alignment();
+    test_arena_full_and_reset();
+    test_arena_invalid_arguments();
+    test_memory_tracking_tagged();
+    test_memory_tracking_realloc();
+    test_memory_tracking_containers();
+    test_memory_tracking_invalid_arguments();
+    test_zero_memory();
+    test_copy_memory();
+    test_move_memory();
+}
+
+static void test_arena_create_and_destroy(void) {
+    core_arena_t arena = CORE_ARENA_INITIALIZER;
+    assert(core_arena_create(256, &arena) == CORE_MEMORY_SUCCESS);
+    assert(arena.internal_data != NULL);
+
+    uint64_t used = 1;
+    uint64_t capacity = 0;
+    assert(core_arena_usage(&arena, &used, &capacity) == CORE_MEMORY_SUCCESS);
+    assert(used == 0);
+    assert(capacity == 256);
+
+    // 再生成(内部で破棄される)
+    assert(core_arena_create(512, &arena) == CORE_MEMORY_SUCCESS);
+    assert(core_arena_usage(&arena, &used, &capacity) == CORE_MEMORY_SUCCESS);
+    assert(capacity == 512);
+
+    core_arena_destroy(&arena);
+    assert(arena.internal_data == NULL);
+    core_arena_destroy(&arena); // 二重破棄でも落ちない
+}
+
+static void test_arena_allocate_alignment(void) {
+    core_arena_t arena = CORE_ARENA_INITIALIZER;
+    assert(core_arena_create(256, &arena) == CORE_MEMORY_SUCCESS);
+
+    void* p1 = NULL;
+    assert(core_arena_allocate(1, 1, &arena, &p1) == CORE_MEMORY_SUCCESS);
+
+    void* p2 = NULL;
+    assert(core_arena_allocate(sizeof(uint64_t), alignof(uint64_t), &arena, &p2) == CORE_MEMORY_SUCCESS);
+    assert(((uintptr_t)p2 % alignof(uint64_t)) == 0);
+    assert((char*)p2 > (char*)p1);
+
+    void* p3 = NULL;
+    assert(core_arena_allocate(3, 64, &arena, &p3) == CORE_MEMORY_SUCCESS);
+    assert(((uintptr_t)p3 % 64) == 0);
+
+    // 割り当て領域は書き込み可能で、互いに重ならない
+    *(uint64_t*)p2 = 0x0123456789ABCDEFull;
+    *(char*)p1 = 'a';
+    assert(*(uint64_t*)p2 == 0x0123456789ABCDEFull);
+
+    core_arena_destroy(&arena);
+}
+
+static void test_arena_full_and_reset(void) {
+    core_arena_t arena = CORE_ARENA_INITIALIZER;
+    assert(core_arena_create(64, &arena) == CORE_MEMORY_SUCCESS);
+
+    void* p = NULL;
+    assert(core_arena_allocate(64, 1, &arena, &p) == CORE_MEMORY_SUCCESS);
+    void* first = p;
+
+    void* q = NULL;
+    assert(core_arena_allocate(1, 1, &arena, &q) == CORE_MEMORY_ARENA_FULL);
+    assert(q == NULL);
+
+    // リセット後は先頭から再利用される
+    assert(core_arena_reset(&arena) == CORE_MEMORY_SUCCESS);
+    uint64_t used = 1;
+    uint64_t capacity = 0;
+    assert(core_arena_usage(&arena, &used, &capacity) == CORE_MEMORY_SUCCESS);
+    assert(used == 0);
+    assert(core_arena_allocate(8, 1, &arena, &p) == CORE_MEMORY_SUCCESS);
+    assert(p == first);
+
+    core_arena_destroy(&arena);
+}
+
+static void test_arena_invalid_arguments(void) {
+    core_arena_t arena = CORE_ARENA_INITIALIZER;
+    void* p = NULL;
+    uint64_t used = 0;
+    uint64_t capacity = 0;
+
+    assert(core_arena_create(0, &arena) == CORE_MEMORY_INVALID_ARGUMENT);
+    assert(core_arena_create(64, NULL) == CORE_MEMORY_INVALID_ARGUMENT);
+    core_arena_destroy(NULL);
+
+    // 未初期化アリーナ
+    assert(core_arena_allocate(8, 8, &arena, &p) == CORE_MEMORY_INVALID_ARENA);
+    assert(core_arena_reset(&arena) == CORE_MEMORY_INVALID_ARENA);
+    assert(core_arena_usage(&arena, &used, &capacity) == CORE_MEMORY_INVALID_ARENA);
+
+    assert(core_arena_create(64, &arena) == CORE_MEMORY_SUCCESS);
+    assert(core_arena_allocate(0, 8, &arena, &p) == CORE_MEMORY_INVALID_ARGUMENT);
+    assert(core_arena_allocate(8, 3, &arena, &p) == CORE_MEMORY_INVALID_ARGUMENT);   // 2の冪乗でない
+    assert(core_arena_allocate(8, 8, NULL, &p) == CORE_MEMORY_INVALID_ARGUMENT);
+    assert(core_arena_allocate(8, 8, &arena, NULL) == CORE_MEMORY_INVALID_ARGUMENT);
+    assert(core_arena_reset(NULL) == CORE_MEMORY_INVALID_ARGUMENT);
+    assert(core_arena_usage(&arena, NULL, &capacity) == CORE_MEMORY_INVALID_ARGUMENT);
+
+    core_arena_destroy(&arena);
+}
+
+static void test_memory_tracking_tagged(void) {
+    core_memory_stats_t before = { 0 };
+    assert(core_memory_report(MEMORY_TAG_USER, &before) == CORE_MEMORY_SUCCESS);
+
+    void* p1 = core_malloc_tagged(100, MEMORY_TAG_USER);
+    void* p2 = core_malloc_tagged(28, MEMORY_TAG_USER);
+    assert(p1 != NULL && p2 != NULL);
+
+    core_memory_stats_t during = { 0 };
+    assert(core_memory_report(MEMORY_TAG_USER, &during) == CORE_MEMORY_SUCCESS);
+    assert(during.current_bytes == before.current_bytes + 128);
+    assert(during.peak_bytes >= during.current_bytes);
+    assert(during.allocation_count == before.allocation_count + 2);
+
+    core_free_tagged(p1, 100, MEMORY_TAG_USER);
+    core_free_tagged(p2, 28, MEMORY_TAG_USER);
+    core_free_tagged(NULL, 64, MEMORY_TAG_USER);    // NULLは何もしない
+
+    core_memory_stats_t after = { 0 };
+    assert(core_memory_report(MEMORY_TAG_USER, &after) == CORE_MEMORY_SUCCESS);
+    assert(after.current_bytes == before.current_bytes);
+    assert(after.peak_bytes >= before.current_bytes + 128);
+    assert(after.free_count == before.free_count + 2);
+
+    core_memory_report_print();
+}
+
+static void test_memory_tracking_realloc(void) {
+    core_memory_stats_t before = { 0 };
+    assert(core_memory_report(MEMORY_TAG_USER, &before) == CORE_MEMORY_SUCCESS);
+
+    // NULLからの再確保はcore_malloc_tagged相当
+    char* p = core_realloc_tagged(NULL, 0, 16, MEMORY_TAG_USER);
+    assert(p != NULL);
+    for(uint32_t i = 0; i != 16; ++i) {
+        p[i] = (char)i;
+    }
+
+    // 拡張しても内容は保持される
+    p = core_realloc_tagged(p, 16, 4096, MEMORY_TAG_USER);
+    assert(p != NULL);
+    for(uint32_t i = 0; i != 16; ++i) {
+        assert(p[i] == (char)i);
+    }
+    core_memory_stats_t during = { 0 };
+    assert(core_memory_report(MEMORY_TAG_USER, &during) == CORE_MEMORY_SUCCESS);
+    assert(during.current_bytes == before.current_bytes + 4096);
+    assert(during.peak_bytes >= before.current_bytes + 4096);
+    assert(during.allocation_count == before.allocation_count + 1);
+
+    // 縮小
+    p = core_realloc_tagged(p, 4096, 8, MEMORY_TAG_USER);
+    assert(p != NULL);
+    assert(core_memory_report(MEMORY_TAG_USER, &during) == CORE_MEMORY_SUCCESS);
+    assert(during.current_bytes == before.current_bytes + 8);
+
+    // 不正な引数ではNULLを返し、元の領域はそのまま
+    assert(core_realloc_tagged(p, 8, 0, MEMORY_TAG_USER) == NULL);
+    assert(core_realloc_tagged(p, 8, 16, MEMORY_TAG_MAX) == NULL);
+
+    core_free_tagged(p, 8, MEMORY_TAG_USER);
+    core_memory_stats_t after = { 0 };
+    assert(core_memory_report(MEMORY_TAG_USER, &after) == CORE_MEMORY_SUCCESS);
+    assert(after.current_bytes == before.current_bytes);
+    assert(after.free_count == before.free_count + 1);
+}
+
+// 各コンテナの生成/破棄でメモリ種別ごとの使用量が元に戻ることを確認する
+static void test_memory_tracking_containers(void) {
+    core_memory_stats_t string_before = { 0 };
+    core_memory_stats_t darray_before = { 0 };
+    core_memory_stats_t stack_before = { 0 };
+    core_memory_stats_t arena_before = { 0 };
+    core_memory_report(MEMORY_TAG_STRING, &string_before);
+    core_memory_report(MEMORY_TAG_DARRAY, &darray_before);
+    core_memory_report(MEMORY_TAG_STACK, &stack_before);
+    core_memory_report(MEMORY_TAG_ARENA, &arena_before);
+
+    core_string_t string = CORE_STRING_INITIALIZER;
+    core_string_t tail = CORE_STRING_INITIALIZER;
+    assert(core_string_create("tracking", &string) == CORE_STRING_SUCCESS);
+    assert(core_string_create("_tail_to_force_resize", &tail) == CORE_STRING_SUCCESS);
+    assert(core_string_concat(&tail, &string) == CORE_STRING_SUCCESS);
+
+    dynamic_array_t array = DYNAMIC_ARRAY_INITIALIZER;
+    assert(dynamic_array_create(sizeof(uint64_t), alignof(uint64_t), 16, &array) == DYNAMIC_ARRAY_SUCCESS);
+
+    stack_t stack = STACK_INITIALIZER;
+    assert(stack_create(sizeof(uint64_t), alignof(uint64_t), 16, &stack) == STACK_ERROR_CODE_SUCCESS);
+    assert(stack_resize(32, &stack) == STACK_ERROR_CODE_SUCCESS);
+
+    core_arena_t arena = CORE_ARENA_INITIALIZER;
+    assert(core_arena_create(1024, &arena) == CORE_MEMORY_SUCCESS);
+
+    core_memory_stats_t stats = { 0 };
+    core_memory_report(MEMORY_TAG_STRING, &stats);
+    assert(stats.current_bytes > string_before.current_bytes);
+    core_memory_report(MEMORY_TAG_DARRAY, &stats);
+    assert(stats.current_bytes >= darray_before.current_bytes + 16 * sizeof(uint64_t));
+    core_memory_report(MEMORY_TAG_STACK, &stats);
+    assert(stats.current_bytes >= stack_before.current_bytes + 32 * sizeof(uint64_t));
+    core_memory_report(MEMORY_TAG_ARENA, &stats);
+    assert(stats.current_bytes >= arena_before.current_bytes + 1024);
+
+    core_string_destroy(&string);
+    core_string_destroy(&tail);
+    dynamic_array_destroy(&array);
+    stack_destroy(&stack);
+    core_arena_destroy(&arena);
+
+    core_memory_report(MEMORY_TAG_STRING, &stats);
+    assert(stats.current_bytes == string_before.current_bytes);
+    core_memory_report(MEMORY_TAG_DARRAY, &stats);
+    assert(stats.current_bytes == darray_before.current_bytes);
+    core_memory_report(MEMORY_TAG_STACK, &stats);
+    assert(stats.current_bytes == stack_before.current_bytes);
+    core_memory_report(MEMORY_TAG_ARENA, &stats);
+    assert(stats.current_bytes == arena_before.current_bytes);
+}
+
+static void test_memory_tracking_invalid_arguments(void) {
+    core_memory_stats_t stats = { 0 };
+    assert(core_memory_report(MEMORY_TAG_USER, NULL) == CORE_MEMORY_INVALID_ARGUMENT);
+    assert(core_memory_report(MEMORY_TAG_MAX, &stats) == CORE_MEMORY_INVALID_ARGUMENT);
+    assert(core_malloc_tagged(16, MEMORY_TAG_MAX) == NULL);
+    assert(core_memory_tag_to_string(MEMORY_TAG_STRING) != NULL);
+    assert(core_memory_tag_to_string(MEMORY_TAG_MAX) != NULL);
+}
+
+// 先頭アドレスのずれ(0〜39byte)とサイズ(0〜299byte)の全組み合わせで、ベクトル処理の先頭/末尾の境界を網羅する
+#define MEMORY_TEST_MAX_OFFSET 40
+#define MEMORY_TEST_MAX_SIZE 300
+#define MEMORY_TEST_BUFFER_SIZE (MEMORY_TEST_MAX_OFFSET + MEMORY_TEST_MAX_SIZE + MEMORY_TEST_MAX_OFFSET)
+
+static void test_zero_memory(void) {
+    alignas(64) unsigned char buffer[MEMORY_TEST_BUFFER_SIZE];
+    for(uint64_t offset = 0; offset != MEMORY_TEST_MAX_OFFSET; ++offset) {
+        for(uint64_t size = 0; size != MEMORY_TEST_MAX_SIZE; ++size) {
+            for(uint64_t i = 0; i != MEMORY_TEST_BUFFER_SIZE; ++i) {
+                buffer[i] = 0xAA;
+            }
+            core_zero_memory(buffer + offset, size);
+            for(uint64_t i = 0; i != MEMORY_TEST_BUFFER_SIZE; ++i) {
+                const bool inside = (i >= offset) && (i < (offset + size));
+                assert(buffer[i] == (inside ? 0 : 0xAA));
+            }
+        }
+    }
+    core_zero_memory(NULL, 0);  // サイズ0ならアクセスしない
+}
+
+static void test_copy_memory(void) {
+    alignas(64) unsigned char src[MEMORY_TEST_BUFFER_SIZE];
+    alignas(64) unsigned char dst[MEMORY_TEST_BUFFER_SIZE];
+    for(uint64_t i = 0; i != MEMORY_TEST_BUFFER_SIZE; ++i) {
+        src[i] = (unsigned char)(i * 7 + 1);
+    }
+    for(uint64_t src_offset = 0; src_offset < MEMORY_TEST_MAX_OFFSET; src_offset += 3) {
+        for(uint64_t dst_offset = 0; dst_offset != MEMORY_TEST_MAX_OFFSET; ++dst_offset) {
+            for(uint64_t size = 0; size != MEMORY_TEST_MAX_SIZE; ++size) {
+                for(uint64_t i = 0; i != MEMORY_TEST_BUFFER_SIZE; ++i) {
+                    dst[i] = 0xAA;
+                }
+                core_copy_memory(src + src_offset, dst + dst_offset, size);
+                for(uint64_t i = 0; i != MEMORY_TEST_BUFFER_SIZE; ++i) {
+                    const bool inside = (i >= dst_offset) && (i < (dst_offset + size));
+                    assert(dst[i] == (inside ? src[src_offset + i - dst_offset] : 0xAA));
+                }
+            }
+        }
+    }
+    core_copy_memory(NULL, NULL, 0);
+}
+
+static void test_move_memory(void) {
+    alignas(64) unsigned char buffer[MEMORY_TEST_BUFFER_SIZE];
+    unsigned char expected[MEMORY_TEST_BUFFER_SIZE];
+    for(uint64_t src_offset = 0; src_offset != MEMORY_TEST_MAX_OFFSET; ++src_offset) {
+        for(uint64_t dst_offset = 0; dst_offset != MEMORY_TEST_MAX_OFFSET; ++dst_offset) {
+            for(uint64_t size = 0; size < MEMORY_TEST_MAX_SIZE; size += 7) {
+                for(uint64_t i = 0; i != MEMORY_TEST_BUFFER_SIZE; ++i) {
+                    buffer[i] = (unsigned char)(i * 13 + 5);
+                    expected[i] = buffer[i];
+                }
+                // 期待値は一時領域を経由したバイト単位のコピーで作る
+                unsigned char tmp[MEMORY_TEST_MAX_SIZE];
+                for(uint64_t i = 0; i != size; ++i) {
+                    tmp[i] = expected[src_offset + i];
+                }
+                for(uint64_t i = 0; i != size; ++i) {
+                    expected[dst_offset + i] = tmp[i];
+                }
+                core_move_memory(buffer + src_offset, buffer + dst_offset, size);
+                for(uint64_t i = 0; i != MEMORY_TEST_BUFFER_SIZE; ++i) {
+                    assert(buffer[i] == expected[i]);
+                }
+            }
+        }
+    }
+}
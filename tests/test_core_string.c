@@ -5,6 +5,9 @@
 #include "include/test_core_string.h"
 
 #include "core/core_string.h"
+#include "core/core_string_view.h"
+#include "core/core_string_number.h"
+#include "core/core_hash.h"
 
 #include "define.h"
 
@@ -26,6 +29,12 @@ static void test_substring_copy_from_greater_than_to(void);
 static void test_concat_resize_failure_simulation(void);
 static void test_concat_invalid_capacity_case(void);
 static void test_destroy_double_free_safe(void);
+static void test_core_string_create_with_arena(void);
+static void test_core_string_inline(void);
+static void test_core_string_append(void);
+static void test_core_string_search(void);
+static void test_core_string_trim_set(void);
+static void test_core_string_hash(void);
 
 void test_core_string(void) {
     test_core_string_default_create();
@@ -46,6 +55,12 @@ void test_core_string(void) {
     test_concat_resize_failure_simulation();
     test_concat_invalid_capacity_case();
     test_destroy_double_free_safe();
+    test_core_string_create_with_arena();
+    test_core_string_inline();
+    test_core_string_append();
+    test_core_string_search();
+    test_core_string_trim_set();
+    test_core_string_hash();
 
     // --- core_string_buffer_capacity ---
     assert(core_string_buffer_capacity(NULL) == INVALID_VALUE_U64);
@@ -237,6 +252,21 @@ static void test_core_string_to_i32_failure_cases(void) {
     core_string_copy_from_char("-2147483649", &str); // INT32_MIN - 1
     assert(core_string_to_i32(&str, &val) == CORE_STRING_RUNTIME_ERROR);
 
+    // 16進数はcore_string_parse_i32()では受け付けるが、core_string_to_i32()では10進数のみ受け付ける
+    val = 0;
+    core_string_copy_from_char("0x10", &str);
+    assert(core_string_to_i32(&str, &val) == CORE_STRING_RUNTIME_ERROR);
+    core_string_copy_from_char("-0X1F", &str);
+    assert(core_string_to_i32(&str, &val) == CORE_STRING_RUNTIME_ERROR);
+    core_string_copy_from_char("+0x7fffffff", &str);
+    assert(core_string_to_i32(&str, &val) == CORE_STRING_RUNTIME_ERROR);
+    assert(val == 0);
+    assert(core_string_parse_i32("0x10", 4, &val, NULL) == CORE_STRING_SUCCESS && val == 16);
+    core_string_copy_from_char("0", &str);
+    assert(core_string_to_i32(&str, &val) == CORE_STRING_SUCCESS && val == 0);
+    core_string_copy_from_char("-010", &str);
+    assert(core_string_to_i32(&str, &val) == CORE_STRING_SUCCESS && val == -10);
+
     core_string_destroy(&str);
 }
 
@@ -327,3 +357,382 @@ static void test_destroy_double_free_safe(void) {
     core_string_destroy(&s); // 再destroy
     assert(s.internal_data == NULL);
 }
+
+static void test_core_string_create_with_arena(void) {
+    core_arena_t arena = CORE_ARENA_INITIALIZER;
+    assert(core_arena_create(256, &arena) == CORE_MEMORY_SUCCESS);
+
+    core_string_t s = CORE_STRING_INITIALIZER;
+    assert(core_string_create_with_arena(NULL, &arena, &s) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_create_with_arena("arena", NULL, &s) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_create_with_arena("arena", &arena, NULL) == CORE_STRING_INVALID_ARGUMENT);
+
+    assert(core_string_create_with_arena("arena", &arena, &s) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("arena", &s));
+
+    // 連結によるバッファ拡張もアリーナから行われる
+    core_string_t tail = CORE_STRING_INITIALIZER;
+    core_string_create("_string", &tail);
+    assert(core_string_concat(&tail, &s) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("arena_string", &s));
+    core_string_destroy(&tail);
+
+    core_string_destroy(&s);
+    assert(s.internal_data == NULL);
+
+    // 容量不足
+    char long_text[300];
+    memset(long_text, 'a', sizeof(long_text) - 1);
+    long_text[sizeof(long_text) - 1] = '\0';
+    assert(core_string_create_with_arena(long_text, &arena, &s) == CORE_STRING_MEMORY_ALLOCATE_ERROR);
+
+    assert(core_arena_reset(&arena) == CORE_MEMORY_SUCCESS);
+    core_arena_destroy(&arena);
+}
+
+// 短い文字列がcore_string_t内のバッファに格納され、長くなった時点でヒープへ移ることを確認する
+static void test_core_string_inline(void) {
+    assert(sizeof(core_string_t) == 32);
+
+    core_memory_stats_t before = { 0 };
+    core_memory_stats_t stats = { 0 };
+    core_memory_report(MEMORY_TAG_STRING, &before);
+
+    // CORE_STRING_INLINE_CAPACITY文字まではヒープを使用しない
+    char inline_text[CORE_STRING_INLINE_CAPACITY + 1];
+    memset(inline_text, 'a', CORE_STRING_INLINE_CAPACITY);
+    inline_text[CORE_STRING_INLINE_CAPACITY] = '\0';
+    core_string_t s = CORE_STRING_INITIALIZER;
+    assert(core_string_create(inline_text, &s) == CORE_STRING_SUCCESS);
+    assert(s.internal_data == NULL);
+    assert(core_string_length(&s) == CORE_STRING_INLINE_CAPACITY);
+    assert(core_string_buffer_capacity(&s) == CORE_STRING_INLINE_CAPACITY + 1);
+    assert(strcmp(core_string_cstr(&s), inline_text) == 0);
+    assert(!core_string_is_empty(&s));
+    core_memory_report(MEMORY_TAG_STRING, &stats);
+    assert(stats.current_bytes == before.current_bytes);
+
+    // 1文字連結するとヒープに移り、内容は保持される
+    core_string_t one = CORE_STRING_INITIALIZER;
+    assert(core_string_create("b", &one) == CORE_STRING_SUCCESS);
+    assert(core_string_concat(&one, &s) == CORE_STRING_SUCCESS);
+    assert(s.internal_data != NULL);
+    assert(core_string_length(&s) == CORE_STRING_INLINE_CAPACITY + 1);
+    assert(strncmp(core_string_cstr(&s), inline_text, CORE_STRING_INLINE_CAPACITY) == 0);
+    assert(core_string_cstr(&s)[CORE_STRING_INLINE_CAPACITY] == 'b');
+    core_memory_report(MEMORY_TAG_STRING, &stats);
+    assert(stats.current_bytes > before.current_bytes);
+
+    // ヒープ文字列 -> インライン文字列へのコピー、および自己連結
+    core_string_t copied = CORE_STRING_INITIALIZER;
+    assert(core_string_copy(&one, &copied) == CORE_STRING_SUCCESS);
+    assert(copied.internal_data == NULL);
+    assert(core_string_concat(&copied, &copied) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("bb", &copied));
+    assert(core_string_copy(&s, &copied) == CORE_STRING_SUCCESS);
+    assert(core_string_equal(&s, &copied));
+    assert(copied.internal_data != NULL);
+
+    // インライン文字列に対するsubstring / trim / 数値変換
+    assert(core_string_copy_from_char("  -42  ", &one) == CORE_STRING_SUCCESS);
+    core_string_t trimmed = CORE_STRING_INITIALIZER;
+    assert(core_string_trim(&one, &trimmed, ' ', ' ') == CORE_STRING_SUCCESS);
+    assert(trimmed.internal_data == NULL);
+    int32_t value = 0;
+    assert(core_string_to_i32(&trimmed, &value) == CORE_STRING_SUCCESS);
+    assert(value == -42);
+    assert(core_string_substring_copy(&trimmed, &trimmed, 1, 2) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("42", &trimmed));
+
+    // 空文字列へのtrimで長さも0になる
+    assert(core_string_copy_from_char("   ", &one) == CORE_STRING_SUCCESS);
+    assert(core_string_trim(&one, &trimmed, ' ', ' ') == CORE_STRING_SUCCESS);
+    assert(core_string_is_empty(&trimmed));
+    assert(core_string_length(&trimmed) == 0);
+
+    core_string_destroy(&s);
+    assert(s.internal_data == NULL);
+    assert(core_string_cstr(&s) == NULL);
+    assert(core_string_buffer_capacity(&s) == 0);
+    core_string_destroy(&one);
+    core_string_destroy(&copied);
+    core_string_destroy(&trimmed);
+    assert(core_string_cstr(&trimmed) == NULL);
+}
+
+// 追記系APIの結果と、容量が倍々で拡張されることを確認する
+static void test_core_string_append(void) {
+    core_string_t s = CORE_STRING_INITIALIZER;
+    assert(core_string_append_char('a', NULL) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_append_char('\0', &s) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_append_from_char(NULL, &s) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_append_from_char("a", NULL) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_append_format(NULL, "%d", 1) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_append_format(&s, NULL) == CORE_STRING_INVALID_ARGUMENT);
+
+    // デフォルト状態への1文字ずつの追記
+    char expected[1025];
+    uint64_t resize_count = 0;
+    uint64_t capacity = core_string_buffer_capacity(&s);
+    for(uint64_t i = 0; i != sizeof(expected) - 1; ++i) {
+        expected[i] = (char)('a' + (i % 26));
+        assert(core_string_append_char(expected[i], &s) == CORE_STRING_SUCCESS);
+        const uint64_t new_capacity = core_string_buffer_capacity(&s);
+        if(new_capacity != capacity) {
+            assert(capacity <= CORE_STRING_INLINE_CAPACITY + 1 || new_capacity >= capacity * 2);
+            capacity = new_capacity;
+            resize_count++;
+        }
+    }
+    expected[sizeof(expected) - 1] = '\0';
+    assert(core_string_length(&s) == sizeof(expected) - 1);
+    assert(strcmp(core_string_cstr(&s), expected) == 0);
+    assert(resize_count <= 8);
+    core_string_destroy(&s);
+
+    // C文字列の追記(空文字列、自身の文字列の一部を含む)
+    assert(core_string_append_from_char("", &s) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("", &s));
+    assert(core_string_append_from_char("0123456789", &s) == CORE_STRING_SUCCESS);
+    assert(core_string_append_from_char(core_string_cstr(&s) + 5, &s) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("012345678956789", &s));
+    assert(core_string_append_from_char(core_string_cstr(&s), &s) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("012345678956789012345678956789", &s));
+    assert(s.internal_data != NULL);
+
+    // ヒープ文字列の自己連結
+    assert(core_string_concat(&s, &s) == CORE_STRING_SUCCESS);
+    assert(core_string_length(&s) == 60);
+    assert(strncmp(core_string_cstr(&s), core_string_cstr(&s) + 30, 30) == 0);
+    core_string_destroy(&s);
+
+    // 整形追記(空き領域に収まる場合と、拡張が必要な場合)
+    assert(core_string_append_format(&s, "%d-%s", 42, "x") == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("42-x", &s));
+    assert(s.internal_data == NULL);
+    assert(core_string_append_format(&s, "[%08x]", 0xbeefu) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("42-x[0000beef]", &s));
+    assert(core_string_append_format(&s, "%s/%s/%llu", "long enough", "to leave inline buffer", 1234567890123ull) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("42-x[0000beef]long enough/to leave inline buffer/1234567890123", &s));
+    assert(core_string_append_format(&s, "%s", "") == CORE_STRING_SUCCESS);
+    assert(core_string_length(&s) == strlen("42-x[0000beef]long enough/to leave inline buffer/1234567890123"));
+    core_string_destroy(&s);
+
+    // アリーナ文字列への追記
+    core_arena_t arena = CORE_ARENA_INITIALIZER;
+    assert(core_arena_create(1024, &arena) == CORE_MEMORY_SUCCESS);
+    assert(core_string_create_with_arena("arena", &arena, &s) == CORE_STRING_SUCCESS);
+    for(uint32_t i = 0; i != 10; ++i) {
+        assert(core_string_append_format(&s, "_%u", i) == CORE_STRING_SUCCESS);
+    }
+    assert(core_string_append_char('!', &s) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("arena_0_1_2_3_4_5_6_7_8_9!", &s));
+    core_string_destroy(&s);
+    assert(core_arena_reset(&arena) == CORE_MEMORY_SUCCESS);
+    core_arena_destroy(&arena);
+}
+
+// 比較用の単純な部分文字列検索
+static uint64_t naive_find(const char* str_, uint64_t size_, const char* needle_, uint64_t needle_size_) {
+    if(needle_size_ > size_) {
+        return INVALID_VALUE_U64;
+    }
+    for(uint64_t i = 0; i + needle_size_ <= size_; ++i) {
+        if(0 == memcmp(str_ + i, needle_, needle_size_)) {
+            return i;
+        }
+    }
+    return INVALID_VALUE_U64;
+}
+
+static void test_core_string_search(void) {
+    assert(core_string_kernel_name() != NULL);
+
+    core_string_t s = CORE_STRING_INITIALIZER;
+    core_string_t needle = CORE_STRING_INITIALIZER;
+    assert(core_string_find_char(NULL, 0, 'a') == INVALID_VALUE_U64);
+    assert(core_string_find_char(&s, 0, 'a') == INVALID_VALUE_U64);     // デフォルト状態
+    assert(core_string_find(NULL, 0, &needle) == INVALID_VALUE_U64);
+    assert(core_string_find(&s, 0, NULL) == INVALID_VALUE_U64);
+    assert(core_string_find_from_char(&s, 0, NULL) == INVALID_VALUE_U64);
+
+    assert(core_string_copy_from_char("hello, world", &s) == CORE_STRING_SUCCESS);
+    assert(core_string_find_char(&s, 0, 'o') == 4);
+    assert(core_string_find_char(&s, 5, 'o') == 8);
+    assert(core_string_find_char(&s, 9, 'o') == INVALID_VALUE_U64);
+    assert(core_string_find_char(&s, 12, 'd') == INVALID_VALUE_U64);   // offset_ == 長さ
+    assert(core_string_find_char(&s, 100, 'h') == INVALID_VALUE_U64);
+    assert(core_string_find_from_char(&s, 0, "world") == 7);
+    assert(core_string_find_from_char(&s, 8, "world") == INVALID_VALUE_U64);
+    assert(core_string_find_from_char(&s, 3, "") == 3);
+    assert(core_string_find_from_char(&s, 12, "") == 12);
+    assert(core_string_find_from_char(&s, 13, "") == INVALID_VALUE_U64);
+    assert(core_string_find_from_char(&s, 0, "hello, world!") == INVALID_VALUE_U64);
+    assert(core_string_copy_from_char("lo", &needle) == CORE_STRING_SUCCESS);
+    assert(core_string_find(&s, 0, &needle) == 3);
+    assert(core_string_find(&s, 4, &needle) == INVALID_VALUE_U64);
+
+    // 長さ、比較、検索をベクトル幅前後の長さ、各アライメントで単純な実装と突き合わせる
+    enum { MAX_SIZE = 160, MAX_ALIGN = 32 };
+    static char buffer[MAX_ALIGN + MAX_SIZE + 1];
+    static char other[MAX_ALIGN + MAX_SIZE + 1];
+    for(uint64_t size = 0; size <= MAX_SIZE; ++size) {
+        for(uint64_t align = 0; align < MAX_ALIGN; align += 3) {
+            char* str = buffer + align;
+            for(uint64_t i = 0; i != size; ++i) {
+                str[i] = (char)('a' + (i * 7 + size) % 5);    // 部分一致が多く発生する文字列
+            }
+            str[size] = '\0';
+
+            assert(core_string_copy_from_char(str, &s) == CORE_STRING_SUCCESS);
+            assert(core_string_length(&s) == size);
+            assert(core_string_equal_from_char(str, &s));
+
+            // 1文字だけ異なる文字列との比較(異なる位置を全て試す)
+            char* str2 = other + (MAX_ALIGN - 1 - align);
+            memcpy(str2, str, size + 1);
+            assert(core_string_equal_from_char(str2, &s));
+            for(uint64_t i = 0; i != size; ++i) {
+                str2[i] = (char)(str2[i] ^ 0x80);
+                assert(!core_string_equal_from_char(str2, &s));
+                str2[i] = (char)(str2[i] ^ 0x80);
+            }
+
+            core_string_view_t view = CORE_STRING_VIEW_INITIALIZER;
+            assert(core_string_view_from_buffer(str, size, &view) == CORE_STRING_SUCCESS);
+            for(char c = 'a'; c <= 'f'; ++c) {
+                const char* expected = memchr(str, c, (size_t)size);
+                const uint64_t index = (0 != expected) ? (uint64_t)(expected - str) : INVALID_VALUE_U64;
+                assert(core_string_find_char(&s, 0, c) == index);
+                assert(core_string_view_find_char(&view, 0, c) == index);
+            }
+            static const char* const needles[] = { "a", "ab", "cad", "abcde", "dbecad", "ecadbecadbecadbec", "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee" };
+            for(uint64_t n = 0; n != sizeof(needles) / sizeof(needles[0]); ++n) {
+                const uint64_t expected = naive_find(str, size, needles[n], strlen(needles[n]));
+                assert(core_string_find_from_char(&s, 0, needles[n]) == expected);
+            }
+            // 末尾の部分文字列は必ず見つかる
+            for(uint64_t n = 1; n <= size && n <= 40; n += 13) {
+                core_string_view_t tail = CORE_STRING_VIEW_INITIALIZER;
+                assert(core_string_view_substring(&view, size - n, n, &tail) == CORE_STRING_SUCCESS);
+                assert(core_string_view_find(&view, 0, &tail) == naive_find(str, size, tail.data, n));
+            }
+        }
+    }
+    core_string_destroy(&needle);
+    core_string_destroy(&s);
+}
+
+static void test_core_string_trim_set(void) {
+    core_string_t src = CORE_STRING_INITIALIZER;
+    core_string_t dst = CORE_STRING_INITIALIZER;
+    assert(core_string_trim_set(NULL, &dst, " ", " ") == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_trim_set(&src, NULL, " ", " ") == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_trim_set(&src, &dst, " ", " ") == CORE_STRING_RUNTIME_ERROR);   // src未初期化
+
+    // 空白類文字の集合、片側のみのトリム
+    assert(core_string_create(" \t key = value\r\n", &src) == CORE_STRING_SUCCESS);
+    assert(core_string_trim_set(&src, &dst, CORE_STRING_WHITESPACE, CORE_STRING_WHITESPACE) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("key = value", &dst));
+    assert(core_string_trim_set(&src, &dst, NULL, "\r\n") == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char(" \t key = value", &dst));
+    assert(core_string_trim_set(&src, &dst, " \t", "") == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("key = value\r\n", &dst));
+    assert(core_string_trim_set(&src, &dst, NULL, NULL) == CORE_STRING_SUCCESS);
+    assert(core_string_equal(&src, &dst));
+    assert(core_string_trim_set(&src, &dst, CORE_STRING_WHITESPACE "keyvalu= ", NULL) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("", &dst));
+
+    // その場でのトリム(src_ == dst_)
+    assert(core_string_trim_set(&src, &src, CORE_STRING_WHITESPACE, CORE_STRING_WHITESPACE) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("key = value", &src));
+    assert(core_string_trim_set(&src, &src, "k", "e") == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("ey = valu", &src));
+    assert(core_string_trim(&src, &src, 'x', 'u') == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("ey = val", &src));
+    assert(core_string_substring_copy(&src, &src, 5, 7) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("val", &src));
+    assert(core_string_substring_copy(&src, &src, 0, 3) == CORE_STRING_INVALID_ARGUMENT);  // to_ == 長さ
+    core_string_destroy(&src);
+    core_string_destroy(&dst);
+
+    // 64KBを超える文字列の部分文字列、トリム(その場で処理し、バッファを再確保しない)
+    enum { LARGE_PADDING = 40000, LARGE_BODY = 70000 };
+    for(uint64_t i = 0; i != LARGE_PADDING; ++i) {
+        assert(core_string_append_char((0 == (i & 1)) ? ' ' : '\t', &src) == CORE_STRING_SUCCESS);
+    }
+    for(uint64_t i = 0; i != LARGE_BODY; ++i) {
+        assert(core_string_append_char((char)('a' + (i % 26)), &src) == CORE_STRING_SUCCESS);
+    }
+    for(uint64_t i = 0; i != LARGE_PADDING; ++i) {
+        assert(core_string_append_char('\n', &src) == CORE_STRING_SUCCESS);
+    }
+    assert(core_string_substring_copy(&src, &dst, LARGE_PADDING + 1, LARGE_PADDING + LARGE_BODY - 1) == CORE_STRING_SUCCESS);
+    assert(core_string_length(&dst) == LARGE_BODY - 1);
+    assert(core_string_cstr(&dst)[0] == 'b');
+    const char* buffer = core_string_cstr(&src);
+    const uint64_t capacity = core_string_buffer_capacity(&src);
+    assert(core_string_trim_set(&src, &src, CORE_STRING_WHITESPACE, CORE_STRING_WHITESPACE) == CORE_STRING_SUCCESS);
+    assert(core_string_cstr(&src) == buffer);
+    assert(core_string_buffer_capacity(&src) == capacity);
+    assert(core_string_length(&src) == LARGE_BODY);
+    assert(core_string_cstr(&src)[0] == 'a');
+    assert(core_string_cstr(&src)[LARGE_BODY - 1] == (char)('a' + ((LARGE_BODY - 1) % 26)));
+    assert(core_string_cstr(&src)[LARGE_BODY] == '\0');
+    core_string_destroy(&src);
+    core_string_destroy(&dst);
+}
+
+// core_string_hashはcore_hash_bytesと同じ値を返し、文字列の変更でキャッシュが無効化されることを確認する
+static void test_core_string_hash(void) {
+    const uint64_t empty_hash = core_hash_bytes(NULL, 0, CORE_HASH_DEFAULT_SEED);
+    assert(core_string_hash(NULL) == 0);
+
+    core_string_t s = CORE_STRING_INITIALIZER;
+    assert(core_string_hash(&s) == empty_hash);     // デフォルト状態は空文字列として扱う
+
+    // インライン文字列
+    assert(core_string_create("short", &s) == CORE_STRING_SUCCESS);
+    assert(s.internal_data == NULL);
+    assert(core_string_hash(&s) == core_hash_bytes("short", 5, CORE_HASH_DEFAULT_SEED));
+    assert(core_string_append_char('!', &s) == CORE_STRING_SUCCESS);
+    assert(core_string_hash(&s) == core_hash_bytes("short!", 6, CORE_HASH_DEFAULT_SEED));
+
+    // インラインからヒープへ移った文字列(移動直後はキャッシュを持たない)
+    const char* long_text = "a rather long string stored on the heap";
+    assert(core_string_append_from_char(" a rather long tail moves it to the heap", &s) == CORE_STRING_SUCCESS);
+    assert(s.internal_data != NULL);
+    assert(core_string_hash(&s) == core_hash_bytes(core_string_cstr(&s), core_string_length(&s), CORE_HASH_DEFAULT_SEED));
+
+    // 2回目以降はキャッシュした値を返す
+    assert(core_string_copy_from_char(long_text, &s) == CORE_STRING_SUCCESS);
+    const uint64_t hash = core_string_hash(&s);
+    assert(hash == core_hash_bytes(long_text, strlen(long_text), CORE_HASH_DEFAULT_SEED));
+    assert(core_string_hash(&s) == hash);
+
+    // 変更するAPIはキャッシュを無効化する
+    assert(core_string_append_char('x', &s) == CORE_STRING_SUCCESS);
+    assert(core_string_hash(&s) == core_hash_bytes(core_string_cstr(&s), core_string_length(&s), CORE_HASH_DEFAULT_SEED));
+    assert(core_string_hash(&s) != hash);
+    assert(core_string_substring_copy(&s, &s, 0, strlen(long_text) - 1) == CORE_STRING_SUCCESS);     // 末尾の'x'を取り除く
+    assert(core_string_hash(&s) == hash);
+    assert(core_string_trim(&s, &s, 'a', 'p') == CORE_STRING_SUCCESS);
+    assert(core_string_hash(&s) == core_hash_bytes(core_string_cstr(&s), core_string_length(&s), CORE_HASH_DEFAULT_SEED));
+    assert(core_string_copy_from_char("", &s) == CORE_STRING_SUCCESS);
+    assert(core_string_hash(&s) == empty_hash);
+    assert(core_string_copy_from_char(long_text, &s) == CORE_STRING_SUCCESS);
+    assert(core_string_hash(&s) == hash);
+    assert(core_string_buffer_reserve(1024, &s) == CORE_STRING_SUCCESS);    // 内容を破棄して再確保
+    assert(core_string_hash(&s) == empty_hash);
+    core_string_destroy(&s);
+
+    // アリーナから確保した文字列
+    core_arena_t arena = CORE_ARENA_INITIALIZER;
+    assert(core_arena_create(256, &arena) == CORE_MEMORY_SUCCESS);
+    assert(core_string_create_with_arena("arena", &arena, &s) == CORE_STRING_SUCCESS);
+    assert(core_string_hash(&s) == core_hash_bytes("arena", 5, CORE_HASH_DEFAULT_SEED));
+    assert(core_string_append_from_char("_string", &s) == CORE_STRING_SUCCESS);
+    assert(core_string_hash(&s) == core_hash_bytes("arena_string", 12, CORE_HASH_DEFAULT_SEED));
+    core_string_destroy(&s);
+    core_arena_destroy(&arena);
+}
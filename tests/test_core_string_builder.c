@@ -0,0 +1,201 @@
+#if defined(__linux__)
+#define _POSIX_C_SOURCE 200809L // for fileno, pipe
+#endif
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "include/test_core_string_builder.h"
+
+#include "core/core_string_builder.h"
+#include "core/core_string.h"
+#include "core/core_memory.h"
+
+#include "define.h"
+
+static void test_core_string_builder_invalid(void);
+static void test_core_string_builder_append(void);
+static void test_core_string_builder_large_append(void);
+static void test_core_string_builder_reset_reuse(void);
+static void test_core_string_builder_write(void);
+
+void test_core_string_builder(void) {
+    test_core_string_builder_invalid();
+    test_core_string_builder_append();
+    test_core_string_builder_large_append();
+    test_core_string_builder_reset_reuse();
+    test_core_string_builder_write();
+}
+
+static void test_core_string_builder_invalid(void) {
+    core_string_builder_t builder = CORE_STRING_BUILDER_INITIALIZER;
+    core_string_t s = CORE_STRING_INITIALIZER;
+    assert(core_string_builder_create(16, NULL) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_builder_append(NULL, &builder) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_builder_append(&s, NULL) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_builder_append_from_char(NULL, &builder) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_builder_append_from_char("a", NULL) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_builder_append_format(NULL, "%d", 1) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_builder_append_format(&builder, NULL) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_builder_finalize(NULL, &s) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_builder_finalize(&builder, NULL) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_builder_write(NULL, 1) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_builder_write(&builder, -1) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_builder_length(NULL) == INVALID_VALUE_U64);
+    core_string_builder_default_create(NULL);
+    core_string_builder_destroy(NULL);
+    core_string_builder_reset(NULL);
+
+    // デフォルト状態: 長さ0、finalizeで空文字列、destroy / resetは何もしない
+    assert(core_string_builder_length(&builder) == 0);
+    assert(core_string_builder_finalize(&builder, &s) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("", &s));
+    assert(core_string_builder_write(&builder, 1) == CORE_STRING_SUCCESS);
+    core_string_builder_reset(&builder);
+    core_string_builder_destroy(&builder);
+    assert(builder.internal_data == NULL);
+    core_string_destroy(&s);
+}
+
+// ブロックを跨ぐ追記の結果が連結と一致することを確認する
+static void test_core_string_builder_append(void) {
+    core_string_builder_t builder = CORE_STRING_BUILDER_INITIALIZER;
+    assert(core_string_builder_create(8, &builder) == CORE_STRING_SUCCESS);
+
+    core_string_t piece = CORE_STRING_INITIALIZER;
+    core_string_t empty = CORE_STRING_INITIALIZER;
+    assert(core_string_create("<piece>", &piece) == CORE_STRING_SUCCESS);
+    assert(core_string_builder_append(&empty, &builder) == CORE_STRING_SUCCESS);
+    assert(core_string_builder_append_from_char("", &builder) == CORE_STRING_SUCCESS);
+    assert(core_string_builder_append_format(&builder, "%s", "") == CORE_STRING_SUCCESS);
+    assert(core_string_builder_length(&builder) == 0);
+
+    char expected[256] = { 0 };
+    for(int i = 0; i != 5; ++i) {
+        assert(core_string_builder_append_from_char("abc", &builder) == CORE_STRING_SUCCESS);
+        assert(core_string_builder_append(&piece, &builder) == CORE_STRING_SUCCESS);
+        assert(core_string_builder_append_format(&builder, "[%d:%s]", i * 1000, "fmt") == CORE_STRING_SUCCESS);
+        char formatted[32];
+        snprintf(formatted, sizeof(formatted), "[%d:%s]", i * 1000, "fmt");
+        strcat(expected, "abc<piece>");
+        strcat(expected, formatted);
+    }
+    assert(core_string_builder_length(&builder) == strlen(expected));
+
+    core_string_t result = CORE_STRING_INITIALIZER;
+    assert(core_string_builder_finalize(&builder, &result) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char(expected, &result));
+    assert(core_string_builder_length(&builder) == 0);
+
+    // finalize後も追記でき、既存の内容は上書きされる
+    assert(core_string_builder_append_from_char("next", &builder) == CORE_STRING_SUCCESS);
+    assert(core_string_builder_finalize(&builder, &result) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("next", &result));
+
+    core_string_destroy(&result);
+    core_string_destroy(&piece);
+    core_string_destroy(&empty);
+    core_string_builder_destroy(&builder);
+    assert(builder.internal_data == NULL);
+}
+
+// ブロックサイズを超える追記、およびデフォルト状態からの自動生成
+static void test_core_string_builder_large_append(void) {
+    core_memory_stats_t before = { 0 };
+    core_memory_stats_t stats = { 0 };
+    core_memory_report(MEMORY_TAG_STRING, &before);
+
+    char large[CORE_STRING_BUILDER_DEFAULT_BLOCK_SIZE * 3 + 1];
+    for(uint64_t i = 0; i != sizeof(large) - 1; ++i) {
+        large[i] = (char)('A' + (i % 26));
+    }
+    large[sizeof(large) - 1] = '\0';
+
+    core_string_builder_t builder = CORE_STRING_BUILDER_INITIALIZER;
+    assert(core_string_builder_append_from_char("head:", &builder) == CORE_STRING_SUCCESS);
+    assert(builder.internal_data != NULL);
+    assert(core_string_builder_append_from_char(large, &builder) == CORE_STRING_SUCCESS);
+    assert(core_string_builder_append_format(&builder, ":%s:", large) == CORE_STRING_SUCCESS);
+    assert(core_string_builder_length(&builder) == 5 + (sizeof(large) - 1) * 2 + 2);
+
+    core_string_t result = CORE_STRING_INITIALIZER;
+    assert(core_string_builder_finalize(&builder, &result) == CORE_STRING_SUCCESS);
+    const char* cstr = core_string_cstr(&result);
+    assert(strncmp(cstr, "head:", 5) == 0);
+    assert(strncmp(cstr + 5, large, sizeof(large) - 1) == 0);
+    assert(cstr[5 + sizeof(large) - 1] == ':');
+    assert(strncmp(cstr + 6 + sizeof(large) - 1, large, sizeof(large) - 1) == 0);
+    assert(strcmp(cstr + 6 + (sizeof(large) - 1) * 2, ":") == 0);
+
+    core_string_destroy(&result);
+    core_string_builder_destroy(&builder);
+    core_memory_report(MEMORY_TAG_STRING, &stats);
+    assert(stats.current_bytes == before.current_bytes);
+}
+
+// reset後はブロックを再確保せずに再利用する
+static void test_core_string_builder_reset_reuse(void) {
+    core_string_builder_t builder = CORE_STRING_BUILDER_INITIALIZER;
+    assert(core_string_builder_create(32, &builder) == CORE_STRING_SUCCESS);
+    for(int i = 0; i != 20; ++i) {
+        assert(core_string_builder_append_format(&builder, "line %02d\n", i) == CORE_STRING_SUCCESS);
+    }
+    core_memory_stats_t stats = { 0 };
+    core_memory_report(MEMORY_TAG_STRING, &stats);
+    const uint64_t allocated = stats.current_bytes;
+
+    core_string_builder_reset(&builder);
+    assert(core_string_builder_length(&builder) == 0);
+    for(int i = 0; i != 20; ++i) {
+        assert(core_string_builder_append_format(&builder, "LINE %02d\n", i) == CORE_STRING_SUCCESS);
+    }
+    core_memory_report(MEMORY_TAG_STRING, &stats);
+    assert(stats.current_bytes == allocated);
+
+    core_string_t result = CORE_STRING_INITIALIZER;
+    assert(core_string_builder_finalize(&builder, &result) == CORE_STRING_SUCCESS);
+    assert(core_string_length(&result) == 20 * 8);
+    assert(strncmp(core_string_cstr(&result), "LINE 00\nLINE 01\n", 16) == 0);
+    assert(strcmp(core_string_cstr(&result) + 19 * 8, "LINE 19\n") == 0);
+
+    core_string_destroy(&result);
+    core_string_builder_destroy(&builder);
+}
+
+// writevで書き出した内容がfinalizeの結果と一致することを確認する
+static void test_core_string_builder_write(void) {
+    core_string_builder_t builder = CORE_STRING_BUILDER_INITIALIZER;
+    assert(core_string_builder_create(16, &builder) == CORE_STRING_SUCCESS);
+    for(int i = 0; i != 100; ++i) {
+        assert(core_string_builder_append_format(&builder, "%d,", i) == CORE_STRING_SUCCESS);
+    }
+    const uint64_t length = core_string_builder_length(&builder);
+
+    FILE* file = tmpfile();
+    assert(file != NULL);
+    assert(core_string_builder_write(&builder, fileno(file)) == CORE_STRING_SUCCESS);
+    assert(core_string_builder_length(&builder) == length);
+
+    char written[512] = { 0 };
+    rewind(file);
+    assert(fread(written, 1, sizeof(written), file) == length);
+    fclose(file);
+
+    core_string_t result = CORE_STRING_INITIALIZER;
+    assert(core_string_builder_finalize(&builder, &result) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char(written, &result));
+
+    // 書き込みに失敗するディスクリプタ
+    int fds[2];
+    assert(pipe(fds) == 0);
+    close(fds[1]);
+    assert(core_string_builder_append_from_char("x", &builder) == CORE_STRING_SUCCESS);
+    assert(core_string_builder_write(&builder, fds[0]) == CORE_STRING_RUNTIME_ERROR);
+    close(fds[0]);
+
+    core_string_destroy(&result);
+    core_string_builder_destroy(&builder);
+}
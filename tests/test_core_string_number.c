@@ -0,0 +1,472 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "include/test_core_string_number.h"
+
+#include "core/core_string_number.h"
+#include "core/core_string.h"
+
+#include "define.h"
+
+static void test_core_string_parse_integer(void);
+static void test_core_string_parse_integer_random(void);
+static void test_core_string_parse_float(void);
+static void test_core_string_parse_float_random(void);
+static void test_core_string_to_number(void);
+static void test_core_string_append_integer(void);
+static void test_core_string_append_float(void);
+static void test_core_string_append_float_random(void);
+
+void test_core_string_number(void) {
+    test_core_string_parse_integer();
+    test_core_string_parse_integer_random();
+    test_core_string_parse_float();
+    test_core_string_parse_float_random();
+    test_core_string_to_number();
+    test_core_string_append_integer();
+    test_core_string_append_float();
+    test_core_string_append_float_random();
+}
+
+// 10進表記text_の有効数字の桁数を返す(符号、小数点、指数部、先頭と末尾の0を除く)
+static uint64_t test_significant_digits(const char* text_) {
+    uint64_t count = 0;
+    uint64_t trailing_zero = 0;
+    bool leading = true;
+    for(const char* p = text_; '\0' != *p && 'e' != *p; ++p) {
+        if(*p < '0' || *p > '9' || (leading && '0' == *p)) {
+            continue;
+        }
+        leading = false;
+        count++;
+        trailing_zero = ('0' == *p) ? trailing_zero + 1 : 0;
+    }
+    return count - trailing_zero;
+}
+
+// テスト用の疑似乱数(xorshift64)
+static uint64_t test_random(uint64_t* state_) {
+    *state_ ^= *state_ << 13;
+    *state_ ^= *state_ >> 7;
+    *state_ ^= *state_ << 17;
+    return *state_;
+}
+
+static void test_core_string_parse_integer(void) {
+    int64_t i64 = 0;
+    uint64_t consumed = 0;
+    assert(core_string_parse_i64("1", 1, NULL, &consumed) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_parse_i64(NULL, 1, &i64, &consumed) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_parse_i64(NULL, 0, &i64, &consumed) == CORE_STRING_RUNTIME_ERROR);   // 空
+    assert(consumed == 0);
+
+    // 10進数、符号、読み取り文字数
+    assert(core_string_parse_i64("0", 1, &i64, NULL) == CORE_STRING_SUCCESS && i64 == 0);
+    assert(core_string_parse_i64("-0", 2, &i64, NULL) == CORE_STRING_SUCCESS && i64 == 0);
+    assert(core_string_parse_i64("+7", 2, &i64, NULL) == CORE_STRING_SUCCESS && i64 == 7);
+    assert(core_string_parse_i64("-123,456", 8, &i64, &consumed) == CORE_STRING_SUCCESS);
+    assert(i64 == -123 && consumed == 4);
+    assert(core_string_parse_i64("-123,456", 8, &i64, NULL) == CORE_STRING_RUNTIME_ERROR);   // 後ろに文字が続く
+    assert(core_string_parse_i64("123", 2, &i64, NULL) == CORE_STRING_SUCCESS && i64 == 12);  // length_で打ち切り
+    assert(core_string_parse_i64(" 1", 2, &i64, &consumed) == CORE_STRING_RUNTIME_ERROR);    // 空白は読み飛ばさない
+    assert(consumed == 0);
+    assert(core_string_parse_i64("-", 1, &i64, &consumed) == CORE_STRING_RUNTIME_ERROR);
+    assert(core_string_parse_i64("+-1", 3, &i64, &consumed) == CORE_STRING_RUNTIME_ERROR);
+
+    // 8桁単位の処理と端数、途中で数字以外が現れる場合
+    assert(core_string_parse_i64("12345678", 8, &i64, NULL) == CORE_STRING_SUCCESS && i64 == 12345678);
+    assert(core_string_parse_i64("1234567890123456", 16, &i64, NULL) == CORE_STRING_SUCCESS && i64 == 1234567890123456);
+    assert(core_string_parse_i64("00000000000000000000042", 23, &i64, NULL) == CORE_STRING_SUCCESS && i64 == 42);
+    for(uint64_t stop = 0; stop != 17; ++stop) {
+        char text[] = "12345678901234567";
+        text[stop] = 'x';
+        const CORE_STRING_ERROR_CODE ret = core_string_parse_i64(text, 17, &i64, &consumed);
+        assert(consumed == stop);
+        assert((0 == stop) ? (ret == CORE_STRING_RUNTIME_ERROR) : (ret == CORE_STRING_SUCCESS));
+        if(0 != stop) {
+            assert(i64 == strtoll(text, NULL, 10));
+        }
+    }
+
+    // 境界値と範囲外(範囲外の場合は最小値/最大値に丸め、全ての桁を読み取る)
+    assert(core_string_parse_i64("9223372036854775807", 19, &i64, NULL) == CORE_STRING_SUCCESS && i64 == INT64_MAX);
+    assert(core_string_parse_i64("-9223372036854775808", 20, &i64, NULL) == CORE_STRING_SUCCESS && i64 == INT64_MIN);
+    assert(core_string_parse_i64("9223372036854775808", 19, &i64, NULL) == CORE_STRING_OUT_OF_RANGE && i64 == INT64_MAX);
+    assert(core_string_parse_i64("-9223372036854775809", 20, &i64, NULL) == CORE_STRING_OUT_OF_RANGE && i64 == INT64_MIN);
+    assert(core_string_parse_i64("123456789012345678901234567890;", 31, &i64, &consumed) == CORE_STRING_OUT_OF_RANGE);
+    assert(i64 == INT64_MAX && consumed == 30);
+
+    uint64_t u64 = 0;
+    assert(core_string_parse_u64("18446744073709551615", 20, &u64, NULL) == CORE_STRING_SUCCESS && u64 == UINT64_MAX);
+    assert(core_string_parse_u64("18446744073709551616", 20, &u64, NULL) == CORE_STRING_OUT_OF_RANGE && u64 == UINT64_MAX);
+    assert(core_string_parse_u64("99999999999999999999", 20, &u64, NULL) == CORE_STRING_OUT_OF_RANGE);
+    assert(core_string_parse_u64("-1", 2, &u64, &consumed) == CORE_STRING_RUNTIME_ERROR && consumed == 0);
+    assert(core_string_parse_u64("+1", 2, &u64, NULL) == CORE_STRING_SUCCESS && u64 == 1);
+
+    int32_t i32 = 0;
+    int16_t i16 = 0;
+    int8_t i8 = 0;
+    uint32_t u32 = 0;
+    uint16_t u16 = 0;
+    uint8_t u8 = 0;
+    assert(core_string_parse_i32("-2147483648", 11, &i32, NULL) == CORE_STRING_SUCCESS && i32 == INT32_MIN);
+    assert(core_string_parse_i32("2147483648", 10, &i32, NULL) == CORE_STRING_OUT_OF_RANGE && i32 == INT32_MAX);
+    assert(core_string_parse_i16("-32768", 6, &i16, NULL) == CORE_STRING_SUCCESS && i16 == INT16_MIN);
+    assert(core_string_parse_i16("32768", 5, &i16, NULL) == CORE_STRING_OUT_OF_RANGE && i16 == INT16_MAX);
+    assert(core_string_parse_i8("-128", 4, &i8, NULL) == CORE_STRING_SUCCESS && i8 == INT8_MIN);
+    assert(core_string_parse_i8("-129", 4, &i8, NULL) == CORE_STRING_OUT_OF_RANGE && i8 == INT8_MIN);
+    assert(core_string_parse_i8("127", 3, &i8, NULL) == CORE_STRING_SUCCESS && i8 == INT8_MAX);
+    assert(core_string_parse_u32("4294967295", 10, &u32, NULL) == CORE_STRING_SUCCESS && u32 == UINT32_MAX);
+    assert(core_string_parse_u32("4294967296", 10, &u32, NULL) == CORE_STRING_OUT_OF_RANGE && u32 == UINT32_MAX);
+    assert(core_string_parse_u16("65535", 5, &u16, NULL) == CORE_STRING_SUCCESS && u16 == UINT16_MAX);
+    assert(core_string_parse_u16("65536", 5, &u16, NULL) == CORE_STRING_OUT_OF_RANGE && u16 == UINT16_MAX);
+    assert(core_string_parse_u8("255", 3, &u8, NULL) == CORE_STRING_SUCCESS && u8 == UINT8_MAX);
+    assert(core_string_parse_u8("256", 3, &u8, NULL) == CORE_STRING_OUT_OF_RANGE && u8 == UINT8_MAX);
+
+    // 16進数
+    assert(core_string_parse_i64("0x1F", 4, &i64, NULL) == CORE_STRING_SUCCESS && i64 == 31);
+    assert(core_string_parse_i64("-0XaBc", 6, &i64, NULL) == CORE_STRING_SUCCESS && i64 == -0xabc);
+    assert(core_string_parse_i64("0x", 2, &i64, &consumed) == CORE_STRING_SUCCESS);   // "0"の後ろに'x'が続くと解釈する
+    assert(i64 == 0 && consumed == 1);
+    assert(core_string_parse_i64("0xg", 3, &i64, &consumed) == CORE_STRING_SUCCESS && consumed == 1);
+    assert(core_string_parse_u64("0xFFFFFFFFFFFFFFFF", 18, &u64, NULL) == CORE_STRING_SUCCESS && u64 == UINT64_MAX);
+    assert(core_string_parse_u64("0x10000000000000000", 19, &u64, NULL) == CORE_STRING_OUT_OF_RANGE);
+    assert(core_string_parse_i8("-0x80", 5, &i8, NULL) == CORE_STRING_SUCCESS && i8 == INT8_MIN);
+    assert(core_string_parse_u8("0x100", 5, &u8, NULL) == CORE_STRING_OUT_OF_RANGE && u8 == UINT8_MAX);
+}
+
+static void test_core_string_parse_integer_random(void) {
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+    char text[64];
+    for(uint32_t i = 0; i != 20000; ++i) {
+        // 桁数が偏らないよう、値を右シフトして様々な大きさにする
+        const uint64_t bits = test_random(&state);
+        const uint64_t value = bits >> (test_random(&state) % 64);
+        const int length = snprintf(text, sizeof(text), "%llu", (unsigned long long)value);
+        uint64_t u64 = 0;
+        uint64_t consumed = 0;
+        assert(core_string_parse_u64(text, (uint64_t)length, &u64, &consumed) == CORE_STRING_SUCCESS);
+        assert(u64 == value && consumed == (uint64_t)length);
+
+        const int64_t signed_value = (int64_t)bits >> (test_random(&state) % 64);
+        const int signed_length = snprintf(text, sizeof(text), "%lld", (long long)signed_value);
+        int64_t i64 = 0;
+        assert(core_string_parse_i64(text, (uint64_t)signed_length, &i64, NULL) == CORE_STRING_SUCCESS);
+        assert(i64 == signed_value);
+
+        const int hex_length = snprintf(text, sizeof(text), "0x%llx", (unsigned long long)value);
+        assert(core_string_parse_u64(text, (uint64_t)hex_length, &u64, NULL) == CORE_STRING_SUCCESS);
+        assert(u64 == value);
+    }
+}
+
+static void test_core_string_parse_float(void) {
+    double f64 = 0.0;
+    float f32 = 0.0f;
+    uint64_t consumed = 0;
+    assert(core_string_parse_f64("1", 1, NULL, NULL) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_parse_f64(NULL, 1, &f64, NULL) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_parse_f32("1", 1, NULL, NULL) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_parse_f64(NULL, 0, &f64, &consumed) == CORE_STRING_RUNTIME_ERROR);
+
+    assert(core_string_parse_f64("3.25", 4, &f64, NULL) == CORE_STRING_SUCCESS && f64 == 3.25);
+    assert(core_string_parse_f64("-4.5e2,", 7, &f64, &consumed) == CORE_STRING_SUCCESS);
+    assert(f64 == -450.0 && consumed == 6);
+    assert(core_string_parse_f64(".5", 2, &f64, NULL) == CORE_STRING_SUCCESS && f64 == 0.5);
+    assert(core_string_parse_f64("5.", 2, &f64, NULL) == CORE_STRING_SUCCESS && f64 == 5.0);
+    assert(core_string_parse_f64("1E+3", 4, &f64, NULL) == CORE_STRING_SUCCESS && f64 == 1000.0);
+    assert(core_string_parse_f64(".", 1, &f64, &consumed) == CORE_STRING_RUNTIME_ERROR && consumed == 0);
+    assert(core_string_parse_f64("-.e1", 4, &f64, &consumed) == CORE_STRING_RUNTIME_ERROR && consumed == 0);
+    assert(core_string_parse_f64("1e", 2, &f64, &consumed) == CORE_STRING_SUCCESS);  // 指数部の数字がない場合は"1"のみ読み取る
+    assert(f64 == 1.0 && consumed == 1);
+    assert(core_string_parse_f64("1e+x", 4, &f64, &consumed) == CORE_STRING_SUCCESS && consumed == 1);
+    assert(core_string_parse_f64("-0.0", 4, &f64, NULL) == CORE_STRING_SUCCESS);
+    assert(f64 == 0.0 && signbit(f64));
+
+    // 特殊値
+    assert(core_string_parse_f64("inf", 3, &f64, NULL) == CORE_STRING_SUCCESS && isinf(f64) && f64 > 0);
+    assert(core_string_parse_f64("-Infinity", 9, &f64, NULL) == CORE_STRING_SUCCESS && isinf(f64) && f64 < 0);
+    assert(core_string_parse_f64("INFIN", 5, &f64, &consumed) == CORE_STRING_SUCCESS && consumed == 3);
+    assert(core_string_parse_f64("NaN", 3, &f64, NULL) == CORE_STRING_SUCCESS && isnan(f64));
+    assert(core_string_parse_f32("-inf", 4, &f32, NULL) == CORE_STRING_SUCCESS && isinf(f32) && f32 < 0);
+    assert(core_string_parse_f64("in", 2, &f64, &consumed) == CORE_STRING_RUNTIME_ERROR && consumed == 0);
+
+    // 範囲外、アンダーフロー
+    assert(core_string_parse_f64("1e400", 5, &f64, NULL) == CORE_STRING_OUT_OF_RANGE && isinf(f64));
+    assert(core_string_parse_f64("-1e400", 6, &f64, NULL) == CORE_STRING_OUT_OF_RANGE && isinf(f64) && f64 < 0);
+    assert(core_string_parse_f32("1e39", 4, &f32, NULL) == CORE_STRING_OUT_OF_RANGE && isinf(f32));
+    assert(core_string_parse_f64("1e-400", 6, &f64, NULL) == CORE_STRING_SUCCESS && f64 == 0.0);
+    assert(core_string_parse_f64("1e99999999999999999999", 22, &f64, NULL) == CORE_STRING_OUT_OF_RANGE);
+    assert(core_string_parse_f64("0e99999999999999999999", 22, &f64, NULL) == CORE_STRING_SUCCESS && f64 == 0.0);
+
+    // 丸めが難しい値(strtodの結果と一致すること)
+    static const char* const hard_cases[] = {
+        "9007199254740993",                 // 2^53 + 1
+        "2.2250738585072011e-308",          // 最小正規化数付近
+        "4.9406564584124654e-324",          // 最小非正規化数
+        "1.7976931348623157e308",           // 最大値
+        "0.1", "0.3", "123456789012345678901234567890",
+        "7.038531e-26",                     // floatで二重丸めが起こる値
+        "1.00000005960464477539062499",     // floatの丸めの境界のすぐ下
+        "1.00000005960464477539062501",     // floatの丸めの境界のすぐ上
+        "3.4028235e38", "1.4e-45",
+    };
+    for(uint64_t i = 0; i != sizeof(hard_cases) / sizeof(hard_cases[0]); ++i) {
+        const uint64_t length = strlen(hard_cases[i]);
+        assert(core_string_parse_f64(hard_cases[i], length, &f64, NULL) == CORE_STRING_SUCCESS);
+        assert(f64 == strtod(hard_cases[i], NULL));
+        const CORE_STRING_ERROR_CODE ret = core_string_parse_f32(hard_cases[i], length, &f32, NULL);
+        const float expected = strtof(hard_cases[i], NULL);
+        assert((isinf(expected) ? CORE_STRING_OUT_OF_RANGE : CORE_STRING_SUCCESS) == ret);
+        assert(f32 == expected);
+    }
+
+    // スタック上のバッファに収まらない長い数字列
+    char long_text[512];
+    memset(long_text, '3', sizeof(long_text) - 1);
+    long_text[1] = '.';
+    long_text[sizeof(long_text) - 1] = '\0';
+    assert(core_string_parse_f64(long_text, sizeof(long_text) - 1, &f64, &consumed) == CORE_STRING_SUCCESS);
+    assert(f64 == strtod(long_text, NULL) && consumed == sizeof(long_text) - 1);
+}
+
+static void test_core_string_parse_float_random(void) {
+    uint64_t state = 0xD1B54A32D192ED03ull;
+    char text[96];
+    for(uint32_t i = 0; i != 20000; ++i) {
+        // 桁数、小数点の位置、指数をランダムに選んだ10進表現
+        const uint64_t digits = 1 + test_random(&state) % 24;
+        const uint64_t point = test_random(&state) % (digits + 1);
+        uint64_t length = 0;
+        if(0 != (test_random(&state) & 1)) {
+            text[length++] = '-';
+        }
+        for(uint64_t d = 0; d != digits; ++d) {
+            if(d == point && 0 != d) {
+                text[length++] = '.';
+            }
+            text[length++] = (char)('0' + test_random(&state) % 10);
+        }
+        if(0 != (test_random(&state) & 1)) {
+            const int exponent = (int)(test_random(&state) % 660) - 340;
+            length += (uint64_t)snprintf(text + length, sizeof(text) - length, "e%d", exponent);
+        }
+        text[length] = '\0';
+
+        double f64 = 0.0;
+        uint64_t consumed = 0;
+        const double expected = strtod(text, NULL);
+        const CORE_STRING_ERROR_CODE ret = core_string_parse_f64(text, length, &f64, &consumed);
+        assert((isinf(expected) ? CORE_STRING_OUT_OF_RANGE : CORE_STRING_SUCCESS) == ret);
+        assert(0 == memcmp(&f64, &expected, sizeof(f64)) && consumed == length);
+
+        float f32 = 0.0f;
+        const float expected_f32 = strtof(text, NULL);
+        assert(core_string_parse_f32(text, length, &f32, NULL) == (isinf(expected_f32) ? CORE_STRING_OUT_OF_RANGE : CORE_STRING_SUCCESS));
+        assert(0 == memcmp(&f32, &expected_f32, sizeof(f32)));
+    }
+}
+
+static void test_core_string_to_number(void) {
+    core_string_t s = CORE_STRING_INITIALIZER;
+    int64_t i64 = 0;
+    uint8_t u8 = 0;
+    double f64 = 0.0;
+    float f32 = 0.0f;
+    assert(core_string_to_i64(NULL, &i64) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_to_i64(&s, NULL) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_to_i64(&s, &i64) == CORE_STRING_RUNTIME_ERROR);  // デフォルト状態
+
+    assert(core_string_copy_from_char("", &s) == CORE_STRING_SUCCESS);
+    assert(core_string_to_f64(&s, &f64) == CORE_STRING_RUNTIME_ERROR);  // 空文字列
+    assert(core_string_copy_from_char("-9000000000", &s) == CORE_STRING_SUCCESS);
+    assert(core_string_to_i64(&s, &i64) == CORE_STRING_SUCCESS && i64 == -9000000000ll);
+    assert(core_string_copy_from_char("42 ", &s) == CORE_STRING_SUCCESS);
+    assert(core_string_to_i64(&s, &i64) == CORE_STRING_RUNTIME_ERROR);  // 数値の後ろに文字が続く
+    assert(core_string_copy_from_char("256", &s) == CORE_STRING_SUCCESS);
+    assert(core_string_to_u8(&s, &u8) == CORE_STRING_OUT_OF_RANGE);
+    assert(core_string_copy_from_char("6.02214076e23", &s) == CORE_STRING_SUCCESS);
+    assert(core_string_to_f64(&s, &f64) == CORE_STRING_SUCCESS && f64 == 6.02214076e23);
+    assert(core_string_to_f32(&s, &f32) == CORE_STRING_SUCCESS && f32 == 6.02214076e23f);
+
+    // core_string_to_i32は互換性のため範囲外もCORE_STRING_RUNTIME_ERRORを返す
+    int32_t i32 = 0;
+    assert(core_string_copy_from_char("-2147483648", &s) == CORE_STRING_SUCCESS);
+    assert(core_string_to_i32(&s, &i32) == CORE_STRING_SUCCESS && i32 == INT32_MIN);
+    assert(core_string_copy_from_char("-2147483649", &s) == CORE_STRING_SUCCESS);
+    assert(core_string_to_i32(&s, &i32) == CORE_STRING_RUNTIME_ERROR);
+    core_string_destroy(&s);
+}
+
+static void test_core_string_append_integer(void) {
+    core_string_t string = CORE_STRING_INITIALIZER;
+
+    // 境界値
+    assert(core_string_append_i64(0, &string) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("0", &string));
+    assert(core_string_append_i64(INT64_MIN, &string) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("0-9223372036854775808", &string));
+    assert(core_string_copy_from_char("", &string) == CORE_STRING_SUCCESS);
+    assert(core_string_append_i64(INT64_MAX, &string) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("9223372036854775807", &string));
+    assert(core_string_copy_from_char("", &string) == CORE_STRING_SUCCESS);
+    assert(core_string_append_u64(UINT64_MAX, &string) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("18446744073709551615", &string));
+    assert(core_string_copy_from_char("", &string) == CORE_STRING_SUCCESS);
+    assert(core_string_append_i64(-7, &string) == CORE_STRING_SUCCESS);
+    assert(core_string_append_u64(10, &string) == CORE_STRING_SUCCESS);
+    assert(core_string_append_u64(99, &string) == CORE_STRING_SUCCESS);
+    assert(core_string_append_u64(100, &string) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("-71099100", &string));
+
+    // 10のべき乗の前後(桁数の切り替わり)
+    char expected[32];
+    uint64_t power = 1;
+    for(uint32_t i = 0; i != 20; ++i) {
+        for(uint64_t value = power - 1; value != power + 2; ++value) {
+            assert(core_string_copy_from_char("", &string) == CORE_STRING_SUCCESS);
+            assert(core_string_append_u64(value, &string) == CORE_STRING_SUCCESS);
+            snprintf(expected, sizeof(expected), "%llu", (unsigned long long)value);
+            assert(core_string_equal_from_char(expected, &string));
+        }
+        power *= 10;
+    }
+
+    // ランダムな値
+    uint64_t state = 0x2545F4914F6CDD1Dull;
+    for(uint32_t i = 0; i != 20000; ++i) {
+        const int64_t value = (int64_t)test_random(&state) >> (test_random(&state) % 64);
+        assert(core_string_copy_from_char("", &string) == CORE_STRING_SUCCESS);
+        assert(core_string_append_i64(value, &string) == CORE_STRING_SUCCESS);
+        snprintf(expected, sizeof(expected), "%lld", (long long)value);
+        assert(core_string_equal_from_char(expected, &string));
+    }
+
+    // 引数異常
+    assert(core_string_append_i64(1, NULL) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_append_u64(1, NULL) == CORE_STRING_INVALID_ARGUMENT);
+
+    core_string_destroy(&string);
+}
+
+static void test_core_string_append_float(void) {
+    static const struct {
+        double value;
+        const char* expected;
+    } cases_f64[] = {
+        { 0.0, "0" },
+        { -0.0, "-0" },
+        { 1.0, "1" },
+        { -1.5, "-1.5" },
+        { 0.1, "0.1" },
+        { 0.3, "0.3" },
+        { 0.1 + 0.2, "0.30000000000000004" },
+        { 123.456, "123.456" },
+        { 100.0, "100" },
+        { 1e20, "100000000000000000000" },
+        { 1e21, "1e21" },
+        { 1.5e21, "1.5e21" },
+        { 1e-6, "0.000001" },
+        { 1.25e-6, "0.00000125" },
+        { 1e-7, "1e-7" },
+        { 1.5e-7, "1.5e-7" },
+        { 5e-324, "5e-324" },
+        { 2.2250738585072014e-308, "2.2250738585072014e-308" },
+        { 1.7976931348623157e308, "1.7976931348623157e308" },
+        { 9007199254740993.0, "9007199254740992" },
+        { INFINITY, "inf" },
+        { -INFINITY, "-inf" },
+        { NAN, "nan" },
+    };
+    core_string_t string = CORE_STRING_INITIALIZER;
+    for(uint64_t i = 0; i != sizeof(cases_f64) / sizeof(cases_f64[0]); ++i) {
+        assert(core_string_copy_from_char("", &string) == CORE_STRING_SUCCESS);
+        assert(core_string_append_f64(cases_f64[i].value, &string) == CORE_STRING_SUCCESS);
+        assert(core_string_equal_from_char(cases_f64[i].expected, &string));
+    }
+
+    static const struct {
+        float value;
+        const char* expected;
+    } cases_f32[] = {
+        { 0.0f, "0" },
+        { 0.1f, "0.1" },
+        { 1.0f / 3.0f, "0.33333334" },
+        { 16777216.0f, "16777216" },
+        { 3.4028235e38f, "3.4028235e38" },
+        { 1.1754944e-38f, "1.1754944e-38" },
+        { 1e-45f, "1e-45" },
+        { -INFINITY, "-inf" },
+    };
+    for(uint64_t i = 0; i != sizeof(cases_f32) / sizeof(cases_f32[0]); ++i) {
+        assert(core_string_copy_from_char("", &string) == CORE_STRING_SUCCESS);
+        assert(core_string_append_f32(cases_f32[i].value, &string) == CORE_STRING_SUCCESS);
+        assert(core_string_equal_from_char(cases_f32[i].expected, &string));
+    }
+
+    // 既存の文字列の末尾への追加
+    assert(core_string_copy_from_char("x=", &string) == CORE_STRING_SUCCESS);
+    assert(core_string_append_f64(2.5, &string) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("x=2.5", &string));
+
+    // 引数異常
+    assert(core_string_append_f64(1.0, NULL) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_append_f32(1.0f, NULL) == CORE_STRING_INVALID_ARGUMENT);
+
+    core_string_destroy(&string);
+}
+
+static void test_core_string_append_float_random(void) {
+    uint64_t state = 0x853C49E6748FEA9Bull;
+    core_string_t string = CORE_STRING_INITIALIZER;
+    char shortest[64];
+    uint64_t longer_count = 0;
+    for(uint32_t i = 0; i != 20000; ++i) {
+        // 全てのビットパターンから有限の値を選ぶ
+        const uint64_t bits = test_random(&state);
+        double value = 0.0;
+        memcpy(&value, &bits, sizeof(value));
+        if(isinf(value) || isnan(value)) {
+            continue;
+        }
+        assert(core_string_copy_from_char("", &string) == CORE_STRING_SUCCESS);
+        assert(core_string_append_f64(value, &string) == CORE_STRING_SUCCESS);
+        const char* text = core_string_cstr(&string);
+
+        // 読み戻すと元の値に戻る
+        double parsed = 0.0;
+        assert(core_string_to_f64(&string, &parsed) == CORE_STRING_SUCCESS);
+        assert(0 == memcmp(&parsed, &value, sizeof(value)));
+        assert(0 == memcmp(&value, &(double){ strtod(text, NULL) }, sizeof(value)));
+
+        // 桁数はほぼ全ての値で最短(最短の表現が隣接する値との中点ちょうどにある場合などは長くなる)
+        int precision = 1;
+        for(; precision != 17; ++precision) {
+            snprintf(shortest, sizeof(shortest), "%.*e", precision - 1, value);
+            if(strtod(shortest, NULL) == value) {
+                break;
+            }
+        }
+        const uint64_t digits = test_significant_digits(text);
+        assert(digits <= 17);
+        longer_count += (digits > (uint64_t)precision) ? 1 : 0;
+
+        // float
+        const float value_f32 = (float)value;
+        if(isinf(value_f32)) {
+            continue;
+        }
+        assert(core_string_copy_from_char("", &string) == CORE_STRING_SUCCESS);
+        assert(core_string_append_f32(value_f32, &string) == CORE_STRING_SUCCESS);
+        float parsed_f32 = 0.0f;
+        assert(core_string_to_f32(&string, &parsed_f32) == CORE_STRING_SUCCESS);
+        assert(0 == memcmp(&parsed_f32, &value_f32, sizeof(value_f32)));
+    }
+    assert(longer_count < 100);  // 0.5%未満
+
+    core_string_destroy(&string);
+}
@@ -0,0 +1,345 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdalign.h>
+#include <string.h>
+
+#include "include/test_core_string_tokenizer.h"
+
+#include "core/core_string_tokenizer.h"
+#include "core/core_string_view.h"
+#include "core/core_string.h"
+
+#include "containers/dynamic_array.h"
+
+static void test_core_string_tokenizer_create(void);
+static void test_core_string_tokenizer_delimiters(void);
+static void test_core_string_tokenizer_separator(void);
+static void test_core_string_tokenizer_quote(void);
+static void test_core_string_tokenizer_skip_empty(void);
+static void test_core_string_tokenizer_long(void);
+static void test_core_string_tokenizer_collect(void);
+
+void test_core_string_tokenizer(void) {
+    test_core_string_tokenizer_create();
+    test_core_string_tokenizer_delimiters();
+    test_core_string_tokenizer_separator();
+    test_core_string_tokenizer_quote();
+    test_core_string_tokenizer_skip_empty();
+    test_core_string_tokenizer_long();
+    test_core_string_tokenizer_collect();
+}
+
+static void test_core_string_tokenizer_create(void) {
+    core_string_view_t source = CORE_STRING_VIEW_INITIALIZER;
+    core_string_view_t token = CORE_STRING_VIEW_INITIALIZER;
+    core_string_tokenizer_t tokenizer = CORE_STRING_TOKENIZER_INITIALIZER;
+    assert(!core_string_tokenizer_next(&tokenizer, &token));   // 初期状態はトークンを返さない
+
+    assert(core_string_tokenizer_create(NULL, ",", &tokenizer) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_tokenizer_create(&source, NULL, &tokenizer) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_tokenizer_create(&source, ",", NULL) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_tokenizer_create(&source, "", &tokenizer) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_tokenizer_create_separator(NULL, "::", &tokenizer) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_tokenizer_create_separator(&source, NULL, &tokenizer) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_tokenizer_create_separator(&source, "::", NULL) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_tokenizer_create_separator(&source, "", &tokenizer) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_tokenizer_quote_set('"', NULL) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_tokenizer_skip_empty_set(true, NULL) == CORE_STRING_INVALID_ARGUMENT);
+
+    // dataがNULLの場合はトークンを返さない
+    assert(core_string_tokenizer_create(&source, ",", &tokenizer) == CORE_STRING_SUCCESS);
+    assert(!core_string_tokenizer_next(&tokenizer, &token));
+
+    // 空の文字列からは空のトークンを1つ返す
+    assert(core_string_view_from_char("", &source) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_create(&source, ",", &tokenizer) == CORE_STRING_SUCCESS);
+    assert(!core_string_tokenizer_next(NULL, &token));
+    assert(!core_string_tokenizer_next(&tokenizer, NULL));
+    assert(core_string_tokenizer_next(&tokenizer, &token) && token.length == 0);
+    assert(!core_string_tokenizer_next(&tokenizer, &token));
+}
+
+static void test_core_string_tokenizer_delimiters(void) {
+    core_string_view_t source = CORE_STRING_VIEW_INITIALIZER;
+    core_string_view_t token = CORE_STRING_VIEW_INITIALIZER;
+    core_string_tokenizer_t tokenizer = CORE_STRING_TOKENIZER_INITIALIZER;
+
+    // 連続、末尾の区切り文字からは空のトークン
+    assert(core_string_view_from_char("a,,b,", &source) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_create(&source, ",", &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_next(&tokenizer, &token) && core_string_view_equal_from_char("a", &token));
+    assert(token.data == source.data);  // コピーせずに元の文字列を参照する
+    assert(core_string_tokenizer_next(&tokenizer, &token) && token.length == 0);
+    assert(core_string_tokenizer_next(&tokenizer, &token) && core_string_view_equal_from_char("b", &token));
+    assert(token.data - tokenizer.data == 3);
+    assert(core_string_tokenizer_next(&tokenizer, &token) && token.length == 0);
+    assert(!core_string_tokenizer_next(&tokenizer, &token));
+
+    // 区切り文字集合(重複した文字は無視する)
+    static const char* const expected[] = { "k1", "v1", "k2", "v2", "" };
+    assert(core_string_view_from_char("k1=v1;k2=v2;", &source) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_create(&source, "=;=", &tokenizer) == CORE_STRING_SUCCESS);
+    assert(tokenizer.delimiter_count == 2);
+    uint64_t count = 0;
+    while(core_string_tokenizer_next(&tokenizer, &token)) {
+        assert(count < sizeof(expected) / sizeof(expected[0]));
+        assert(core_string_view_equal_from_char(expected[count], &token));
+        count++;
+    }
+    assert(count == 5);
+
+    // ベクトル命令で扱える数を超える区切り文字集合
+    assert(core_string_view_from_char("a b\tc\nd|e#f", &source) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_create(&source, " \t\n|#", &tokenizer) == CORE_STRING_SUCCESS);
+    assert(tokenizer.delimiter_count > CORE_STRING_TOKENIZER_VECTOR_DELIMITER_MAX);
+    for(char c = 'a'; c <= 'f'; ++c) {
+        assert(core_string_tokenizer_next(&tokenizer, &token));
+        assert(token.length == 1 && token.data[0] == c);
+    }
+    assert(!core_string_tokenizer_next(&tokenizer, &token));
+}
+
+static void test_core_string_tokenizer_separator(void) {
+    core_string_view_t source = CORE_STRING_VIEW_INITIALIZER;
+    core_string_view_t token = CORE_STRING_VIEW_INITIALIZER;
+    core_string_tokenizer_t tokenizer = CORE_STRING_TOKENIZER_INITIALIZER;
+
+    assert(core_string_view_from_char("std::core:::string::", &source) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_create_separator(&source, "::", &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_next(&tokenizer, &token) && core_string_view_equal_from_char("std", &token));
+    assert(core_string_tokenizer_next(&tokenizer, &token) && core_string_view_equal_from_char("core", &token));
+    assert(core_string_tokenizer_next(&tokenizer, &token) && core_string_view_equal_from_char(":string", &token));
+    assert(core_string_tokenizer_next(&tokenizer, &token) && token.length == 0);
+    assert(!core_string_tokenizer_next(&tokenizer, &token));
+
+    // 区切り文字列より短い文字列
+    assert(core_string_view_from_char("a\r", &source) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_create_separator(&source, "\r\n", &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_next(&tokenizer, &token) && core_string_view_equal_from_char("a\r", &token));
+    assert(!core_string_tokenizer_next(&tokenizer, &token));
+
+    // 1文字の区切り文字列
+    assert(core_string_view_from_char("x/y", &source) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_create_separator(&source, "/", &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_next(&tokenizer, &token) && core_string_view_equal_from_char("x", &token));
+    assert(core_string_tokenizer_next(&tokenizer, &token) && core_string_view_equal_from_char("y", &token));
+    assert(!core_string_tokenizer_next(&tokenizer, &token));
+
+    // 空のトークンを返さない場合、連続した区切り文字列を読み飛ばす
+    assert(core_string_view_from_char("\r\na\r\n\r\nb\r\n", &source) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_create_separator(&source, "\r\n", &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_skip_empty_set(true, &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_next(&tokenizer, &token) && core_string_view_equal_from_char("a", &token));
+    assert(core_string_tokenizer_next(&tokenizer, &token) && core_string_view_equal_from_char("b", &token));
+    assert(!core_string_tokenizer_next(&tokenizer, &token));
+}
+
+static void test_core_string_tokenizer_quote(void) {
+    core_string_view_t source = CORE_STRING_VIEW_INITIALIZER;
+    core_string_view_t token = CORE_STRING_VIEW_INITIALIZER;
+    core_string_token_t quoted_token = CORE_STRING_TOKEN_INITIALIZER;
+    core_string_tokenizer_t tokenizer = CORE_STRING_TOKENIZER_INITIALIZER;
+    core_string_t unquoted = CORE_STRING_INITIALIZER;
+
+    assert(core_string_view_from_char("id,\"name, with comma\",\"say \"\"hi\"\"\",\"\",plain\"x,\"open", &source) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_create(&source, ",", &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_quote_set('"', &tokenizer) == CORE_STRING_SUCCESS);
+
+    assert(core_string_tokenizer_next_token(&tokenizer, &quoted_token) && core_string_view_equal_from_char("id", &quoted_token.view));
+    assert(!quoted_token.quoted);
+    assert(core_string_tokenizer_unquote(&tokenizer, &quoted_token, &unquoted) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("id", &unquoted));
+
+    // 引用符内の区切り文字は区切りとして扱わない
+    assert(core_string_tokenizer_next_token(&tokenizer, &quoted_token) && core_string_view_equal_from_char("name, with comma", &quoted_token.view));
+    assert(quoted_token.quoted);
+
+    // 重ねた引用符は閉じ引用符とみなさず、unquoteで1文字に戻す
+    assert(core_string_tokenizer_next_token(&tokenizer, &quoted_token) && core_string_view_equal_from_char("say \"\"hi\"\"", &quoted_token.view));
+    assert(core_string_tokenizer_unquote(NULL, &quoted_token, &unquoted) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_tokenizer_unquote(&tokenizer, NULL, &unquoted) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_tokenizer_unquote(&tokenizer, &quoted_token, NULL) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_tokenizer_unquote(&tokenizer, &quoted_token, &unquoted) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("say \"hi\"", &unquoted));
+
+    assert(core_string_tokenizer_next_token(&tokenizer, &quoted_token) && quoted_token.view.length == 0 && quoted_token.quoted);
+    assert(core_string_tokenizer_unquote(&tokenizer, &quoted_token, &unquoted) == CORE_STRING_SUCCESS);
+    assert(core_string_length(&unquoted) == 0);
+
+    // トークンの途中の引用符は通常の文字として扱う(unquoteでも変換しない)
+    assert(core_string_tokenizer_next_token(&tokenizer, &quoted_token) && core_string_view_equal_from_char("plain\"x", &quoted_token.view));
+    assert(!quoted_token.quoted);
+    assert(core_string_tokenizer_unquote(&tokenizer, &quoted_token, &unquoted) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("plain\"x", &unquoted));
+
+    // 閉じ引用符がない場合は末尾までをトークンとする
+    assert(core_string_tokenizer_next(&tokenizer, &token) && core_string_view_equal_from_char("open", &token));
+    assert(!core_string_tokenizer_next(&tokenizer, &token));
+    assert(!core_string_tokenizer_next_token(&tokenizer, &quoted_token));
+    assert(!core_string_tokenizer_next_token(NULL, &quoted_token));
+    assert(!core_string_tokenizer_next_token(&tokenizer, NULL));
+
+    // 閉じ引用符から次の区切り文字までは無視する
+    assert(core_string_view_from_char("\"a\"junk,b", &source) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_create(&source, ",", &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_quote_set('"', &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_next(&tokenizer, &token) && core_string_view_equal_from_char("a", &token));
+    assert(core_string_tokenizer_next(&tokenizer, &token) && core_string_view_equal_from_char("b", &token));
+    assert(!core_string_tokenizer_next(&tokenizer, &token));
+
+    // 引用符を扱わない設定では通常の文字
+    assert(core_string_view_from_char("\"a,b\"", &source) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_create(&source, ",", &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_next(&tokenizer, &token) && core_string_view_equal_from_char("\"a", &token));
+    assert(core_string_tokenizer_next(&tokenizer, &token) && core_string_view_equal_from_char("b\"", &token));
+    assert(!core_string_tokenizer_next(&tokenizer, &token));
+
+    core_string_destroy(&unquoted);
+}
+
+static void test_core_string_tokenizer_skip_empty(void) {
+    core_string_view_t source = CORE_STRING_VIEW_INITIALIZER;
+    core_string_view_t token = CORE_STRING_VIEW_INITIALIZER;
+    core_string_tokenizer_t tokenizer = CORE_STRING_TOKENIZER_INITIALIZER;
+
+    assert(core_string_view_from_char("  a \t  b\t", &source) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_create(&source, " \t", &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_skip_empty_set(true, &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_next(&tokenizer, &token) && core_string_view_equal_from_char("a", &token));
+    assert(core_string_tokenizer_next(&tokenizer, &token) && core_string_view_equal_from_char("b", &token));
+    assert(!core_string_tokenizer_next(&tokenizer, &token));
+
+    // 区切り文字のみ、空の文字列からはトークンを返さない
+    assert(core_string_view_from_char(" \t ", &source) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_create(&source, " \t", &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_skip_empty_set(true, &tokenizer) == CORE_STRING_SUCCESS);
+    assert(!core_string_tokenizer_next(&tokenizer, &token));
+    assert(core_string_view_from_char("", &source) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_create(&source, " ", &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_skip_empty_set(true, &tokenizer) == CORE_STRING_SUCCESS);
+    assert(!core_string_tokenizer_next(&tokenizer, &token));
+
+    // 引用符で囲まれた空のフィールドは空のトークンとして返す
+    assert(core_string_view_from_char("a \"\" b", &source) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_create(&source, " ", &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_quote_set('"', &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_skip_empty_set(true, &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_next(&tokenizer, &token) && core_string_view_equal_from_char("a", &token));
+    assert(core_string_tokenizer_next(&tokenizer, &token) && token.length == 0);
+    assert(core_string_tokenizer_next(&tokenizer, &token) && core_string_view_equal_from_char("b", &token));
+    assert(!core_string_tokenizer_next(&tokenizer, &token));
+}
+
+// ベクトル命令の幅をまたぐ長いフィールド、末尾の端数を含む長さで区切り位置を確認する
+static void test_core_string_tokenizer_long(void) {
+    char buffer[300];
+    core_string_view_t source = CORE_STRING_VIEW_INITIALIZER;
+    core_string_view_t token = CORE_STRING_VIEW_INITIALIZER;
+    core_string_tokenizer_t tokenizer = CORE_STRING_TOKENIZER_INITIALIZER;
+    for(uint64_t field = 1; field != 70; field += 3) {
+        uint64_t length = 0;
+        uint64_t fields = 0;
+        while(length + field + 1 < sizeof(buffer)) {
+            memset(buffer + length, 'x', field);
+            length += field;
+            buffer[length++] = (0 == (fields % 2)) ? ';' : '|';
+            fields++;
+        }
+        for(uint64_t size = length - 2 * field; size <= length; ++size) {
+            assert(core_string_view_from_buffer(buffer, size, &source) == CORE_STRING_SUCCESS);
+            assert(core_string_tokenizer_create(&source, ";|", &tokenizer) == CORE_STRING_SUCCESS);
+            uint64_t position = 0;
+            uint64_t count = 0;
+            while(core_string_tokenizer_next(&tokenizer, &token)) {
+                assert((uint64_t)(token.data - buffer) == position);
+                const uint64_t expected = (size - position < field) ? size - position : field;
+                assert(token.length == expected);
+                position += field + 1;
+                count++;
+            }
+            assert(count == size / (field + 1) + 1);
+        }
+    }
+}
+
+static void test_core_string_tokenizer_collect(void) {
+    core_string_view_t source = CORE_STRING_VIEW_INITIALIZER;
+    core_string_tokenizer_t tokenizer = CORE_STRING_TOKENIZER_INITIALIZER;
+    dynamic_array_t tokens = DYNAMIC_ARRAY_INITIALIZER;
+    dynamic_array_const_span_t span;
+
+    assert(core_string_tokenizer_collect(NULL, &tokens) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_tokenizer_collect(&tokenizer, NULL) == CORE_STRING_INVALID_ARGUMENT);
+
+    // デフォルト状態の配列はcore_string_token_t用として生成する(初期容量を超える要素数)
+    char line[64];
+    for(uint64_t i = 0; i != 32; ++i) {
+        line[i * 2] = (char)('a' + (i % 26));
+        line[i * 2 + 1] = ' ';
+    }
+    assert(core_string_view_from_buffer(line, sizeof(line), &source) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_create(&source, " ", &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_skip_empty_set(true, &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_collect(&tokenizer, &tokens) == CORE_STRING_SUCCESS);
+    assert(dynamic_array_const_span(&tokens, &span) == DYNAMIC_ARRAY_SUCCESS);
+    assert(span.count == 32);
+    uint64_t index = 0;
+    for(const char* it = span.begin; it != (const char*)span.end; it += span.stride) {
+        const core_string_token_t* token = (const core_string_token_t*)it;
+        assert(token->view.length == 1 && token->view.data == line + index * 2 && !token->quoted);
+        index++;
+    }
+    assert(!core_string_tokenizer_next(&tokenizer, &(core_string_view_t)CORE_STRING_VIEW_INITIALIZER));
+
+    // 既存の要素は削除し、バッファを再利用する
+    uint64_t capacity = 0;
+    assert(dynamic_array_capacity(&tokens, &capacity) == DYNAMIC_ARRAY_SUCCESS);
+    assert(core_string_view_from_char("x,\"y,z\"", &source) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_create(&source, ",", &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_quote_set('"', &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_collect(&tokenizer, &tokens) == CORE_STRING_SUCCESS);
+    assert(dynamic_array_const_span(&tokens, &span) == DYNAMIC_ARRAY_SUCCESS);
+    assert(span.count == 2);
+    const core_string_token_t* first = (const core_string_token_t*)span.begin;
+    const core_string_token_t* second = (const core_string_token_t*)((const char*)span.begin + span.stride);
+    assert(core_string_view_equal_from_char("x", &first->view) && !first->quoted);
+    assert(core_string_view_equal_from_char("y,z", &second->view) && second->quoted);
+    uint64_t capacity_after = 0;
+    assert(dynamic_array_capacity(&tokens, &capacity_after) == DYNAMIC_ARRAY_SUCCESS);
+    assert(capacity_after == capacity);
+
+    // 格納したトークンごとに引用符の有無を保持し、取得順によらずunquoteできる
+    assert(core_string_view_from_char("\"a\"\"b\",pl\"ain,\"c\",d\"\"e", &source) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_create(&source, ",", &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_quote_set('"', &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_collect(&tokenizer, &tokens) == CORE_STRING_SUCCESS);
+    assert(dynamic_array_const_span(&tokens, &span) == DYNAMIC_ARRAY_SUCCESS);
+    assert(span.count == 4);
+    static const char* const expected_unquoted[4] = { "a\"b", "pl\"ain", "c", "d\"\"e" };
+    static const bool expected_quoted[4] = { true, false, true, false };
+    core_string_t unquoted = CORE_STRING_INITIALIZER;
+    for(uint64_t i = 4; i != 0; --i) {
+        const core_string_token_t* token = (const core_string_token_t*)((const char*)span.begin + (i - 1) * span.stride);
+        assert(token->quoted == expected_quoted[i - 1]);
+        assert(core_string_tokenizer_unquote(&tokenizer, token, &unquoted) == CORE_STRING_SUCCESS);
+        assert(core_string_equal_from_char(expected_unquoted[i - 1], &unquoted));
+    }
+    core_string_destroy(&unquoted);
+
+    // トークンがない場合は空の配列
+    assert(core_string_view_from_char("   ", &source) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_create(&source, " ", &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_skip_empty_set(true, &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_collect(&tokenizer, &tokens) == CORE_STRING_SUCCESS);
+    uint64_t size = 1;
+    assert(dynamic_array_size(&tokens, &size) == DYNAMIC_ARRAY_SUCCESS && size == 0);
+
+    dynamic_array_destroy(&tokens);
+
+    // 他の要素型の配列は格納先として使用できない
+    assert(dynamic_array_create(sizeof(uint8_t), alignof(uint8_t), 4, &tokens) == DYNAMIC_ARRAY_SUCCESS);
+    assert(core_string_view_from_char("a,b", &source) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_create(&source, ",", &tokenizer) == CORE_STRING_SUCCESS);
+    assert(core_string_tokenizer_collect(&tokenizer, &tokens) == CORE_STRING_INVALID_ARGUMENT);
+    dynamic_array_destroy(&tokens);
+}
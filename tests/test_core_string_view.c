@@ -0,0 +1,230 @@
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "include/test_core_string_view.h"
+
+#include "core/core_string_view.h"
+#include "core/core_string.h"
+#include "core/core_memory.h"
+
+#include "define.h"
+
+static void test_core_string_view_create(void);
+static void test_core_string_view_substring_trim(void);
+static void test_core_string_view_split(void);
+static void test_core_string_view_find(void);
+static void test_core_string_view_compare(void);
+static void test_core_string_view_to_string(void);
+
+void test_core_string_view(void) {
+    test_core_string_view_create();
+    test_core_string_view_substring_trim();
+    test_core_string_view_split();
+    test_core_string_view_find();
+    test_core_string_view_compare();
+    test_core_string_view_to_string();
+}
+
+static void test_core_string_view_create(void) {
+    core_string_view_t view = CORE_STRING_VIEW_INITIALIZER;
+    core_string_t s = CORE_STRING_INITIALIZER;
+    assert(core_string_view_from_string(NULL, &view) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_view_from_string(&s, NULL) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_view_from_char(NULL, &view) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_view_from_char("a", NULL) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_view_from_buffer(NULL, 1, &view) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_view_from_buffer("a", 1, NULL) == CORE_STRING_INVALID_ARGUMENT);
+
+    // デフォルト状態の文字列からは空のビュー(dataはNULL)
+    assert(core_string_view_from_string(&s, &view) == CORE_STRING_SUCCESS);
+    assert(view.data == NULL && view.length == 0);
+    assert(core_string_view_from_buffer(NULL, 0, &view) == CORE_STRING_SUCCESS);
+    assert(view.data == NULL && view.length == 0);
+
+    // インライン / ヒープ文字列を参照する(コピーしない)
+    assert(core_string_create("inline", &s) == CORE_STRING_SUCCESS);
+    assert(core_string_view_from_string(&s, &view) == CORE_STRING_SUCCESS);
+    assert(view.data == core_string_cstr(&s) && view.length == 6);
+    assert(core_string_create("this string is stored on the heap", &s) == CORE_STRING_SUCCESS);
+    assert(core_string_view_from_string(&s, &view) == CORE_STRING_SUCCESS);
+    assert(view.data == core_string_cstr(&s) && view.length == strlen("this string is stored on the heap"));
+    core_string_destroy(&s);
+
+    const char buffer[] = { 'a', 'b', 'c' };
+    assert(core_string_view_from_buffer(buffer, sizeof(buffer), &view) == CORE_STRING_SUCCESS);
+    assert(core_string_view_equal_from_char("abc", &view));
+    assert(core_string_view_from_char("", &view) == CORE_STRING_SUCCESS);
+    assert(view.data != NULL && view.length == 0);
+}
+
+static void test_core_string_view_substring_trim(void) {
+    core_string_view_t view = CORE_STRING_VIEW_INITIALIZER;
+    core_string_view_t out = CORE_STRING_VIEW_INITIALIZER;
+    assert(core_string_view_from_char("0123456789", &view) == CORE_STRING_SUCCESS);
+
+    assert(core_string_view_substring(NULL, 0, 1, &out) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_view_substring(&view, 0, 1, NULL) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_view_substring(&view, 11, 1, &out) == CORE_STRING_INVALID_ARGUMENT);
+
+    assert(core_string_view_substring(&view, 2, 3, &out) == CORE_STRING_SUCCESS);
+    assert(core_string_view_equal_from_char("234", &out));
+    assert(out.data == view.data + 2);
+    assert(core_string_view_substring(&view, 7, INVALID_VALUE_U64, &out) == CORE_STRING_SUCCESS);
+    assert(core_string_view_equal_from_char("789", &out));
+    assert(core_string_view_substring(&view, 10, 5, &out) == CORE_STRING_SUCCESS);
+    assert(out.length == 0);
+    assert(core_string_view_substring(&view, 1, 8, &view) == CORE_STRING_SUCCESS);     // 入出力が同一
+    assert(core_string_view_equal_from_char("12345678", &view));
+
+    assert(core_string_view_trim(NULL, ' ', ' ', &out) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_view_trim(&view, ' ', ' ', NULL) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_view_from_char("  -a b-  ", &view) == CORE_STRING_SUCCESS);
+    assert(core_string_view_trim(&view, ' ', ' ', &out) == CORE_STRING_SUCCESS);
+    assert(core_string_view_equal_from_char("-a b-", &out));
+    assert(core_string_view_trim(&out, '-', ' ', &out) == CORE_STRING_SUCCESS);
+    assert(core_string_view_equal_from_char("a b-", &out));
+    assert(core_string_view_from_char("     ", &view) == CORE_STRING_SUCCESS);
+    assert(core_string_view_trim(&view, ' ', ' ', &out) == CORE_STRING_SUCCESS);
+    assert(out.length == 0);
+}
+
+static void test_core_string_view_split(void) {
+    core_string_view_t rest = CORE_STRING_VIEW_INITIALIZER;
+    core_string_view_t token = CORE_STRING_VIEW_INITIALIZER;
+    assert(!core_string_view_split(&rest, ',', &token));    // dataがNULL
+    assert(!core_string_view_split(NULL, ',', &token));
+    assert(!core_string_view_split(&rest, ',', NULL));
+
+    const char* expected[] = { "a", "", "bc", "" };
+    assert(core_string_view_from_char("a,,bc,", &rest) == CORE_STRING_SUCCESS);
+    uint64_t count = 0;
+    while(core_string_view_split(&rest, ',', &token)) {
+        assert(count < sizeof(expected) / sizeof(expected[0]));
+        assert(core_string_view_equal_from_char(expected[count], &token));
+        count++;
+    }
+    assert(count == 4);
+    assert(rest.data == NULL && rest.length == 0);
+
+    // 空文字列は空のトークン1つ、区切り文字なしは全体が1トークン
+    assert(core_string_view_from_char("", &rest) == CORE_STRING_SUCCESS);
+    assert(core_string_view_split(&rest, ',', &token) && token.length == 0);
+    assert(!core_string_view_split(&rest, ',', &token));
+    assert(core_string_view_from_char("key=value", &rest) == CORE_STRING_SUCCESS);
+    assert(core_string_view_split(&rest, '=', &token));
+    assert(core_string_view_equal_from_char("key", &token));
+    assert(core_string_view_equal_from_char("value", &rest));
+    assert(core_string_view_split(&rest, '=', &token));
+    assert(core_string_view_equal_from_char("value", &token));
+    assert(!core_string_view_split(&rest, '=', &token));
+}
+
+static void test_core_string_view_find(void) {
+    core_string_view_t view = CORE_STRING_VIEW_INITIALIZER;
+    core_string_view_t needle = CORE_STRING_VIEW_INITIALIZER;
+    assert(core_string_view_find_char(NULL, 0, 'a') == INVALID_VALUE_U64);
+    assert(core_string_view_find_char(&view, 0, 'a') == INVALID_VALUE_U64);
+    assert(core_string_view_find(NULL, 0, &needle) == INVALID_VALUE_U64);
+    assert(core_string_view_find(&view, 0, NULL) == INVALID_VALUE_U64);
+
+    assert(core_string_view_from_char("abcabcabd", &view) == CORE_STRING_SUCCESS);
+    assert(core_string_view_find_char(&view, 0, 'c') == 2);
+    assert(core_string_view_find_char(&view, 3, 'c') == 5);
+    assert(core_string_view_find_char(&view, 6, 'c') == INVALID_VALUE_U64);
+    assert(core_string_view_find_char(&view, 9, 'a') == INVALID_VALUE_U64);
+
+    assert(core_string_view_from_char("abd", &needle) == CORE_STRING_SUCCESS);
+    assert(core_string_view_find(&view, 0, &needle) == 6);
+    assert(core_string_view_find(&view, 7, &needle) == INVALID_VALUE_U64);
+    assert(core_string_view_from_char("bca", &needle) == CORE_STRING_SUCCESS);
+    assert(core_string_view_find(&view, 0, &needle) == 1);
+    assert(core_string_view_find(&view, 2, &needle) == 4);
+    assert(core_string_view_from_char("abcabcabdx", &needle) == CORE_STRING_SUCCESS);
+    assert(core_string_view_find(&view, 0, &needle) == INVALID_VALUE_U64);
+    assert(core_string_view_from_char("", &needle) == CORE_STRING_SUCCESS);
+    assert(core_string_view_find(&view, 3, &needle) == 3);
+    assert(core_string_view_find(&view, 9, &needle) == 9);
+    assert(core_string_view_find(&view, 10, &needle) == INVALID_VALUE_U64);
+}
+
+static void test_core_string_view_compare(void) {
+    core_string_view_t a = CORE_STRING_VIEW_INITIALIZER;
+    core_string_view_t b = CORE_STRING_VIEW_INITIALIZER;
+    assert(core_string_view_equal(&a, &b));         // 空同士
+    assert(!core_string_view_equal(NULL, &b));
+    assert(!core_string_view_equal_from_char(NULL, &a));
+    assert(!core_string_view_equal_from_char("a", NULL));
+    assert(core_string_view_equal_from_char("", &a));
+    assert(core_string_view_compare(NULL, &b) == 0);
+
+    assert(core_string_view_from_char("apple", &a) == CORE_STRING_SUCCESS);
+    assert(core_string_view_from_char("apples", &b) == CORE_STRING_SUCCESS);
+    assert(!core_string_view_equal(&a, &b));
+    assert(core_string_view_compare(&a, &b) < 0);
+    assert(core_string_view_compare(&b, &a) > 0);
+    assert(core_string_view_starts_with(&b, &a));
+    assert(!core_string_view_starts_with(&a, &b));
+    assert(!core_string_view_ends_with(&b, &a));
+    assert(core_string_view_substring(&b, 0, 5, &b) == CORE_STRING_SUCCESS);
+    assert(core_string_view_equal(&a, &b));
+    assert(core_string_view_compare(&a, &b) == 0);
+
+    assert(core_string_view_from_char("\xff", &b) == CORE_STRING_SUCCESS);     // unsigned charとして比較する
+    assert(core_string_view_compare(&a, &b) < 0);
+
+    assert(!core_string_view_equal_from_char("appl", &a));
+    assert(!core_string_view_equal_from_char("applex", &a));
+    assert(core_string_view_equal_from_char("apple", &a));
+    const char with_null[] = { 'a', '\0', 'b' };
+    assert(core_string_view_from_buffer(with_null, sizeof(with_null), &b) == CORE_STRING_SUCCESS);
+    assert(!core_string_view_equal_from_char("a", &b));
+
+    core_string_view_t suffix = CORE_STRING_VIEW_INITIALIZER;
+    assert(core_string_view_from_char("ple", &suffix) == CORE_STRING_SUCCESS);
+    assert(core_string_view_ends_with(&a, &suffix));
+    assert(!core_string_view_starts_with(&a, &suffix));
+    assert(!core_string_view_ends_with(NULL, &suffix));
+    assert(!core_string_view_starts_with(&a, NULL));
+    assert(core_string_view_from_char("", &suffix) == CORE_STRING_SUCCESS);
+    assert(core_string_view_ends_with(&a, &suffix));
+    assert(core_string_view_starts_with(&a, &suffix));
+}
+
+static void test_core_string_view_to_string(void) {
+    core_string_view_t view = CORE_STRING_VIEW_INITIALIZER;
+    core_string_t s = CORE_STRING_INITIALIZER;
+    assert(core_string_view_to_string(NULL, &s) == CORE_STRING_INVALID_ARGUMENT);
+    assert(core_string_view_to_string(&view, NULL) == CORE_STRING_INVALID_ARGUMENT);
+
+    assert(core_string_view_to_string(&view, &s) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("", &s));
+
+    assert(core_string_view_from_char("GET /index.html HTTP/1.1", &view) == CORE_STRING_SUCCESS);
+    assert(core_string_view_substring(&view, 4, 11, &view) == CORE_STRING_SUCCESS);
+    assert(core_string_view_to_string(&view, &s) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("/index.html", &s));
+
+    // 自身の一部を参照するビュー(インライン / ヒープ)
+    assert(core_string_view_from_string(&s, &view) == CORE_STRING_SUCCESS);
+    assert(core_string_view_substring(&view, 1, 5, &view) == CORE_STRING_SUCCESS);
+    assert(core_string_view_to_string(&view, &s) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("index", &s));
+    assert(core_string_create("a long heap allocated string for view test", &s) == CORE_STRING_SUCCESS);
+    assert(core_string_view_from_string(&s, &view) == CORE_STRING_SUCCESS);
+    assert(core_string_view_substring(&view, 2, 4, &view) == CORE_STRING_SUCCESS);
+    assert(core_string_view_to_string(&view, &s) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("long", &s));
+
+    // 自身を参照する空のビュー(非参照時と同じく空文字列となる)
+    assert(core_string_view_from_string(&s, &view) == CORE_STRING_SUCCESS);
+    assert(core_string_view_substring(&view, 1, 0, &view) == CORE_STRING_SUCCESS);
+    assert(core_string_view_to_string(&view, &s) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("", &s));
+    assert(core_string_create("a long heap allocated string for view test", &s) == CORE_STRING_SUCCESS);
+    assert(core_string_view_from_string(&s, &view) == CORE_STRING_SUCCESS);
+    assert(core_string_view_substring(&view, 8, 0, &view) == CORE_STRING_SUCCESS);
+    assert(core_string_view_to_string(&view, &s) == CORE_STRING_SUCCESS);
+    assert(core_string_equal_from_char("", &s));
+    core_string_destroy(&s);
+}
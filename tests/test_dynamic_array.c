@@ -5,6 +5,7 @@
 #include "include/test_dynamic_array.h"
 
 #include "containers/dynamic_array.h"
+#include "containers/dynamic_array_unchecked.h"
 
 typedef struct {
     int id;
@@ -25,6 +26,18 @@ static void test_alignment_and_padding_behavior(void);
 static void test_null_pointer_handling();
 static void test_uninitialized_dynamic_array(void);
 static void test_push_overflow(void);
+static void test_create_with_arena(void);
+static void test_resize_keeps_elements(void);
+static void test_growth_policy(void);
+static void test_growth_policy_with_arena(void);
+static void test_element_ptr(void);
+static void test_data_and_span(void);
+static void test_ref_copies_element_size_only(void);
+static void test_push_n(void);
+static void test_insert_and_erase(void);
+static void test_self_aliasing_input(void);
+static void test_append(void);
+static void test_unchecked_access(void);
 
 void test_dynamic_array(void) {
     test_create_and_destroy();
@@ -36,6 +49,18 @@ void test_dynamic_array(void) {
     test_null_pointer_handling();
     test_uninitialized_dynamic_array();
     test_push_overflow();
+    test_create_with_arena();
+    test_resize_keeps_elements();
+    test_growth_policy();
+    test_growth_policy_with_arena();
+    test_element_ptr();
+    test_data_and_span();
+    test_ref_copies_element_size_only();
+    test_push_n();
+    test_insert_and_erase();
+    test_self_aliasing_input();
+    test_append();
+    test_unchecked_access();
 }
 
 static void test_create_and_destroy(void) {
@@ -178,3 +203,473 @@ static void test_push_overflow(void) {
 
     dynamic_array_destroy(&array);
 }
+
+static void test_create_with_arena(void) {
+    core_arena_t arena = CORE_ARENA_INITIALIZER;
+    assert(core_arena_create(1024, &arena) == CORE_MEMORY_SUCCESS);
+
+    dynamic_array_t array = DYNAMIC_ARRAY_INITIALIZER;
+    assert(dynamic_array_create_with_arena(sizeof(test_object_t), alignof(test_object_t), 4, NULL, &array) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(dynamic_array_create_with_arena(sizeof(test_object_t), 3, 4, &arena, &array) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(dynamic_array_create_with_arena(sizeof(test_object_t), alignof(test_object_t), 4, &arena, &array) == DYNAMIC_ARRAY_SUCCESS);
+
+    test_object_t obj = { 7, 0.5f };
+    assert(dynamic_array_element_push(&obj, &array) == DYNAMIC_ARRAY_SUCCESS);
+    test_object_t out = { 0 };
+    assert(dynamic_array_element_ref(0, &array, &out) == DYNAMIC_ARRAY_SUCCESS);
+    assert(out.id == 7);
+
+    // 要素格納領域もアリーナから確保されている
+    uint64_t used = 0;
+    uint64_t capacity = 0;
+    assert(core_arena_usage(&arena, &used, &capacity) == CORE_MEMORY_SUCCESS);
+    assert(used >= 4 * sizeof(test_object_t));
+
+    // 容量不足
+    dynamic_array_t big = DYNAMIC_ARRAY_INITIALIZER;
+    assert(dynamic_array_create_with_arena(sizeof(test_object_t), alignof(test_object_t), 1024, &arena, &big) == DYNAMIC_ARRAY_MEMORY_ALLOCATE_ERROR);
+
+    // destroyはメモリを解放せずデフォルト状態に戻すのみ
+    dynamic_array_destroy(&array);
+    assert(array.internal_data == NULL);
+
+    assert(core_arena_reset(&arena) == CORE_MEMORY_SUCCESS);
+    core_arena_destroy(&arena);
+}
+
+static void test_resize_keeps_elements(void) {
+    dynamic_array_t array = DYNAMIC_ARRAY_INITIALIZER;
+    assert(dynamic_array_create(sizeof(uint32_t), alignof(uint32_t), 2, &array) == DYNAMIC_ARRAY_SUCCESS);
+    uint32_t value = 10;
+    assert(dynamic_array_element_push(&value, &array) == DYNAMIC_ARRAY_SUCCESS);
+    value = 11;
+    assert(dynamic_array_element_push(&value, &array) == DYNAMIC_ARRAY_SUCCESS);
+
+    assert(dynamic_array_resize(64, &array) == DYNAMIC_ARRAY_SUCCESS);
+    uint64_t capacity = 0;
+    assert(dynamic_array_capacity(&array, &capacity) == DYNAMIC_ARRAY_SUCCESS);
+    assert(capacity == 64);
+
+    // 拡張した領域まで書き込める
+    for(value = 12; value != 74; ++value) {
+        assert(dynamic_array_element_push(&value, &array) == DYNAMIC_ARRAY_SUCCESS);
+    }
+    assert(dynamic_array_element_push(&value, &array) == DYNAMIC_ARRAY_BUFFER_FULL);
+    for(uint32_t i = 0; i != 64; ++i) {
+        uint32_t out = 0;
+        assert(dynamic_array_element_ref(i, &array, &out) == DYNAMIC_ARRAY_SUCCESS);
+        assert(out == 10 + i);
+    }
+    dynamic_array_destroy(&array);
+
+    // 未初期化オブジェクトに対するreserve
+    assert(dynamic_array_reserve(4, &array) == DYNAMIC_ARRAY_INVALID_DARRAY);
+}
+
+static void test_growth_policy(void) {
+    dynamic_array_t array = DYNAMIC_ARRAY_INITIALIZER;
+    assert(dynamic_array_growth_policy_set(200, NULL) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(dynamic_array_growth_policy_set(200, &array) == DYNAMIC_ARRAY_INVALID_DARRAY);
+
+    // 要素数0で生成し、pushのみで拡張していく
+    assert(dynamic_array_create(sizeof(uint64_t), alignof(uint64_t), 0, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_growth_policy_set(100, &array) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(dynamic_array_growth_policy_set(50, &array) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(dynamic_array_growth_policy_set(150, &array) == DYNAMIC_ARRAY_SUCCESS);
+
+    uint64_t capacity = 0;
+    uint64_t previous_capacity = 0;
+    uint64_t grow_count = 0;
+    for(uint64_t i = 0; i != 10000; ++i) {
+        assert(dynamic_array_element_push(&i, &array) == DYNAMIC_ARRAY_SUCCESS);
+        assert(dynamic_array_capacity(&array, &capacity) == DYNAMIC_ARRAY_SUCCESS);
+        if(capacity != previous_capacity) {
+            assert(capacity > previous_capacity);
+            previous_capacity = capacity;
+            grow_count++;
+        }
+    }
+    assert(grow_count < 30);    // 幾何級数的に拡張されている
+
+    uint64_t size = 0;
+    assert(dynamic_array_size(&array, &size) == DYNAMIC_ARRAY_SUCCESS);
+    assert(size == 10000);
+    for(uint64_t i = 0; i != 10000; ++i) {
+        uint64_t out = 0;
+        assert(dynamic_array_element_ref(i, &array, &out) == DYNAMIC_ARRAY_SUCCESS);
+        assert(out == i);
+    }
+
+    // 自動拡張を無効に戻すと満杯時にエラーとなる
+    assert(dynamic_array_growth_policy_set(0, &array) == DYNAMIC_ARRAY_SUCCESS);
+    uint64_t value = 0;
+    for(uint64_t i = size; i != capacity; ++i) {
+        assert(dynamic_array_element_push(&value, &array) == DYNAMIC_ARRAY_SUCCESS);
+    }
+    assert(dynamic_array_element_push(&value, &array) == DYNAMIC_ARRAY_BUFFER_FULL);
+    dynamic_array_destroy(&array);
+
+    // 要素数1で拡張率を掛けても増えない場合は1要素分拡張される
+    assert(dynamic_array_create(sizeof(uint64_t), alignof(uint64_t), 1, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_growth_policy_set(150, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_element_push(&value, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_element_push(&value, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_capacity(&array, &capacity) == DYNAMIC_ARRAY_SUCCESS);
+    assert(capacity == 2);
+    dynamic_array_destroy(&array);
+}
+
+static void test_growth_policy_with_arena(void) {
+    core_arena_t arena = CORE_ARENA_INITIALIZER;
+    assert(core_arena_create(1024, &arena) == CORE_MEMORY_SUCCESS);
+
+    dynamic_array_t array = DYNAMIC_ARRAY_INITIALIZER;
+    assert(dynamic_array_create_with_arena(sizeof(uint32_t), alignof(uint32_t), 4, &arena, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_growth_policy_set(200, &array) == DYNAMIC_ARRAY_SUCCESS);
+
+    // 4 -> 8 -> 16 -> 32 -> 64 -> 128(512byte)と拡張され、旧領域はアリーナに残るため途中で容量不足となる
+    DYNAMIC_ARRAY_ERROR_CODE result = DYNAMIC_ARRAY_SUCCESS;
+    uint32_t count = 0;
+    for(; count != 256; ++count) {
+        result = dynamic_array_element_push(&count, &array);
+        if(DYNAMIC_ARRAY_SUCCESS != result) {
+            break;
+        }
+    }
+    assert(result == DYNAMIC_ARRAY_MEMORY_ALLOCATE_ERROR);
+    assert(count >= 64);
+
+    // 拡張に失敗しても格納済みの要素は保持されている
+    for(uint32_t i = 0; i != count; ++i) {
+        uint32_t out = 0;
+        assert(dynamic_array_element_ref(i, &array, &out) == DYNAMIC_ARRAY_SUCCESS);
+        assert(out == i);
+    }
+    dynamic_array_destroy(&array);
+    core_arena_destroy(&arena);
+}
+
+static void test_element_ptr(void) {
+    dynamic_array_t array = DYNAMIC_ARRAY_INITIALIZER;
+    void* ptr = NULL;
+    const void* const_ptr = NULL;
+    assert(dynamic_array_element_ptr(0, NULL, &ptr) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(dynamic_array_element_ptr(0, &array, NULL) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(dynamic_array_element_ptr(0, &array, &ptr) == DYNAMIC_ARRAY_INVALID_DARRAY);
+    assert(dynamic_array_element_const_ptr(0, NULL, &const_ptr) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(dynamic_array_element_const_ptr(0, &array, NULL) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(dynamic_array_element_const_ptr(0, &array, &const_ptr) == DYNAMIC_ARRAY_INVALID_DARRAY);
+
+    assert(dynamic_array_create(sizeof(test_object_t), alignof(test_object_t), 4, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_element_ptr(0, &array, &ptr) == DYNAMIC_ARRAY_OUT_OF_RANGE);
+    assert(dynamic_array_element_const_ptr(0, &array, &const_ptr) == DYNAMIC_ARRAY_OUT_OF_RANGE);
+
+    test_object_t obj = { 1, 1.5f };
+    assert(dynamic_array_element_push(&obj, &array) == DYNAMIC_ARRAY_SUCCESS);
+    obj.id = 2;
+    assert(dynamic_array_element_push(&obj, &array) == DYNAMIC_ARRAY_SUCCESS);
+
+    // ポインタ経由の書き換えが配列に反映される
+    assert(dynamic_array_element_ptr(1, &array, &ptr) == DYNAMIC_ARRAY_SUCCESS);
+    assert(((uintptr_t)ptr % alignof(test_object_t)) == 0);
+    ((test_object_t*)ptr)->id = 20;
+    assert(dynamic_array_element_const_ptr(1, &array, &const_ptr) == DYNAMIC_ARRAY_SUCCESS);
+    assert(const_ptr == ptr);
+    assert(((const test_object_t*)const_ptr)->id == 20);
+
+    test_object_t out = { 0 };
+    assert(dynamic_array_element_ref(1, &array, &out) == DYNAMIC_ARRAY_SUCCESS);
+    assert(out.id == 20);
+    assert(dynamic_array_element_ptr(2, &array, &ptr) == DYNAMIC_ARRAY_OUT_OF_RANGE);
+
+    dynamic_array_destroy(&array);
+}
+
+static void test_data_and_span(void) {
+    dynamic_array_t array = DYNAMIC_ARRAY_INITIALIZER;
+    void* data = NULL;
+    uint64_t stride = 0;
+    dynamic_array_span_t span;
+    dynamic_array_const_span_t const_span;
+    assert(dynamic_array_data(NULL, &data, &stride) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(dynamic_array_data(&array, NULL, &stride) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(dynamic_array_data(&array, &data, NULL) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(dynamic_array_data(&array, &data, &stride) == DYNAMIC_ARRAY_INVALID_DARRAY);
+    assert(dynamic_array_span(NULL, &span) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(dynamic_array_span(&array, NULL) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(dynamic_array_span(&array, &span) == DYNAMIC_ARRAY_INVALID_DARRAY);
+    assert(dynamic_array_const_span(NULL, &const_span) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(dynamic_array_const_span(&array, NULL) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(dynamic_array_const_span(&array, &const_span) == DYNAMIC_ARRAY_INVALID_DARRAY);
+
+    // パディングありの要素(7byte、アライメント4 -> stride 8)
+    typedef struct { uint32_t a; uint8_t b[3]; } padded_t;
+    assert(dynamic_array_create(sizeof(padded_t), alignof(padded_t), 0, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_span(&array, &span) == DYNAMIC_ARRAY_SUCCESS);
+    assert(span.begin == span.end);
+    assert(span.count == 0);
+
+    assert(dynamic_array_growth_policy_set(200, &array) == DYNAMIC_ARRAY_SUCCESS);
+    for(uint32_t i = 0; i != 100; ++i) {
+        padded_t obj = { i, { 1, 2, 3 } };
+        assert(dynamic_array_element_push(&obj, &array) == DYNAMIC_ARRAY_SUCCESS);
+    }
+
+    assert(dynamic_array_data(&array, &data, &stride) == DYNAMIC_ARRAY_SUCCESS);
+    assert(stride == 8);
+    for(uint32_t i = 0; i != 100; ++i) {
+        padded_t* element = (padded_t*)((char*)data + i * stride);
+        assert(element->a == i);
+        element->a *= 2;
+    }
+
+    assert(dynamic_array_span(&array, &span) == DYNAMIC_ARRAY_SUCCESS);
+    assert(span.begin == data);
+    assert(span.count == 100);
+    assert(span.stride == stride);
+    assert((char*)span.end == (char*)span.begin + 100 * stride);
+    for(char* it = span.begin; it != (char*)span.end; it += span.stride) {
+        ((padded_t*)it)->a += 1;
+    }
+
+    assert(dynamic_array_const_span(&array, &const_span) == DYNAMIC_ARRAY_SUCCESS);
+    assert(const_span.begin == span.begin);
+    assert(const_span.end == span.end);
+    uint32_t expected = 0;
+    for(const char* it = const_span.begin; it != (const char*)const_span.end; it += const_span.stride) {
+        assert(((const padded_t*)it)->a == expected * 2 + 1);
+        assert(((const padded_t*)it)->b[2] == 3);
+        expected++;
+    }
+    assert(expected == 100);
+
+    dynamic_array_destroy(&array);
+}
+
+// refはパディングを含まない要素サイズ分のみコピーする
+static void test_ref_copies_element_size_only(void) {
+    dynamic_array_t array = DYNAMIC_ARRAY_INITIALIZER;
+    assert(dynamic_array_create(3, 4, 2, &array) == DYNAMIC_ARRAY_SUCCESS);
+    const uint8_t in[3] = { 1, 2, 3 };
+    assert(dynamic_array_element_push(in, &array) == DYNAMIC_ARRAY_SUCCESS);
+
+    uint8_t out[4] = { 0xAA, 0xAA, 0xAA, 0xAA };
+    assert(dynamic_array_element_ref(0, &array, out) == DYNAMIC_ARRAY_SUCCESS);
+    assert(out[0] == 1 && out[1] == 2 && out[2] == 3);
+    assert(out[3] == 0xAA);
+
+    dynamic_array_destroy(&array);
+}
+
+// 配列の内容がexpected_と一致することを確認する
+static void assert_u32_array(const dynamic_array_t* array_, const uint32_t* expected_, uint64_t count_) {
+    uint64_t size = 0;
+    assert(dynamic_array_size(array_, &size) == DYNAMIC_ARRAY_SUCCESS);
+    assert(size == count_);
+    for(uint64_t i = 0; i != count_; ++i) {
+        uint32_t out = 0;
+        assert(dynamic_array_element_ref(i, array_, &out) == DYNAMIC_ARRAY_SUCCESS);
+        assert(out == expected_[i]);
+    }
+}
+
+static void test_push_n(void) {
+    dynamic_array_t array = DYNAMIC_ARRAY_INITIALIZER;
+    uint32_t values[1000];
+    for(uint32_t i = 0; i != 1000; ++i) {
+        values[i] = i * 3;
+    }
+    assert(dynamic_array_element_push_n(values, 1, NULL) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(dynamic_array_element_push_n(NULL, 1, &array) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(dynamic_array_element_push_n(values, 1, &array) == DYNAMIC_ARRAY_INVALID_DARRAY);
+
+    // 容量不足(自動拡張無効)では何も追加されない
+    assert(dynamic_array_create(sizeof(uint32_t), alignof(uint32_t), 10, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_element_push_n(values, 4, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_element_push_n(values + 4, 7, &array) == DYNAMIC_ARRAY_BUFFER_FULL);
+    assert(dynamic_array_element_push_n(values + 4, 0, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert_u32_array(&array, values, 4);
+
+    // 自動拡張有効
+    assert(dynamic_array_growth_policy_set(200, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_element_push_n(values + 4, 996, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert_u32_array(&array, values, 1000);
+    dynamic_array_destroy(&array);
+
+    // パディングありの要素(入力は要素サイズ間隔で詰まっている)
+    const uint8_t packed[9] = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    assert(dynamic_array_create(3, 4, 3, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_element_push_n(packed, 3, &array) == DYNAMIC_ARRAY_SUCCESS);
+    for(uint64_t i = 0; i != 3; ++i) {
+        const void* ptr = NULL;
+        assert(dynamic_array_element_const_ptr(i, &array, &ptr) == DYNAMIC_ARRAY_SUCCESS);
+        const uint8_t* element = ptr;
+        assert(element[0] == packed[i * 3] && element[1] == packed[i * 3 + 1] && element[2] == packed[i * 3 + 2]);
+        assert(element[3] == 0);    // パディングは0のまま
+    }
+    dynamic_array_destroy(&array);
+}
+
+// 自身の要素を入力に指定した場合(拡張でバッファが移動する、挿入で入力がずれる)
+static void test_self_aliasing_input(void) {
+    dynamic_array_t array = DYNAMIC_ARRAY_INITIALIZER;
+    const uint32_t values[4] = { 10, 20, 30, 40 };
+    void* data = NULL;
+    uint64_t stride = 0;
+
+    // 容量一杯の状態で自身の要素をpushする
+    assert(dynamic_array_create(sizeof(uint32_t), alignof(uint32_t), 4, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_growth_policy_set(200, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_element_push_n(values, 4, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_data(&array, &data, &stride) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_element_push((const uint32_t*)data + 1, &array) == DYNAMIC_ARRAY_SUCCESS);
+    const uint32_t expected_push[5] = { 10, 20, 30, 40, 20 };
+    assert_u32_array(&array, expected_push, 5);
+
+    // 全要素を自身の末尾にpush_nする(拡張が発生する)
+    assert(dynamic_array_data(&array, &data, &stride) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_element_push_n(data, 5, &array) == DYNAMIC_ARRAY_SUCCESS);
+    const uint32_t expected_push_n[10] = { 10, 20, 30, 40, 20, 10, 20, 30, 40, 20 };
+    assert_u32_array(&array, expected_push_n, 10);
+    dynamic_array_destroy(&array);
+
+    // 挿入位置をまたぐ範囲を自身に挿入する(挿入位置以降の入力は後ろへずれる)
+    assert(dynamic_array_create(sizeof(uint32_t), alignof(uint32_t), 4, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_growth_policy_set(200, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_element_push_n(values, 4, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_data(&array, &data, &stride) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_element_insert(2, (const uint32_t*)data + 1, 3, &array) == DYNAMIC_ARRAY_SUCCESS);
+    const uint32_t expected_insert[7] = { 10, 20, 20, 30, 40, 30, 40 };
+    assert_u32_array(&array, expected_insert, 7);
+    dynamic_array_destroy(&array);
+
+    // パディングありの要素(入力は要素サイズ間隔で読まれる)
+    assert(dynamic_array_create(3, 4, 2, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_growth_policy_set(200, &array) == DYNAMIC_ARRAY_SUCCESS);
+    const uint8_t packed[6] = { 1, 2, 3, 4, 5, 6 };
+    assert(dynamic_array_element_push_n(packed, 2, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_data(&array, &data, &stride) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_element_insert(0, data, 1, &array) == DYNAMIC_ARRAY_SUCCESS);
+    static const uint8_t expected_padded[9] = { 1, 2, 3, 1, 2, 3, 4, 5, 6 };
+    for(uint64_t i = 0; i != 3; ++i) {
+        const void* ptr = NULL;
+        assert(dynamic_array_element_const_ptr(i, &array, &ptr) == DYNAMIC_ARRAY_SUCCESS);
+        assert(memcmp(ptr, expected_padded + i * 3, 3) == 0);
+        assert(((const uint8_t*)ptr)[3] == 0);
+    }
+    dynamic_array_destroy(&array);
+}
+
+static void test_insert_and_erase(void) {
+    dynamic_array_t array = DYNAMIC_ARRAY_INITIALIZER;
+    const uint32_t values[5] = { 10, 20, 30, 40, 50 };
+    const uint32_t inserts[3] = { 1, 2, 3 };
+    assert(dynamic_array_element_insert(0, inserts, 1, NULL) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(dynamic_array_element_insert(0, NULL, 1, &array) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(dynamic_array_element_insert(0, inserts, 1, &array) == DYNAMIC_ARRAY_INVALID_DARRAY);
+    assert(dynamic_array_element_erase(0, 1, NULL) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(dynamic_array_element_erase(0, 1, &array) == DYNAMIC_ARRAY_INVALID_DARRAY);
+
+    assert(dynamic_array_create(sizeof(uint32_t), alignof(uint32_t), 8, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_element_push_n(values, 5, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_element_insert(6, inserts, 1, &array) == DYNAMIC_ARRAY_OUT_OF_RANGE);
+    assert(dynamic_array_element_insert(2, inserts, 4, &array) == DYNAMIC_ARRAY_BUFFER_FULL);
+
+    // 中間への挿入
+    assert(dynamic_array_element_insert(2, inserts, 3, &array) == DYNAMIC_ARRAY_SUCCESS);
+    const uint32_t expected1[8] = { 10, 20, 1, 2, 3, 30, 40, 50 };
+    assert_u32_array(&array, expected1, 8);
+
+    // 範囲外の削除
+    assert(dynamic_array_element_erase(9, 0, &array) == DYNAMIC_ARRAY_OUT_OF_RANGE);
+    assert(dynamic_array_element_erase(6, 3, &array) == DYNAMIC_ARRAY_OUT_OF_RANGE);
+    assert(dynamic_array_element_erase(1, UINT64_MAX, &array) == DYNAMIC_ARRAY_OUT_OF_RANGE);
+
+    // 中間の削除
+    assert(dynamic_array_element_erase(1, 3, &array) == DYNAMIC_ARRAY_SUCCESS);
+    const uint32_t expected2[5] = { 10, 3, 30, 40, 50 };
+    assert_u32_array(&array, expected2, 5);
+
+    // 削除で空いた領域は0クリアされている
+    void* data = NULL;
+    uint64_t stride = 0;
+    assert(dynamic_array_data(&array, &data, &stride) == DYNAMIC_ARRAY_SUCCESS);
+    for(uint64_t i = 5; i != 8; ++i) {
+        assert(*(uint32_t*)((char*)data + i * stride) == 0);
+    }
+
+    // 先頭/末尾への挿入(自動拡張あり)、末尾の削除
+    assert(dynamic_array_growth_policy_set(150, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_element_insert(0, inserts, 3, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_element_insert(8, inserts, 2, &array) == DYNAMIC_ARRAY_SUCCESS);
+    const uint32_t expected3[10] = { 1, 2, 3, 10, 3, 30, 40, 50, 1, 2 };
+    assert_u32_array(&array, expected3, 10);
+    assert(dynamic_array_element_erase(7, 3, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_element_erase(0, 0, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert_u32_array(&array, expected3, 7);
+    assert(dynamic_array_element_erase(0, 7, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert_u32_array(&array, expected3, 0);
+
+    dynamic_array_destroy(&array);
+}
+
+static void test_append(void) {
+    dynamic_array_t src = DYNAMIC_ARRAY_INITIALIZER;
+    dynamic_array_t dst = DYNAMIC_ARRAY_INITIALIZER;
+    assert(dynamic_array_append(NULL, &dst) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(dynamic_array_append(&src, NULL) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(dynamic_array_append(&src, &dst) == DYNAMIC_ARRAY_INVALID_DARRAY);
+
+    const uint32_t values[6] = { 1, 2, 3, 4, 5, 6 };
+    assert(dynamic_array_create(sizeof(uint32_t), alignof(uint32_t), 3, &src) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_create(sizeof(uint32_t), alignof(uint32_t), 4, &dst) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_element_push_n(values + 3, 3, &src) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_element_push_n(values, 3, &dst) == DYNAMIC_ARRAY_SUCCESS);
+
+    assert(dynamic_array_append(&src, &dst) == DYNAMIC_ARRAY_BUFFER_FULL);
+    assert(dynamic_array_growth_policy_set(200, &dst) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_append(&src, &dst) == DYNAMIC_ARRAY_SUCCESS);
+    assert_u32_array(&dst, values, 6);
+    assert_u32_array(&src, values + 3, 3);
+
+    // 自身の連結
+    assert(dynamic_array_append(&dst, &dst) == DYNAMIC_ARRAY_SUCCESS);
+    const uint32_t expected[12] = { 1, 2, 3, 4, 5, 6, 1, 2, 3, 4, 5, 6 };
+    assert_u32_array(&dst, expected, 12);
+
+    // 要素サイズの異なる配列
+    dynamic_array_t other = DYNAMIC_ARRAY_INITIALIZER;
+    assert(dynamic_array_create(sizeof(uint64_t), alignof(uint64_t), 4, &other) == DYNAMIC_ARRAY_SUCCESS);
+    assert(dynamic_array_append(&other, &dst) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+
+    dynamic_array_destroy(&other);
+    dynamic_array_destroy(&src);
+    dynamic_array_destroy(&dst);
+}
+
+static void test_unchecked_access(void) {
+    dynamic_array_t array = DYNAMIC_ARRAY_INITIALIZER;
+    assert(dynamic_array_create(sizeof(test_object_t), alignof(test_object_t), 4, &array) == DYNAMIC_ARRAY_SUCCESS);
+
+    const test_object_t obj0 = { 1, 0.5f };
+    const test_object_t obj1 = { 2, 1.5f };
+    dynamic_array_element_push_unchecked(&obj0, &array);
+    assert(dynamic_array_element_push(&obj1, &array) == DYNAMIC_ARRAY_SUCCESS);  // 通常版との混在
+    assert(dynamic_array_size_unchecked(&array) == 2);
+
+    test_object_t out = { 0 };
+    dynamic_array_element_ref_unchecked(1, &array, &out);
+    assert(out.id == 2 && out.value == 1.5f);
+
+    test_object_t* ptr = (test_object_t*)dynamic_array_element_ptr_unchecked(0, &array);
+    assert(ptr->id == 1);
+    ptr->id = 10;
+    assert(dynamic_array_element_ref(0, &array, &out) == DYNAMIC_ARRAY_SUCCESS);
+    assert(out.id == 10 && out.value == 0.5f);
+
+    uint64_t size = 0;
+    assert(dynamic_array_size(&array, &size) == DYNAMIC_ARRAY_SUCCESS);
+    assert(size == dynamic_array_size_unchecked(&array));
+
+    dynamic_array_destroy(&array);
+}
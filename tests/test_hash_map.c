@@ -0,0 +1,435 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdalign.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "include/test_hash_map.h"
+
+#include "containers/hash_map.h"
+
+#include "core/core_hash.h"
+#include "core/core_memory.h"
+#include "core/core_string.h"
+
+// ======== テスト用サンプル型 ========
+
+// 12byte(8の倍数でない)のキー
+typedef struct sample_key_t {
+    uint32_t x;
+    uint32_t y;
+    uint32_t z;
+} sample_key_t;
+
+// アライメント要件の大きい値
+typedef struct sample_aligned_value_t {
+    alignas(64) uint64_t value;
+} sample_aligned_value_t;
+
+static void test_create_and_destroy(void);
+static void test_invalid_argument(void);
+static void test_insert_find_erase(void);
+static void test_grow_and_churn(void);
+static void test_reserve_rehash(void);
+static void test_struct_key_and_alignment(void);
+static void test_key_set(void);
+static void test_string_key(void);
+static void test_iterate_and_clear(void);
+static void test_error_code_to_string(void);
+
+void test_hash_map(void) {
+    test_create_and_destroy();
+    test_invalid_argument();
+    test_insert_find_erase();
+    test_grow_and_churn();
+    test_reserve_rehash();
+    test_struct_key_and_alignment();
+    test_key_set();
+    test_string_key();
+    test_iterate_and_clear();
+    test_error_code_to_string();
+}
+
+static void test_create_and_destroy(void) {
+    hash_map_t map = HASH_MAP_INITIALIZER;
+    assert(map.internal_data == NULL);
+    hash_map_default_create(&map);
+    assert(map.internal_data == NULL);
+    hash_map_default_create(NULL);
+
+    core_memory_stats_t before = { 0 };
+    core_memory_stats_t stats = { 0 };
+    core_memory_report(MEMORY_TAG_HASH_MAP, &before);
+
+    // 格納数0の場合はスロットを確保しない
+    uint64_t slot_count = 1;
+    uint64_t size = 1;
+    assert(hash_map_create(sizeof(uint64_t), alignof(uint64_t), sizeof(uint32_t), alignof(uint32_t), 0, &map) == HASH_MAP_SUCCESS);
+    assert(map.internal_data != NULL);
+    assert(hash_map_slot_count(&map, &slot_count) == HASH_MAP_SUCCESS && slot_count == 0);
+    assert(hash_map_size(&map, &size) == HASH_MAP_SUCCESS && size == 0);
+    void* value = NULL;
+    const uint64_t key = 1;
+    assert(hash_map_find(&key, &map, &value) == HASH_MAP_NOT_FOUND);
+    assert(hash_map_erase(&key, &map) == HASH_MAP_NOT_FOUND);
+
+    // 格納数を指定した場合は、その数を使用率7/8以下で格納できるスロットを確保する
+    assert(hash_map_create(sizeof(uint64_t), alignof(uint64_t), sizeof(uint32_t), alignof(uint32_t), 100, &map) == HASH_MAP_SUCCESS);
+    assert(hash_map_slot_count(&map, &slot_count) == HASH_MAP_SUCCESS);
+    assert(slot_count == 128);
+
+    hash_map_destroy(&map);
+    assert(map.internal_data == NULL);
+    hash_map_destroy(&map);   // 2重destroyでもクラッシュしない
+    hash_map_destroy(NULL);
+    core_memory_report(MEMORY_TAG_HASH_MAP, &stats);
+    assert(stats.current_bytes == before.current_bytes);
+}
+
+static void test_invalid_argument(void) {
+    hash_map_t map = HASH_MAP_INITIALIZER;
+    uint64_t key = 0;
+    uint32_t value = 0;
+    void* out = NULL;
+    uint64_t size = 0;
+
+    assert(hash_map_create(sizeof(uint64_t), alignof(uint64_t), sizeof(uint32_t), alignof(uint32_t), 8, NULL) == HASH_MAP_INVALID_ARGUMENT);
+    assert(hash_map_create(0, alignof(uint64_t), sizeof(uint32_t), alignof(uint32_t), 8, &map) == HASH_MAP_INVALID_ARGUMENT);
+    assert(hash_map_create(sizeof(uint64_t), 0, sizeof(uint32_t), alignof(uint32_t), 8, &map) == HASH_MAP_INVALID_ARGUMENT);
+    assert(hash_map_create(sizeof(uint64_t), alignof(uint64_t), sizeof(uint32_t), 3, 8, &map) == HASH_MAP_INVALID_ARGUMENT);    // アライメントが2の冪乗でない
+    assert(hash_map_create(sizeof(uint64_t), alignof(uint64_t), sizeof(uint32_t), alignof(uint32_t), UINT64_MAX, &map) == HASH_MAP_INVALID_ARGUMENT);
+    assert(hash_map_create_string_key(sizeof(uint32_t), alignof(uint32_t), 8, NULL) == HASH_MAP_INVALID_ARGUMENT);
+    assert(hash_map_create_string_key(sizeof(uint32_t), 0, 8, &map) == HASH_MAP_INVALID_ARGUMENT);
+    assert(map.internal_data == NULL);
+
+    // 未初期化マップ
+    assert(hash_map_insert(&key, &value, &map) == HASH_MAP_INVALID_MAP);
+    assert(hash_map_find(&key, &map, &out) == HASH_MAP_INVALID_MAP);
+    assert(hash_map_erase(&key, &map) == HASH_MAP_INVALID_MAP);
+    assert(hash_map_reserve(16, &map) == HASH_MAP_INVALID_MAP);
+    assert(hash_map_rehash(16, &map) == HASH_MAP_INVALID_MAP);
+    assert(hash_map_clear(&map) == HASH_MAP_INVALID_MAP);
+    assert(hash_map_size(&map, &size) == HASH_MAP_INVALID_MAP);
+    assert(hash_map_slot_count(&map, &size) == HASH_MAP_INVALID_MAP);
+
+    // NULL引数
+    assert(hash_map_create(sizeof(uint64_t), alignof(uint64_t), sizeof(uint32_t), alignof(uint32_t), 8, &map) == HASH_MAP_SUCCESS);
+    assert(hash_map_insert(NULL, &value, &map) == HASH_MAP_INVALID_ARGUMENT);
+    assert(hash_map_insert(&key, NULL, &map) == HASH_MAP_INVALID_ARGUMENT);
+    assert(hash_map_insert(&key, &value, NULL) == HASH_MAP_INVALID_ARGUMENT);
+    assert(hash_map_find(NULL, &map, &out) == HASH_MAP_INVALID_ARGUMENT);
+    assert(hash_map_find(&key, NULL, &out) == HASH_MAP_INVALID_ARGUMENT);
+    assert(hash_map_find(&key, &map, NULL) == HASH_MAP_INVALID_ARGUMENT);
+    assert(hash_map_erase(NULL, &map) == HASH_MAP_INVALID_ARGUMENT);
+    assert(hash_map_erase(&key, NULL) == HASH_MAP_INVALID_ARGUMENT);
+    assert(hash_map_reserve(16, NULL) == HASH_MAP_INVALID_ARGUMENT);
+    assert(hash_map_reserve(UINT64_MAX, &map) == HASH_MAP_INVALID_ARGUMENT);
+    assert(hash_map_rehash(16, NULL) == HASH_MAP_INVALID_ARGUMENT);
+    assert(hash_map_rehash(UINT64_MAX, &map) == HASH_MAP_INVALID_ARGUMENT);
+    assert(hash_map_clear(NULL) == HASH_MAP_INVALID_ARGUMENT);
+    assert(hash_map_size(NULL, &size) == HASH_MAP_INVALID_ARGUMENT);
+    assert(hash_map_size(&map, NULL) == HASH_MAP_INVALID_ARGUMENT);
+    assert(hash_map_slot_count(NULL, &size) == HASH_MAP_INVALID_ARGUMENT);
+    assert(hash_map_slot_count(&map, NULL) == HASH_MAP_INVALID_ARGUMENT);
+    hash_map_destroy(&map);
+}
+
+static void test_insert_find_erase(void) {
+    hash_map_t map = HASH_MAP_INITIALIZER;
+    assert(hash_map_create(sizeof(uint64_t), alignof(uint64_t), sizeof(uint32_t), alignof(uint32_t), 0, &map) == HASH_MAP_SUCCESS);
+
+    uint64_t key = 42;
+    uint32_t value = 7;
+    void* out = NULL;
+    uint64_t size = 0;
+    assert(hash_map_insert(&key, &value, &map) == HASH_MAP_SUCCESS);    // 最初の挿入でスロットを確保する
+    assert(hash_map_find(&key, &map, &out) == HASH_MAP_SUCCESS);
+    assert(*(uint32_t*)out == 7);
+    assert(((uintptr_t)out % alignof(uint32_t)) == 0);
+
+    // 格納済みのキーは値を上書きする
+    value = 8;
+    assert(hash_map_insert(&key, &value, &map) == HASH_MAP_SUCCESS);
+    assert(hash_map_size(&map, &size) == HASH_MAP_SUCCESS && size == 1);
+    assert(hash_map_find(&key, &map, &out) == HASH_MAP_SUCCESS && *(uint32_t*)out == 8);
+
+    // 取得したポインタから値を直接更新できる
+    *(uint32_t*)out = 9;
+    assert(hash_map_find(&key, &map, &out) == HASH_MAP_SUCCESS && *(uint32_t*)out == 9);
+
+    const uint64_t missing = 43;
+    out = NULL;
+    assert(hash_map_find(&missing, &map, &out) == HASH_MAP_NOT_FOUND);
+    assert(out == NULL);
+
+    assert(hash_map_erase(&missing, &map) == HASH_MAP_NOT_FOUND);
+    assert(hash_map_erase(&key, &map) == HASH_MAP_SUCCESS);
+    assert(hash_map_size(&map, &size) == HASH_MAP_SUCCESS && size == 0);
+    assert(hash_map_find(&key, &map, &out) == HASH_MAP_NOT_FOUND);
+    assert(hash_map_erase(&key, &map) == HASH_MAP_NOT_FOUND);
+    hash_map_destroy(&map);
+}
+
+// 自動拡張と、削除済みスロットが溜まる挿入 / 削除の繰り返し
+static void test_grow_and_churn(void) {
+    hash_map_t map = HASH_MAP_INITIALIZER;
+    assert(hash_map_create(sizeof(uint64_t), alignof(uint64_t), sizeof(uint64_t), alignof(uint64_t), 0, &map) == HASH_MAP_SUCCESS);
+    const uint64_t count = 20000;
+    void* out = NULL;
+    uint64_t size = 0;
+    uint64_t slot_count = 0;
+    for(uint64_t i = 0; i != count; ++i) {
+        const uint64_t key = i * 0x9E3779B97F4A7C15ull;
+        const uint64_t value = i;
+        assert(hash_map_insert(&key, &value, &map) == HASH_MAP_SUCCESS);
+    }
+    assert(hash_map_size(&map, &size) == HASH_MAP_SUCCESS && size == count);
+    assert(hash_map_slot_count(&map, &slot_count) == HASH_MAP_SUCCESS);
+    assert(slot_count - slot_count / 8 >= count && slot_count <= 2 * 32768);
+    for(uint64_t i = 0; i != count; ++i) {
+        const uint64_t key = i * 0x9E3779B97F4A7C15ull;
+        assert(hash_map_find(&key, &map, &out) == HASH_MAP_SUCCESS);
+        assert(*(uint64_t*)out == i);
+    }
+
+    // 偶数番目を削除
+    for(uint64_t i = 0; i < count; i += 2) {
+        const uint64_t key = i * 0x9E3779B97F4A7C15ull;
+        assert(hash_map_erase(&key, &map) == HASH_MAP_SUCCESS);
+    }
+    assert(hash_map_size(&map, &size) == HASH_MAP_SUCCESS && size == count / 2);
+    for(uint64_t i = 0; i != count; ++i) {
+        const uint64_t key = i * 0x9E3779B97F4A7C15ull;
+        assert(hash_map_find(&key, &map, &out) == ((0 == (i % 2)) ? HASH_MAP_NOT_FOUND : HASH_MAP_SUCCESS));
+    }
+
+    // 要素数を一定に保ったまま挿入 / 削除を繰り返しても、スロット数は増え続けない
+    uint64_t slot_count_before = 0;
+    assert(hash_map_slot_count(&map, &slot_count_before) == HASH_MAP_SUCCESS);
+    for(uint64_t i = count; i != count * 10; ++i) {
+        const uint64_t key = i * 0x9E3779B97F4A7C15ull;
+        const uint64_t old_key = (i - count + 1) * 0x9E3779B97F4A7C15ull;
+        assert(hash_map_insert(&key, &i, &map) == HASH_MAP_SUCCESS);
+        if(0 != ((i - count + 1) % 2)) {
+            assert(hash_map_erase(&old_key, &map) == HASH_MAP_SUCCESS);
+        } else {
+            hash_map_erase(&old_key, &map);
+        }
+    }
+    assert(hash_map_slot_count(&map, &slot_count) == HASH_MAP_SUCCESS);
+    assert(slot_count <= slot_count_before * 2);
+    assert(hash_map_size(&map, &size) == HASH_MAP_SUCCESS);
+    uint64_t found = 0;
+    for(uint64_t i = 0; i != count * 10; ++i) {
+        const uint64_t key = i * 0x9E3779B97F4A7C15ull;
+        if(HASH_MAP_SUCCESS == hash_map_find(&key, &map, &out)) {
+            assert(*(uint64_t*)out == i);
+            found++;
+        }
+    }
+    assert(found == size);
+    hash_map_destroy(&map);
+}
+
+static void test_reserve_rehash(void) {
+    hash_map_t map = HASH_MAP_INITIALIZER;
+    uint64_t slot_count = 0;
+    void* out = NULL;
+    assert(hash_map_create(sizeof(uint32_t), alignof(uint32_t), sizeof(uint32_t), alignof(uint32_t), 0, &map) == HASH_MAP_SUCCESS);
+    assert(hash_map_reserve(1000, &map) == HASH_MAP_SUCCESS);
+    assert(hash_map_slot_count(&map, &slot_count) == HASH_MAP_SUCCESS && slot_count == 2048);
+
+    // 予約した数までは再配置しない
+    for(uint32_t i = 0; i != 1000; ++i) {
+        assert(hash_map_insert(&i, &i, &map) == HASH_MAP_SUCCESS);
+    }
+    assert(hash_map_slot_count(&map, &slot_count) == HASH_MAP_SUCCESS && slot_count == 2048);
+    assert(hash_map_reserve(10, &map) == HASH_MAP_SUCCESS);     // 縮小はしない
+    assert(hash_map_slot_count(&map, &slot_count) == HASH_MAP_SUCCESS && slot_count == 2048);
+
+    // rehashは指定した数(2の冪乗に切り上げ)に再配置し、格納済みの要素は保持する
+    assert(hash_map_rehash(5000, &map) == HASH_MAP_SUCCESS);
+    assert(hash_map_slot_count(&map, &slot_count) == HASH_MAP_SUCCESS && slot_count == 8192);
+    for(uint32_t i = 0; i < 1000; i += 3) {
+        assert(hash_map_erase(&i, &map) == HASH_MAP_SUCCESS);
+    }
+    assert(hash_map_rehash(0, &map) == HASH_MAP_SUCCESS);      // 格納数に必要な最小数に縮小
+    assert(hash_map_slot_count(&map, &slot_count) == HASH_MAP_SUCCESS && slot_count == 1024);
+    assert(hash_map_rehash(16, &map) == HASH_MAP_SUCCESS);     // 格納数に対して不足する指定は必要な数まで増やす
+    assert(hash_map_slot_count(&map, &slot_count) == HASH_MAP_SUCCESS && slot_count == 1024);
+    for(uint32_t i = 0; i != 1000; ++i) {
+        if(0 == (i % 3)) {
+            assert(hash_map_find(&i, &map, &out) == HASH_MAP_NOT_FOUND);
+        } else {
+            assert(hash_map_find(&i, &map, &out) == HASH_MAP_SUCCESS && *(uint32_t*)out == i);
+        }
+    }
+    hash_map_destroy(&map);
+
+    // 探索を始めるグループが同じキーでスロットを使い切ってから全て削除すると、使用していたグループは削除済みスロットで埋まる。
+    // この状態で挿入 / 削除を繰り返し、削除済みスロットの回収が起きても予約したスロット数を下回らない
+    // (グループはハッシュ値の7bit目以降で決まる。128スロットのグループ数は16以下のため、下位4bitが0のキーを選ぶ)
+    uint32_t keys[112];
+    assert(hash_map_create(sizeof(uint32_t), alignof(uint32_t), sizeof(uint32_t), alignof(uint32_t), 0, &map) == HASH_MAP_SUCCESS);
+    assert(hash_map_reserve(100, &map) == HASH_MAP_SUCCESS);
+    assert(hash_map_slot_count(&map, &slot_count) == HASH_MAP_SUCCESS && slot_count == 128);
+    for(uint32_t key = 0, i = 0; i != 112; ++key) {
+        if(0 == ((core_hash_bytes(&key, sizeof(key), CORE_HASH_DEFAULT_SEED) >> 7) & 0xF)) {
+            keys[i++] = key;
+        }
+    }
+    for(uint32_t i = 0; i != 112; ++i) {
+        assert(hash_map_insert(&keys[i], &keys[i], &map) == HASH_MAP_SUCCESS);
+    }
+    for(uint32_t i = 0; i != 112; ++i) {
+        assert(hash_map_erase(&keys[i], &map) == HASH_MAP_SUCCESS);
+    }
+    for(uint32_t i = 0; i != 1000; ++i) {
+        const uint32_t key = UINT32_MAX - i;
+        assert(hash_map_insert(&key, &key, &map) == HASH_MAP_SUCCESS);
+        assert(hash_map_find(&key, &map, &out) == HASH_MAP_SUCCESS && *(uint32_t*)out == key);
+        assert(hash_map_erase(&key, &map) == HASH_MAP_SUCCESS);
+        assert(hash_map_slot_count(&map, &slot_count) == HASH_MAP_SUCCESS && slot_count == 128);
+    }
+    hash_map_destroy(&map);
+}
+
+static void test_struct_key_and_alignment(void) {
+    hash_map_t map = HASH_MAP_INITIALIZER;
+    void* out = NULL;
+    assert(hash_map_create(sizeof(sample_key_t), alignof(sample_key_t), sizeof(sample_aligned_value_t), alignof(sample_aligned_value_t), 4, &map) == HASH_MAP_SUCCESS);
+    for(uint32_t i = 0; i != 300; ++i) {
+        const sample_key_t key = { i, i * 2, i * 3 };
+        const sample_aligned_value_t value = { (uint64_t)i * 10 };
+        assert(hash_map_insert(&key, &value, &map) == HASH_MAP_SUCCESS);
+    }
+    for(uint32_t i = 0; i != 300; ++i) {
+        const sample_key_t key = { i, i * 2, i * 3 };
+        assert(hash_map_find(&key, &map, &out) == HASH_MAP_SUCCESS);
+        assert(((uintptr_t)out % alignof(sample_aligned_value_t)) == 0);
+        assert(((const sample_aligned_value_t*)out)->value == (uint64_t)i * 10);
+    }
+    const sample_key_t missing = { 1, 2, 4 };
+    assert(hash_map_find(&missing, &map, &out) == HASH_MAP_NOT_FOUND);
+    hash_map_destroy(&map);
+}
+
+// 値のサイズが0の場合はキーの集合として使用できる
+static void test_key_set(void) {
+    hash_map_t map = HASH_MAP_INITIALIZER;
+    void* out = NULL;
+    uint64_t size = 0;
+    assert(hash_map_create(sizeof(uint16_t), alignof(uint16_t), 0, 1, 0, &map) == HASH_MAP_SUCCESS);
+    for(uint16_t i = 0; i != 100; ++i) {
+        const uint16_t key = (uint16_t)(i % 10);
+        assert(hash_map_insert(&key, NULL, &map) == HASH_MAP_SUCCESS);
+    }
+    assert(hash_map_size(&map, &size) == HASH_MAP_SUCCESS && size == 10);
+    const uint16_t key = 5;
+    assert(hash_map_find(&key, &map, &out) == HASH_MAP_SUCCESS);
+    hash_map_destroy(&map);
+}
+
+static void test_string_key(void) {
+    core_memory_stats_t before = { 0 };
+    core_memory_stats_t stats = { 0 };
+    core_memory_report(MEMORY_TAG_STRING, &before);
+
+    hash_map_t map = HASH_MAP_INITIALIZER;
+    core_string_t key = CORE_STRING_INITIALIZER;
+    void* out = NULL;
+    uint64_t size = 0;
+    char buffer[64];
+    assert(hash_map_create_string_key(sizeof(uint64_t), alignof(uint64_t), 0, &map) == HASH_MAP_SUCCESS);
+
+    // インライン文字列とヒープ文字列のキー
+    for(uint64_t i = 0; i != 2000; ++i) {
+        snprintf(buffer, sizeof(buffer), (0 == (i % 2)) ? "k%llu" : "a rather long key stored on the heap %llu", (unsigned long long)i);
+        assert(core_string_copy_from_char(buffer, &key) == CORE_STRING_SUCCESS);
+        assert(hash_map_insert(&key, &i, &map) == HASH_MAP_SUCCESS);
+    }
+    assert(core_string_copy_from_char("k10", &key) == CORE_STRING_SUCCESS);
+    assert(hash_map_find(&key, &map, &out) == HASH_MAP_SUCCESS && *(uint64_t*)out == 10);
+    // キーはマップ内にコピーされるため、挿入に使用した文字列を変更しても影響しない
+    assert(core_string_copy_from_char("a rather long key stored on the heap 1999", &key) == CORE_STRING_SUCCESS);
+    assert(hash_map_find(&key, &map, &out) == HASH_MAP_SUCCESS && *(uint64_t*)out == 1999);
+    assert(core_string_copy_from_char("k1", &key) == CORE_STRING_SUCCESS);
+    assert(hash_map_find(&key, &map, &out) == HASH_MAP_NOT_FOUND);
+
+    // 空文字列とデフォルト状態の文字列は同じキー
+    const uint64_t empty_value = 12345;
+    assert(core_string_copy_from_char("", &key) == CORE_STRING_SUCCESS);
+    assert(hash_map_insert(&key, &empty_value, &map) == HASH_MAP_SUCCESS);
+    core_string_t default_key = CORE_STRING_INITIALIZER;
+    assert(hash_map_find(&default_key, &map, &out) == HASH_MAP_SUCCESS && *(uint64_t*)out == empty_value);
+
+    for(uint64_t i = 0; i < 2000; i += 2) {
+        snprintf(buffer, sizeof(buffer), "k%llu", (unsigned long long)i);
+        assert(core_string_copy_from_char(buffer, &key) == CORE_STRING_SUCCESS);
+        assert(hash_map_erase(&key, &map) == HASH_MAP_SUCCESS);
+    }
+    assert(hash_map_size(&map, &size) == HASH_MAP_SUCCESS && size == 1001);
+    assert(hash_map_rehash(0, &map) == HASH_MAP_SUCCESS);
+    assert(core_string_copy_from_char("a rather long key stored on the heap 1001", &key) == CORE_STRING_SUCCESS);
+    assert(hash_map_find(&key, &map, &out) == HASH_MAP_SUCCESS && *(uint64_t*)out == 1001);
+
+    // 削除、破棄でマップ内の文字列キーも破棄される
+    core_string_destroy(&key);
+    hash_map_destroy(&map);
+    core_memory_report(MEMORY_TAG_STRING, &stats);
+    assert(stats.current_bytes == before.current_bytes);
+}
+
+static void test_iterate_and_clear(void) {
+    hash_map_t map = HASH_MAP_INITIALIZER;
+    uint64_t cursor = 0;
+    const void* key = NULL;
+    void* value = NULL;
+    assert(!hash_map_iterate(&map, &cursor, &key, &value));    // 未初期化
+    assert(hash_map_create(sizeof(uint32_t), alignof(uint32_t), sizeof(uint32_t), alignof(uint32_t), 0, &map) == HASH_MAP_SUCCESS);
+    assert(!hash_map_iterate(&map, &cursor, &key, &value));    // スロット未確保
+    cursor = 0;
+
+    bool seen[100] = { false };
+    for(uint32_t i = 0; i != 100; ++i) {
+        const uint32_t v = i + 1000;
+        assert(hash_map_insert(&i, &v, &map) == HASH_MAP_SUCCESS);
+    }
+    assert(!hash_map_iterate(NULL, &cursor, &key, &value));
+    assert(!hash_map_iterate(&map, NULL, &key, &value));
+    assert(!hash_map_iterate(&map, &cursor, NULL, &value));
+    assert(!hash_map_iterate(&map, &cursor, &key, NULL));
+    uint32_t count = 0;
+    while(hash_map_iterate(&map, &cursor, &key, &value)) {
+        const uint32_t k = *(const uint32_t*)key;
+        assert(k < 100 && !seen[k]);
+        assert(*(uint32_t*)value == k + 1000);
+        seen[k] = true;
+        count++;
+    }
+    assert(count == 100);
+    assert(!hash_map_iterate(&map, &cursor, &key, &value));    // 終端に達した後もfalse
+
+    uint64_t size = 0;
+    uint64_t slot_count = 0;
+    uint64_t slot_count_before = 0;
+    assert(hash_map_slot_count(&map, &slot_count_before) == HASH_MAP_SUCCESS);
+    assert(hash_map_clear(&map) == HASH_MAP_SUCCESS);
+    assert(hash_map_size(&map, &size) == HASH_MAP_SUCCESS && size == 0);
+    assert(hash_map_slot_count(&map, &slot_count) == HASH_MAP_SUCCESS && slot_count == slot_count_before);
+    const uint32_t k = 5;
+    assert(hash_map_find(&k, &map, &value) == HASH_MAP_NOT_FOUND);
+    cursor = 0;
+    assert(!hash_map_iterate(&map, &cursor, &key, &value));
+    hash_map_destroy(&map);
+}
+
+static void test_error_code_to_string(void) {
+    assert(strcmp(hash_map_error_code_to_string(HASH_MAP_SUCCESS), "hash map error code: success.") == 0);
+    assert(strcmp(hash_map_error_code_to_string(HASH_MAP_INVALID_ARGUMENT), "hash map error code: invalid argument.") == 0);
+    assert(strcmp(hash_map_error_code_to_string(HASH_MAP_MEMORY_ALLOCATE_ERROR), "hash map error code: failed to allocate memory.") == 0);
+    assert(strcmp(hash_map_error_code_to_string(HASH_MAP_INVALID_MAP), "hash map error code: invalid map.") == 0);
+    assert(strcmp(hash_map_error_code_to_string(HASH_MAP_NOT_FOUND), "hash map error code: key not found.") == 0);
+    assert(strcmp(hash_map_error_code_to_string((HASH_MAP_ERROR_CODE)0xFF), "hash map error code: undefined error.") == 0);
+}
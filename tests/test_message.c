@@ -0,0 +1,337 @@
+// このファイルのメッセージ出力マクロはワーニング以上のみコードを生成する(コンパイル時フィルタの確認用)
+#define MESSAGE_COMPILE_LEVEL_DEFAULT MESSAGE_LEVEL_WARNING
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "include/test_message.h"
+
+#include "core/message.h"
+#include "core/core_memory.h"
+
+static void test_message_format(void);
+static void test_message_format_truncate(void);
+static void test_message_format_invalid(void);
+static void test_message_output_no_allocation(void);
+static void test_message_level_compile_time(void);
+static void test_message_level_runtime(void);
+static void test_message_level_invalid(void);
+static void test_message_async_invalid(void);
+static void test_message_async_block(void);
+static void test_message_async_drop(void);
+static void test_message_async_stop_while_logging(void);
+
+static const char* count_evaluation(void);
+static void* async_logging_thread(void* arg_);
+static uint64_t count_lines(const char* path_, uint64_t* max_line_length_);
+
+#define ASYNC_LOG_PATH "test_message_async.log"
+#define SYNC_LOG_PATH "test_message_sync.log"
+#define ASYNC_STOP_ROUNDS 20
+#define ASYNC_THREAD_COUNT 4
+#define ASYNC_MESSAGE_COUNT 500
+
+// メッセージ出力マクロの引数が評価された回数
+static uint32_t s_evaluation_count;
+
+void test_message(void) {
+    test_message_format();
+    test_message_format_truncate();
+    test_message_format_invalid();
+    test_message_output_no_allocation();
+    test_message_level_compile_time();
+    test_message_level_runtime();
+    test_message_level_invalid();
+    test_message_async_invalid();
+    test_message_async_block();
+    test_message_async_drop();
+    test_message_async_stop_while_logging();
+}
+
+static void test_message_format(void) {
+    char buffer[128];
+    uint64_t length = message_format(MESSAGE_SEVERITY_ERROR, buffer, sizeof(buffer), "%s - value = %d.", "func", 10);
+    const char* expected = "\033[1;31m[ERROR] func - value = 10.\033[0m\n";
+    assert(length == strlen(expected));
+    assert(strcmp(buffer, expected) == 0);
+
+    length = message_format(MESSAGE_SEVERITY_WARNING, buffer, sizeof(buffer), "warn");
+    assert(strcmp(buffer, "\033[1;33m[WARNING] warn\033[0m\n") == 0);
+    length = message_format(MESSAGE_SEVERITY_INFORMATION, buffer, sizeof(buffer), "info");
+    assert(strcmp(buffer, "\033[1;35m[INFORMATION] info\033[0m\n") == 0);
+    length = message_format(MESSAGE_SEVERITY_DEBUG, buffer, sizeof(buffer), "");
+    assert(strcmp(buffer, "\033[1;34m[DEBUG] \033[0m\n") == 0);
+    assert(length == strlen(buffer));
+}
+
+static void test_message_format_truncate(void) {
+    // 本文が収まらない場合は"..."で切り詰め、末尾の制御文字は残る
+    char buffer[32];
+    const char* header = "\033[1;31m[ERROR] ";    // 15文字
+    const char* tail = "\033[0m\n";               // 5文字
+    const uint64_t length = message_format(MESSAGE_SEVERITY_ERROR, buffer, sizeof(buffer), "%s", "0123456789abcdefghij");
+    assert(length == sizeof(buffer) - 1);
+    assert(strlen(buffer) == length);
+    assert(strncmp(buffer, header, strlen(header)) == 0);
+    assert(strncmp(buffer + strlen(header), "01234567...", 11) == 0);
+    assert(strncmp(buffer + length - strlen(tail) - 3, "...", 3) == 0);
+    assert(strcmp(buffer + length - strlen(tail), tail) == 0);
+
+    // ちょうど収まる場合は切り詰めない
+    const uint64_t body_max = sizeof(buffer) - 1 - strlen(header) - strlen(tail);
+    char body[32];
+    memset(body, 'x', body_max);
+    body[body_max] = '\0';
+    assert(message_format(MESSAGE_SEVERITY_ERROR, buffer, sizeof(buffer), "%s", body) == sizeof(buffer) - 1);
+    assert(strncmp(buffer + strlen(header), body, body_max) == 0);
+}
+
+static void test_message_format_invalid(void) {
+    char buffer[64] = "garbage";
+    assert(message_format(MESSAGE_SEVERITY_ERROR, NULL, sizeof(buffer), "x") == 0);
+    assert(message_format(MESSAGE_SEVERITY_ERROR, buffer, 0, "x") == 0);
+    assert(message_format(MESSAGE_SEVERITY_ERROR, buffer, sizeof(buffer), NULL) == 0);
+    assert(buffer[0] == '\0');
+    assert(message_format((MESSAGE_SEVERITY)100, buffer, sizeof(buffer), "x") == 0);
+    assert(message_format(MESSAGE_SEVERITY_ERROR, buffer, 8, "x") == 0);  // ヘッダも格納できない
+    assert(buffer[0] == '\0');
+    message_output((MESSAGE_SEVERITY)100, "x");  // 未定義の重要度でもクラッシュしない
+}
+
+static void test_message_output_no_allocation(void) {
+    core_memory_stats_t before[MEMORY_TAG_MAX];
+    for(int tag = 0; tag != MEMORY_TAG_MAX; ++tag) {
+        core_memory_report((MEMORY_TAG)tag, &before[tag]);
+    }
+    message_output(MESSAGE_SEVERITY_INFORMATION, "test_message_output_no_allocation - %s %d %.1f", "message", 1, 2.0);
+    WARN_MESSAGE("test_message_output_no_allocation - warning output.");
+    for(int tag = 0; tag != MEMORY_TAG_MAX; ++tag) {
+        core_memory_stats_t after;
+        core_memory_report((MEMORY_TAG)tag, &after);
+        assert(after.allocation_count == before[tag].allocation_count);
+    }
+}
+
+static void test_message_level_compile_time(void) {
+    // コンパイル時に無効化された重要度は、実行時の設定に関わらず引数も評価されない
+    assert(message_level_get() == MESSAGE_LEVEL_DEBUG);
+    assert(message_is_enabled(MESSAGE_SEVERITY_DEBUG, MESSAGE_MODULE_DEFAULT));
+    s_evaluation_count = 0;
+    INFO_MESSAGE("%s", count_evaluation());
+    DEBUG_MESSAGE("%s", count_evaluation());
+    assert(s_evaluation_count == 0);
+}
+
+static void test_message_level_runtime(void) {
+    s_evaluation_count = 0;
+
+    // 全体をエラーのみに設定: ワーニングは引数を評価せずに破棄される
+    message_level_set(MESSAGE_LEVEL_ERROR);
+    assert(message_level_get() == MESSAGE_LEVEL_ERROR);
+    assert(message_is_enabled(MESSAGE_SEVERITY_ERROR, MESSAGE_MODULE_DEFAULT));
+    assert(!message_is_enabled(MESSAGE_SEVERITY_WARNING, MESSAGE_MODULE_DEFAULT));
+    assert(!message_is_enabled(MESSAGE_SEVERITY_WARNING, MESSAGE_MODULE_STACK));
+    WARN_MESSAGE("%s", count_evaluation());
+    assert(s_evaluation_count == 0);
+
+    // モジュール個別設定は全体の設定より優先される
+    message_module_level_set(MESSAGE_MODULE_DEFAULT, MESSAGE_LEVEL_WARNING);
+    assert(message_is_enabled(MESSAGE_SEVERITY_WARNING, MESSAGE_MODULE_DEFAULT));
+    assert(!message_is_enabled(MESSAGE_SEVERITY_WARNING, MESSAGE_MODULE_STACK));
+    WARN_MESSAGE("test_message_level_runtime - module level warning%s", count_evaluation());
+    assert(s_evaluation_count == 1);
+
+    message_module_level_set(MESSAGE_MODULE_DEFAULT, MESSAGE_LEVEL_NONE);
+    assert(!message_is_enabled(MESSAGE_SEVERITY_ERROR, MESSAGE_MODULE_DEFAULT));
+    assert(message_is_enabled(MESSAGE_SEVERITY_ERROR, MESSAGE_MODULE_STACK));
+    ERROR_MESSAGE("%s", count_evaluation());
+    assert(s_evaluation_count == 1);
+
+    // 個別設定を解除すると全体の設定に戻る
+    message_module_level_set(MESSAGE_MODULE_DEFAULT, MESSAGE_LEVEL_INHERIT);
+    assert(message_is_enabled(MESSAGE_SEVERITY_ERROR, MESSAGE_MODULE_DEFAULT));
+    assert(!message_is_enabled(MESSAGE_SEVERITY_WARNING, MESSAGE_MODULE_DEFAULT));
+
+    message_level_set(MESSAGE_LEVEL_NONE);
+    assert(!message_is_enabled(MESSAGE_SEVERITY_ERROR, MESSAGE_MODULE_DEFAULT));
+
+    message_level_set(MESSAGE_LEVEL_DEBUG);
+    assert(message_is_enabled(MESSAGE_SEVERITY_DEBUG, MESSAGE_MODULE_RING_QUEUE));
+}
+
+static void test_message_level_invalid(void) {
+    // 範囲外の設定は無視される
+    message_level_set(MESSAGE_LEVEL_DEBUG + 1);
+    assert(message_level_get() == MESSAGE_LEVEL_DEBUG);
+    message_module_level_set(MESSAGE_MODULE_DEFAULT, MESSAGE_LEVEL_DEBUG + 1);
+    assert(message_is_enabled(MESSAGE_SEVERITY_DEBUG, MESSAGE_MODULE_DEFAULT));
+    message_module_level_set(MESSAGE_MODULE_MAX, MESSAGE_LEVEL_NONE);
+    assert(!message_is_enabled(MESSAGE_SEVERITY_ERROR, MESSAGE_MODULE_MAX));
+    assert(!message_is_enabled((MESSAGE_SEVERITY)(MESSAGE_SEVERITY_DEBUG + 1), MESSAGE_MODULE_DEFAULT));
+}
+
+static void test_message_async_invalid(void) {
+    message_async_config_t config = { 16, MESSAGE_ASYNC_POLICY_DROP, NULL };
+    assert(message_async_start(NULL) == MESSAGE_INVALID_ARGUMENT);
+    config.queue_capacity = 0;
+    assert(message_async_start(&config) == MESSAGE_INVALID_ARGUMENT);
+    config.queue_capacity = 3;     // 2の冪乗でない
+    assert(message_async_start(&config) == MESSAGE_INVALID_ARGUMENT);
+    config.queue_capacity = 16;
+    config.policy = (MESSAGE_ASYNC_POLICY)5;
+    assert(message_async_start(&config) == MESSAGE_INVALID_ARGUMENT);
+    config.policy = MESSAGE_ASYNC_POLICY_DROP;
+    config.file_path = "./not_exist_directory/test.log";
+    assert(message_async_start(&config) == MESSAGE_RUNTIME_ERROR);
+
+    // 非同期出力中でない場合のstop / flushは何もしない
+    message_async_stop();
+    message_async_flush();
+
+    remove(ASYNC_LOG_PATH);
+    config.file_path = ASYNC_LOG_PATH;
+    assert(message_async_start(&config) == MESSAGE_SUCCESS);
+    assert(message_async_start(&config) == MESSAGE_ALREADY_STARTED);
+    message_async_stop();
+    message_async_stop();   // 2重stopでもクラッシュしない
+    remove(ASYNC_LOG_PATH);
+}
+
+// 複数スレッドから出力したメッセージが、欠落なくファイルに書き出されることを確認する
+static void test_message_async_block(void) {
+    remove(ASYNC_LOG_PATH);
+    message_async_config_t config = { 64, MESSAGE_ASYNC_POLICY_BLOCK, ASYNC_LOG_PATH };
+    assert(message_async_start(&config) == MESSAGE_SUCCESS);
+
+    pthread_t threads[ASYNC_THREAD_COUNT];
+    for(int i = 0; i != ASYNC_THREAD_COUNT; ++i) {
+        const int ret = pthread_create(&threads[i], NULL, async_logging_thread, NULL);
+        assert(0 == ret);
+        (void)ret;
+    }
+    for(int i = 0; i != ASYNC_THREAD_COUNT; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+
+    // 長いメッセージはレコードサイズに切り詰められる
+    char long_text[MESSAGE_ASYNC_RECORD_SIZE * 2];
+    memset(long_text, 'x', sizeof(long_text) - 1);
+    long_text[sizeof(long_text) - 1] = '\0';
+    ERROR_MESSAGE("%s", long_text);
+
+    message_async_flush();
+    uint64_t max_line_length = 0;
+    assert(count_lines(ASYNC_LOG_PATH, &max_line_length) == ASYNC_THREAD_COUNT * ASYNC_MESSAGE_COUNT + 1);
+    assert(max_line_length < MESSAGE_ASYNC_RECORD_SIZE);
+    assert(message_async_dropped_count() == 0);
+
+    message_async_stop();
+    remove(ASYNC_LOG_PATH);
+}
+
+// DROPの場合、出力されたメッセージ数と破棄されたメッセージ数の合計が出力要求数と一致することを確認する
+static void test_message_async_drop(void) {
+    remove(ASYNC_LOG_PATH);
+    message_async_config_t config = { 2, MESSAGE_ASYNC_POLICY_DROP, ASYNC_LOG_PATH };
+    assert(message_async_start(&config) == MESSAGE_SUCCESS);
+    async_logging_thread(NULL);
+    message_async_stop();   // stopでも未出力分が書き出される
+
+    const uint64_t lines = count_lines(ASYNC_LOG_PATH, NULL);
+    assert(lines + message_async_dropped_count() == ASYNC_MESSAGE_COUNT);
+    assert(lines >= 2);
+    remove(ASYNC_LOG_PATH);
+}
+
+// 他スレッドが出力中にstopしても、メッセージが欠落せず非同期 / 同期のいずれかで出力されることを確認する
+// (容量の小さいBLOCKキューで、格納待ちのスレッドがある状態でstopする)
+static void test_message_async_stop_while_logging(void) {
+    remove(ASYNC_LOG_PATH);
+    remove(SYNC_LOG_PATH);
+    // stop後の同期出力を数えるため、標準出力 / 標準エラー出力をファイルに切り替える
+    fflush(stdout);
+    fflush(stderr);
+    const int saved_stdout = dup(STDOUT_FILENO);
+    const int saved_stderr = dup(STDERR_FILENO);
+    const int sync_fd = open(SYNC_LOG_PATH, O_WRONLY | O_CREAT | O_APPEND, 0644);
+    assert(saved_stdout >= 0 && saved_stderr >= 0 && sync_fd >= 0);
+    dup2(sync_fd, STDOUT_FILENO);
+    dup2(sync_fd, STDERR_FILENO);
+
+    message_async_config_t config = { 4, MESSAGE_ASYNC_POLICY_BLOCK, ASYNC_LOG_PATH };
+    for(int round = 0; round != ASYNC_STOP_ROUNDS; ++round) {
+        assert(message_async_start(&config) == MESSAGE_SUCCESS);
+        pthread_t threads[ASYNC_THREAD_COUNT];
+        for(int i = 0; i != ASYNC_THREAD_COUNT; ++i) {
+            const int ret = pthread_create(&threads[i], NULL, async_logging_thread, NULL);
+            assert(0 == ret);
+            (void)ret;
+        }
+        message_async_stop();
+        for(int i = 0; i != ASYNC_THREAD_COUNT; ++i) {
+            pthread_join(threads[i], NULL);
+        }
+        assert(message_async_dropped_count() == 0);
+    }
+
+    fflush(stdout);
+    fflush(stderr);
+    dup2(saved_stdout, STDOUT_FILENO);
+    dup2(saved_stderr, STDERR_FILENO);
+    close(saved_stdout);
+    close(saved_stderr);
+    close(sync_fd);
+
+    const uint64_t lines = count_lines(ASYNC_LOG_PATH, NULL) + count_lines(SYNC_LOG_PATH, NULL);
+    assert(lines == (uint64_t)ASYNC_STOP_ROUNDS * ASYNC_THREAD_COUNT * ASYNC_MESSAGE_COUNT);
+    (void)lines;
+    remove(ASYNC_LOG_PATH);
+    remove(SYNC_LOG_PATH);
+}
+
+// 評価回数を数え、空文字列を返す
+static const char* count_evaluation(void) {
+    s_evaluation_count++;
+    return "";
+}
+
+static void* async_logging_thread(void* arg_) {
+    (void)arg_;
+    for(int i = 0; i != ASYNC_MESSAGE_COUNT; ++i) {
+        if(0 == (i % 2)) {
+            ERROR_MESSAGE("async_logging_thread - error message %d.", i);
+        } else {
+            WARN_MESSAGE("async_logging_thread - warning message %d.", i);
+        }
+    }
+    return NULL;
+}
+
+// ファイルの行数を数える(max_line_length_がNULLでなければ最大行長も格納する)
+static uint64_t count_lines(const char* path_, uint64_t* max_line_length_) {
+    FILE* file = fopen(path_, "rb");
+    assert(NULL != file);
+    uint64_t lines = 0;
+    uint64_t line_length = 0;
+    uint64_t max_line_length = 0;
+    int c = 0;
+    while(EOF != (c = fgetc(file))) {
+        if('\n' == c) {
+            lines++;
+            max_line_length = (line_length > max_line_length) ? line_length : max_line_length;
+            line_length = 0;
+        } else {
+            line_length++;
+        }
+    }
+    fclose(file);
+    if(NULL != max_line_length_) {
+        *max_line_length_ = max_line_length;
+    }
+    return lines;
+}
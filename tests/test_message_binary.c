@@ -0,0 +1,230 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "include/test_message_binary.h"
+
+#include "core/message.h"
+#include "core/core_memory.h"
+
+static void test_message_binary_invalid(void);
+static void test_message_binary_round_trip(void);
+static void test_message_binary_truncate(void);
+static void test_message_binary_drop(void);
+static void test_message_binary_threads(void);
+
+static void* binary_logging_thread(void* arg_);
+static FILE* decode_to_tmpfile(const char* path_);
+static const char* skip_timestamp(const char* line_);
+
+#define BINARY_LOG_PATH "test_message_binary.clog"
+#define BINARY_FILE_SIZE (1024 * 1024)
+#define BINARY_THREAD_COUNT 4
+#define BINARY_MESSAGE_COUNT 1000
+#define BINARY_EXPECTED_MAX 16
+
+// バイナリ出力したメッセージと、同じ引数でmessage_formatした期待値を記録する
+#define OUTPUT_AND_EXPECT(severity_, ...) \
+    do { \
+        message_output(severity_, __VA_ARGS__); \
+        message_format(severity_, s_expected[s_expected_count++], MESSAGE_BUFFER_SIZE, __VA_ARGS__); \
+    } while(0)
+
+static char s_expected[BINARY_EXPECTED_MAX][MESSAGE_BUFFER_SIZE];
+static uint64_t s_expected_count;
+
+void test_message_binary(void) {
+    test_message_binary_invalid();
+    test_message_binary_round_trip();
+    test_message_binary_truncate();
+    test_message_binary_drop();
+    test_message_binary_threads();
+}
+
+static void test_message_binary_invalid(void) {
+    assert(message_binary_start(NULL, BINARY_FILE_SIZE) == MESSAGE_INVALID_ARGUMENT);
+    assert(message_binary_start(BINARY_LOG_PATH, 64) == MESSAGE_INVALID_ARGUMENT);
+    assert(message_binary_start("./not_exist_directory/test.clog", BINARY_FILE_SIZE) == MESSAGE_RUNTIME_ERROR);
+    message_binary_stop();  // バイナリ出力中でない場合は何もしない
+
+    assert(message_binary_start(BINARY_LOG_PATH, BINARY_FILE_SIZE) == MESSAGE_SUCCESS);
+    assert(message_binary_start(BINARY_LOG_PATH, BINARY_FILE_SIZE) == MESSAGE_ALREADY_STARTED);
+    message_binary_stop();
+    message_binary_stop();  // 2重stopでもクラッシュしない
+
+    // 空のログは何も出力しない
+    FILE* decoded = decode_to_tmpfile(BINARY_LOG_PATH);
+    assert(EOF == fgetc(decoded));
+    fclose(decoded);
+
+    assert(message_binary_decode(NULL, stdout) == MESSAGE_INVALID_ARGUMENT);
+    assert(message_binary_decode(BINARY_LOG_PATH, NULL) == MESSAGE_INVALID_ARGUMENT);
+    assert(message_binary_decode("./not_exist_directory/test.clog", stdout) == MESSAGE_RUNTIME_ERROR);
+
+    // バイナリログではないファイル
+    FILE* text = fopen(BINARY_LOG_PATH, "wb");
+    assert(NULL != text);
+    for(int i = 0; i != 16; ++i) {
+        fputs("not a binary log file\n", text);
+    }
+    fclose(text);
+    assert(message_binary_decode(BINARY_LOG_PATH, stdout) == MESSAGE_INVALID_FILE);
+    remove(BINARY_LOG_PATH);
+}
+
+// 復元結果がmessage_formatでの整形結果と一致することを確認する
+static void test_message_binary_round_trip(void) {
+    core_memory_stats_t before;
+    core_memory_report(MEMORY_TAG_MESSAGE, &before);
+    s_expected_count = 0;
+
+    assert(message_binary_start(BINARY_LOG_PATH, BINARY_FILE_SIZE) == MESSAGE_SUCCESS);
+    OUTPUT_AND_EXPECT(MESSAGE_SEVERITY_ERROR, "%s - value = %d.", "func", -10);
+    OUTPUT_AND_EXPECT(MESSAGE_SEVERITY_WARNING, "no arguments");
+    OUTPUT_AND_EXPECT(MESSAGE_SEVERITY_INFORMATION, "%hhd %hu %ld %lld %zu %x %#o %c %%", 300, 70000, -5L, 1LL << 40, (size_t)7, 255u, 8u, 'A');
+    OUTPUT_AND_EXPECT(MESSAGE_SEVERITY_DEBUG, "%5.2f|%-8s|%e|%g|%Lf", 3.14159, "ab", 1e10, 0.5, (long double)1.5);
+    OUTPUT_AND_EXPECT(MESSAGE_SEVERITY_WARNING, "%*d|%.*s|%-*d|%.*f", 6, 42, 3, "abcdef", 4, 7, -1, 2.5);
+    OUTPUT_AND_EXPECT(MESSAGE_SEVERITY_ERROR, "%p %s", (void*)0x1234, (const char*)NULL);
+    OUTPUT_AND_EXPECT(MESSAGE_SEVERITY_ERROR, "%s - value = %d.", "func", 20);  // 出力済みフォーマットの再利用
+    WARN_MESSAGE("macro %s", "output");
+    message_format(MESSAGE_SEVERITY_WARNING, s_expected[s_expected_count++], MESSAGE_BUFFER_SIZE, "macro %s", "output");
+    assert(message_binary_dropped_count() == 0);
+    message_binary_stop();
+
+    // バイナリ出力はヒープ確保を行わない
+    core_memory_stats_t after;
+    core_memory_report(MEMORY_TAG_MESSAGE, &after);
+    assert(after.allocation_count == before.allocation_count);
+
+    FILE* decoded = decode_to_tmpfile(BINARY_LOG_PATH);
+    char line[MESSAGE_BUFFER_SIZE * 2];
+    for(uint64_t i = 0; i != s_expected_count; ++i) {
+        assert(NULL != fgets(line, sizeof(line), decoded));
+        assert(strcmp(skip_timestamp(line), s_expected[i]) == 0);
+    }
+    assert(NULL == fgets(line, sizeof(line), decoded));
+    fclose(decoded);
+    remove(BINARY_LOG_PATH);
+}
+
+// レコードに収まらない文字列引数は切り詰められ、"..."を付加して復元される
+static void test_message_binary_truncate(void) {
+    char long_text[MESSAGE_BUFFER_SIZE * 2];
+    memset(long_text, 'x', sizeof(long_text) - 1);
+    long_text[sizeof(long_text) - 1] = '\0';
+
+    assert(message_binary_start(BINARY_LOG_PATH, BINARY_FILE_SIZE) == MESSAGE_SUCCESS);
+    ERROR_MESSAGE("head %s tail %d", long_text, 10);
+    ERROR_MESSAGE("after %d", 1);
+    message_binary_stop();
+
+    FILE* decoded = decode_to_tmpfile(BINARY_LOG_PATH);
+    char line[MESSAGE_BUFFER_SIZE * 2];
+    assert(NULL != fgets(line, sizeof(line), decoded));
+    const char* message = skip_timestamp(line);
+    assert(strncmp(message, "\033[1;31m[ERROR] head xxx", 23) == 0);
+    assert(NULL != strstr(message, "...\033[0m\n"));
+    assert(NULL == strstr(message, "tail"));
+    assert(NULL != fgets(line, sizeof(line), decoded));
+    assert(strcmp(skip_timestamp(line), "\033[1;31m[ERROR] after 1\033[0m\n") == 0);
+    fclose(decoded);
+    remove(BINARY_LOG_PATH);
+}
+
+// ファイルが満杯の場合、復元されたメッセージ数と破棄数の合計が出力要求数と一致する
+static void test_message_binary_drop(void) {
+    assert(message_binary_start(BINARY_LOG_PATH, 64 + MESSAGE_BUFFER_SIZE) == MESSAGE_SUCCESS);
+    for(int i = 0; i != 100; ++i) {
+        WARN_MESSAGE("test_message_binary_drop - message %d.", i);
+    }
+    const uint64_t dropped = message_binary_dropped_count();
+    assert(dropped > 0);
+    message_binary_stop();
+
+    FILE* decoded = decode_to_tmpfile(BINARY_LOG_PATH);
+    char line[MESSAGE_BUFFER_SIZE];
+    char dropped_line[64];
+    snprintf(dropped_line, sizeof(dropped_line), "(%llu messages dropped)\n", (unsigned long long)dropped);
+    uint64_t messages = 0;
+    bool dropped_found = false;
+    while(NULL != fgets(line, sizeof(line), decoded)) {
+        if(strcmp(line, dropped_line) == 0) {
+            dropped_found = true;
+        } else {
+            messages++;
+        }
+    }
+    assert(dropped_found);
+    assert(messages + dropped == 100);
+    fclose(decoded);
+    remove(BINARY_LOG_PATH);
+}
+
+// 複数スレッドから出力したメッセージが欠落なく復元されることを確認する
+static void test_message_binary_threads(void) {
+    assert(message_binary_start(BINARY_LOG_PATH, BINARY_FILE_SIZE) == MESSAGE_SUCCESS);
+    pthread_t threads[BINARY_THREAD_COUNT];
+    int ids[BINARY_THREAD_COUNT];
+    for(int i = 0; i != BINARY_THREAD_COUNT; ++i) {
+        ids[i] = i;
+        const int ret = pthread_create(&threads[i], NULL, binary_logging_thread, &ids[i]);
+        assert(0 == ret);
+        (void)ret;
+    }
+    for(int i = 0; i != BINARY_THREAD_COUNT; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+    assert(message_binary_dropped_count() == 0);
+    message_binary_stop();
+
+    // スレッドごとに、全メッセージが出力順に復元される
+    int next[BINARY_THREAD_COUNT] = { 0 };
+    FILE* decoded = decode_to_tmpfile(BINARY_LOG_PATH);
+    char line[MESSAGE_BUFFER_SIZE];
+    uint64_t lines = 0;
+    while(NULL != fgets(line, sizeof(line), decoded)) {
+        int thread = -1;
+        int index = -1;
+        const int matched = sscanf(skip_timestamp(line), "\033[1;33m[WARNING] thread %d message %d.", &thread, &index);
+        assert(2 == matched);
+        assert(thread >= 0 && thread < BINARY_THREAD_COUNT);
+        assert(index == next[thread]);
+        (void)matched;
+        next[thread]++;
+        lines++;
+    }
+    assert(lines == BINARY_THREAD_COUNT * BINARY_MESSAGE_COUNT);
+    fclose(decoded);
+    remove(BINARY_LOG_PATH);
+}
+
+static void* binary_logging_thread(void* arg_) {
+    const int id = *(const int*)arg_;
+    for(int i = 0; i != BINARY_MESSAGE_COUNT; ++i) {
+        WARN_MESSAGE("thread %d message %d.", id, i);
+    }
+    return NULL;
+}
+
+// path_を復元した結果を一時ファイルに書き出し、先頭に戻して返す
+static FILE* decode_to_tmpfile(const char* path_) {
+    FILE* decoded = tmpfile();
+    assert(NULL != decoded);
+    const MESSAGE_ERROR_CODE ret = message_binary_decode(path_, decoded);
+    assert(MESSAGE_SUCCESS == ret);
+    (void)ret;
+    rewind(decoded);
+    return decoded;
+}
+
+// 復元結果の行頭のタイムスタンプ("秒.ナノ秒 ")を読み飛ばす
+static const char* skip_timestamp(const char* line_) {
+    const char* space = strchr(line_, ' ');
+    assert(NULL != space);
+    const char* dot = strchr(line_, '.');
+    assert(NULL != dot && dot < space && (space - dot) == 10);
+    return space + 1;
+}
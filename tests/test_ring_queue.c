@@ -0,0 +1,372 @@
+#if defined(__linux__)
+#define _POSIX_C_SOURCE 200809L // for sched_yield
+#endif
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "include/test_ring_queue.h"
+
+#include "containers/ring_queue.h"
+
+// ======== テスト用サンプル型 ========
+
+// パディングあり
+typedef struct sample_with_pad_t {
+    uint8_t  a;
+    uint32_t b;
+} sample_with_pad_t;
+
+// マルチスレッドテストでやり取りするメッセージ
+typedef struct stress_message_t {
+    uint32_t producer_id;
+    uint32_t padding;
+    uint64_t sequence;
+} stress_message_t;
+
+#define STRESS_QUEUE_CAPACITY 64
+#define STRESS_MESSAGE_COUNT 20000
+#define STRESS_MAX_THREADS 4
+
+typedef struct stress_context_t {
+    ring_queue_t* queue;
+    uint32_t producer_id;
+    uint32_t producer_count;
+    uint64_t message_count;         // プロデューサ1スレッドあたりの送信数
+    _Atomic uint64_t* popped_count; // 全コンシューマの受信数合計
+    uint64_t total_count;           // 全プロデューサの送信数合計
+    uint64_t received_count;        // このコンシューマの受信数
+    uint64_t received_sum;          // このコンシューマが受信したsequenceの合計
+    bool ordered;                   // プロデューサごとにsequenceが増加順で受信できたか
+} stress_context_t;
+
+static void test_create_and_destroy(void);
+static void test_invalid_argument(void);
+static void test_fifo_order(void);
+static void test_full_and_empty(void);
+static void test_wrap_around(void);
+static void test_struct_element(void);
+static void test_spsc_stress(void);
+static void test_mpmc_stress(void);
+static void test_error_code_to_string(void);
+
+static void* stress_producer(void* arg_);
+static void* stress_consumer(void* arg_);
+static void run_stress(RING_QUEUE_MODE mode_, uint32_t producer_count_, uint32_t consumer_count_);
+
+void test_ring_queue(void) {
+    test_create_and_destroy();
+    test_invalid_argument();
+    test_fifo_order();
+    test_full_and_empty();
+    test_wrap_around();
+    test_struct_element();
+    test_spsc_stress();
+    test_mpmc_stress();
+    test_error_code_to_string();
+}
+
+static void test_create_and_destroy(void) {
+    ring_queue_t queue = RING_QUEUE_INITIALIZER;
+    assert(queue.internal_data == NULL);
+    ring_queue_default_create(&queue);
+    assert(queue.internal_data == NULL);
+    ring_queue_default_create(NULL);
+
+    assert(ring_queue_create(sizeof(uint64_t), alignof(uint64_t), 8, RING_QUEUE_MODE_SPSC, &queue) == RING_QUEUE_SUCCESS);
+    assert(queue.internal_data != NULL);
+    uint64_t capacity = 0;
+    uint64_t size = 1;
+    assert(ring_queue_capacity(&queue, &capacity) == RING_QUEUE_SUCCESS);
+    assert(capacity == 8);
+    assert(ring_queue_size(&queue, &size) == RING_QUEUE_SUCCESS);
+    assert(size == 0);
+
+    // 初期化済みオブジェクトに対する再createは、古いバッファを破棄して作り直す
+    assert(ring_queue_create(sizeof(uint32_t), alignof(uint32_t), 16, RING_QUEUE_MODE_MPMC, &queue) == RING_QUEUE_SUCCESS);
+    assert(ring_queue_capacity(&queue, &capacity) == RING_QUEUE_SUCCESS);
+    assert(capacity == 16);
+
+    ring_queue_destroy(&queue);
+    assert(queue.internal_data == NULL);
+    ring_queue_destroy(&queue);   // 2重destroyでもクラッシュしない
+    ring_queue_destroy(NULL);
+}
+
+static void test_invalid_argument(void) {
+    ring_queue_t queue = RING_QUEUE_INITIALIZER;
+    uint64_t value = 0;
+    uint64_t out = 0;
+
+    assert(ring_queue_create(sizeof(uint64_t), alignof(uint64_t), 8, RING_QUEUE_MODE_SPSC, NULL) == RING_QUEUE_INVALID_ARGUMENT);
+    assert(ring_queue_create(0, alignof(uint64_t), 8, RING_QUEUE_MODE_SPSC, &queue) == RING_QUEUE_INVALID_ARGUMENT);
+    assert(ring_queue_create(sizeof(uint64_t), 0, 8, RING_QUEUE_MODE_SPSC, &queue) == RING_QUEUE_INVALID_ARGUMENT);
+    assert(ring_queue_create(sizeof(uint64_t), alignof(uint64_t), 0, RING_QUEUE_MODE_SPSC, &queue) == RING_QUEUE_INVALID_ARGUMENT);
+    assert(ring_queue_create(sizeof(uint64_t), 3, 8, RING_QUEUE_MODE_SPSC, &queue) == RING_QUEUE_INVALID_ARGUMENT);     // アライメントが2の冪乗でない
+    assert(ring_queue_create(sizeof(uint64_t), alignof(uint64_t), 6, RING_QUEUE_MODE_SPSC, &queue) == RING_QUEUE_INVALID_ARGUMENT);  // 格納数が2の冪乗でない
+    assert(ring_queue_create(sizeof(uint64_t), alignof(uint64_t), 8, (RING_QUEUE_MODE)2, &queue) == RING_QUEUE_INVALID_ARGUMENT);
+    assert(ring_queue_create(sizeof(uint64_t), alignof(uint64_t), (uint64_t)1 << 63, RING_QUEUE_MODE_MPMC, &queue) == RING_QUEUE_INVALID_ARGUMENT);
+    assert(queue.internal_data == NULL);
+
+    // 未初期化キュー
+    assert(ring_queue_push(&queue, &value) == RING_QUEUE_INVALID_QUEUE);
+    assert(ring_queue_pop(&queue, &out) == RING_QUEUE_INVALID_QUEUE);
+    assert(ring_queue_capacity(&queue, &out) == RING_QUEUE_INVALID_QUEUE);
+    assert(ring_queue_size(&queue, &out) == RING_QUEUE_INVALID_QUEUE);
+
+    // NULL引数
+    assert(ring_queue_create(sizeof(uint64_t), alignof(uint64_t), 8, RING_QUEUE_MODE_MPMC, &queue) == RING_QUEUE_SUCCESS);
+    assert(ring_queue_push(NULL, &value) == RING_QUEUE_INVALID_ARGUMENT);
+    assert(ring_queue_push(&queue, NULL) == RING_QUEUE_INVALID_ARGUMENT);
+    assert(ring_queue_pop(NULL, &out) == RING_QUEUE_INVALID_ARGUMENT);
+    assert(ring_queue_pop(&queue, NULL) == RING_QUEUE_INVALID_ARGUMENT);
+    assert(ring_queue_capacity(NULL, &out) == RING_QUEUE_INVALID_ARGUMENT);
+    assert(ring_queue_capacity(&queue, NULL) == RING_QUEUE_INVALID_ARGUMENT);
+    assert(ring_queue_size(NULL, &out) == RING_QUEUE_INVALID_ARGUMENT);
+    assert(ring_queue_size(&queue, NULL) == RING_QUEUE_INVALID_ARGUMENT);
+    ring_queue_destroy(&queue);
+}
+
+static void test_fifo_order(void) {
+    const RING_QUEUE_MODE modes[] = { RING_QUEUE_MODE_SPSC, RING_QUEUE_MODE_MPMC };
+    for(size_t m = 0; m != sizeof(modes) / sizeof(modes[0]); ++m) {
+        ring_queue_t queue = RING_QUEUE_INITIALIZER;
+        assert(ring_queue_create(sizeof(uint64_t), alignof(uint64_t), 8, modes[m], &queue) == RING_QUEUE_SUCCESS);
+        for(uint64_t i = 1; i <= 5; ++i) {
+            assert(ring_queue_push(&queue, &i) == RING_QUEUE_SUCCESS);
+        }
+        uint64_t size = 0;
+        assert(ring_queue_size(&queue, &size) == RING_QUEUE_SUCCESS);
+        assert(size == 5);
+
+        uint64_t out = 0;
+        for(uint64_t i = 1; i <= 5; ++i) {
+            assert(ring_queue_pop(&queue, &out) == RING_QUEUE_SUCCESS);
+            assert(out == i);
+        }
+        assert(ring_queue_size(&queue, &size) == RING_QUEUE_SUCCESS);
+        assert(size == 0);
+        ring_queue_destroy(&queue);
+    }
+}
+
+static void test_full_and_empty(void) {
+    const RING_QUEUE_MODE modes[] = { RING_QUEUE_MODE_SPSC, RING_QUEUE_MODE_MPMC };
+    for(size_t m = 0; m != sizeof(modes) / sizeof(modes[0]); ++m) {
+        ring_queue_t queue = RING_QUEUE_INITIALIZER;
+        uint64_t out = 0;
+        assert(ring_queue_create(sizeof(uint64_t), alignof(uint64_t), 4, modes[m], &queue) == RING_QUEUE_SUCCESS);
+        assert(ring_queue_pop(&queue, &out) == RING_QUEUE_EMPTY);
+        for(uint64_t i = 0; i != 4; ++i) {
+            assert(ring_queue_push(&queue, &i) == RING_QUEUE_SUCCESS);
+        }
+        uint64_t value = 100;
+        assert(ring_queue_push(&queue, &value) == RING_QUEUE_FULL);
+        uint64_t size = 0;
+        assert(ring_queue_size(&queue, &size) == RING_QUEUE_SUCCESS);
+        assert(size == 4);
+
+        // 1つ取り出すと再度pushできる
+        assert(ring_queue_pop(&queue, &out) == RING_QUEUE_SUCCESS);
+        assert(out == 0);
+        assert(ring_queue_push(&queue, &value) == RING_QUEUE_SUCCESS);
+        assert(ring_queue_push(&queue, &value) == RING_QUEUE_FULL);
+
+        for(uint64_t i = 1; i != 4; ++i) {
+            assert(ring_queue_pop(&queue, &out) == RING_QUEUE_SUCCESS);
+            assert(out == i);
+        }
+        assert(ring_queue_pop(&queue, &out) == RING_QUEUE_SUCCESS);
+        assert(out == 100);
+        assert(ring_queue_pop(&queue, &out) == RING_QUEUE_EMPTY);
+        ring_queue_destroy(&queue);
+    }
+}
+
+static void test_wrap_around(void) {
+    // バッファを何周もさせて、インデックスのマスク計算とシーケンス番号の更新を確認する
+    const RING_QUEUE_MODE modes[] = { RING_QUEUE_MODE_SPSC, RING_QUEUE_MODE_MPMC };
+    for(size_t m = 0; m != sizeof(modes) / sizeof(modes[0]); ++m) {
+        ring_queue_t queue = RING_QUEUE_INITIALIZER;
+        assert(ring_queue_create(sizeof(uint64_t), alignof(uint64_t), 4, modes[m], &queue) == RING_QUEUE_SUCCESS);
+        uint64_t next_push = 0;
+        uint64_t next_pop = 0;
+        uint64_t out = 0;
+        for(uint64_t round = 0; round != 100; ++round) {
+            for(uint64_t i = 0; i != 3; ++i) {
+                assert(ring_queue_push(&queue, &next_push) == RING_QUEUE_SUCCESS);
+                next_push++;
+            }
+            for(uint64_t i = 0; i != 2; ++i) {
+                assert(ring_queue_pop(&queue, &out) == RING_QUEUE_SUCCESS);
+                assert(out == next_pop);
+                next_pop++;
+            }
+            while(next_push - next_pop > 1) {
+                assert(ring_queue_pop(&queue, &out) == RING_QUEUE_SUCCESS);
+                assert(out == next_pop);
+                next_pop++;
+            }
+        }
+        ring_queue_destroy(&queue);
+    }
+}
+
+static void test_struct_element(void) {
+    ring_queue_t queue = RING_QUEUE_INITIALIZER;
+    assert(ring_queue_create(sizeof(sample_with_pad_t), alignof(sample_with_pad_t), 2, RING_QUEUE_MODE_MPMC, &queue) == RING_QUEUE_SUCCESS);
+    sample_with_pad_t in;
+    memset(&in, 0, sizeof(in));
+    in.a = 0x5A;
+    in.b = 0xDEADBEEF;
+    assert(ring_queue_push(&queue, &in) == RING_QUEUE_SUCCESS);
+
+    sample_with_pad_t out;
+    memset(&out, 0xFF, sizeof(out));
+    assert(ring_queue_pop(&queue, &out) == RING_QUEUE_SUCCESS);
+    assert(out.a == 0x5A);
+    assert(out.b == 0xDEADBEEF);
+    ring_queue_destroy(&queue);
+
+    // アライメント要件がキャッシュラインより大きい場合
+    typedef struct big_align_t {
+        alignas(128) uint64_t value;
+    } big_align_t;
+    assert(ring_queue_create(sizeof(big_align_t), alignof(big_align_t), 4, RING_QUEUE_MODE_SPSC, &queue) == RING_QUEUE_SUCCESS);
+    big_align_t big_in = { 42 };
+    big_align_t big_out = { 0 };
+    assert(ring_queue_push(&queue, &big_in) == RING_QUEUE_SUCCESS);
+    assert(ring_queue_pop(&queue, &big_out) == RING_QUEUE_SUCCESS);
+    assert(big_out.value == 42);
+    ring_queue_destroy(&queue);
+}
+
+static void test_spsc_stress(void) {
+    run_stress(RING_QUEUE_MODE_SPSC, 1, 1);
+}
+
+static void test_mpmc_stress(void) {
+    run_stress(RING_QUEUE_MODE_MPMC, 1, 1);
+    run_stress(RING_QUEUE_MODE_MPMC, 4, 1);
+    run_stress(RING_QUEUE_MODE_MPMC, 1, 4);
+    run_stress(RING_QUEUE_MODE_MPMC, 4, 4);
+}
+
+static void test_error_code_to_string(void) {
+    assert(strcmp(ring_queue_error_code_to_string(RING_QUEUE_SUCCESS), "ring queue error code: success.") == 0);
+    assert(strcmp(ring_queue_error_code_to_string(RING_QUEUE_MEMORY_ALLOCATE_ERROR), "ring queue error code: failed to allocate memory.") == 0);
+    assert(strcmp(ring_queue_error_code_to_string(RING_QUEUE_INVALID_ARGUMENT), "ring queue error code: invalid argument.") == 0);
+    assert(strcmp(ring_queue_error_code_to_string(RING_QUEUE_INVALID_QUEUE), "ring queue error code: invalid queue.") == 0);
+    assert(strcmp(ring_queue_error_code_to_string(RING_QUEUE_EMPTY), "ring queue error code: queue is empty.") == 0);
+    assert(strcmp(ring_queue_error_code_to_string(RING_QUEUE_FULL), "ring queue error code: queue is full.") == 0);
+    assert(strcmp(ring_queue_error_code_to_string((RING_QUEUE_ERROR_CODE)0xFF), "ring queue error code: undefined error.") == 0);
+}
+
+// プロデューサスレッド: 自分のIDと0から始まる連番をpushする
+static void* stress_producer(void* arg_) {
+    stress_context_t* ctx = (stress_context_t*)arg_;
+    for(uint64_t i = 0; i != ctx->message_count; ++i) {
+        stress_message_t message = { ctx->producer_id, 0, i };
+        RING_QUEUE_ERROR_CODE ret = ring_queue_push(ctx->queue, &message);
+        while(RING_QUEUE_FULL == ret) {
+            sched_yield();
+            ret = ring_queue_push(ctx->queue, &message);
+        }
+        assert(RING_QUEUE_SUCCESS == ret);
+    }
+    return NULL;
+}
+
+// コンシューマスレッド: 全メッセージを受信し終えるまでpopし、プロデューサごとの順序を確認する
+static void* stress_consumer(void* arg_) {
+    stress_context_t* ctx = (stress_context_t*)arg_;
+    uint64_t next_sequence[STRESS_MAX_THREADS] = { 0 };
+    while(atomic_load(ctx->popped_count) < ctx->total_count) {
+        stress_message_t message;
+        const RING_QUEUE_ERROR_CODE ret = ring_queue_pop(ctx->queue, &message);
+        if(RING_QUEUE_EMPTY == ret) {
+            sched_yield();
+            continue;
+        }
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(message.producer_id < ctx->producer_count);
+        // 同一プロデューサからのメッセージは、1つのコンシューマから見て必ず増加順になる
+        if(message.sequence < next_sequence[message.producer_id]) {
+            ctx->ordered = false;
+        }
+        next_sequence[message.producer_id] = message.sequence + 1;
+        ctx->received_count++;
+        ctx->received_sum += message.sequence;
+        atomic_fetch_add(ctx->popped_count, 1);
+    }
+    return NULL;
+}
+
+static void run_stress(RING_QUEUE_MODE mode_, uint32_t producer_count_, uint32_t consumer_count_) {
+    assert(producer_count_ <= STRESS_MAX_THREADS && consumer_count_ <= STRESS_MAX_THREADS);
+    ring_queue_t queue = RING_QUEUE_INITIALIZER;
+    assert(ring_queue_create(sizeof(stress_message_t), alignof(stress_message_t), STRESS_QUEUE_CAPACITY, mode_, &queue) == RING_QUEUE_SUCCESS);
+
+    _Atomic uint64_t popped_count = 0;
+    const uint64_t message_count = STRESS_MESSAGE_COUNT / producer_count_;
+    const uint64_t total_count = message_count * producer_count_;
+    stress_context_t producers[STRESS_MAX_THREADS];
+    stress_context_t consumers[STRESS_MAX_THREADS];
+    pthread_t producer_threads[STRESS_MAX_THREADS];
+    pthread_t consumer_threads[STRESS_MAX_THREADS];
+
+    for(uint32_t i = 0; i != consumer_count_; ++i) {
+        memset(&consumers[i], 0, sizeof(stress_context_t));
+        consumers[i].queue = &queue;
+        consumers[i].producer_count = producer_count_;
+        consumers[i].popped_count = &popped_count;
+        consumers[i].total_count = total_count;
+        consumers[i].ordered = true;
+        const int ret = pthread_create(&consumer_threads[i], NULL, stress_consumer, &consumers[i]);
+        assert(0 == ret);
+        (void)ret;
+    }
+    for(uint32_t i = 0; i != producer_count_; ++i) {
+        memset(&producers[i], 0, sizeof(stress_context_t));
+        producers[i].queue = &queue;
+        producers[i].producer_id = i;
+        producers[i].message_count = message_count;
+        const int ret = pthread_create(&producer_threads[i], NULL, stress_producer, &producers[i]);
+        assert(0 == ret);
+        (void)ret;
+    }
+    for(uint32_t i = 0; i != producer_count_; ++i) {
+        const int ret = pthread_join(producer_threads[i], NULL);
+        assert(0 == ret);
+        (void)ret;
+    }
+    for(uint32_t i = 0; i != consumer_count_; ++i) {
+        const int ret = pthread_join(consumer_threads[i], NULL);
+        assert(0 == ret);
+        (void)ret;
+    }
+
+    // 欠落 / 重複がないことを、受信数と連番の合計で確認する
+    uint64_t received_count = 0;
+    uint64_t received_sum = 0;
+    for(uint32_t i = 0; i != consumer_count_; ++i) {
+        assert(consumers[i].ordered);
+        received_count += consumers[i].received_count;
+        received_sum += consumers[i].received_sum;
+    }
+    assert(received_count == total_count);
+    assert(received_sum == (uint64_t)producer_count_ * (message_count * (message_count - 1) / 2));
+
+    uint64_t size = 1;
+    uint64_t out = 0;
+    assert(ring_queue_size(&queue, &size) == RING_QUEUE_SUCCESS);
+    assert(size == 0);
+    assert(ring_queue_pop(&queue, &out) == RING_QUEUE_EMPTY);
+    ring_queue_destroy(&queue);
+}
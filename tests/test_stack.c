@@ -7,6 +7,7 @@
 #include "include/test_stack.h"
 
 #include "containers/stack.h"
+#include "containers/stack_unchecked.h"
 
 // ======== テスト用サンプル型 ========
 
@@ -273,6 +274,61 @@ static void test_error_code_to_string(void) {
 }
 
 
+static void test_create_with_arena(void) {
+    core_arena_t arena = CORE_ARENA_INITIALIZER;
+    assert(core_arena_create(1024, &arena) == CORE_MEMORY_SUCCESS);
+
+    stack_t st = STACK_INITIALIZER;
+    assert(stack_create_with_arena(sizeof(sample_no_pad_t), alignof(sample_no_pad_t), 4, NULL, &st) == STACK_ERROR_INVALID_ARGUMENT);
+    expect_success(stack_create_with_arena(sizeof(sample_no_pad_t), alignof(sample_no_pad_t), 4, &arena, &st));
+
+    for (uint32_t i = 1; i <= 4; ++i) {
+        sample_no_pad_t in = { .a = i };
+        expect_success(stack_push(&st, &in));
+    }
+    // resizeの新領域もアリーナから確保され、内容は保持される
+    expect_success(stack_resize(8, &st));
+    sample_no_pad_t out = {0};
+    expect_success(stack_pop(&st, &out));
+    assert(out.a == 4);
+
+    // 容量不足
+    stack_t big = STACK_INITIALIZER;
+    assert(stack_create_with_arena(sizeof(sample_no_pad_t), alignof(sample_no_pad_t), 1024, &arena, &big) == STACK_ERROR_MEMORY_ALLOCATE_ERROR);
+
+    stack_destroy(&st);
+    assert(st.internal_data == NULL);
+
+    assert(core_arena_reset(&arena) == CORE_MEMORY_SUCCESS);
+    core_arena_destroy(&arena);
+}
+
+static void test_unchecked_push_pop(void) {
+    stack_t st = STACK_INITIALIZER;
+    // 要素サイズ3byte / アライメント4byte(1byteのパディングあり)
+    expect_success(stack_create(3, 4, 8, &st));
+
+    const uint8_t in0[3] = { 1, 2, 3 };
+    const uint8_t in1[3] = { 4, 5, 6 };
+    stack_push_unchecked(&st, in0);
+    expect_success(stack_push(&st, in1));   // 通常版との混在
+    assert(stack_size_unchecked(&st) == 2);
+
+    const uint8_t* top = (const uint8_t*)stack_peek_unchecked(&st);
+    assert(top[0] == 4 && top[1] == 5 && top[2] == 6);
+    assert(top[3] == 0);    // パディング領域は0クリアされる
+
+    uint8_t out[3] = { 0 };
+    stack_pop_unchecked(&st, out);
+    assert(out[0] == 4 && out[1] == 5 && out[2] == 6);
+    expect_success(stack_pop(&st, out));
+    assert(out[0] == 1 && out[1] == 2 && out[2] == 3);
+    assert(stack_size_unchecked(&st) == 0);
+    assert(stack_empty(&st) == true);
+
+    stack_destroy(&st);
+}
+
 void test_stack(void) {
     puts("=== stack tests start ===");
 
@@ -291,5 +347,9 @@ void test_stack(void) {
     test_null_arguments();
     test_error_code_to_string();
 
+    test_create_with_arena();
+
+    test_unchecked_push_pop();
+
     puts("=== stack tests OK ===");
 }
\ No newline at end of file
@@ -0,0 +1,181 @@
+#include <assert.h>
+#include <stdint.h>
+
+#include "include/test_typed_dynamic_array.h"
+
+#include "containers/typed_dynamic_array.h"
+
+typedef struct {
+    int id;
+    float value;
+} test_object_t;
+
+DEFINE_DYNAMIC_ARRAY(test_u32_array, uint32_t)
+DEFINE_DYNAMIC_ARRAY(test_object_array, test_object_t)
+
+static void test_create_and_destroy(void);
+static void test_push_ref_set_pop(void);
+static void test_buffer_full_and_growth(void);
+static void test_resize(void);
+static void test_struct_element(void);
+static void test_null_pointer_handling(void);
+
+void test_typed_dynamic_array(void) {
+    test_create_and_destroy();
+    test_push_ref_set_pop();
+    test_buffer_full_and_growth();
+    test_resize();
+    test_struct_element();
+    test_null_pointer_handling();
+}
+
+static void test_create_and_destroy(void) {
+    test_u32_array_t array = TYPED_DYNAMIC_ARRAY_INITIALIZER;
+    assert(test_u32_array_create(8, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(array.data != NULL);
+    assert(test_u32_array_size(&array) == 0);
+    assert(test_u32_array_capacity(&array) == 8);
+    for(uint64_t i = 0; i != 8; ++i) {
+        assert(array.data[i] == 0);
+    }
+
+    // 再createで既存バッファは破棄される
+    assert(test_u32_array_create(0, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(array.data == NULL);
+    assert(test_u32_array_capacity(&array) == 0);
+
+    test_u32_array_destroy(&array);
+    assert(array.data == NULL);
+    test_u32_array_destroy(&array);   // 2重destroyでもクラッシュしない
+    test_u32_array_destroy(NULL);
+}
+
+static void test_push_ref_set_pop(void) {
+    test_u32_array_t array = TYPED_DYNAMIC_ARRAY_INITIALIZER;
+    assert(test_u32_array_create(4, &array) == DYNAMIC_ARRAY_SUCCESS);
+    for(uint32_t i = 0; i != 4; ++i) {
+        const uint32_t value = i * 10;
+        assert(test_u32_array_push(&value, &array) == DYNAMIC_ARRAY_SUCCESS);
+    }
+    assert(test_u32_array_size(&array) == 4);
+
+    uint32_t out = 0;
+    assert(test_u32_array_ref(2, &array, &out) == DYNAMIC_ARRAY_SUCCESS);
+    assert(out == 20);
+    assert(test_u32_array_ref(4, &array, &out) == DYNAMIC_ARRAY_OUT_OF_RANGE);
+
+    const uint32_t new_value = 99;
+    assert(test_u32_array_set(1, &new_value, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(test_u32_array_set(4, &new_value, &array) == DYNAMIC_ARRAY_OUT_OF_RANGE);
+
+    uint32_t* ptr = NULL;
+    assert(test_u32_array_ptr(1, &array, &ptr) == DYNAMIC_ARRAY_SUCCESS);
+    assert(*ptr == 99);
+    *ptr = 11;
+    assert(test_u32_array_ptr(4, &array, &ptr) == DYNAMIC_ARRAY_OUT_OF_RANGE);
+
+    assert(test_u32_array_pop(&array, &out) == DYNAMIC_ARRAY_SUCCESS);
+    assert(out == 30);
+    assert(test_u32_array_size(&array) == 3);
+    assert(test_u32_array_ref(1, &array, &out) == DYNAMIC_ARRAY_SUCCESS);
+    assert(out == 11);
+
+    assert(test_u32_array_clear(&array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(test_u32_array_size(&array) == 0);
+    assert(test_u32_array_capacity(&array) == 4);
+    assert(test_u32_array_pop(&array, &out) == DYNAMIC_ARRAY_OUT_OF_RANGE);
+
+    test_u32_array_destroy(&array);
+}
+
+static void test_buffer_full_and_growth(void) {
+    test_u32_array_t array = TYPED_DYNAMIC_ARRAY_INITIALIZER;
+    assert(test_u32_array_create(2, &array) == DYNAMIC_ARRAY_SUCCESS);
+    const uint32_t value = 7;
+    assert(test_u32_array_push(&value, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(test_u32_array_push(&value, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(test_u32_array_push(&value, &array) == DYNAMIC_ARRAY_BUFFER_FULL);   // デフォルトでは自動拡張しない
+
+    assert(test_u32_array_growth_policy_set(100, &array) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(test_u32_array_growth_policy_set(150, &array) == DYNAMIC_ARRAY_SUCCESS);
+    for(uint32_t i = 2; i != 100; ++i) {
+        assert(test_u32_array_push(&i, &array) == DYNAMIC_ARRAY_SUCCESS);
+    }
+    assert(test_u32_array_size(&array) == 100);
+    assert(test_u32_array_capacity(&array) >= 100);
+    for(uint32_t i = 2; i != 100; ++i) {
+        assert(array.data[i] == i);
+    }
+    assert(array.data[0] == 7 && array.data[1] == 7);
+
+    // 容量一杯の状態で自身の要素をpushする(拡張でバッファが移動する)
+    while(test_u32_array_size(&array) != test_u32_array_capacity(&array)) {
+        assert(test_u32_array_push(&value, &array) == DYNAMIC_ARRAY_SUCCESS);
+    }
+    const uint64_t count = test_u32_array_size(&array);
+    assert(test_u32_array_push(&array.data[2], &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(test_u32_array_size(&array) == count + 1);
+    assert(array.data[count] == 2);
+    test_u32_array_destroy(&array);
+
+    // バッファ未確保状態からの自動拡張
+    test_u32_array_t empty = TYPED_DYNAMIC_ARRAY_INITIALIZER;
+    assert(test_u32_array_push(&value, &empty) == DYNAMIC_ARRAY_BUFFER_FULL);
+    assert(test_u32_array_growth_policy_set(200, &empty) == DYNAMIC_ARRAY_SUCCESS);
+    assert(test_u32_array_push(&value, &empty) == DYNAMIC_ARRAY_SUCCESS);
+    assert(test_u32_array_capacity(&empty) == TYPED_DARRAY_GROWTH_INITIAL_COUNT);
+    test_u32_array_destroy(&empty);
+}
+
+static void test_resize(void) {
+    test_u32_array_t array = TYPED_DYNAMIC_ARRAY_INITIALIZER;
+    assert(test_u32_array_create(2, &array) == DYNAMIC_ARRAY_SUCCESS);
+    const uint32_t values[2] = { 5, 6 };
+    assert(test_u32_array_push(&values[0], &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(test_u32_array_push(&values[1], &array) == DYNAMIC_ARRAY_SUCCESS);
+
+    assert(test_u32_array_resize(1, &array) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(test_u32_array_resize(16, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(test_u32_array_capacity(&array) == 16);
+    assert(array.data[0] == 5 && array.data[1] == 6);
+    for(uint64_t i = 2; i != 16; ++i) {
+        assert(array.data[i] == 0);
+    }
+    assert(test_u32_array_resize(UINT64_MAX, &array) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+
+    assert(test_u32_array_clear(&array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(test_u32_array_resize(0, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(array.data == NULL);
+    test_u32_array_destroy(&array);
+}
+
+static void test_struct_element(void) {
+    test_object_array_t array = TYPED_DYNAMIC_ARRAY_INITIALIZER;
+    assert(test_object_array_create(3, &array) == DYNAMIC_ARRAY_SUCCESS);
+    const test_object_t obj = { 42, 3.5f };
+    assert(test_object_array_push(&obj, &array) == DYNAMIC_ARRAY_SUCCESS);
+
+    test_object_t out = { 0 };
+    assert(test_object_array_ref(0, &array, &out) == DYNAMIC_ARRAY_SUCCESS);
+    assert(out.id == 42 && out.value == 3.5f);
+    test_object_array_destroy(&array);
+}
+
+static void test_null_pointer_handling(void) {
+    test_u32_array_t array = TYPED_DYNAMIC_ARRAY_INITIALIZER;
+    uint32_t value = 0;
+    uint32_t* ptr = NULL;
+    assert(test_u32_array_create(4, NULL) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(test_u32_array_create(4, &array) == DYNAMIC_ARRAY_SUCCESS);
+    assert(test_u32_array_push(NULL, &array) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(test_u32_array_push(&value, NULL) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(test_u32_array_pop(&array, NULL) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(test_u32_array_ref(0, &array, NULL) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(test_u32_array_set(0, NULL, &array) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(test_u32_array_ptr(0, &array, NULL) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(test_u32_array_ptr(0, NULL, &ptr) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(test_u32_array_resize(8, NULL) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(test_u32_array_growth_policy_set(200, NULL) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    assert(test_u32_array_clear(NULL) == DYNAMIC_ARRAY_INVALID_ARGUMENT);
+    test_u32_array_destroy(&array);
+}
@@ -0,0 +1,141 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "include/test_typed_stack.h"
+
+#include "containers/typed_stack.h"
+
+typedef struct {
+    uint8_t a;
+    uint32_t b;
+} sample_with_pad_t;
+
+DEFINE_STACK(test_u64_stack, uint64_t)
+DEFINE_STACK(test_pad_stack, sample_with_pad_t)
+
+static void test_create_and_destroy(void);
+static void test_push_pop_lifo(void);
+static void test_full_and_empty(void);
+static void test_resize_preserves_content(void);
+static void test_struct_element(void);
+static void test_null_and_invalid(void);
+
+void test_typed_stack(void) {
+    test_create_and_destroy();
+    test_push_pop_lifo();
+    test_full_and_empty();
+    test_resize_preserves_content();
+    test_struct_element();
+    test_null_and_invalid();
+}
+
+static void test_create_and_destroy(void) {
+    test_u64_stack_t stack = TYPED_STACK_INITIALIZER;
+    assert(test_u64_stack_create(0, &stack) == STACK_ERROR_INVALID_ARGUMENT);
+    assert(test_u64_stack_create(UINT64_MAX, &stack) == STACK_ERROR_INVALID_ARGUMENT);
+    assert(test_u64_stack_create(8, &stack) == STACK_ERROR_CODE_SUCCESS);
+    assert(stack.data != NULL);
+    assert(stack.max_element_count == 8);
+    assert(test_u64_stack_empty(&stack));
+    assert(!test_u64_stack_full(&stack));
+
+    test_u64_stack_destroy(&stack);
+    assert(stack.data == NULL);
+    test_u64_stack_destroy(&stack);   // 2重destroyでもクラッシュしない
+    test_u64_stack_destroy(NULL);
+}
+
+static void test_push_pop_lifo(void) {
+    test_u64_stack_t stack = TYPED_STACK_INITIALIZER;
+    assert(test_u64_stack_create(4, &stack) == STACK_ERROR_CODE_SUCCESS);
+    for(uint64_t i = 1; i <= 3; ++i) {
+        assert(test_u64_stack_push(&stack, &i) == STACK_ERROR_CODE_SUCCESS);
+    }
+    assert(test_u64_stack_size(&stack) == 3);
+
+    const uint64_t* top = NULL;
+    assert(test_u64_stack_peek_ptr(&stack, &top) == STACK_ERROR_CODE_SUCCESS);
+    assert(*top == 3);
+    assert(test_u64_stack_size(&stack) == 3);
+
+    uint64_t out = 0;
+    for(uint64_t i = 3; i >= 1; --i) {
+        assert(test_u64_stack_pop(&stack, &out) == STACK_ERROR_CODE_SUCCESS);
+        assert(out == i);
+    }
+    assert(test_u64_stack_empty(&stack));
+
+    assert(test_u64_stack_push(&stack, &out) == STACK_ERROR_CODE_SUCCESS);
+    assert(test_u64_stack_clear(&stack) == STACK_ERROR_CODE_SUCCESS);
+    assert(test_u64_stack_size(&stack) == 0);
+    test_u64_stack_destroy(&stack);
+}
+
+static void test_full_and_empty(void) {
+    test_u64_stack_t stack = TYPED_STACK_INITIALIZER;
+    assert(test_u64_stack_create(2, &stack) == STACK_ERROR_CODE_SUCCESS);
+    uint64_t value = 5;
+    const uint64_t* top = NULL;
+    assert(test_u64_stack_pop(&stack, &value) == STACK_ERROR_STACK_EMPTY);
+    assert(test_u64_stack_peek_ptr(&stack, &top) == STACK_ERROR_STACK_EMPTY);
+    assert(test_u64_stack_push(&stack, &value) == STACK_ERROR_CODE_SUCCESS);
+    assert(test_u64_stack_push(&stack, &value) == STACK_ERROR_CODE_SUCCESS);
+    assert(test_u64_stack_full(&stack));
+    assert(test_u64_stack_push(&stack, &value) == STACK_ERROR_STACK_FULL);
+    assert(test_u64_stack_size(&stack) == 2);
+    test_u64_stack_destroy(&stack);
+}
+
+static void test_resize_preserves_content(void) {
+    test_u64_stack_t stack = TYPED_STACK_INITIALIZER;
+    assert(test_u64_stack_create(2, &stack) == STACK_ERROR_CODE_SUCCESS);
+    for(uint64_t i = 10; i != 12; ++i) {
+        assert(test_u64_stack_push(&stack, &i) == STACK_ERROR_CODE_SUCCESS);
+    }
+    assert(test_u64_stack_resize(2, &stack) == STACK_ERROR_INVALID_ARGUMENT);   // 縮小/同サイズは不可
+    assert(test_u64_stack_resize(8, &stack) == STACK_ERROR_CODE_SUCCESS);
+    assert(stack.max_element_count == 8);
+    for(uint64_t i = 2; i != 8; ++i) {
+        assert(stack.data[i] == 0);
+    }
+    uint64_t value = 12;
+    assert(test_u64_stack_push(&stack, &value) == STACK_ERROR_CODE_SUCCESS);
+    for(uint64_t i = 12; i >= 10; --i) {
+        assert(test_u64_stack_pop(&stack, &value) == STACK_ERROR_CODE_SUCCESS);
+        assert(value == i);
+    }
+    test_u64_stack_destroy(&stack);
+}
+
+static void test_struct_element(void) {
+    test_pad_stack_t stack = TYPED_STACK_INITIALIZER;
+    assert(test_pad_stack_create(4, &stack) == STACK_ERROR_CODE_SUCCESS);
+    const sample_with_pad_t in = { 7, 0xA5A5A5A5u };
+    assert(test_pad_stack_push(&stack, &in) == STACK_ERROR_CODE_SUCCESS);
+    sample_with_pad_t out = { 0 };
+    assert(test_pad_stack_pop(&stack, &out) == STACK_ERROR_CODE_SUCCESS);
+    assert(out.a == 7 && out.b == 0xA5A5A5A5u);
+    test_pad_stack_destroy(&stack);
+}
+
+static void test_null_and_invalid(void) {
+    test_u64_stack_t stack = TYPED_STACK_INITIALIZER;
+    uint64_t value = 0;
+    const uint64_t* top = NULL;
+    // バッファ未確保のスタック
+    assert(test_u64_stack_push(&stack, &value) == STACK_ERROR_INVALID_STACK);
+    assert(test_u64_stack_pop(&stack, &value) == STACK_ERROR_INVALID_STACK);
+    assert(test_u64_stack_peek_ptr(&stack, &top) == STACK_ERROR_INVALID_STACK);
+    assert(test_u64_stack_resize(8, &stack) == STACK_ERROR_INVALID_STACK);
+
+    assert(test_u64_stack_create(4, NULL) == STACK_ERROR_INVALID_ARGUMENT);
+    assert(test_u64_stack_create(4, &stack) == STACK_ERROR_CODE_SUCCESS);
+    assert(test_u64_stack_push(NULL, &value) == STACK_ERROR_INVALID_ARGUMENT);
+    assert(test_u64_stack_push(&stack, NULL) == STACK_ERROR_INVALID_ARGUMENT);
+    assert(test_u64_stack_pop(&stack, NULL) == STACK_ERROR_INVALID_ARGUMENT);
+    assert(test_u64_stack_peek_ptr(&stack, NULL) == STACK_ERROR_INVALID_ARGUMENT);
+    assert(test_u64_stack_resize(8, NULL) == STACK_ERROR_INVALID_ARGUMENT);
+    assert(test_u64_stack_clear(NULL) == STACK_ERROR_INVALID_ARGUMENT);
+    test_u64_stack_destroy(&stack);
+}
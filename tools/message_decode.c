@@ -0,0 +1,28 @@
+/**
+ * @file message_decode.c
+ * @author chocolate-pie24
+ * @brief message_binary_start()で出力したバイナリログファイルをテキストに復元して標準出力に出力するツール
+ *
+ * 使用方法:
+ * @code
+ * ./build.sh tools
+ * ./bin/message_decode app.clog > app.log
+ * @endcode
+ *
+ * @version 0.1
+ * @date 2025-08-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include <stdio.h>
+
+#include "core/message.h"
+
+int main(int argc_, char** argv_) {
+    if(2 != argc_) {
+        fprintf(stderr, "usage: %s <binary log file>\n", (argc_ > 0) ? argv_[0] : "message_decode");
+        return 1;
+    }
+    return (MESSAGE_SUCCESS == message_binary_decode(argv_[1], stdout)) ? 0 : 1;
+}